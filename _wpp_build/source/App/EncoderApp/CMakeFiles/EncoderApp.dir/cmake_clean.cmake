@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/umake/gcc-12.2/x86_64/relwithdebinfo/EncoderApp"
+  "/root/repo/bin/umake/gcc-12.2/x86_64/relwithdebinfo/EncoderApp.pdb"
+  "CMakeFiles/EncoderApp.dir/EncApp.cpp.o"
+  "CMakeFiles/EncoderApp.dir/EncApp.cpp.o.d"
+  "CMakeFiles/EncoderApp.dir/EncAppCfg.cpp.o"
+  "CMakeFiles/EncoderApp.dir/EncAppCfg.cpp.o.d"
+  "CMakeFiles/EncoderApp.dir/encmain.cpp.o"
+  "CMakeFiles/EncoderApp.dir/encmain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EncoderApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
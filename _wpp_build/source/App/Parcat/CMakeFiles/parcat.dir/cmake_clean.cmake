@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/umake/gcc-12.2/x86_64/relwithdebinfo/parcat"
+  "/root/repo/bin/umake/gcc-12.2/x86_64/relwithdebinfo/parcat.pdb"
+  "CMakeFiles/parcat.dir/parcat.cpp.o"
+  "CMakeFiles/parcat.dir/parcat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parcat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/umake/gcc-12.2/x86_64/relwithdebinfo/SEIRemovalApp"
+  "/root/repo/bin/umake/gcc-12.2/x86_64/relwithdebinfo/SEIRemovalApp.pdb"
+  "CMakeFiles/SEIRemovalApp.dir/SEIRemovalApp.cpp.o"
+  "CMakeFiles/SEIRemovalApp.dir/SEIRemovalApp.cpp.o.d"
+  "CMakeFiles/SEIRemovalApp.dir/SEIRemovalAppCfg.cpp.o"
+  "CMakeFiles/SEIRemovalApp.dir/SEIRemovalAppCfg.cpp.o.d"
+  "CMakeFiles/SEIRemovalApp.dir/seiremovalmain.cpp.o"
+  "CMakeFiles/SEIRemovalApp.dir/seiremovalmain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SEIRemovalApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/umake/gcc-12.2/x86_64/relwithdebinfo/StreamMergeApp"
+  "/root/repo/bin/umake/gcc-12.2/x86_64/relwithdebinfo/StreamMergeApp.pdb"
+  "CMakeFiles/StreamMergeApp.dir/StreamMergeApp.cpp.o"
+  "CMakeFiles/StreamMergeApp.dir/StreamMergeApp.cpp.o.d"
+  "CMakeFiles/StreamMergeApp.dir/StreamMergeAppCfg.cpp.o"
+  "CMakeFiles/StreamMergeApp.dir/StreamMergeAppCfg.cpp.o.d"
+  "CMakeFiles/StreamMergeApp.dir/StreamMergeMain.cpp.o"
+  "CMakeFiles/StreamMergeApp.dir/StreamMergeMain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StreamMergeApp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
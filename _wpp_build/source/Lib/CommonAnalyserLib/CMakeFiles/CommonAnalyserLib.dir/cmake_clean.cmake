@@ -0,0 +1,135 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libCommonAnalyserLib.a"
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libCommonAnalyserLib.pdb"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/AdaptiveLoopFilter.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/AdaptiveLoopFilter.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/AffineGradientSearch.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/AffineGradientSearch.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/ApproximatAdderSubtraction.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/ApproximatAdderSubtraction.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/BitStream.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/BitStream.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Buffer.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Buffer.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/CacheModel.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/CacheModel.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/ChromaFormat.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/ChromaFormat.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/CodingStructure.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/CodingStructure.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/ContextModelling.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/ContextModelling.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Contexts.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Contexts.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/CrossCompPrediction.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/CrossCompPrediction.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/DepQuant.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/DepQuant.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/HRD.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/HRD.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Hash.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Hash.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/IbcHashMap.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/IbcHashMap.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/InterPrediction.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/InterPrediction.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/InterpolationFilter.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/InterpolationFilter.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/IntraPrediction.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/IntraPrediction.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/LoopFilter.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/LoopFilter.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/MCTS.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/MCTS.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/MatrixIntraPrediction.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/MatrixIntraPrediction.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Mv.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Mv.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/PicYuvMD5.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/PicYuvMD5.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Picture.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Picture.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Profiler.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Profiler.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Quant.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Quant.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/QuantRDOQ.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/QuantRDOQ.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/RdCost.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/RdCost.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/RdCostWeightPrediction.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/RdCostWeightPrediction.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Reshape.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Reshape.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Rom.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Rom.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/RomLFNST.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/RomLFNST.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/RomTr.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/RomTr.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/SEI.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/SEI.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/SampleAdaptiveOffset.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/SampleAdaptiveOffset.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Slice.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Slice.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/TrQuant.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/TrQuant.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/TrQuant_EMT.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/TrQuant_EMT.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Unit.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/Unit.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/UnitPartitioner.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/UnitPartitioner.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/UnitTools.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/UnitTools.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/WeightPrediction.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/WeightPrediction.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/dtrace.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/dtrace.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/dtrace_blockstatistics.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/dtrace_blockstatistics.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/CommonDefX86.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/CommonDefX86.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/InitX86.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/InitX86.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/AdaptiveLoopFilter_avx.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/AdaptiveLoopFilter_avx.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/AffineGradientSearch_avx.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/AffineGradientSearch_avx.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/Buffer_avx.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/Buffer_avx.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/InterpolationFilter_avx.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/InterpolationFilter_avx.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/RdCost_avx.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx/RdCost_avx.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/AdaptiveLoopFilter_avx2.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/AdaptiveLoopFilter_avx2.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/AffineGradientSearch_avx2.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/AffineGradientSearch_avx2.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/Buffer_avx2.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/Buffer_avx2.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/InterpolationFilter_avx2.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/InterpolationFilter_avx2.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/RdCost_avx2.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/avx2/RdCost_avx2.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/AdaptiveLoopFilter_sse41.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/AdaptiveLoopFilter_sse41.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/AffineGradientSearch_sse41.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/AffineGradientSearch_sse41.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/Buffer_sse41.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/Buffer_sse41.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/InterpolationFilter_sse41.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/InterpolationFilter_sse41.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/RdCost_sse41.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse41/RdCost_sse41.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse42/IbcHashmap_sse42.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/CommonLib/x86/sse42/IbcHashmap_sse42.cpp.o.d"
+  "CMakeFiles/CommonAnalyserLib.dir/__/libmd5/libmd5.cpp.o"
+  "CMakeFiles/CommonAnalyserLib.dir/__/libmd5/libmd5.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonAnalyserLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
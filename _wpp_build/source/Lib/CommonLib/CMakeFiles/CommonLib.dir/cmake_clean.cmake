@@ -0,0 +1,135 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libCommonLib.a"
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libCommonLib.pdb"
+  "CMakeFiles/CommonLib.dir/AdaptiveLoopFilter.cpp.o"
+  "CMakeFiles/CommonLib.dir/AdaptiveLoopFilter.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/AffineGradientSearch.cpp.o"
+  "CMakeFiles/CommonLib.dir/AffineGradientSearch.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/ApproximatAdderSubtraction.cpp.o"
+  "CMakeFiles/CommonLib.dir/ApproximatAdderSubtraction.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/BitStream.cpp.o"
+  "CMakeFiles/CommonLib.dir/BitStream.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Buffer.cpp.o"
+  "CMakeFiles/CommonLib.dir/Buffer.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/CacheModel.cpp.o"
+  "CMakeFiles/CommonLib.dir/CacheModel.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/ChromaFormat.cpp.o"
+  "CMakeFiles/CommonLib.dir/ChromaFormat.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/CodingStructure.cpp.o"
+  "CMakeFiles/CommonLib.dir/CodingStructure.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/ContextModelling.cpp.o"
+  "CMakeFiles/CommonLib.dir/ContextModelling.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Contexts.cpp.o"
+  "CMakeFiles/CommonLib.dir/Contexts.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/CrossCompPrediction.cpp.o"
+  "CMakeFiles/CommonLib.dir/CrossCompPrediction.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/DepQuant.cpp.o"
+  "CMakeFiles/CommonLib.dir/DepQuant.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/HRD.cpp.o"
+  "CMakeFiles/CommonLib.dir/HRD.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Hash.cpp.o"
+  "CMakeFiles/CommonLib.dir/Hash.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/IbcHashMap.cpp.o"
+  "CMakeFiles/CommonLib.dir/IbcHashMap.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/InterPrediction.cpp.o"
+  "CMakeFiles/CommonLib.dir/InterPrediction.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/InterpolationFilter.cpp.o"
+  "CMakeFiles/CommonLib.dir/InterpolationFilter.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/IntraPrediction.cpp.o"
+  "CMakeFiles/CommonLib.dir/IntraPrediction.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/LoopFilter.cpp.o"
+  "CMakeFiles/CommonLib.dir/LoopFilter.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/MCTS.cpp.o"
+  "CMakeFiles/CommonLib.dir/MCTS.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/MatrixIntraPrediction.cpp.o"
+  "CMakeFiles/CommonLib.dir/MatrixIntraPrediction.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Mv.cpp.o"
+  "CMakeFiles/CommonLib.dir/Mv.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/PicYuvMD5.cpp.o"
+  "CMakeFiles/CommonLib.dir/PicYuvMD5.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Picture.cpp.o"
+  "CMakeFiles/CommonLib.dir/Picture.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Profiler.cpp.o"
+  "CMakeFiles/CommonLib.dir/Profiler.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Quant.cpp.o"
+  "CMakeFiles/CommonLib.dir/Quant.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/QuantRDOQ.cpp.o"
+  "CMakeFiles/CommonLib.dir/QuantRDOQ.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/RdCost.cpp.o"
+  "CMakeFiles/CommonLib.dir/RdCost.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/RdCostWeightPrediction.cpp.o"
+  "CMakeFiles/CommonLib.dir/RdCostWeightPrediction.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Reshape.cpp.o"
+  "CMakeFiles/CommonLib.dir/Reshape.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Rom.cpp.o"
+  "CMakeFiles/CommonLib.dir/Rom.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/RomLFNST.cpp.o"
+  "CMakeFiles/CommonLib.dir/RomLFNST.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/RomTr.cpp.o"
+  "CMakeFiles/CommonLib.dir/RomTr.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/SEI.cpp.o"
+  "CMakeFiles/CommonLib.dir/SEI.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/SampleAdaptiveOffset.cpp.o"
+  "CMakeFiles/CommonLib.dir/SampleAdaptiveOffset.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Slice.cpp.o"
+  "CMakeFiles/CommonLib.dir/Slice.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/TrQuant.cpp.o"
+  "CMakeFiles/CommonLib.dir/TrQuant.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/TrQuant_EMT.cpp.o"
+  "CMakeFiles/CommonLib.dir/TrQuant_EMT.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/Unit.cpp.o"
+  "CMakeFiles/CommonLib.dir/Unit.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/UnitPartitioner.cpp.o"
+  "CMakeFiles/CommonLib.dir/UnitPartitioner.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/UnitTools.cpp.o"
+  "CMakeFiles/CommonLib.dir/UnitTools.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/WeightPrediction.cpp.o"
+  "CMakeFiles/CommonLib.dir/WeightPrediction.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/__/libmd5/libmd5.cpp.o"
+  "CMakeFiles/CommonLib.dir/__/libmd5/libmd5.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/dtrace.cpp.o"
+  "CMakeFiles/CommonLib.dir/dtrace.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/dtrace_blockstatistics.cpp.o"
+  "CMakeFiles/CommonLib.dir/dtrace_blockstatistics.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/CommonDefX86.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/CommonDefX86.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/InitX86.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/InitX86.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx/AdaptiveLoopFilter_avx.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx/AdaptiveLoopFilter_avx.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx/AffineGradientSearch_avx.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx/AffineGradientSearch_avx.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx/Buffer_avx.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx/Buffer_avx.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx/InterpolationFilter_avx.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx/InterpolationFilter_avx.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx/RdCost_avx.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx/RdCost_avx.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx2/AdaptiveLoopFilter_avx2.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx2/AdaptiveLoopFilter_avx2.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx2/AffineGradientSearch_avx2.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx2/AffineGradientSearch_avx2.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx2/Buffer_avx2.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx2/Buffer_avx2.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx2/InterpolationFilter_avx2.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx2/InterpolationFilter_avx2.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/avx2/RdCost_avx2.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/avx2/RdCost_avx2.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/sse41/AdaptiveLoopFilter_sse41.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/sse41/AdaptiveLoopFilter_sse41.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/sse41/AffineGradientSearch_sse41.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/sse41/AffineGradientSearch_sse41.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/sse41/Buffer_sse41.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/sse41/Buffer_sse41.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/sse41/InterpolationFilter_sse41.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/sse41/InterpolationFilter_sse41.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/sse41/RdCost_sse41.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/sse41/RdCost_sse41.cpp.o.d"
+  "CMakeFiles/CommonLib.dir/x86/sse42/IbcHashmap_sse42.cpp.o"
+  "CMakeFiles/CommonLib.dir/x86/sse42/IbcHashmap_sse42.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
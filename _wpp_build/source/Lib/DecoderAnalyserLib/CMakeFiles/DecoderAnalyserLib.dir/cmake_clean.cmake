@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libDecoderAnalyserLib.a"
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libDecoderAnalyserLib.pdb"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/AnnexBread.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/AnnexBread.cpp.o.d"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/BinDecoder.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/BinDecoder.cpp.o.d"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/CABACReader.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/CABACReader.cpp.o.d"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/DecCu.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/DecCu.cpp.o.d"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/DecLib.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/DecLib.cpp.o.d"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/DecSlice.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/DecSlice.cpp.o.d"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/NALread.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/NALread.cpp.o.d"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/SEIread.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/SEIread.cpp.o.d"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/VLCReader.cpp.o"
+  "CMakeFiles/DecoderAnalyserLib.dir/__/DecoderLib/VLCReader.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DecoderAnalyserLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libEncoderLib.a"
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libEncoderLib.pdb"
+  "CMakeFiles/EncoderLib.dir/AQp.cpp.o"
+  "CMakeFiles/EncoderLib.dir/AQp.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/BinEncoder.cpp.o"
+  "CMakeFiles/EncoderLib.dir/BinEncoder.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/CABACWriter.cpp.o"
+  "CMakeFiles/EncoderLib.dir/CABACWriter.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncAdaptiveLoopFilter.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncAdaptiveLoopFilter.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncCu.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncCu.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncGOP.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncGOP.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncHRD.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncHRD.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncLib.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncLib.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncModeCtrl.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncModeCtrl.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncReshape.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncReshape.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncSampleAdaptiveOffset.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncSampleAdaptiveOffset.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/EncSlice.cpp.o"
+  "CMakeFiles/EncoderLib.dir/EncSlice.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/InterSearch.cpp.o"
+  "CMakeFiles/EncoderLib.dir/InterSearch.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/IntraSearch.cpp.o"
+  "CMakeFiles/EncoderLib.dir/IntraSearch.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/NALwrite.cpp.o"
+  "CMakeFiles/EncoderLib.dir/NALwrite.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/RateCtrl.cpp.o"
+  "CMakeFiles/EncoderLib.dir/RateCtrl.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/SEIEncoder.cpp.o"
+  "CMakeFiles/EncoderLib.dir/SEIEncoder.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/SEIwrite.cpp.o"
+  "CMakeFiles/EncoderLib.dir/SEIwrite.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/VLCWriter.cpp.o"
+  "CMakeFiles/EncoderLib.dir/VLCWriter.cpp.o.d"
+  "CMakeFiles/EncoderLib.dir/WeightPredAnalysis.cpp.o"
+  "CMakeFiles/EncoderLib.dir/WeightPredAnalysis.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EncoderLib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libUtilities.a"
+  "/root/repo/lib/umake/gcc-12.2/x86_64/relwithdebinfo/libUtilities.pdb"
+  "CMakeFiles/Utilities.dir/ColourRemapping.cpp.o"
+  "CMakeFiles/Utilities.dir/ColourRemapping.cpp.o.d"
+  "CMakeFiles/Utilities.dir/VideoIOYuv.cpp.o"
+  "CMakeFiles/Utilities.dir/VideoIOYuv.cpp.o.d"
+  "CMakeFiles/Utilities.dir/program_options_lite.cpp.o"
+  "CMakeFiles/Utilities.dir/program_options_lite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -45,6 +45,7 @@
 #include "DecoderLib/NALread.h"
 #if RExt__DECODER_DEBUG_STATISTICS
 #include "CommonLib/CodingStatistics.h"
+#include "CommonLib/Profiler.h"
 #endif
 #include "CommonLib/dtrace_codingstruct.h"
 
@@ -78,6 +79,17 @@ uint32_t DecApp::decode()
   int                 poc;
   PicList* pcListPic = NULL;
 
+#if ENABLE_PROFILING
+  if( !m_profileTraceFile.empty() )
+  {
+    Profiler::enableTrace( m_profileTraceMaxEvents );
+  }
+  if( !m_profileKernelsFile.empty() )
+  {
+    Profiler::enableKernelStats();
+  }
+#endif
+
   ifstream bitstreamFile(m_bitstreamFileName.c_str(), ifstream::in | ifstream::binary);
   if (!bitstreamFile)
   {
@@ -274,10 +286,39 @@ uint32_t DecApp::decode()
 #endif
 
   destroyROM();
+#if ENABLE_PROFILING
+  xWriteProfile();
+#endif
 
   return nRet;
 }
 
+#if ENABLE_PROFILING
+void DecApp::xWriteProfile()
+{
+  if( m_profileMinPercent >= 0.0 )
+  {
+    Profiler::printCallTree( stdout, m_profileMinPercent );
+  }
+  if( !m_profileCallTreeFile.empty() && !Profiler::writeCallTree( m_profileCallTreeFile ) )
+  {
+    msg( WARNING, "\nFailed to write the profiling call tree to %s\n", m_profileCallTreeFile.c_str() );
+  }
+  if( !m_profileTraceFile.empty() && !Profiler::writeChromeTrace( m_profileTraceFile ) )
+  {
+    msg( WARNING, "\nFailed to write the profiling trace to %s\n", m_profileTraceFile.c_str() );
+  }
+  if( !m_profileKernelsFile.empty() )
+  {
+    Profiler::printKernelStats( stdout, std::max( m_profileMinPercent, 0.0 ) );
+    if( m_profileKernelsFile != "-" && !Profiler::writeKernelStatsCsv( m_profileKernelsFile ) )
+    {
+      msg( WARNING, "\nFailed to write the kernel statistics to %s\n", m_profileKernelsFile.c_str() );
+    }
+  }
+}
+#endif
+
 // ====================================================================================================================
 // Protected member functions
 // ====================================================================================================================
@@ -288,6 +329,8 @@ void DecApp::xCreateDecLib()
 
   // create decoder class
   m_cDecLib.create();
+  m_cDecLib.setApproxProfile( m_approxAdder, m_approxWidth, m_approxBits, m_approxSites );
+  m_cDecLib.setNumThreads( m_numThreads );
 
   // initialize decoder class
   m_cDecLib.init(
@@ -42,6 +42,7 @@
 #include "Utilities/program_options_lite.h"
 #include "CommonLib/ChromaFormat.h"
 #include "CommonLib/dtrace_next.h"
+#include "CommonLib/ApproximatAdderSubtraction.h"
 
 using namespace std;
 namespace po = df::program_options_lite;
@@ -61,6 +62,8 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
   bool do_help = false;
   string cfg_TargetDecLayerIdSetFile;
   string outputColourSpaceConvert;
+  string approxAdderName;
+  string approxSitesName;
   int warnUnknowParameter = 0;
 #if ENABLE_TRACING
   string sTracingRule;
@@ -115,6 +118,18 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
 #endif
   ("MCTSCheck",                m_mctsCheck,                           false,       "If enabled, the decoder checks for violations of mc_exact_sample_value_match_flag in Temporal MCTS ")
   ( "UpscaledOutput",          m_upscaledOutput,                          0,       "Upscaled output for RPR" )
+  ("NumThreads",                m_numThreads,                         1,           "Number of threads of the slice decoder, the CTU rows are reconstructed in parallel to the parsing when greater than 1")
+  ("ApproxAdder",               approxAdderName,                      string( "Exact" ), "Approximate adder of the arithmetic profile, has to match the encoder: Exact, LOA, Type1 .. Type5, M45P35A7, M45P30A6, M60P25A6, M95P10A5")
+  ("ApproxWidth",               m_approxWidth,                        8,           "Word width of the LOA adder")
+  ("ApproxBits",                m_approxBits,                         7,           "Number of approximated (ORed) lower bits of the LOA adder")
+  ("ApproxSites",               approxSitesName,                      string( "MC,GBI" ), "Comma separated list of the places using the approximate adder: MC, GBI (ME is ignored by the decoder)")
+#if ENABLE_PROFILING
+  ("ProfileCallTree",           m_profileCallTreeFile,                string( "" ), "Call tree of the profiling zones, written as JSON for a .json file and as CSV otherwise. If empty, do not produce a file")
+  ("ProfileTrace",              m_profileTraceFile,                   string( "" ), "Chrome trace (chrome://tracing) of the profiling zones. If empty, no events are recorded")
+  ("ProfileTraceMaxEvents",     m_profileTraceMaxEvents,              1000000,     "Maximum number of trace events recorded per thread")
+  ("ProfileMinPercent",         m_profileMinPercent,                  -1.0,        "Profiling zones below this share of the total time are not printed, negative disables the print")
+  ("ProfileKernels",            m_profileKernelsFile,                 string( "" ), "Calls and cycles of the distortion, interpolation, PelBufferOps and transform kernels per block size, written as CSV. '-' only prints them. If empty, nothing is recorded")
+#endif
   ;
 
   po::setDefaults(opts);
@@ -152,6 +167,36 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
 #endif
 
   g_mctsDecCheckEnabled = m_mctsCheck;
+
+  if( m_numThreads < 1 )
+  {
+    msg( ERROR, "NumThreads must be at least 1\n" );
+    return false;
+  }
+#if ENABLE_TRACING
+  if( m_numThreads > 1 && g_trace_ctx )
+  {
+    msg( ERROR, "Tracing requires NumThreads=1\n" );
+    return false;
+  }
+#endif
+
+  if( !parseApproxAdder( approxAdderName, m_approxAdder ) )
+  {
+    msg( ERROR, "Unknown ApproxAdder %s\n", approxAdderName.c_str() );
+    return false;
+  }
+  if( !parseApproxSites( approxSitesName, m_approxSites ) )
+  {
+    msg( ERROR, "Unknown site in ApproxSites %s\n", approxSitesName.c_str() );
+    return false;
+  }
+  if( m_approxWidth < 1 || m_approxWidth > 30 || m_approxBits < 0 || m_approxBits > 30 )
+  {
+    msg( ERROR, "ApproxWidth/ApproxBits exceed range (1/0 to 30)\n" );
+    return false;
+  }
+
   // Chroma output bit-depth
   if( m_outputBitDepth[CHANNEL_TYPE_LUMA] != 0 && m_outputBitDepth[CHANNEL_TYPE_CHROMA] == 0 )
   {
@@ -236,6 +281,15 @@ DecAppCfg::DecAppCfg()
 , m_packedYUVMode(false)
 , m_statMode(0)
 , m_mctsCheck(false)
+, m_numThreads(1)
+, m_approxAdder(APPROX_ADDER_EXACT)
+, m_approxWidth(8)
+, m_approxBits(7)
+, m_approxSites(0)
+#if ENABLE_PROFILING
+, m_profileTraceMaxEvents(0)
+, m_profileMinPercent(-1.0)
+#endif
 {
   for (uint32_t channelTypeIndex = 0; channelTypeIndex < MAX_NUM_CHANNEL_TYPE; channelTypeIndex++)
   {
@@ -75,9 +75,23 @@ protected:
   std::string   m_cacheCfgFile;                       ///< Config file of cache model
   int           m_statMode;                           ///< Config statistic mode (0 - bit stat, 1 - tool stat, 3 - both)
   bool          m_mctsCheck;
+  int           m_numThreads;                         ///< threads of the slice decoder
 
   int          m_upscaledOutput;                     ////< Output upscaled (2), decoded but in full resolution buffer (1) or decoded cropped (0, default) picture for RPR.
 
+  ApproxAdderType m_approxAdder;                     ///< approximate adder of the arithmetic profile
+  int           m_approxWidth;                        ///< word width of the lower-part OR adder
+  int           m_approxBits;                         ///< number of approximated bits of the lower-part OR adder
+  uint32_t      m_approxSites;                        ///< bit mask of ApproxSite using the approximate adder
+
+#if ENABLE_PROFILING
+  std::string   m_profileCallTreeFile;                ///< call tree output of the profiling zones (.json or CSV), empty = none
+  std::string   m_profileTraceFile;                   ///< Chrome trace output of the profiling zones, empty = none
+  int           m_profileTraceMaxEvents;              ///< maximum number of trace events recorded per thread
+  double        m_profileMinPercent;                  ///< call tree nodes below this share of the total are not printed, negative = no print
+  std::string   m_profileKernelsFile;                 ///< block size histogram of the PROFILE_KERNEL sites, empty = not recorded
+#endif
+
 public:
   DecAppCfg();
   virtual ~DecAppCfg();
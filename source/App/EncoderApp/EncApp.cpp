@@ -44,21 +44,15 @@
 
 #include "EncApp.h"
 #include "EncoderLib/AnnexBwrite.h"
+#include "CommonLib/Profiler.h"
 #if EXTENSION_360_VIDEO
 #include "AppEncHelper360/TExt360AppEncTop.h"
 #endif
 
 #include <chrono>
 
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
 using namespace std;
 
-long long int timeOfXInitLibCfg = 0;
-
 //! \ingroup EncoderApp
 //! \{
 
@@ -82,7 +76,7 @@ EncApp::~EncApp()
 
 void EncApp::xInitLibCfg()
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "EncApp::xInitLibCfg" );
   VPS vps;
 
   vps.setMaxLayers                                               ( 1 );
@@ -125,6 +119,10 @@ void EncApp::xInitLibCfg()
   m_cEncLib.setRPREnabled                                        ( m_rprEnabled );
   m_cEncLib.setSwitchPocPeriod                                   ( m_switchPocPeriod );
   m_cEncLib.setUpscaledOutput                                    ( m_upscaledOutput );
+  m_cEncLib.setApproxAdder                                       ( m_approxAdder );
+  m_cEncLib.setApproxWidth                                       ( m_approxWidth );
+  m_cEncLib.setApproxBits                                        ( m_approxBits );
+  m_cEncLib.setApproxSites                                       ( m_approxSites );
   m_cEncLib.setFramesToBeEncoded                                 ( m_framesToBeEncoded );
 
   //====== SPS constraint flags =======
@@ -616,11 +614,13 @@ void EncApp::xInitLibCfg()
 #if ENABLE_SPLIT_PARALLELISM
   m_cEncLib.setNumSplitThreads                                   ( m_numSplitThreads );
   m_cEncLib.setForceSingleSplitThread                            ( m_forceSplitSequential );
+  m_cEncLib.setSplitParallelCuSize                               ( m_splitParallelCuSize );
 #endif
 #if ENABLE_WPP_PARALLELISM
   m_cEncLib.setNumWppThreads                                     ( m_numWppThreads );
   m_cEncLib.setNumWppExtraLines                                  ( m_numWppExtraLines );
   m_cEncLib.setEnsureWppBitEqual                                 ( m_ensureWppBitEqual );
+  m_cEncLib.setNumFrameThreads                                   ( m_numFrameThreads );
 
 #endif
   m_cEncLib.setUseALF                                            ( m_alf );
@@ -649,11 +649,6 @@ void EncApp::xInitLibCfg()
   m_cEncLib.setCropOffsetBottom                                  (m_cropOffsetBottom);
   m_cEncLib.setCalculateHdrMetrics                               (m_calculateHdrMetrics);
 #endif
-
-  
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfXInitLibCfg        = timeOfXInitLibCfg + duration.count();
 }
 
 void EncApp::xCreateLib( std::list<PelUnitBuf*>& recBufList
@@ -721,6 +716,16 @@ void EncApp::xInitLib(bool isFieldCoding)
  */
 void EncApp::encode()
 {
+#if ENABLE_PROFILING
+  if( !m_profileTraceFile.empty() )
+  {
+    Profiler::enableTrace( m_profileTraceMaxEvents );
+  }
+  if( !m_profileKernelsFile.empty() )
+  {
+    Profiler::enableKernelStats();
+  }
+#endif
   m_bitstream.open(m_bitstreamFileName.c_str(), fstream::binary | fstream::out);
   if (!m_bitstream)
   {
@@ -837,10 +842,39 @@ void EncApp::encode()
   m_bitstream.close();
 
   printRateSummary();
+#if ENABLE_PROFILING
+  xWriteProfile();
+#endif
 
   return;
 }
 
+#if ENABLE_PROFILING
+void EncApp::xWriteProfile()
+{
+  if( m_profileMinPercent >= 0.0 )
+  {
+    Profiler::printCallTree( stdout, m_profileMinPercent );
+  }
+  if( !m_profileCallTreeFile.empty() && !Profiler::writeCallTree( m_profileCallTreeFile ) )
+  {
+    msg( WARNING, "\nFailed to write the profiling call tree to %s\n", m_profileCallTreeFile.c_str() );
+  }
+  if( !m_profileTraceFile.empty() && !Profiler::writeChromeTrace( m_profileTraceFile ) )
+  {
+    msg( WARNING, "\nFailed to write the profiling trace to %s\n", m_profileTraceFile.c_str() );
+  }
+  if( !m_profileKernelsFile.empty() )
+  {
+    Profiler::printKernelStats( stdout, std::max( m_profileMinPercent, 0.0 ) );
+    if( m_profileKernelsFile != "-" && !Profiler::writeKernelStatsCsv( m_profileKernelsFile ) )
+    {
+      msg( WARNING, "\nFailed to write the kernel statistics to %s\n", m_profileKernelsFile.c_str() );
+    }
+  }
+}
+#endif
+
 // ====================================================================================================================
 // Protected member functions
 // ====================================================================================================================
@@ -50,9 +50,6 @@
 #include <chrono>
 #endif
 
-
-extern long long int timeOfXInitLibCfg;
-
 //! \ingroup EncoderApp
 //! \{
 
@@ -90,6 +87,9 @@ private:
   void rateStatsAccum   ( const AccessUnit& au, const std::vector<uint32_t>& stats);
   void printRateSummary ();
   void printChromaFormat();
+#if ENABLE_PROFILING
+  void xWriteProfile    ();                      ///< print and write the profiling zones
+#endif
 
 public:
   EncApp();
@@ -46,6 +46,7 @@
 
 #include "Utilities/program_options_lite.h"
 #include "CommonLib/Rom.h"
+#include "CommonLib/ApproximatAdderSubtraction.h"
 #include "EncoderLib/RateCtrl.h"
 
 #include "CommonLib/dtrace_next.h"
@@ -705,6 +706,8 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   int tmpDecodedPictureHashSEIMappedType;
   string inputColourSpaceConvert;
   string inputPathPrefix;
+  string approxAdderName;
+  string approxSitesName;
   ExtendedProfileName extendedProfile;
   int saoOffsetBitShift[MAX_NUM_CHANNEL_TYPE];
 
@@ -1358,8 +1361,10 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("DecodeBitstream2ModPOCAndType",                   m_bs2ModPOCAndType,                       false, "Modify POC and NALU-type of second input bitstream, to use second BS as closing I-slice")
   ("NumSplitThreads",                                 m_numSplitThreads,                            1, "Number of threads used to parallelize splitting")
   ("ForceSingleSplitThread",                          m_forceSplitSequential,                   false, "Force single thread execution even if taking the parallelized path")
+  ("SplitParallelCuSize",                             m_splitParallelCuSize,                       64, "Size of the CUs at which the split candidates are searched as parallel jobs")
   ("NumWppThreads",                                   m_numWppThreads,                              1, "Number of threads used to run WPP-style parallelization")
   ("NumWppExtraLines",                                m_numWppExtraLines,                           0, "Number of additional wpp lines to switch when threads are blocked")
+  ("NumFrameThreads",                                 m_numFrameThreads,                            1, "Number of threads used to encode the independent pictures of a GOP in parallel")
   ("DebugCTU",                                        m_debugCTU,                                  -1, "If DebugBitstream is present, load frames up to this POC from this bitstream. Starting with DebugPOC-frame at CTUline containin debug CTU.")
 #if ENABLE_WPP_PARALLELISM
   ("EnsureWppBitEqual",                               m_ensureWppBitEqual,                       true, "Ensure the results are equal to results with WPP-style parallelism, even if WPP is off")
@@ -1372,6 +1377,17 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ( "FractionNumFrames",                              m_fractionOfFrames,                         1.0, "Encode a fraction of the specified in FramesToBeEncoded frames" )
   ( "SwitchPocPeriod",                                m_switchPocPeriod,                            0, "Switch POC period for RPR" )
   ( "UpscaledOutput",                                 m_upscaledOutput,                             0, "Output upscaled (2), decoded but in full resolution buffer (1) or decoded cropped (0, default) picture for RPR" )
+  ( "ApproxAdder",                                    approxAdderName,                  string( "Exact" ), "Approximate adder of the arithmetic profile: Exact, LOA, Type1 .. Type5, M45P35A7, M45P30A6, M60P25A6, M95P10A5" )
+  ( "ApproxWidth",                                    m_approxWidth,                                8, "Word width of the LOA adder" )
+  ( "ApproxBits",                                     m_approxBits,                                 7, "Number of approximated (ORed) lower bits of the LOA adder" )
+  ( "ApproxSites",                                    approxSitesName,                 string( "MC,GBI" ), "Comma separated list of the places using the approximate adder: MC, GBI, ME. The decoder has to use the same MC and GBI sites" )
+#if ENABLE_PROFILING
+  ( "ProfileCallTree",                                m_profileCallTreeFile,         string( "Result.csv" ), "Call tree of the profiling zones, written as JSON for a .json file and as CSV otherwise. If empty, do not produce a file" )
+  ( "ProfileTrace",                                   m_profileTraceFile,                        string(), "Chrome trace (chrome://tracing) of the profiling zones. If empty, no events are recorded" )
+  ( "ProfileTraceMaxEvents",                          m_profileTraceMaxEvents,                  1000000, "Maximum number of trace events recorded per thread" )
+  ( "ProfileMinPercent",                              m_profileMinPercent,                          0.1, "Profiling zones below this share of the total time are not printed" )
+  ( "ProfileKernels",                                 m_profileKernelsFile,                      string(), "Calls and cycles of the distortion, interpolation, PelBufferOps and transform kernels per block size, written as CSV. '-' only prints them. If empty, nothing is recorded" )
+#endif
     ;
 
 #if EXTENSION_360_VIDEO
@@ -1509,6 +1525,15 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
 
   g_verbosity = MsgLevel( m_verbosity );
 
+  if( !parseApproxAdder( approxAdderName, m_approxAdder ) )
+  {
+    EXIT( "Error: unknown ApproxAdder " << approxAdderName );
+  }
+  if( !parseApproxSites( approxSitesName, m_approxSites ) )
+  {
+    EXIT( "Error: unknown site in ApproxSites " << approxSitesName );
+  }
+
 
   /*
    * Set any derived parameters
@@ -2409,6 +2434,7 @@ bool EncAppCfg::xCheckParameter()
 #if ENABLE_SPLIT_PARALLELISM
   xConfirmPara( m_numSplitThreads < 1, "Number of used threads cannot be smaller than 1" );
   xConfirmPara( m_numSplitThreads > PARL_SPLIT_MAX_NUM_THREADS, "Number of used threads cannot be higher than the number of actual jobs" );
+  xConfirmPara( m_numSplitThreads > 1 && ( m_splitParallelCuSize < 16 || m_splitParallelCuSize > m_uiCTUSize || ( m_splitParallelCuSize & ( m_splitParallelCuSize - 1 ) ) != 0 ), "SplitParallelCuSize must be a power of 2 between 16 and the CTU size" );
 #if _MSC_VER && ENABLE_WPP_PARALLELISM
   xConfirmPara( m_numSplitThreads > 1 && m_numSplitThreads != NUM_SPLIT_THREADS_IF_MSVC, "Due to poor implementation by Microsoft, NumSplitThreads cannot be set dynamically on runtime!" );
 #endif
@@ -2420,13 +2446,32 @@ bool EncAppCfg::xCheckParameter()
   xConfirmPara( m_numWppThreads < 1, "Number of threads used for WPP-style parallelization cannot be smaller than 1" );
   xConfirmPara( m_numWppThreads > PARL_WPP_MAX_NUM_THREADS, "Number of threads used for WPP-style parallelization cannot be bigger than PARL_WPP_MAX_NUM_THREADS" );
   xConfirmPara( !m_ensureWppBitEqual && m_numWppThreads > 1, "WPP bit equality is implied when using WPP-style parallelism" );
+  xConfirmPara( m_numWppThreads > 1 && m_sliceMode != NO_SLICES, "WPP-style parallelization is only supported with one slice per picture" );
+  xConfirmPara( m_numWppThreads > 1 && ( m_numTileColumnsMinus1 > 0 || m_numTileRowsMinus1 > 0 ), "WPP-style parallelization is only supported with one tile per picture" );
+  xConfirmPara( m_numWppThreads > 1 && m_RCEnableRateControl, "WPP-style parallelization is not supported with rate control" );
 #if ENABLE_WPP_STATIC_LINK
   xConfirmPara( m_numWppExtraLines != 0, "WPP-style extra lines out of range" );
 #else
   xConfirmPara( m_numWppExtraLines < 0, "WPP-style extra lines out of range" );
 #endif
+  xConfirmPara( m_numFrameThreads < 1, "Number of frame threads cannot be smaller than 1" );
+  xConfirmPara( m_numFrameThreads > PARL_WPP_MAX_NUM_THREADS, "Number of frame threads cannot be bigger than PARL_WPP_MAX_NUM_THREADS" );
+  if( m_numFrameThreads > 1 )
+  {
+    xConfirmPara( m_numWppThreads > 1 || m_numWppExtraLines > 0, "Frame-parallel encoding cannot be combined with WPP-style parallelization" );
+    xConfirmPara( m_numSplitThreads > 1, "Frame-parallel encoding cannot be combined with the parallel split search" );
+    xConfirmPara( m_RCEnableRateControl, "Frame-parallel encoding is not supported with rate control" );
+    xConfirmPara( m_compositeRefEnabled, "Frame-parallel encoding is not supported with the composite reference" );
+    xConfirmPara( m_isField, "Frame-parallel encoding is not supported with field coding" );
+    xConfirmPara( m_rprEnabled, "Frame-parallel encoding is not supported with reference picture resampling" );
+    xConfirmPara( m_encDbOpt, "Frame-parallel encoding is not supported with EncDbOpt" );
+    xConfirmPara( m_HashME, "Frame-parallel encoding is not supported with the hash motion estimation" );
+    xConfirmPara( m_lumaReshapeEnable && ( m_updateCtrl == 2 || m_reshapeSignalType == RESHAPE_SIGNAL_PQ ), "Frame-parallel encoding is not supported with LMCSUpdateCtrl 2 or the PQ LMCS signal type" );
+    xConfirmPara( !m_decodeBitstreams[0].empty() || !m_decodeBitstreams[1].empty() || m_fastForwardToPOC >= 0, "Frame-parallel encoding is not supported when pictures are decoded or skipped" );
+  }
 #else
   xConfirmPara( m_numWppThreads != 1, "ENABLE_WPP_PARALLELISM is disabled, numWppThreads has to be 1" );
+  xConfirmPara( m_numFrameThreads != 1, "ENABLE_WPP_PARALLELISM is disabled, NumFrameThreads has to be 1" );
   xConfirmPara( m_ensureWppBitEqual, "ENABLE_WPP_PARALLELISM is disabled, cannot ensure being WPP bit-equal" );
 #endif
 
@@ -3368,6 +3413,8 @@ bool EncAppCfg::xCheckParameter()
   xConfirmPara( m_decodeBitstreams[0] == m_bitstreamFileName, "Debug bitstream and the output bitstream cannot be equal.\n" );
   xConfirmPara( m_decodeBitstreams[1] == m_bitstreamFileName, "Decode2 bitstream and the output bitstream cannot be equal.\n" );
   xConfirmPara(unsigned(m_LMChroma) > 1, "LMMode exceeds range (0 to 1)");
+  xConfirmPara( m_approxWidth < 1 || m_approxWidth > 30, "ApproxWidth exceeds range (1 to 30)" );
+  xConfirmPara( m_approxBits < 0 || m_approxBits > 30, "ApproxBits exceeds range (0 to 30)" );
 #if EXTENSION_360_VIDEO
   check_failed |= m_ext360.verifyParameters();
 #endif
@@ -3678,9 +3725,16 @@ void EncAppCfg::xPrintParameter()
   if( m_numSplitThreads > 1 )
   {
     msg( VERBOSE, "ForceSingleSplitThread:%d ", m_forceSplitSequential );
+    msg( VERBOSE, "SplitParallelCuSize:%d ", m_splitParallelCuSize );
   }
   msg( VERBOSE, "NumWppThreads:%d+%d ", m_numWppThreads, m_numWppExtraLines );
   msg( VERBOSE, "EnsureWppBitEqual:%d ", m_ensureWppBitEqual );
+  msg( VERBOSE, "NumFrameThreads:%d ", m_numFrameThreads );
+
+  if( m_approxAdder != APPROX_ADDER_EXACT )
+  {
+    msg( VERBOSE, "ApproxAdder:%s(%d,%d)|%s ", getApproxAdderName( m_approxAdder ), m_approxWidth, m_approxBits, getApproxSitesName( m_approxSites ).c_str() );
+  }
 
   if( m_rprEnabled )
   {
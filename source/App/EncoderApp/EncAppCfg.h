@@ -339,9 +339,11 @@ protected:
 
   int       m_numSplitThreads;
   bool      m_forceSplitSequential;
+  int       m_splitParallelCuSize;
   int       m_numWppThreads;
   int       m_numWppExtraLines;
   bool      m_ensureWppBitEqual;
+  int       m_numFrameThreads;
 
   int       m_log2MaxTbSize;
   // coding tools (bit-depth)
@@ -605,6 +607,19 @@ protected:
   int         m_switchPocPeriod;
   int         m_upscaledOutput;                               ////< Output upscaled (2), decoded cropped but in full resolution buffer (1) or decoded cropped (0, default) picture for RPR.
 
+  ApproxAdderType m_approxAdder;                              ///< approximate adder of the arithmetic profile
+  int         m_approxWidth;                                  ///< word width of the lower-part OR adder
+  int         m_approxBits;                                   ///< number of approximated bits of the lower-part OR adder
+  uint32_t    m_approxSites;                                  ///< bit mask of ApproxSite using the approximate adder
+
+#if ENABLE_PROFILING
+  std::string m_profileCallTreeFile;                          ///< call tree output of the profiling zones (.json or CSV), empty = none
+  std::string m_profileTraceFile;                             ///< Chrome trace output of the profiling zones, empty = none
+  int         m_profileTraceMaxEvents;                        ///< maximum number of trace events recorded per thread
+  double      m_profileMinPercent;                            ///< call tree nodes below this share of the total are not printed
+  std::string m_profileKernelsFile;                           ///< block size histogram of the PROFILE_KERNEL sites, empty = not recorded
+#endif
+
 #if EXTENSION_360_VIDEO
   TExt360AppEncCfg m_ext360;
   friend class TExt360AppEncCfg;
@@ -85,6 +85,12 @@ public:
   void reconstructCoeffAPSs(CodingStructure& cs, bool luma, bool chroma, bool isRdo);
   void reconstructCoeff(AlfParam& alfParam, ChannelType channel, const bool isRdo, const bool isRedo = false);
   void ALFProcess(CodingStructure& cs);
+  // ALFProcess split into CTU rows: ALFProcessStart() once per picture, returns false when ALF is off,
+  // then every CTU row is filtered with ALFProcessCtuRow() after it and the rows next to it were passed
+  // to ALFProcessCopyCtuRow()
+  bool ALFProcessStart( CodingStructure& cs );
+  void ALFProcessCopyCtuRow( CodingStructure& cs, const int ctuRow );
+  void ALFProcessCtuRow( CodingStructure& cs, const int ctuRow );
   void create( const int picWidth, const int picHeight, const ChromaFormat format, const int maxCUWidth, const int maxCUHeight, const int maxCUDepth, const int inputBitDepth[MAX_NUM_CHANNEL_TYPE] );
   void destroy();
 #if JVET_O0625_ALF_PADDING
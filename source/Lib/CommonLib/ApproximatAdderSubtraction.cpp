@@ -4,19 +4,9 @@
 #include<algorithm>
 #include <string>
 #include <cmath>
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
 
 using namespace std;
 
-long long int accurateTime    = 0;
-long long int approximateTime = 0;
-
-
 int charToInt(char c)
 {
   return c - '0';
@@ -154,16 +144,11 @@ binaryOutput accurate_binary_adder(string binaryOne, string binaryTwo, bool cOut
 
   for (int index = static_cast<int>(binaryOne.length()) - 1; index >= 0; index--)
   {
-    //auto start = high_resolution_clock::now();
     halfResult        = full_adder(charToInt(binaryOne[index]), charToInt(binaryTwo[index]), halfResult.carry);
     finalResult.carry = to_string(halfResult.carry) + finalResult.carry;
     finalResult.sum   = to_string(halfResult.sum) + finalResult.sum;
     if (index == 0 && cOut == true)
       finalResult.sum = to_string(halfResult.carry) + finalResult.sum;
-
-    //auto stop     = high_resolution_clock::now();
-    //auto duration = duration_cast<nanoseconds>(stop - start);
-    //accurateTime  = accurateTime + duration.count();
   }
   return finalResult;
 }
@@ -177,28 +162,19 @@ binaryOutput approximate_binary_adder(string binaryOne, string binaryTwo, bool c
 
   for (int index = length - 1; length - approximateCount <= index; index--)
   {
-    //auto start = high_resolution_clock::now();
     finalResult.carry = "X" + finalResult.carry;
     finalResult.sum   = to_string(OR(charToInt(binaryOne[index]), charToInt(binaryTwo[index]))) + finalResult.sum;
-    //auto stop         = high_resolution_clock::now();
-    //auto duration     = duration_cast<nanoseconds>(stop - start);
-    //approximateTime   = approximateTime + duration.count();
   }
   if (length > approximateCount) {
     adderOutput halfResult = { 0, AND(charToInt(binaryOne[length - approximateCount]),
                                       charToInt(binaryTwo[length - approximateCount])) };
     for (int index = length - approximateCount - 1; index >= 0; index--)
     {
-      //auto start        = high_resolution_clock::now();
       halfResult        = full_adder(charToInt(binaryOne[index]), charToInt(binaryTwo[index]), halfResult.carry);
       finalResult.carry = to_string(halfResult.carry) + finalResult.carry;
       finalResult.sum   = to_string(halfResult.sum) + finalResult.sum;
       if (index == 0 && cOut == true)
         finalResult.sum = to_string(halfResult.carry) + finalResult.sum;
-
-      //auto stop       = high_resolution_clock::now();
-      //auto duration   = duration_cast<nanoseconds>(stop - start);
-      //approximateTime = approximateTime + duration.count();
     }
   }
   return finalResult;
@@ -230,7 +206,7 @@ binaryOutput approximate_binary_subtraction(string binaryOne, string binaryTwo,
   return approximate_binary_adder(binaryOne, complement(binaryTwo, '2', approximateCount), false, approximateCount);
 }
 
-int calculateSum(int numOne, int numTwo,int numberBits, int approximateCount)
+int calculateSumReference(int numOne, int numTwo,int numberBits, int approximateCount)
 {
   string       operation = "add";
   int          sign      = 1;
@@ -296,7 +272,7 @@ string approximate_binary_subtraction_8bit_type1(string binaryOne, string binary
   return approximate_binary_adder_8bit_type1(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumType1(int numOne, int numTwo)
+int approximate8BitSumType1Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -354,7 +330,7 @@ string approximate_binary_subtraction_8bit_type2(string binaryOne, string binary
   return approximate_binary_adder_8bit_type2(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumType2(int numOne, int numTwo)
+int approximate8BitSumType2Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -412,7 +388,7 @@ string approximate_binary_subtraction_8bit_type3(string binaryOne, string binary
   return approximate_binary_adder_8bit_type3(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumType3(int numOne, int numTwo)
+int approximate8BitSumType3Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -471,7 +447,7 @@ string approximate_binary_subtraction_8bit_type4(string binaryOne, string binary
   return approximate_binary_adder_8bit_type4(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumType4(int numOne, int numTwo)
+int approximate8BitSumType4Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -532,7 +508,7 @@ string approximate_binary_subtraction_8bit_type5(string binaryOne, string binary
   return approximate_binary_adder_8bit_type5(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumType5(int numOne, int numTwo)
+int approximate8BitSumType5Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -590,7 +566,7 @@ string approximate_binary_subtraction_8bit_M45_P35_A7(string binaryOne, string b
   return approximate_binary_adder_8bit_M45_P35_A7(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumM45P35A7(int numOne, int numTwo)
+int approximate8BitSumM45P35A7Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -646,7 +622,7 @@ string approximate_binary_subtraction_8bit_M45_P30_A6(string binaryOne, string b
   return approximate_binary_adder_8bit_M45_P30_A6(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumM45P30A6(int numOne, int numTwo)
+int approximate8BitSumM45P30A6Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -705,7 +681,7 @@ string approximate_binary_subtraction_8bit_M60_P25_A6(string binaryOne, string b
   return approximate_binary_adder_8bit_M60_P25_A6(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumM60P25A6(int numOne, int numTwo)
+int approximate8BitSumM60P25A6Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -767,7 +743,7 @@ string approximate_binary_subtraction_8bit_M95_P10_A5(string binaryOne, string b
   return approximate_binary_adder_8bit_M95_P10_A5(binaryOne, complement(binaryTwo, '2', 0), false);
 }
 
-int approximate8BitSumM95P10A5(int numOne, int numTwo)
+int approximate8BitSumM95P10A5Reference(int numOne, int numTwo)
 {
   string       operation = "add";
   int          sign = 1;
@@ -795,4 +771,172 @@ int approximate8BitSumM95P10A5(int numOne, int numTwo)
   }
 
   return sign * binaryToDecimal(result);
-}
\ No newline at end of file
+}
+
+
+//// Integer engine /////////////////////////////////////////////////////
+
+uint16_t g_approx8BitAddTable[NUM_APPROX_ADDERS_8BIT][256][256];
+uint8_t  g_approx8BitSubTable[NUM_APPROX_ADDERS_8BIT][256][256];
+
+ApproxAdderParam g_approxAdderParam = { 8, 7 };
+ApproxProfile    g_approxProfile    = { APPROX_ADDER_EXACT, 0 };
+
+typedef int (*ApproximateAdder8BitFunc)(int, int);
+
+static const ApproximateAdder8BitFunc s_approximateAdders8Bit[NUM_APPROX_ADDERS_8BIT] =
+{
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_TYPE1>,
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_TYPE2>,
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_TYPE3>,
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_TYPE4>,
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_TYPE5>,
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_M45_P35_A7>,
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_M45_P30_A6>,
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_M60_P25_A6>,
+  approximateAdder8BitGates<ApproxScalarOps, APPROX_ADDER_8BIT_M95_P10_A5>,
+};
+
+static const ApproximateAdder8BitFunc s_approximateAdders8BitReference[NUM_APPROX_ADDERS_8BIT] =
+{
+  approximate8BitSumType1Reference,
+  approximate8BitSumType2Reference,
+  approximate8BitSumType3Reference,
+  approximate8BitSumType4Reference,
+  approximate8BitSumType5Reference,
+  approximate8BitSumM45P35A7Reference,
+  approximate8BitSumM45P30A6Reference,
+  approximate8BitSumM60P25A6Reference,
+  approximate8BitSumM95P10A5Reference,
+};
+
+void initApproximateAdders()
+{
+  for (int type = 0; type < NUM_APPROX_ADDERS_8BIT; type++)
+  {
+    for (int a = 0; a < 256; a++)
+    {
+      for (int b = 0; b < 256; b++)
+      {
+        g_approx8BitAddTable[type][a][b] = uint16_t(s_approximateAdders8Bit[type](a, b));
+        // subtraction adds the (exact) two's complement of the smaller magnitude without carry out
+        g_approx8BitSubTable[type][a][b] = uint8_t(s_approximateAdders8Bit[type](a, (256 - b) & 0xff));
+      }
+    }
+  }
+}
+
+bool checkApproximateAdders()
+{
+  bool ok = true;
+
+  for (int numOne = -255; numOne <= 255; numOne++)
+  {
+    for (int numTwo = -255; numTwo <= 255; numTwo++)
+    {
+      for (int type = 0; type < NUM_APPROX_ADDERS_8BIT; type++)
+      {
+        const int ref = s_approximateAdders8BitReference[type](numOne, numTwo);
+        const int res = approximate8BitSum(ApproxAdder8Bit(type), numOne, numTwo);
+        if (ref != res)
+        {
+          cout << "approximate 8 bit adder " << type << " mismatch: " << numOne << " + " << numTwo << " = " << res
+               << " (expected " << ref << ")" << endl;
+          ok = false;
+        }
+      }
+      for (int approximateCount = 0; approximateCount <= 9; approximateCount++)
+      {
+        const int ref = calculateSumReference(numOne, numTwo, 8, approximateCount);
+        const int res = calculateSum(numOne, numTwo, 8, approximateCount);
+        if (ref != res)
+        {
+          cout << "approximate adder (8," << approximateCount << ") mismatch: " << numOne << " + " << numTwo << " = "
+               << res << " (expected " << ref << ")" << endl;
+          ok = false;
+        }
+      }
+    }
+  }
+  return ok;
+}
+
+//// Arithmetic profile /////////////////////////////////////////////////
+
+static const char* const s_approxAdderNames[NUM_APPROX_ADDER_TYPES] =
+{
+  "Exact", "LOA", "Type1", "Type2", "Type3", "Type4", "Type5", "M45P35A7", "M45P30A6", "M60P25A6", "M95P10A5"
+};
+
+static const char* const s_approxSiteNames[NUM_APPROX_SITES] =
+{
+  "MC", "GBI", "ME"
+};
+
+void setApproxProfile(ApproxAdderType adder, int numberBits, int approximateCount, uint32_t sites)
+{
+  g_approxAdderParam.numberBits       = numberBits;
+  g_approxAdderParam.approximateCount = approximateCount;
+  g_approxProfile.adder               = adder;
+  g_approxProfile.sites               = sites;
+}
+
+bool parseApproxAdder(const string &name, ApproxAdderType &adder)
+{
+  for (int i = 0; i < NUM_APPROX_ADDER_TYPES; i++)
+  {
+    if (name == s_approxAdderNames[i])
+    {
+      adder = ApproxAdderType(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool parseApproxSites(const string &list, uint32_t &sites)
+{
+  sites = 0;
+  size_t start = 0;
+  while (start <= list.size())
+  {
+    const size_t end  = std::min(list.find(',', start), list.size());
+    const string site = list.substr(start, end - start);
+    int          i    = 0;
+    while (i < NUM_APPROX_SITES && site != s_approxSiteNames[i])
+    {
+      i++;
+    }
+    if (i == NUM_APPROX_SITES)
+    {
+      if (!site.empty())
+      {
+        return false;
+      }
+    }
+    else
+    {
+      sites |= 1u << i;
+    }
+    start = end + 1;
+  }
+  return true;
+}
+
+const char* getApproxAdderName(ApproxAdderType adder)
+{
+  return s_approxAdderNames[adder];
+}
+
+string getApproxSitesName(uint32_t sites)
+{
+  string list;
+  for (int i = 0; i < NUM_APPROX_SITES; i++)
+  {
+    if (sites >> i & 1)
+    {
+      list += (list.empty() ? "" : ",") + string(s_approxSiteNames[i]);
+    }
+  }
+  return list;
+}
@@ -6,18 +6,12 @@
 #include<algorithm>
 #include <string>
 #include <cmath>
-#include <chrono>
+#include <cstdint>
 
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
+#include "CommonDef.h"
 
 using namespace std;
 
-extern long long int accurateTime;
-extern long long int approximateTime;
-
 struct adderOutput
 {
   int sum;
@@ -47,43 +41,234 @@ binaryOutput approximate_binary_adder(string binaryOne, string binaryTwo, bool c
 string       complement(string binaryNumber, char type);
 binaryOutput accurate_binary_subtraction(string binaryOne, string binaryTwo);
 binaryOutput approximate_binary_subtraction(string binaryOne, string binaryTwo, int approximateCount);
-extern int   calculateSum(int numOne, int numTwo, int numberBits, int approximateCount);
+int          calculateSumReference(int numOne, int numTwo, int numberBits, int approximateCount);
 
 string approximate_binary_adder_8bit_type1(string binaryOne, string binaryTwo, bool cOut);
 string approximate_binary_subtraction_8bit_type1(string binaryOne, string binaryTwo);
-extern int approximate8BitSumType1(int numOne, int numTwo);
+int        approximate8BitSumType1Reference(int numOne, int numTwo);
 
 string     approximate_binary_adder_8bit_type2(string binaryOne, string binaryTwo, bool cOut);
 string     approximate_binary_subtraction_8bit_type2(string binaryOne, string binaryTwo);
-extern int approximate8BitSumType2(int numOne, int numTwo);
+int        approximate8BitSumType2Reference(int numOne, int numTwo);
 
 string     approximate_binary_adder_8bit_type3(string binaryOne, string binaryTwo, bool cOut);
 string     approximate_binary_subtraction_8bit_type3(string binaryOne, string binaryTwo);
-extern int approximate8BitSumType3(int numOne, int numTwo);
+int        approximate8BitSumType3Reference(int numOne, int numTwo);
 
 string     approximate_binary_adder_8bit_type4(string binaryOne, string binaryTwo, bool cOut);
 string     approximate_binary_subtraction_8bit_type4(string binaryOne, string binaryTwo);
-extern int approximate8BitSumType4(int numOne, int numTwo);
+int        approximate8BitSumType4Reference(int numOne, int numTwo);
 
 string     approximate_binary_adder_8bit_type5(string binaryOne, string binaryTwo, bool cOut);
 string     approximate_binary_subtraction_8bit_type5(string binaryOne, string binaryTwo);
-extern int approximate8BitSumType5(int numOne, int numTwo);
+int        approximate8BitSumType5Reference(int numOne, int numTwo);
 
 string     approximate_binary_adder_8bit_M45_P35_A7(string binaryOne, string binaryTwo, bool cOut);
 string     approximate_binary_subtraction_8bit_M45_P35_A7(string binaryOne, string binaryTwo);
-extern int approximate8BitSumM45P35A7(int numOne, int numTwo);
+int        approximate8BitSumM45P35A7Reference(int numOne, int numTwo);
 
 string     approximate_binary_adder_8bit_M45_P30_A6(string binaryOne, string binaryTwo, bool cOut);
 string     approximate_binary_subtraction_8bit_M45_P30_A6(string binaryOne, string binaryTwo);
-extern int approximate8BitSumM45P30A6(int numOne, int numTwo);
+int        approximate8BitSumM45P30A6Reference(int numOne, int numTwo);
 
 string     approximate_binary_adder_8bit_M60_P25_A6(string binaryOne, string binaryTwo, bool cOut);
 string     approximate_binary_subtraction_8bit_M60_P25_A6(string binaryOne, string binaryTwo);
-extern int approximate8BitSumM60P25A6(int numOne, int numTwo);
+int        approximate8BitSumM60P25A6Reference(int numOne, int numTwo);
 
 string     approximate_binary_adder_8bit_M95_P10_A5(string binaryOne, string binaryTwo, bool cOut);
 string     approximate_binary_subtraction_8bit_M95_P10_A5(string binaryOne, string binaryTwo);
-extern int approximate8BitSumM95P10A5(int numOne, int numTwo);
+int        approximate8BitSumM95P10A5Reference(int numOne, int numTwo);
+
+
+//// Integer engine /////////////////////////////////////////////////////
+//
+// Bit-exact replacement of the string based adders above. calculateSum() evaluates the lower-part OR adder
+// with pure integer operations, the 8 bit adders read precomputed 256x256 tables indexed by the (truncated)
+// magnitudes of the operands. The *Reference() functions are kept as the golden model.
+
+enum ApproxAdder8Bit
+{
+  APPROX_ADDER_8BIT_TYPE1 = 0,
+  APPROX_ADDER_8BIT_TYPE2,
+  APPROX_ADDER_8BIT_TYPE3,
+  APPROX_ADDER_8BIT_TYPE4,
+  APPROX_ADDER_8BIT_TYPE5,
+  APPROX_ADDER_8BIT_M45_P35_A7,
+  APPROX_ADDER_8BIT_M45_P30_A6,
+  APPROX_ADDER_8BIT_M60_P25_A6,
+  APPROX_ADDER_8BIT_M95_P10_A5,
+  NUM_APPROX_ADDERS_8BIT
+};
+
+static_assert( NUM_APPROX_ADDER_TYPES - APPROX_ADDER_TYPE1 == NUM_APPROX_ADDERS_8BIT, "ApproxAdderType does not match ApproxAdder8Bit" );
+
+extern uint16_t g_approx8BitAddTable[NUM_APPROX_ADDERS_8BIT][256][256];   // [type][|numOne|][|numTwo|], 9 bit result
+extern uint8_t  g_approx8BitSubTable[NUM_APPROX_ADDERS_8BIT][256][256];   // [type][max magnitude][min magnitude]
+
+void initApproximateAdders();
+bool checkApproximateAdders();   // exhaustive comparison of the integer engine against the string reference
+
+// sign handling shared by all adders: the operation is a subtraction of the smaller magnitude from the larger
+// one if the signs differ, the sign of the result is the sign of the operand with the larger magnitude
+static inline int approximateSumSign(int numOne, int numTwo, bool &isSub)
+{
+  const int absOne = abs(numOne);
+  const int absTwo = abs(numTwo);
+  isSub            = (numOne < 0 && numTwo > 0) || (numOne > 0 && numTwo < 0);
+  return absOne > absTwo ? (numOne < 0 ? -1 : 1) : (absOne < absTwo ? (numTwo < 0 ? -1 : 1) : 1);
+}
+
+// lower-part OR adder: the lower approximateCount bits are ORed, the upper bits are added exactly with the
+// AND of the two boundary bits as carry in
+static inline int approximateAdd(uint32_t binaryOne, uint32_t binaryTwo, int numberBits, int approximateCount, bool cOut)
+{
+  if (approximateCount >= numberBits)
+  {
+    return int(binaryOne | binaryTwo);
+  }
+  uint32_t lowerPart = 0;
+  uint32_t carry     = 0;
+  if (approximateCount > 0)
+  {
+    lowerPart = (binaryOne | binaryTwo) & ((1u << approximateCount) - 1);
+    carry     = (binaryOne & binaryTwo) >> (approximateCount - 1) & 1;
+  }
+  uint32_t upperPart = (binaryOne >> approximateCount) + (binaryTwo >> approximateCount) + carry;
+  if (!cOut)
+  {
+    upperPart &= (1u << (numberBits - approximateCount)) - 1;
+  }
+  return int((upperPart << approximateCount) | lowerPart);
+}
+
+static inline int calculateSum(int numOne, int numTwo, int numberBits, int approximateCount)
+{
+  bool           isSub;
+  const int      sign   = approximateSumSign(numOne, numTwo, isSub);
+  const uint32_t mask   = (1u << numberBits) - 1;
+  const uint32_t absOne = uint32_t(abs(numOne));
+  const uint32_t absTwo = uint32_t(abs(numTwo));
+  const uint32_t maxBin = std::max(absOne, absTwo) & mask;
+  const uint32_t minBin = std::min(absOne, absTwo) & mask;
+
+  approximateCount = std::max(approximateCount, 0);
+  if (!isSub)
+  {
+    return sign * approximateAdd(maxBin, minBin, numberBits, approximateCount, true);
+  }
+  // the two's complement of the subtrahend is formed with the same (approximate) adder over the balanced width
+  const int      numBits = std::max(numberBits, approximateCount);
+  const uint32_t compl2  = uint32_t(approximateAdd(~minBin & ((1u << numBits) - 1), 1, numBits, approximateCount, false));
+  return sign * approximateAdd(maxBin, compl2, numBits, approximateCount, false);
+}
+
+static inline int approximate8BitSum(ApproxAdder8Bit type, int numOne, int numTwo)
+{
+  bool      isSub;
+  const int sign   = approximateSumSign(numOne, numTwo, isSub);
+  const int absOne = abs(numOne);
+  const int absTwo = abs(numTwo);
+
+  if (!isSub)
+  {
+    return sign * g_approx8BitAddTable[type][absOne & 0xff][absTwo & 0xff];
+  }
+  return sign * g_approx8BitSubTable[type][std::max(absOne, absTwo) & 0xff][std::min(absOne, absTwo) & 0xff];
+}
+
+static inline int approximate8BitSumType1     (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_TYPE1,      numOne, numTwo); }
+static inline int approximate8BitSumType2     (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_TYPE2,      numOne, numTwo); }
+static inline int approximate8BitSumType3     (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_TYPE3,      numOne, numTwo); }
+static inline int approximate8BitSumType4     (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_TYPE4,      numOne, numTwo); }
+static inline int approximate8BitSumType5     (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_TYPE5,      numOne, numTwo); }
+static inline int approximate8BitSumM45P35A7  (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_M45_P35_A7, numOne, numTwo); }
+static inline int approximate8BitSumM45P30A6  (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_M45_P30_A6, numOne, numTwo); }
+static inline int approximate8BitSumM60P25A6  (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_M60_P25_A6, numOne, numTwo); }
+static inline int approximate8BitSumM95P10A5  (int numOne, int numTwo) { return approximate8BitSum(APPROX_ADDER_8BIT_M95_P10_A5, numOne, numTwo); }
+
+// word level gate description of the 8 bit adders on the magnitudes binaryOne/binaryTwo (bit 8 is the carry out).
+// OPS supplies the bitwise operations, so the same description builds the scalar tables and the SIMD kernels.
+template<typename OPS, ApproxAdder8Bit type>
+static inline typename OPS::T approximateAdder8BitGates(const typename OPS::T a, const typename OPS::T b)
+{
+  typedef typename OPS::T T;
+
+  // bits 5 to 8 shared by the types 2 to 5 and M45_P35_A7
+  const T upper = OPS::Or(OPS::Or(OPS::And(OPS::AndNot(b, OPS::Or(a, OPS::Shl1(a))), OPS::Set(0x20)), OPS::And(OPS::And(a, b), OPS::Set(0x40))),
+                          OPS::Or(OPS::AndNot(OPS::Xor(a, b), OPS::Set(0x80)), OPS::Shl1(OPS::And(OPS::Or(a, b), OPS::Set(0x80)))));
+
+  switch (type)
+  {
+  case APPROX_ADDER_8BIT_TYPE1:
+    return OPS::Or(OPS::Or(OPS::Or(OPS::And(OPS::Or(a, b), OPS::Set(0x41)), OPS::And(b, OPS::Set(0x12))), OPS::AndNot(b, OPS::Set(0x0c))),
+                   OPS::Or(OPS::And(OPS::Xor(a, b), OPS::Set(0xa0)), OPS::Shl1(OPS::And(OPS::And(a, b), OPS::Set(0x80)))));
+  case APPROX_ADDER_8BIT_TYPE2:
+    return OPS::Or(OPS::Or(OPS::And(a, OPS::Set(0x11)), OPS::AndNot(OPS::Or(b, OPS::Shl1(b)), OPS::Set(0x02))),
+                   OPS::Or(OPS::And(OPS::Xor(a, b), OPS::Set(0x0c)), upper));
+  case APPROX_ADDER_8BIT_TYPE3:
+    return OPS::Or(OPS::Or(OPS::AndNot(a, OPS::Set(0x05)), OPS::AndNot(OPS::Xor(a, b), OPS::Set(0x02))),
+                   OPS::Or(OPS::Or(OPS::And(b, OPS::Set(0x08)), OPS::And(a, OPS::Set(0x10))), upper));
+  case APPROX_ADDER_8BIT_TYPE4:
+    return OPS::Or(OPS::Or(OPS::And(b, OPS::Set(0x03)), OPS::And(OPS::And(a, b), OPS::Set(0x04))),
+                   OPS::Or(OPS::And(a, OPS::Set(0x18)), upper));
+  case APPROX_ADDER_8BIT_TYPE5:
+    return OPS::Or(OPS::Or(OPS::And(a, OPS::Set(0x1a)), OPS::AndNot(a, OPS::Set(0x04))), OPS::Or(OPS::And(b, OPS::Set(0x04)), upper));
+  case APPROX_ADDER_8BIT_M45_P35_A7:
+    return OPS::Or(OPS::Or(OPS::And(a, OPS::Set(0x11)), OPS::AndNot(OPS::And(a, b), OPS::Set(0x02))),
+                   OPS::Or(OPS::And(b, OPS::Set(0x04)), upper));
+  case APPROX_ADDER_8BIT_M45_P30_A6:
+    return OPS::Or(OPS::Or(OPS::And(a, OPS::Set(0x0a)), OPS::And(OPS::AndNot(b, OPS::Shl1(OPS::And(a, b))), OPS::Set(0x04))),
+                   OPS::Or(OPS::Or(OPS::And(OPS::Xor(a, b), OPS::Set(0x10)), OPS::AndNot(OPS::Xor(a, b), OPS::Set(0x80))),
+                           OPS::Shl1(OPS::And(OPS::Or(a, b), OPS::Set(0x80)))));
+  case APPROX_ADDER_8BIT_M60_P25_A6:
+    return OPS::Or(OPS::Or(OPS::Or(OPS::And(b, OPS::Set(0x11)), OPS::AndNot(OPS::Or(a, b), OPS::Set(0x02))),
+                           OPS::Or(OPS::And(a, OPS::Set(0x44)), OPS::And(OPS::Shl1(OPS::Or(a, b)), OPS::Set(0x20)))),
+                   OPS::Or(OPS::Or(OPS::AndNot(b, OPS::Set(0x20)), OPS::And(OPS::Xor(a, b), OPS::Set(0x80))),
+                           OPS::Shl1(OPS::And(OPS::And(a, b), OPS::Set(0x80)))));
+  case APPROX_ADDER_8BIT_M95_P10_A5:
+  default:
+    return OPS::Or(OPS::Or(OPS::And(a, OPS::Set(0x49)), OPS::AndNot(a, OPS::Set(0x94))), OPS::Shl1(OPS::And(a, OPS::Set(0x80))));
+  }
+}
+
+struct ApproxScalarOps
+{
+  typedef int T;
+  static inline T And   (T a, T b) { return a & b; }
+  static inline T Or    (T a, T b) { return a | b; }
+  static inline T Xor   (T a, T b) { return a ^ b; }
+  static inline T AndNot(T a, T b) { return ~a & b; }
+  static inline T Shl1  (T a)      { return a << 1; }
+  static inline T Set   (int c)    { return c; }
+};
+
+// word width and number of approximated bits of the lower-part OR adder (APPROX_ADDER_LOA)
+struct ApproxAdderParam
+{
+  int numberBits;
+  int approximateCount;
+};
+
+extern ApproxAdderParam g_approxAdderParam;
+
+// arithmetic profile selected by the applications (--ApproxAdder, --ApproxWidth, --ApproxBits, --ApproxSites).
+// The kernels are resolved once at init (InterpolationFilter::setApproxAdder(), PelBufferOps::initApproxProfile()).
+extern ApproxProfile g_approxProfile;
+
+void        setApproxProfile  (ApproxAdderType adder, int numberBits, int approximateCount, uint32_t sites);
+bool        parseApproxAdder  (const string &name, ApproxAdderType &adder);   // "Exact", "LOA", "Type1", ..., "M95P10A5"
+bool        parseApproxSites  (const string &list, uint32_t &sites);          // comma separated list of "MC", "GBI", "ME"
+const char* getApproxAdderName(ApproxAdderType adder);
+string      getApproxSitesName(uint32_t sites);
+
+// generic entry point used by the kernels, the adder is resolved at compile time
+template<int adder>
+static inline int approximateSum(int numOne, int numTwo, const int numberBits, const int approximateCount)
+{
+  return adder == APPROX_ADDER_EXACT ? numOne + numTwo
+       : adder == APPROX_ADDER_LOA   ? calculateSum(numOne, numTwo, numberBits, approximateCount)
+                                     : approximate8BitSum(ApproxAdder8Bit(adder - APPROX_ADDER_TYPE1), numOne, numTwo);
+}
 
 
 #endif
\ No newline at end of file
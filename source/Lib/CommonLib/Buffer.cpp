@@ -42,14 +42,7 @@
 #include "Buffer.h"
 #include "InterpolationFilter.h"
 #include "ApproximatAdderSubtraction.h"
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-long long int timeOfAddWeightedAvg = 0;
+#include "Profiler.h"
 
 void applyPROFCore(Pel* dst, int dstStride, const Pel* src, int srcStride, int width, int height, const Pel* gradX, const Pel* gradY, int gradStride, const int* dMvX, const int* dMvY, int dMvStride, int shiftNum, Pel offset, const ClpRng& clpRng)
 {
@@ -341,6 +334,42 @@ void removeHighFreq(int16_t* dst, int dstStride, const int16_t* src, int srcStri
 }
 #endif
 
+template<int adder>
+void addAvgApproxCore( const Pel* src1, int src1Stride, const Pel* src2, int src2Stride, Pel* dest, int dstStride, int width, int height, int rshift, int offset, const ClpRng& clpRng )
+{
+  const int numberBits       = g_approxAdderParam.numberBits;
+  const int approximateCount = g_approxAdderParam.approximateCount;
+
+#define ADD_AVG_APPROX_OP( ADDR ) dest[ADDR] = ClipPel( rightShift( approximateSum<adder>( approximateSum<adder>( src1[ADDR], src2[ADDR], numberBits, approximateCount ), offset, numberBits, approximateCount ), rshift ), clpRng )
+#define ADD_AVG_APPROX_INC  \
+  src1 += src1Stride;       \
+  src2 += src2Stride;       \
+  dest +=  dstStride;       \
+
+  SIZE_AWARE_PER_EL_OP( ADD_AVG_APPROX_OP, ADD_AVG_APPROX_INC );
+
+#undef ADD_AVG_APPROX_OP
+#undef ADD_AVG_APPROX_INC
+}
+
+template<int adder>
+void addWeightedAvgApproxCore( const Pel* src1, int src1Stride, const Pel* src2, int src2Stride, Pel* dest, int dstStride, int width, int height, int w0, int w1, int rshift, int offset, const ClpRng& clpRng )
+{
+  const int numberBits       = g_approxAdderParam.numberBits;
+  const int approximateCount = g_approxAdderParam.approximateCount;
+
+#define ADD_WGHT_AVG_APPROX_OP( ADDR ) dest[ADDR] = ClipPel( rightShift( approximateSum<adder>( approximateSum<adder>( src1[ADDR] * w0, src2[ADDR] * w1, numberBits, approximateCount ), offset, numberBits, approximateCount ), rshift ), clpRng )
+#define ADD_WGHT_AVG_APPROX_INC  \
+  src1 += src1Stride;            \
+  src2 += src2Stride;            \
+  dest +=  dstStride;            \
+
+  SIZE_AWARE_PER_EL_OP( ADD_WGHT_AVG_APPROX_OP, ADD_WGHT_AVG_APPROX_INC );
+
+#undef ADD_WGHT_AVG_APPROX_OP
+#undef ADD_WGHT_AVG_APPROX_INC
+}
+
 template<typename T>
 void reconstructCore( const T* src1, int src1Stride, const T* src2, int src2Stride, T* dest, int dstStride, int width, int height, const ClpRng& clpRng )
 {
@@ -376,6 +405,31 @@ PelBufferOps::PelBufferOps()
   addAvg4 = addAvgCore<Pel>;
   addAvg8 = addAvgCore<Pel>;
 
+  addAvgApprox[APPROX_ADDER_EXACT]              = addAvgCore<Pel>;
+  addAvgApprox[APPROX_ADDER_LOA]                = addAvgApproxCore<APPROX_ADDER_LOA>;
+  addAvgApprox[APPROX_ADDER_TYPE1]              = addAvgApproxCore<APPROX_ADDER_TYPE1>;
+  addAvgApprox[APPROX_ADDER_TYPE2]              = addAvgApproxCore<APPROX_ADDER_TYPE2>;
+  addAvgApprox[APPROX_ADDER_TYPE3]              = addAvgApproxCore<APPROX_ADDER_TYPE3>;
+  addAvgApprox[APPROX_ADDER_TYPE4]              = addAvgApproxCore<APPROX_ADDER_TYPE4>;
+  addAvgApprox[APPROX_ADDER_TYPE5]              = addAvgApproxCore<APPROX_ADDER_TYPE5>;
+  addAvgApprox[APPROX_ADDER_M45_P35_A7]         = addAvgApproxCore<APPROX_ADDER_M45_P35_A7>;
+  addAvgApprox[APPROX_ADDER_M45_P30_A6]         = addAvgApproxCore<APPROX_ADDER_M45_P30_A6>;
+  addAvgApprox[APPROX_ADDER_M60_P25_A6]         = addAvgApproxCore<APPROX_ADDER_M60_P25_A6>;
+  addAvgApprox[APPROX_ADDER_M95_P10_A5]         = addAvgApproxCore<APPROX_ADDER_M95_P10_A5>;
+
+  addWeightedAvgApprox[APPROX_ADDER_EXACT]      = addWeightedAvgApproxCore<APPROX_ADDER_EXACT>;
+  addWeightedAvgApprox[APPROX_ADDER_LOA]        = addWeightedAvgApproxCore<APPROX_ADDER_LOA>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE1]      = addWeightedAvgApproxCore<APPROX_ADDER_TYPE1>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE2]      = addWeightedAvgApproxCore<APPROX_ADDER_TYPE2>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE3]      = addWeightedAvgApproxCore<APPROX_ADDER_TYPE3>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE4]      = addWeightedAvgApproxCore<APPROX_ADDER_TYPE4>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE5]      = addWeightedAvgApproxCore<APPROX_ADDER_TYPE5>;
+  addWeightedAvgApprox[APPROX_ADDER_M45_P35_A7] = addWeightedAvgApproxCore<APPROX_ADDER_M45_P35_A7>;
+  addWeightedAvgApprox[APPROX_ADDER_M45_P30_A6] = addWeightedAvgApproxCore<APPROX_ADDER_M45_P30_A6>;
+  addWeightedAvgApprox[APPROX_ADDER_M60_P25_A6] = addWeightedAvgApproxCore<APPROX_ADDER_M60_P25_A6>;
+  addWeightedAvgApprox[APPROX_ADDER_M95_P10_A5] = addWeightedAvgApproxCore<APPROX_ADDER_M95_P10_A5>;
+  addWeightedAvg                                = addWeightedAvgApproxCore<APPROX_ADDER_EXACT>;
+
   reco4 = reconstructCore<Pel>;
   reco8 = reconstructCore<Pel>;
 
@@ -402,6 +456,20 @@ PelBufferOps::PelBufferOps()
   roundIntVector = nullptr;
 }
 
+// installs the approximate kernels of the enabled sites, must be called after initPelBufOpsX86()
+void PelBufferOps::initApproxProfile( const ApproxProfile& profile )
+{
+  if( profile.isActive( APPROX_SITE_MC ) )
+  {
+    addAvg4 = addAvgApprox[profile.adder];
+    addAvg8 = addAvgApprox[profile.adder];
+  }
+  if( profile.isActive( APPROX_SITE_GBI ) )
+  {
+    addWeightedAvg = addWeightedAvgApprox[profile.adder];
+  }
+}
+
 PelBufferOps g_pelBufOP = PelBufferOps();
 
 void copyBufferCore(Pel *src, int srcStride, Pel *dst, int dstStride, int width, int height)
@@ -441,7 +509,8 @@ void paddingCore(Pel *ptr, int stride, int width, int height, int padSize)
 template<>
 void AreaBuf<Pel>::addWeightedAvg(const AreaBuf<const Pel> &other1, const AreaBuf<const Pel> &other2, const ClpRng& clpRng, const int8_t gbiIdx)
 {
-  auto         start          = high_resolution_clock::now();
+  PROFILE_ZONE( "AreaBuf<Pel>::addWeightedAvg" );
+  PROFILE_KERNEL( "PelBufferOps::addWeightedAvg", width, height, clpRng.bd );
 
   const int8_t w0 = getGbiWeight(gbiIdx, REF_PIC_LIST_0);
   const int8_t w1 = getGbiWeight(gbiIdx, REF_PIC_LIST_1);
@@ -456,23 +525,9 @@ void AreaBuf<Pel>::addWeightedAvg(const AreaBuf<const Pel> &other1, const AreaBu
   const unsigned destStride = stride;
   const int clipbd = clpRng.bd;
   const int shiftNum = std::max<int>(2, (IF_INTERNAL_PREC - clipbd)) + log2WeightBase;
-  //const int offset = (1 << (shiftNum - 1)) + (IF_INTERNAL_OFFS << log2WeightBase);
-  const int offset = calculateSum((1 << (shiftNum - 1)) , (IF_INTERNAL_OFFS << log2WeightBase), 8 , 8);
-
-#define ADD_AVG_OP( ADDR ) dest[ADDR] = ClipPel( rightShift( ( src0[ADDR]*w0 + src2[ADDR]*w1 + offset ), shiftNum ), clpRng )
-#define ADD_AVG_INC     \
-    src0 += src1Stride; \
-    src2 += src2Stride; \
-    dest += destStride; \
-
-  SIZE_AWARE_PER_EL_OP(ADD_AVG_OP, ADD_AVG_INC);
+  const int offset = (1 << (shiftNum - 1)) + (IF_INTERNAL_OFFS << log2WeightBase);
 
-#undef ADD_AVG_OP
-#undef ADD_AVG_INC
-
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfAddWeightedAvg = timeOfAddWeightedAvg + duration.count();
+  g_pelBufOP.addWeightedAvg( src0, src1Stride, src2, src2Stride, dest, destStride, width, height, w0, w1, shiftNum, offset, clpRng );
 }
 
 template<>
@@ -545,6 +600,8 @@ void AreaBuf<Pel>::scaleSignal(const int scale, const bool dir, const ClpRng& cl
 template<>
 void AreaBuf<Pel>::addAvg( const AreaBuf<const Pel> &other1, const AreaBuf<const Pel> &other2, const ClpRng& clpRng)
 {
+  PROFILE_KERNEL( "PelBufferOps::addAvg", width, height, clpRng.bd );
+
   const Pel* src0 = other1.buf;
   const Pel* src2 = other2.buf;
         Pel* dest =        buf;
@@ -656,6 +713,8 @@ void AreaBuf<Pel>::copyClip( const AreaBuf<const Pel> &src, const ClpRng& clpRng
 template<>
 void AreaBuf<Pel>::reconstruct( const AreaBuf<const Pel> &pred, const AreaBuf<const Pel> &resi, const ClpRng& clpRng )
 {
+  PROFILE_KERNEL( "PelBufferOps::reco", width, height, clpRng.bd );
+
   const Pel* src1 = pred.buf;
   const Pel* src2 = resi.buf;
         Pel* dest =      buf;
@@ -692,6 +751,8 @@ void AreaBuf<Pel>::reconstruct( const AreaBuf<const Pel> &pred, const AreaBuf<co
 template<>
 void AreaBuf<Pel>::linearTransform( const int scale, const int shift, const int offset, bool bClip, const ClpRng& clpRng )
 {
+  PROFILE_KERNEL( "PelBufferOps::linTf", width, height, clpRng.bd );
+
   const Pel* src = buf;
         Pel* dst = buf;
 
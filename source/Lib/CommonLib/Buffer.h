@@ -51,8 +51,6 @@
 // AreaBuf struct
 // ---------------------------------------------------------------------------
 
-extern long long int timeOfAddWeightedAvg;
-
 struct PelBufferOps
 {
   PelBufferOps();
@@ -62,9 +60,14 @@ struct PelBufferOps
   template<X86_VEXT vext>
   void _initPelBufOpsX86();
 #endif
+  void initApproxProfile( const ApproxProfile& profile );
 
   void ( *addAvg4 )       ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,            int shift, int offset, const ClpRng& clpRng );
   void ( *addAvg8 )       ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,            int shift, int offset, const ClpRng& clpRng );
+  // [ApproxAdderType], additions of the (weighted) average done with the approximate adder
+  void ( *addAvgApprox[NUM_APPROX_ADDER_TYPES] )         ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,                 int shift, int offset, const ClpRng& clpRng );
+  void ( *addWeightedAvgApprox[NUM_APPROX_ADDER_TYPES] ) ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int shift, int offset, const ClpRng& clpRng );
+  void ( *addWeightedAvg )( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int shift, int offset, const ClpRng& clpRng );
   void ( *reco4 )         ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,                                   const ClpRng& clpRng );
   void ( *reco8 )         ( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height,                                   const ClpRng& clpRng );
   void ( *linTf4 )        ( const Pel* src0, int src0Stride,                                  Pel *dst, int dstStride, int width, int height, int scale, int shift, int offset, const ClpRng& clpRng, bool bClip );
@@ -120,6 +123,7 @@ struct AreaBuf : public Size
   void subtract             ( const AreaBuf<const T> &other );
   void extendSingleBorderPel();
   void extendBorderPel      (  unsigned margin );
+  void extendBorderPel      (  unsigned margin, bool top, bool bottom );
   void addWeightedAvg       ( const AreaBuf<const T> &other1, const AreaBuf<const T> &other2, const ClpRng& clpRng, const int8_t gbiIdx);
   void removeWeightHighFreq ( const AreaBuf<T>& other, const bool bClip, const ClpRng& clpRng, const int8_t iGbiWeight);
   void addAvg               ( const AreaBuf<const T> &other1, const AreaBuf<const T> &other2, const ClpRng& clpRng );
@@ -530,6 +534,13 @@ void AreaBuf<T>::updateHistogram( std::vector<int32_t>& hist ) const
 
 template<typename T>
 void AreaBuf<T>::extendBorderPel( unsigned margin )
+{
+  extendBorderPel( margin, true, true );
+}
+
+// the left and right margins are always extended, the top and bottom margins only when requested
+template<typename T>
+void AreaBuf<T>::extendBorderPel( unsigned margin, bool top, bool bottom )
 {
   T*  p = buf;
   int h = height;
@@ -551,17 +562,23 @@ void AreaBuf<T>::extendBorderPel( unsigned margin )
   // p is now the (0,height) (bottom left of image within bigger picture
   p -= ( s + margin );
   // p is now the (-margin, height-1)
-  for( int y = 0; y < margin; y++ )
+  if( bottom )
   {
-    ::memcpy( p + ( y + 1 ) * s, p, sizeof( T ) * ( w + ( margin << 1 ) ) );
+    for( int y = 0; y < margin; y++ )
+    {
+      ::memcpy( p + ( y + 1 ) * s, p, sizeof( T ) * ( w + ( margin << 1 ) ) );
+    }
   }
 
   // pi is still (-marginX, height-1)
   p -= ( ( h - 1 ) * s );
   // pi is now (-marginX, 0)
-  for( int y = 0; y < margin; y++ )
+  if( top )
   {
-    ::memcpy( p - ( y + 1 ) * s, p, sizeof( T ) * ( w + ( margin << 1 ) ) );
+    for( int y = 0; y < margin; y++ )
+    {
+      ::memcpy( p - ( y + 1 ) * s, p, sizeof( T ) * ( w + ( margin << 1 ) ) );
+    }
   }
 }
 
@@ -696,6 +713,7 @@ struct UnitBuf
   void addAvg               ( const UnitBuf<const T> &other1, const UnitBuf<const T> &other2, const ClpRngs& clpRngs, const bool chromaOnly = false, const bool lumaOnly = false);
   void extendSingleBorderPel();
   void extendBorderPel      ( unsigned margin );
+  void extendBorderPel      ( unsigned margin, bool top, bool bottom );
   void removeHighFreq       ( const UnitBuf<T>& other, const bool bClip, const ClpRngs& clpRngs
                             , const int8_t gbiWeight = g_GbiWeights[GBI_DEFAULT]
                             );
@@ -813,6 +831,15 @@ void UnitBuf<T>::extendBorderPel( unsigned margin )
   }
 }
 
+template<typename T>
+void UnitBuf<T>::extendBorderPel( unsigned margin, bool top, bool bottom )
+{
+  for( unsigned i = 0; i < bufs.size(); i++ )
+  {
+    bufs[i].extendBorderPel( margin, top, bottom );
+  }
+}
+
 template<typename T>
 void UnitBuf<T>::removeHighFreq( const UnitBuf<T>& other, const bool bClip, const ClpRngs& clpRngs
                                , const int8_t gbiWeight
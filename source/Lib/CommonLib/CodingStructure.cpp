@@ -42,14 +42,7 @@
 #include "Picture.h"
 #include "UnitTools.h"
 #include "UnitPartitioner.h"
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-long long int timeOfTraverseTUs = 0;
+#include "Profiler.h"
 
 
 XUCache g_globalUnitCache = XUCache();
@@ -71,6 +64,7 @@ CodingStructure::CodingStructure(CUCache& cuCache, PUCache& puCache, TUCache& tu
   , picture   ( nullptr )
   , parent    ( nullptr )
   , bestCS    ( nullptr )
+  , pcv       ( nullptr )
   , m_isTuEnc ( false )
   , m_cuCache ( cuCache )
   , m_puCache ( puCache )
@@ -288,12 +282,13 @@ CodingUnit* CodingStructure::getCU( const Position &pos, const ChannelType effCh
 {
   const CompArea &_blk = area.blocks[effChType];
 
-  if( !_blk.contains( pos ) || (treeType == TREE_C && effChType == CHANNEL_TYPE_LUMA) )
+  // the decoder reconstructs CTUs while the parser changes the treeType of the picture structure,
+  // only the luma CUs of a sub-structure in a chroma tree are taken from the parent
+  if( !_blk.contains( pos ) || ( parent && treeType == TREE_C && effChType == CHANNEL_TYPE_LUMA ) )
   {
     //keep this check, which is helpful to identify bugs
-    if( treeType == TREE_C && effChType == CHANNEL_TYPE_LUMA )
+    if( parent && treeType == TREE_C && effChType == CHANNEL_TYPE_LUMA )
     {
-      CHECK( parent == nullptr, "parent shall be valid; consider using function getLumaCU()" );
       CHECK( parent->treeType != TREE_D, "wrong parent treeType " );
     }
     if( parent ) return parent->getCU( pos, effChType );
@@ -312,11 +307,12 @@ const CodingUnit* CodingStructure::getCU( const Position &pos, const ChannelType
 {
   const CompArea &_blk = area.blocks[effChType];
 
-  if( !_blk.contains( pos ) || (treeType == TREE_C && effChType == CHANNEL_TYPE_LUMA) )
+  // the decoder reconstructs CTUs while the parser changes the treeType of the picture structure,
+  // only the luma CUs of a sub-structure in a chroma tree are taken from the parent
+  if( !_blk.contains( pos ) || ( parent && treeType == TREE_C && effChType == CHANNEL_TYPE_LUMA ) )
   {
-    if( treeType == TREE_C && effChType == CHANNEL_TYPE_LUMA )
+    if( parent && treeType == TREE_C && effChType == CHANNEL_TYPE_LUMA )
     {
-      CHECK( parent == nullptr, "parent shall be valid; consider using function getLumaCU()" );
       CHECK( parent->treeType != TREE_D, "wrong parent treeType" );
     }
     if( parent ) return parent->getCU( pos, effChType );
@@ -722,33 +718,25 @@ PUTraverser CodingStructure::traversePUs( const UnitArea& unit, const ChannelTyp
 
 TUTraverser CodingStructure::traverseTUs( const UnitArea& unit, const ChannelType effChType )
 {
-  auto           start   = high_resolution_clock::now();
+  PROFILE_ZONE( "CodingStructure::traverseTUs" );
 
   TransformUnit* firstTU = getTU( isLuma( effChType ) ? unit.lumaPos() : unit.chromaPos(), effChType );
   TransformUnit* lastTU  = firstTU;
 
   do { } while( lastTU && ( lastTU = lastTU->next ) && unit.contains( *lastTU ) );
 
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfTraverseTUs = timeOfTraverseTUs + duration.count();
-
   return TUTraverser( firstTU, lastTU );
 }
 
 cCUTraverser CodingStructure::traverseCUs( const UnitArea& unit, const ChannelType effChType ) const
 {
-  auto              start   = high_resolution_clock::now();
+  PROFILE_ZONE( "CodingStructure::traverseCUs" );
 
   const CodingUnit* firstCU = getCU( isLuma( effChType ) ? unit.lumaPos() : unit.chromaPos(), effChType );
   const CodingUnit* lastCU  = firstCU;
 
   do { } while( lastCU && ( lastCU = lastCU->next ) && unit.contains( *lastCU ) );
 
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfTraverseTUs = timeOfTraverseTUs + duration.count();
-
   return cCUTraverser( firstCU, lastCU );
 }
 
@@ -870,6 +858,42 @@ void CodingStructure::addMiToLut(static_vector<MotionInfo, MAX_NUM_HMVP_CANDS> &
   lut.push_back(mi);
 }
 
+static inline int getCtuRow( const UnitArea& ctuArea, const PreCalcValues& pcv )
+{
+  const CompArea& blk = ctuArea.Y().valid() ? ctuArea.Y() : ctuArea.Cb();
+
+  return blk.lumaPos().y / pcv.maxCUHeight;
+}
+
+LutMotionCand& CodingStructure::getMotionLut( const UnitArea& ctuArea )
+{
+  if( nullptr == parent && !motionLutRows.empty() )
+  {
+    return motionLutRows[getCtuRow( ctuArea, *pcv )];
+  }
+  return motionLut;
+}
+
+const LutMotionCand& CodingStructure::getMotionLut( const UnitArea& ctuArea ) const
+{
+  if( nullptr == parent && !motionLutRows.empty() )
+  {
+    return motionLutRows[getCtuRow( ctuArea, *pcv )];
+  }
+  return motionLut;
+}
+
+PLTBuf& CodingStructure::getPrevPLT( const UnitArea& ctuArea )
+{
+#if ENABLE_WPP_PARALLELISM
+  if( nullptr == parent && !prevPLTRows.empty() )
+  {
+    return prevPLTRows[getCtuRow( ctuArea, *pcv )];
+  }
+#endif
+  return prevPLT;
+}
+
 void CodingStructure::resetPrevPLT(PLTBuf& prevPLT)
 {
   for (int comp = 0; comp < MAX_NUM_COMPONENT; comp++)
@@ -1008,9 +1032,9 @@ void CodingStructure::initSubStructure( CodingStructure& subStruct, const Channe
 
   subStruct.m_isTuEnc = isTuEnc;
 
-  subStruct.motionLut = motionLut;
+  subStruct.motionLut = getMotionLut( subArea );
 
-  subStruct.prevPLT = prevPLT;
+  subStruct.prevPLT = getPrevPLT( subArea );
 
   subStruct.treeType  = treeType;
   subStruct.modeType  = modeType;
@@ -1074,9 +1098,9 @@ void CodingStructure::useSubStructure( const CodingStructure& subStruct, const C
 
     ownMB.copyFrom( subMB );
 
-    motionLut = subStruct.motionLut;
+    getMotionLut( subArea ) = subStruct.motionLut;
   }
-  prevPLT = subStruct.prevPLT;
+  getPrevPLT( subArea ) = subStruct.prevPLT;
 
 #if ENABLE_WPP_PARALLELISM
 
@@ -1494,7 +1518,7 @@ PelBuf CodingStructure::getBuf( const CompArea &blk, const PictureType &type )
   cFinal.relativeTo( area.blocks[compID] );
 
 #if !KEEP_PRED_AND_RESI_SIGNALS
-  if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) )
+  if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) && picture->getCtuTempBuffers() )
   {
     cFinal.x &= ( pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
     cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
@@ -1528,7 +1552,7 @@ const CPelBuf CodingStructure::getBuf( const CompArea &blk, const PictureType &t
   cFinal.relativeTo( area.blocks[compID] );
 
 #if !KEEP_PRED_AND_RESI_SIGNALS
-  if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) )
+  if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) && picture->getCtuTempBuffers() )
   {
     cFinal.x &= ( pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
     cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
@@ -1567,14 +1591,15 @@ const CPelUnitBuf CodingStructure::getBuf( const UnitArea &unit, const PictureTy
 const CodingUnit* CodingStructure::getCURestricted( const Position &pos, const CodingUnit& curCu, const ChannelType _chType ) const
 {
   const CodingUnit* cu = getCU( pos, _chType );
-  // exists       same slice and tile                  cu precedes curCu in encoding order
-  //                                                  (thus, is either from parent CS in RD-search or its index is lower)
+  // exists       cu precedes curCu in encoding order                  same slice and tile
+  //              (thus, is either from parent CS in RD-search or its index is lower)
+  // the order is checked first, the units following curCu might still be parsed when the decoder reconstructs in parallel
   const bool wavefrontsEnabled = curCu.slice->getPPS()->getEntropyCodingSyncEnabledFlag();
   int ctuSizeBit = floorLog2(curCu.cs->sps->getMaxCUWidth());
   int xNbY  = pos.x << getChannelTypeScaleX( _chType, curCu.chromaFormat );
   int xCurr = curCu.blocks[_chType].x << getChannelTypeScaleX( _chType, curCu.chromaFormat );
   bool addCheck = (wavefrontsEnabled && (xNbY >> ctuSizeBit) >= (xCurr >> ctuSizeBit) + 1 ) ? false : true;
-  if( cu && CU::isSameSliceAndTile( *cu, curCu ) && ( cu->cs != curCu.cs || cu->idx <= curCu.idx ) && addCheck)
+  if( cu && ( cu->cs != curCu.cs || cu->idx <= curCu.idx ) && CU::isSameSliceAndTile( *cu, curCu ) && addCheck)
   {
     return cu;
   }
@@ -1598,14 +1623,14 @@ const CodingUnit* CodingStructure::getCURestricted( const Position &pos, const P
 const PredictionUnit* CodingStructure::getPURestricted( const Position &pos, const PredictionUnit& curPu, const ChannelType _chType ) const
 {
   const PredictionUnit* pu = getPU( pos, _chType );
-  // exists       same slice and tile                  pu precedes curPu in encoding order
-  //                                                  (thus, is either from parent CS in RD-search or its index is lower)
+  // exists       pu precedes curPu in encoding order                  same slice and tile
+  //              (thus, is either from parent CS in RD-search or its index is lower)
   const bool wavefrontsEnabled = curPu.cu->slice->getPPS()->getEntropyCodingSyncEnabledFlag();
   int ctuSizeBit = floorLog2(curPu.cs->sps->getMaxCUWidth());
   int xNbY  = pos.x << getChannelTypeScaleX( _chType, curPu.chromaFormat );
   int xCurr = curPu.blocks[_chType].x << getChannelTypeScaleX( _chType, curPu.chromaFormat );
   bool addCheck = (wavefrontsEnabled && (xNbY >> ctuSizeBit) >= (xCurr >> ctuSizeBit) + 1 ) ? false : true;
-  if( pu && CU::isSameSliceAndTile( *pu->cu, *curPu.cu ) && ( pu->cs != curPu.cs || pu->idx <= curPu.idx ) && addCheck )
+  if( pu && ( pu->cs != curPu.cs || pu->idx <= curPu.idx ) && CU::isSameSliceAndTile( *pu->cu, *curPu.cu ) && addCheck )
   {
     return pu;
   }
@@ -1618,14 +1643,14 @@ const PredictionUnit* CodingStructure::getPURestricted( const Position &pos, con
 const TransformUnit* CodingStructure::getTURestricted( const Position &pos, const TransformUnit& curTu, const ChannelType _chType ) const
 {
   const TransformUnit* tu = getTU( pos, _chType );
-  // exists       same slice and tile                  tu precedes curTu in encoding order
-  //                                                  (thus, is either from parent CS in RD-search or its index is lower)
+  // exists       tu precedes curTu in encoding order                  same slice and tile
+  //              (thus, is either from parent CS in RD-search or its index is lower)
   const bool wavefrontsEnabled = curTu.cu->slice->getPPS()->getEntropyCodingSyncEnabledFlag();
   int ctuSizeBit = floorLog2(curTu.cs->sps->getMaxCUWidth());
   int xNbY  = pos.x << getChannelTypeScaleX( _chType, curTu.chromaFormat );
   int xCurr = curTu.blocks[_chType].x << getChannelTypeScaleX( _chType, curTu.chromaFormat );
   bool addCheck = (wavefrontsEnabled && (xNbY >> ctuSizeBit) >= (xCurr >> ctuSizeBit) + 1 ) ? false : true;
-  if( tu && CU::isSameSliceAndTile( *tu->cu, *curTu.cu ) && ( tu->cs != curTu.cs || tu->idx <= curTu.idx ) && addCheck )
+  if( tu && ( tu->cs != curTu.cs || tu->idx <= curTu.idx ) && CU::isSameSliceAndTile( *tu->cu, *curTu.cu ) && addCheck )
   {
     return tu;
   }
@@ -64,8 +64,6 @@ enum PictureType
 };
 extern XUCache g_globalUnitCache;
 
-extern long long int timeOfTraverseTUs;
-
 // ---------------------------------------------------------------------------
 // coding structure
 // ---------------------------------------------------------------------------
@@ -203,6 +201,17 @@ public:
   PLTBuf prevPLT;
   void resetPrevPLT(PLTBuf& prevPLT);
   void reorderPrevPLT(PLTBuf& prevPLT, uint32_t curPLTSize[MAX_NUM_COMPONENT], Pel curPLT[MAX_NUM_COMPONENT][MAXPLTSIZE], bool reuseflag[MAX_NUM_COMPONENT][MAXPLTPREDSIZE], uint32_t compBegin, uint32_t numComp, bool jointPLT);
+
+  // HMVP table of each CTU row at the picture level, only allocated when the CTU rows are encoded or reconstructed in parallel
+  std::vector<LutMotionCand> motionLutRows;
+#if ENABLE_WPP_PARALLELISM
+  // palette predictor of each CTU row at the picture level, only allocated when the CTU rows are encoded in parallel
+  std::vector<PLTBuf>        prevPLTRows;
+#endif
+  // motionLut and prevPLT, or the ones of the CTU row when the rows are processed in parallel
+  LutMotionCand&       getMotionLut( const UnitArea& ctuArea );
+  const LutMotionCand& getMotionLut( const UnitArea& ctuArea ) const;
+  PLTBuf&              getPrevPLT  ( const UnitArea& ctuArea );
 private:
 
   // needed for TU encoding
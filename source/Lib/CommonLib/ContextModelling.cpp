@@ -39,17 +39,7 @@
 #include "UnitTools.h"
 #include "CodingStructure.h"
 #include "Picture.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-
-long long int timeOfCtxAffineFlag = 0;
-long long int timeOfCtxInterDir   = 0;
-
+#include "Profiler.h"
 
 CoeffCodingContext::CoeffCodingContext( const TransformUnit& tu, ComponentID component, bool signHide, bool bdpcm )
   : m_compID                    (component)
@@ -270,18 +260,15 @@ unsigned DeriveCtx::CtxQtCbf( const ComponentID compID, const bool prevCbf, cons
 
 unsigned DeriveCtx::CtxInterDir( const PredictionUnit& pu )
 {
-  auto     start  = high_resolution_clock::now();
+  PROFILE_ZONE( "DeriveCtx::CtxInterDir" );
   unsigned output = (7 - ((floorLog2(pu.lumaSize().width) + floorLog2(pu.lumaSize().height) + 1) >> 1));
   //unsigned output   = (7 - ((calculateSum(floorLog2(pu.lumaSize().width) , floorLog2(pu.lumaSize().height), 8, 7) + 1) >> 1));
-  auto     stop     = high_resolution_clock::now();
-  auto     duration = duration_cast<nanoseconds>(stop - start);
-  timeOfCtxInterDir = timeOfCtxInterDir + duration.count();
   return output;
 }
 
 unsigned DeriveCtx::CtxAffineFlag( const CodingUnit& cu )
 {
-  auto                   start = high_resolution_clock::now();
+  PROFILE_ZONE( "DeriveCtx::CtxAffineFlag" );
   const CodingStructure *cs = cu.cs;
   unsigned ctxId = 0;
 
@@ -291,12 +278,6 @@ unsigned DeriveCtx::CtxAffineFlag( const CodingUnit& cu )
   const CodingUnit *cuAbove = cs->getCURestricted( cu.lumaPos().offset( 0, -1 ), cu, CH_L );
   ctxId += ( cuAbove && cuAbove->affine ) ? 1 : 0;
 
-  
-
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfCtxAffineFlag      = timeOfCtxAffineFlag + duration.count();
-
   return ctxId;
 }
 unsigned DeriveCtx::CtxSkipFlag( const CodingUnit& cu )
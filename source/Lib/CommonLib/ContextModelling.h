@@ -47,10 +47,6 @@
 
 #include <bitset>
 
-extern long long int timeOfCtxAffineFlag;
-extern long long int timeOfCtxInterDir;
-
-
 struct CoeffCodingContext
 {
 public:
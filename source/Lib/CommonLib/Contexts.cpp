@@ -37,19 +37,11 @@
 
 #include "Contexts.h"
 #include "ApproximatAdderSubtraction.h"
+#include "Profiler.h"
 
 #include <algorithm>
 #include <cstring>
 #include <limits>
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-long long int timeOfBinProbModel_Std = 0;
-
 
 const uint8_t ProbModelTables::m_RenormTable_32[32] =
 {
@@ -131,7 +123,7 @@ const BinFracBits ProbModelTables::m_binFracBits[256] = {
 };
 void BinProbModel_Std::init( int qp, int initId )
 {
-  auto      start      = high_resolution_clock::now();
+  PROFILE_ZONE( "BinProbModel_Std::init" );
 
   int slope = (initId >> 3) - 4;
   int offset = ((initId & 7) * 18) + 1;
@@ -141,10 +133,6 @@ void BinProbModel_Std::init( int qp, int initId )
   const int p1 = (state_clip << 8);
   m_state[0]   = p1 & MASK_0;
   m_state[1]   = p1 & MASK_1;
-
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfBinProbModel_Std = timeOfBinProbModel_Std + duration.count();
 }
 
 
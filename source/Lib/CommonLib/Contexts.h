@@ -50,8 +50,6 @@ static constexpr int     MASK_0      = ~(~0u << PROB_BITS_0) << (PROB_BITS - PRO
 static constexpr int     MASK_1      = ~(~0u << PROB_BITS_1) << (PROB_BITS - PROB_BITS_1);
 static constexpr uint8_t DWS         = 8;   // 0x47 Default window sizes
 
-extern long long int timeOfBinProbModel_Std;
-
 struct BinFracBits
 {
   uint32_t intBits[2];
@@ -35,22 +35,9 @@
 #include "TrQuant.h"
 #include "CodingStructure.h"
 #include "UnitTools.h"
+#include "Profiler.h"
 
 #include <bitset>
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-
-long long int timeOfXSetGtxFlagBits = 0;
-long long int timeOfXSetSigFlagBits = 0;
-long long int timeOfXInitScanArrays = 0;
-
-
-
 
 namespace DQIntern
 {
@@ -60,49 +47,13 @@ namespace DQIntern
   /*=====                                                                      =====*/
   /*================================================================================*/
 
-  struct NbInfoSbb
-  {
-    uint8_t   num;
-    uint8_t   inPos[5];
-  };
   struct NbInfoOut
   {
     uint16_t  maxDist;
     uint16_t  num;
     uint16_t  outPos[5];
   };
-  struct CoeffFracBits
-  {
-    int32_t   bits[6];
-  };
-
-
-  enum ScanPosType { SCAN_ISCSBB = 0, SCAN_SOCSBB = 1, SCAN_EOCSBB = 2 };
 
-  struct ScanInfo
-  {
-    ScanInfo() {}
-    int           sbbSize;
-    int           numSbb;
-    int           scanIdx;
-    int           rasterPos;
-    int           sbbPos;
-    int           insidePos;
-    bool          eosbb;
-    ScanPosType   spt;
-    unsigned      sigCtxOffsetNext;
-    unsigned      gtxCtxOffsetNext;
-    int           nextInsidePos;
-    NbInfoSbb     nextNbInfoSbb;
-    int           nextSbbRight;
-    int           nextSbbBelow;
-    int           posX;
-    int           posY;
-    ChannelType   chType;
-    int           sbtInfo;
-    int           tuWidth;
-    int           tuHeight;
-  };
 
   class Rom;
   struct TUParameters
@@ -159,12 +110,9 @@ namespace DQIntern
 
   void Rom::xInitScanArrays()
   {
-    auto start = high_resolution_clock::now();
+    PROFILE_ZONE( "Rom::xInitScanArrays" );
     if( m_scansInitialized )
     {
-      auto stop                = high_resolution_clock::now();
-      auto duration            = duration_cast<nanoseconds>(stop - start);
-      timeOfXInitScanArrays    = timeOfXInitScanArrays + duration.count();
 
       return;
     }
@@ -313,10 +261,6 @@ namespace DQIntern
       }
     }
     m_scansInitialized = true;
-
-    auto stop             = high_resolution_clock::now();
-    auto duration         = duration_cast<nanoseconds>(stop - start);
-    timeOfXInitScanArrays = timeOfXInitScanArrays + duration.count();
   }
 
   void Rom::xUninitScanArrays()
@@ -573,7 +517,7 @@ namespace DQIntern
 
   void RateEstimator::xSetSigFlagBits( const FracBitsAccess& fracBitsAccess, ChannelType chType )
   {
-    auto start = high_resolution_clock::now();
+    PROFILE_ZONE( "RateEstimator::xSetSigFlagBits" );
     for( unsigned ctxSetId = 0; ctxSetId < sm_numCtxSetsSig; ctxSetId++ )
     {
       BinFracBits*    bits    = m_sigFracBits [ ctxSetId ];
@@ -584,14 +528,11 @@ namespace DQIntern
         bits[ ctxId ] = fracBitsAccess.getFracBitsArray( ctxSet( ctxId ) );
       }
     }
-    auto stop                    = high_resolution_clock::now();
-    auto duration                = duration_cast<nanoseconds>(stop - start);
-    timeOfXSetSigFlagBits        = timeOfXSetSigFlagBits + duration.count();
   }
 
   void RateEstimator::xSetGtxFlagBits( const FracBitsAccess& fracBitsAccess, ChannelType chType )
   {
-    auto            start       = high_resolution_clock::now();
+    PROFILE_ZONE( "RateEstimator::xSetGtxFlagBits" );
     const CtxSet&   ctxSetPar   = Ctx::ParFlag [     chType ];
     const CtxSet&   ctxSetGt1   = Ctx::GtxFlag [ 2 + chType ];
     const CtxSet&   ctxSetGt2   = Ctx::GtxFlag [     chType ];
@@ -611,10 +552,6 @@ namespace DQIntern
       cb.bits[4] = fbGt1.intBits[1] + par0 + fbGt2.intBits[1];
       cb.bits[5] = fbGt1.intBits[1] + par1 + fbGt2.intBits[1];
     }
-
-    auto stop                    = high_resolution_clock::now();
-    auto duration                = duration_cast<nanoseconds>(stop - start);
-    timeOfXSetGtxFlagBits        = timeOfXSetGtxFlagBits + duration.count();
   }
 
 
@@ -628,21 +565,6 @@ namespace DQIntern
   /*================================================================================*/
 
 
-  struct PQData
-  {
-    TCoeff  absLevel;
-    int64_t deltaDist;
-  };
-
-
-  struct Decision
-  {
-    int64_t rdCost;
-    TCoeff  absLevel;
-    int     prevId;
-  };
-
-
 
 
   /*================================================================================*/
@@ -831,12 +753,11 @@ namespace DQIntern
   /*=====                                                                      =====*/
   /*================================================================================*/
 
-  class State;
-
   struct SbbCtx
   {
     uint8_t*  sbbFlags;
     uint8_t*  levels;
+    uint16_t* ctxInit;
   };
 
   class CommonCtx
@@ -857,10 +778,13 @@ namespace DQIntern
       {
         m_allSbbCtx[k].sbbFlags = nextMem;
         m_allSbbCtx[k].levels   = nextMem + numSbb;
+        m_allSbbCtx[k].ctxInit  = m_ctxInitMemory[k];
       }
     }
 
-    inline void update(const ScanInfo &scanInfo, const State *prevState, State &currState);
+    inline void countRefs(const StateMem &prevStates, const StateMem &skipStates, const Decision *decisions);
+    inline void update(const ScanInfo &scanInfo, const StateMem *prevStates, const int prevId, const uint8_t *absLevels,
+                       StateMem &currStates, const int stateId, const int32_t initRemRegBins);
 
   private:
     const NbInfoOut*            m_nbInfo;
@@ -868,220 +792,128 @@ namespace DQIntern
     SbbCtx                      m_allSbbCtx  [8];
     SbbCtx*                     m_currSbbCtx;
     SbbCtx*                     m_prevSbbCtx;
+    int8_t                      m_numRefs[4];
     uint8_t                     m_memory[ 8 * ( MAX_TB_SIZEY * MAX_TB_SIZEY + MLS_GRP_NUM ) ];
+    uint16_t                    m_ctxInitMemory[8][16];
   };
 
+  const uint16_t g_zeroCtxInit[16] = { 0 };
+
 #define RICEMAX 32
-  const int32_t g_goRiceBits[4][RICEMAX] =
+  const int32_t g_goRiceBits[RICEMAX][4] =
   {
-    { 32768,  65536,  98304, 131072, 163840, 196608, 262144, 262144, 327680, 327680, 327680, 327680, 393216, 393216, 393216, 393216, 393216, 393216, 393216, 393216, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752},
-    { 65536,  65536,  98304,  98304, 131072, 131072, 163840, 163840, 196608, 196608, 229376, 229376, 294912, 294912, 294912, 294912, 360448, 360448, 360448, 360448, 360448, 360448, 360448, 360448, 425984, 425984, 425984, 425984, 425984, 425984, 425984, 425984},
-    { 98304,  98304,  98304,  98304, 131072, 131072, 131072, 131072, 163840, 163840, 163840, 163840, 196608, 196608, 196608, 196608, 229376, 229376, 229376, 229376, 262144, 262144, 262144, 262144, 327680, 327680, 327680, 327680, 327680, 327680, 327680, 327680},
-    {131072, 131072, 131072, 131072, 131072, 131072, 131072, 131072, 163840, 163840, 163840, 163840, 163840, 163840, 163840, 163840, 196608, 196608, 196608, 196608, 196608, 196608, 196608, 196608, 229376, 229376, 229376, 229376, 229376, 229376, 229376, 229376}
+    {  32768,  65536,  98304, 131072 },
+    {  65536,  65536,  98304, 131072 },
+    {  98304,  98304,  98304, 131072 },
+    { 131072,  98304,  98304, 131072 },
+    { 163840, 131072, 131072, 131072 },
+    { 196608, 131072, 131072, 131072 },
+    { 262144, 163840, 131072, 131072 },
+    { 262144, 163840, 131072, 131072 },
+    { 327680, 196608, 163840, 163840 },
+    { 327680, 196608, 163840, 163840 },
+    { 327680, 229376, 163840, 163840 },
+    { 327680, 229376, 163840, 163840 },
+    { 393216, 294912, 196608, 163840 },
+    { 393216, 294912, 196608, 163840 },
+    { 393216, 294912, 196608, 163840 },
+    { 393216, 294912, 196608, 163840 },
+    { 393216, 360448, 229376, 196608 },
+    { 393216, 360448, 229376, 196608 },
+    { 393216, 360448, 229376, 196608 },
+    { 393216, 360448, 229376, 196608 },
+    { 458752, 360448, 262144, 196608 },
+    { 458752, 360448, 262144, 196608 },
+    { 458752, 360448, 262144, 196608 },
+    { 458752, 360448, 262144, 196608 },
+    { 458752, 425984, 327680, 229376 },
+    { 458752, 425984, 327680, 229376 },
+    { 458752, 425984, 327680, 229376 },
+    { 458752, 425984, 327680, 229376 },
+    { 458752, 425984, 327680, 229376 },
+    { 458752, 425984, 327680, 229376 },
+    { 458752, 425984, 327680, 229376 },
+    { 458752, 425984, 327680, 229376 }
   };
 
-  class State
+  static inline void setSigFracBits( StateMem& states, const int stateId, const BinFracBits& fracBits )
   {
-    friend class CommonCtx;
-  public:
-    State( const RateEstimator& rateEst, CommonCtx& commonCtx, const int stateId );
-
-    template<uint8_t numIPos>
-    inline void updateState(const ScanInfo &scanInfo, const State *prevStates, const Decision &decision);
-    inline void updateStateEOS(const ScanInfo &scanInfo, const State *prevStates, const State *skipStates,
-                               const Decision &decision);
-
-    inline void init()
-    {
-      m_rdCost        = std::numeric_limits<int64_t>::max()>>1;
-      m_numSigSbb     = 0;
-      m_remRegBins    = 4;  // just large enough for last scan pos
-      m_refSbbCtxId   = -1;
-      m_sigFracBits   = m_sigFracBitsArray[ 0 ];
-      m_coeffFracBits = m_gtxFracBitsArray[ 0 ];
-      m_goRicePar     = 0;
-      m_goRiceZero    = 0;
-    }
-    void checkRdCosts( const ScanPosType spt, const PQData& pqDataA, const PQData& pqDataB, Decision& decisionA, Decision& decisionB ) const
-    {
-      const int32_t*  goRiceTab = g_goRiceBits[m_goRicePar];
-      int64_t         rdCostA   = m_rdCost + pqDataA.deltaDist;
-      int64_t         rdCostB   = m_rdCost + pqDataB.deltaDist;
-      int64_t         rdCostZ   = m_rdCost;
-        if( m_remRegBins >= 4 )
-        {
-          if( pqDataA.absLevel < 4 )
-            rdCostA += m_coeffFracBits.bits[ pqDataA.absLevel ];
-          else
-          {
-            const unsigned value = ( pqDataA.absLevel - 4 ) >> 1;
-            rdCostA += m_coeffFracBits.bits[ pqDataA.absLevel - ( value << 1 ) ] + goRiceTab[ value < RICEMAX ? value : RICEMAX - 1 ];
-          }
-          if( pqDataB.absLevel < 4 )
-            rdCostB += m_coeffFracBits.bits[ pqDataB.absLevel ];
-          else
-          {
-            const unsigned value = ( pqDataB.absLevel - 4 ) >> 1;
-            rdCostB += m_coeffFracBits.bits[ pqDataB.absLevel - ( value << 1 ) ] + goRiceTab[ value < RICEMAX ? value : RICEMAX - 1 ];
-          }
-          if( spt == SCAN_ISCSBB )
-          {
-            rdCostA += m_sigFracBits.intBits[ 1 ];
-            rdCostB += m_sigFracBits.intBits[ 1 ];
-            rdCostZ += m_sigFracBits.intBits[ 0 ];
-          }
-          else if( spt == SCAN_SOCSBB )
-          {
-            rdCostA += m_sbbFracBits.intBits[ 1 ] + m_sigFracBits.intBits[ 1 ];
-            rdCostB += m_sbbFracBits.intBits[ 1 ] + m_sigFracBits.intBits[ 1 ];
-            rdCostZ += m_sbbFracBits.intBits[ 1 ] + m_sigFracBits.intBits[ 0 ];
-          }
-          else if( m_numSigSbb )
-          {
-            rdCostA += m_sigFracBits.intBits[ 1 ];
-            rdCostB += m_sigFracBits.intBits[ 1 ];
-            rdCostZ += m_sigFracBits.intBits[ 0 ];
-          }
-          else
-          {
-            rdCostZ = decisionA.rdCost;
-          }
-        }
-        else
-        {
-          rdCostA += ( 1 << SCALE_BITS ) + goRiceTab[ pqDataA.absLevel <= m_goRiceZero ? pqDataA.absLevel - 1 : ( pqDataA.absLevel < RICEMAX ? pqDataA.absLevel : RICEMAX - 1 ) ];
-          rdCostB += ( 1 << SCALE_BITS ) + goRiceTab[ pqDataB.absLevel <= m_goRiceZero ? pqDataB.absLevel - 1 : ( pqDataB.absLevel < RICEMAX ? pqDataB.absLevel : RICEMAX - 1 ) ];
-          rdCostZ += goRiceTab[ m_goRiceZero ];
-        }
-        if( rdCostA < decisionA.rdCost )
-        {
-          decisionA.rdCost = rdCostA;
-          decisionA.absLevel = pqDataA.absLevel;
-          decisionA.prevId = m_stateId;
-        }
-        if( rdCostZ < decisionA.rdCost )
-        {
-          decisionA.rdCost = rdCostZ;
-          decisionA.absLevel = 0;
-          decisionA.prevId = m_stateId;
-        }
-        if( rdCostB < decisionB.rdCost )
-        {
-          decisionB.rdCost = rdCostB;
-          decisionB.absLevel = pqDataB.absLevel;
-          decisionB.prevId = m_stateId;
-        }
-      }
-
-    inline void checkRdCostStart(int32_t lastOffset, const PQData &pqData, Decision &decision) const
-    {
-      int64_t rdCost = pqData.deltaDist + lastOffset;
-      if (pqData.absLevel < 4)
-      {
-        rdCost += m_coeffFracBits.bits[pqData.absLevel];
-      }
-      else
-      {
-        const unsigned value = (pqData.absLevel - 4) >> 1;
-        rdCost += m_coeffFracBits.bits[pqData.absLevel - (value << 1)] + g_goRiceBits[m_goRicePar][value < RICEMAX ? value : RICEMAX-1];
-      }
-      if( rdCost < decision.rdCost )
-      {
-        decision.rdCost   = rdCost;
-        decision.absLevel = pqData.absLevel;
-        decision.prevId   = -1;
-      }
-    }
+    states.sigBits[0][stateId] = fracBits.intBits[0];
+    states.sigBits[1][stateId] = fracBits.intBits[1];
+  }
 
-    inline void checkRdCostSkipSbb(Decision &decision) const
+  static inline void setCoeffFracBits( StateMem& states, const int stateId, const CoeffFracBits& fracBits )
+  {
+    for( int k = 0; k < 6; k++ )
     {
-      int64_t rdCost = m_rdCost + m_sbbFracBits.intBits[0];
-      if( rdCost < decision.rdCost )
-      {
-        decision.rdCost   = rdCost;
-        decision.absLevel = 0;
-        decision.prevId   = 4+m_stateId;
-      }
+      states.coeffBits[k][stateId] = fracBits.bits[k];
     }
+  }
 
-    inline void checkRdCostSkipSbbZeroOut(Decision &decision) const
+  static inline void initStates( StateMem& states, const StateRateTabs& rateTabs )
+  {
+    for( int stateId = 0; stateId < 4; stateId++ )
     {
-      int64_t rdCost = m_rdCost + m_sbbFracBits.intBits[0];
-      decision.rdCost = rdCost;
-      decision.absLevel = 0;
-      decision.prevId = 4 + m_stateId;
+      states.rdCost     [stateId] = std::numeric_limits<int64_t>::max()>>1;
+      states.numSigSbb  [stateId] = 0;
+      states.remRegBins [stateId] = 4;  // just large enough for last scan pos
+      states.refSbbCtxId[stateId] = -1;
+      states.ctxInit    [stateId] = g_zeroCtxInit;
+      setSigFracBits  ( states, stateId, rateTabs.sigFracBits[stateId][0] );
+      setCoeffFracBits( states, stateId, rateTabs.gtxFracBits[0] );
+      states.goRicePar  [stateId] = 0;
+      states.goRiceZero [stateId] = 0;
     }
-
-  private:
-    int64_t                   m_rdCost;
-    uint16_t                  m_absLevelsAndCtxInit[24];  // 16x8bit for abs levels + 16x16bit for ctx init id
-    int8_t                    m_numSigSbb;
-    int                       m_remRegBins;
-    int8_t                    m_refSbbCtxId;
-    BinFracBits               m_sbbFracBits;
-    BinFracBits               m_sigFracBits;
-    CoeffFracBits             m_coeffFracBits;
-    int8_t                    m_goRicePar;
-    int8_t                    m_goRiceZero;
-    const int8_t              m_stateId;
-    const BinFracBits*const   m_sigFracBitsArray;
-    const CoeffFracBits*const m_gtxFracBitsArray;
-    const uint32_t*const      m_goRiceZeroArray;
-    CommonCtx&                m_commonCtx;
-  public:
-    unsigned                  effWidth;
-    unsigned                  effHeight;
-  };
-
-
-  State::State( const RateEstimator& rateEst, CommonCtx& commonCtx, const int stateId )
-    : m_sbbFracBits     { { 0, 0 } }
-    , m_stateId         ( stateId )
-    , m_sigFracBitsArray( rateEst.sigFlagBits(stateId) )
-    , m_gtxFracBitsArray( rateEst.gtxFracBits(stateId) )
-    , m_goRiceZeroArray ( g_auiGoRicePosCoeff0[std::max(0,stateId-1)] )
-    , m_commonCtx       ( commonCtx )
-  {
   }
 
   template<uint8_t numIPos>
-  inline void State::updateState(const ScanInfo &scanInfo, const State *prevStates, const Decision &decision)
+  static inline void updateState( const ScanInfo& scanInfo, const StateRateTabs& rateTabs, const StateMem& prevStates, StateMem& currStates,
+                                  const int stateId, const Decision& decision )
   {
-    m_rdCost = decision.rdCost;
+    currStates.rdCost[stateId] = decision.rdCost;
     if( decision.prevId > -2 )
     {
+      int32_t& remRegBins = currStates.remRegBins[stateId];
       if( decision.prevId >= 0 )
       {
-        const State*  prvState  = prevStates            +   decision.prevId;
-        m_numSigSbb             = prvState->m_numSigSbb + !!decision.absLevel;
-        m_refSbbCtxId           = prvState->m_refSbbCtxId;
-        m_sbbFracBits           = prvState->m_sbbFracBits;
-        m_remRegBins            = prvState->m_remRegBins - 1;
-        m_goRicePar             = prvState->m_goRicePar;
-        if( m_remRegBins >= 4 )
+        const int prvId                 = decision.prevId;
+        currStates.numSigSbb  [stateId] = prevStates.numSigSbb[prvId] + !!decision.absLevel;
+        currStates.refSbbCtxId[stateId] = prevStates.refSbbCtxId[prvId];
+        currStates.ctxInit    [stateId] = prevStates.ctxInit[prvId];
+        currStates.sbbBits [0][stateId] = prevStates.sbbBits[0][prvId];
+        currStates.sbbBits [1][stateId] = prevStates.sbbBits[1][prvId];
+        currStates.goRicePar  [stateId] = prevStates.goRicePar[prvId];
+        remRegBins                      = prevStates.remRegBins[prvId] - 1;
+        if( remRegBins >= 4 )
         {
-          m_remRegBins -= (decision.absLevel < 2 ? decision.absLevel : 3);
+          remRegBins -= (decision.absLevel < 2 ? decision.absLevel : 3);
+        }
+        for( int k = 0; k < 16; k++ )
+        {
+          currStates.absLevels[k][stateId] = prevStates.absLevels[k][prvId];
         }
-        ::memcpy( m_absLevelsAndCtxInit, prvState->m_absLevelsAndCtxInit, 48*sizeof(uint8_t) );
       }
       else
       {
-        m_numSigSbb     =  1;
-        m_refSbbCtxId   = -1;
-        int ctxBinSampleRatio = (scanInfo.chType == CHANNEL_TYPE_LUMA) ? MAX_TU_LEVEL_CTX_CODED_BIN_CONSTRAINT_LUMA : MAX_TU_LEVEL_CTX_CODED_BIN_CONSTRAINT_CHROMA;
-        m_remRegBins = (effWidth * effHeight *ctxBinSampleRatio) / 16 - (decision.absLevel < 2 ? decision.absLevel : 3);
-        ::memset( m_absLevelsAndCtxInit, 0, 48*sizeof(uint8_t) );
+        currStates.numSigSbb  [stateId] =  1;
+        currStates.refSbbCtxId[stateId] = -1;
+        currStates.ctxInit    [stateId] = g_zeroCtxInit;
+        remRegBins                      = rateTabs.initRemRegBins - (decision.absLevel < 2 ? decision.absLevel : 3);
+        for( int k = 0; k < 16; k++ )
+        {
+          currStates.absLevels[k][stateId] = 0;
+        }
       }
 
-      uint8_t* levels               = reinterpret_cast<uint8_t*>(m_absLevelsAndCtxInit);
-      levels[ scanInfo.insidePos ]  = (uint8_t)std::min<TCoeff>( 255, decision.absLevel );
+      currStates.absLevels[ scanInfo.insidePos ][stateId] = (uint8_t)std::min<TCoeff>( 255, decision.absLevel );
 
-      if (m_remRegBins >= 4)
+      const uint16_t* ctxInit = currStates.ctxInit[stateId];
+      if (remRegBins >= 4)
       {
-        TCoeff  tinit = m_absLevelsAndCtxInit[8 + scanInfo.nextInsidePos];
+        TCoeff  tinit = ctxInit[scanInfo.nextInsidePos];
         TCoeff  sumAbs1 = (tinit >> 3) & 31;
         TCoeff  sumNum = tinit & 7;
-#define UPDATE(k) {TCoeff t=levels[scanInfo.nextNbInfoSbb.inPos[k]]; sumAbs1+=std::min<TCoeff>(4+(t&1),t); sumNum+=!!t; }
+#define UPDATE(k) {TCoeff t=currStates.absLevels[scanInfo.nextNbInfoSbb.inPos[k]][stateId]; sumAbs1+=std::min<TCoeff>(4+(t&1),t); sumNum+=!!t; }
         if (numIPos == 1)
         {
           UPDATE(0);
@@ -1114,11 +946,11 @@ namespace DQIntern
         }
 #undef UPDATE
         TCoeff sumGt1 = sumAbs1 - sumNum;
-        m_sigFracBits = m_sigFracBitsArray[scanInfo.sigCtxOffsetNext + std::min( (sumAbs1+1)>>1, 3 )];
-        m_coeffFracBits = m_gtxFracBitsArray[scanInfo.gtxCtxOffsetNext + (sumGt1 < 4 ? sumGt1 : 4)];
+        setSigFracBits  ( currStates, stateId, rateTabs.sigFracBits[stateId][scanInfo.sigCtxOffsetNext + std::min( (sumAbs1+1)>>1, 3 )] );
+        setCoeffFracBits( currStates, stateId, rateTabs.gtxFracBits[scanInfo.gtxCtxOffsetNext + (sumGt1 < 4 ? sumGt1 : 4)] );
 
-        TCoeff  sumAbs = m_absLevelsAndCtxInit[8 + scanInfo.nextInsidePos] >> 8;
-#define UPDATE(k) {TCoeff t=levels[scanInfo.nextNbInfoSbb.inPos[k]]; sumAbs+=t; }
+        TCoeff  sumAbs = ctxInit[scanInfo.nextInsidePos] >> 8;
+#define UPDATE(k) {TCoeff t=currStates.absLevels[scanInfo.nextNbInfoSbb.inPos[k]][stateId]; sumAbs+=t; }
         if (numIPos == 1)
         {
           UPDATE(0);
@@ -1151,12 +983,12 @@ namespace DQIntern
         }
 #undef UPDATE
         int sumAll = std::max(std::min(31, (int)sumAbs - 4 * 5), 0);
-        m_goRicePar = g_auiGoRiceParsCoeff[sumAll];
+        currStates.goRicePar[stateId] = g_auiGoRiceParsCoeff[sumAll];
       }
       else
       {
-        TCoeff  sumAbs = m_absLevelsAndCtxInit[8 + scanInfo.nextInsidePos] >> 8;
-#define UPDATE(k) {TCoeff t=levels[scanInfo.nextNbInfoSbb.inPos[k]]; sumAbs+=t; }
+        TCoeff  sumAbs = ctxInit[scanInfo.nextInsidePos] >> 8;
+#define UPDATE(k) {TCoeff t=currStates.absLevels[scanInfo.nextNbInfoSbb.inPos[k]][stateId]; sumAbs+=t; }
         if (numIPos == 1)
         {
           UPDATE(0);
@@ -1189,93 +1021,79 @@ namespace DQIntern
         }
 #undef UPDATE
         sumAbs = std::min<TCoeff>(31, sumAbs);
-        m_goRicePar = g_auiGoRiceParsCoeff[sumAbs];
-        m_goRiceZero = m_goRiceZeroArray[sumAbs];
+        currStates.goRicePar [stateId] = g_auiGoRiceParsCoeff[sumAbs];
+        currStates.goRiceZero[stateId] = rateTabs.goRiceZero[stateId][sumAbs];
       }
     }
   }
 
-  inline void State::updateStateEOS(const ScanInfo &scanInfo, const State *prevStates, const State *skipStates,
-                                    const Decision &decision)
+  template<uint8_t numIPos>
+  static inline void updateStates( const ScanInfo& scanInfo, const StateRateTabs& rateTabs, const StateMem& prevStates, StateMem& currStates,
+                                   const Decision* decisions )
   {
-    m_rdCost = decision.rdCost;
-    if( decision.prevId > -2 )
+    updateState<numIPos>( scanInfo, rateTabs, prevStates, currStates, 0, decisions[0] );
+    updateState<numIPos>( scanInfo, rateTabs, prevStates, currStates, 1, decisions[1] );
+    updateState<numIPos>( scanInfo, rateTabs, prevStates, currStates, 2, decisions[2] );
+    updateState<numIPos>( scanInfo, rateTabs, prevStates, currStates, 3, decisions[3] );
+  }
+
+  inline void CommonCtx::countRefs(const StateMem &prevStates, const StateMem &skipStates, const Decision *decisions)
+  {
+    ::memset( m_numRefs, 0, sizeof( m_numRefs ) );
+    for( int k = 0; k < 4; k++ )
     {
-      const State* prvState = 0;
-      if( decision.prevId  >= 4 )
+      const int prevId      = decisions[k].prevId;
+      const int refSbbCtxId = ( prevId >= 4 ? skipStates.refSbbCtxId[prevId - 4] : prevId >= 0 ? prevStates.refSbbCtxId[prevId] : -1 );
+      if( refSbbCtxId >= 0 )
       {
-        CHECK( decision.absLevel != 0, "cannot happen" );
-        prvState    = skipStates + ( decision.prevId - 4 );
-        m_numSigSbb = 0;
-        ::memset( m_absLevelsAndCtxInit, 0, 16*sizeof(uint8_t) );
+        m_numRefs[ refSbbCtxId ]++;
       }
-      else if( decision.prevId  >= 0 )
-      {
-        prvState    = prevStates            +   decision.prevId;
-        m_numSigSbb = prvState->m_numSigSbb + !!decision.absLevel;
-        ::memcpy( m_absLevelsAndCtxInit, prvState->m_absLevelsAndCtxInit, 16*sizeof(uint8_t) );
-      }
-      else
-      {
-        m_numSigSbb = 1;
-        ::memset( m_absLevelsAndCtxInit, 0, 16*sizeof(uint8_t) );
-      }
-      reinterpret_cast<uint8_t*>(m_absLevelsAndCtxInit)[ scanInfo.insidePos ] = (uint8_t)std::min<TCoeff>( 255, decision.absLevel );
-
-      m_commonCtx.update( scanInfo, prvState, *this );
-
-      TCoeff  tinit   = m_absLevelsAndCtxInit[ 8 + scanInfo.nextInsidePos ];
-      TCoeff  sumNum  =   tinit        & 7;
-      TCoeff  sumAbs1 = ( tinit >> 3 ) & 31;
-      TCoeff  sumGt1  = sumAbs1        - sumNum;
-      m_sigFracBits   = m_sigFracBitsArray[ scanInfo.sigCtxOffsetNext + std::min( (sumAbs1+1)>>1, 3 ) ];
-      m_coeffFracBits = m_gtxFracBitsArray[ scanInfo.gtxCtxOffsetNext + ( sumGt1  < 4 ? sumGt1  : 4 ) ];
     }
   }
 
-  inline void CommonCtx::update(const ScanInfo &scanInfo, const State *prevState, State &currState)
+  inline void CommonCtx::update(const ScanInfo &scanInfo, const StateMem *prevStates, const int prevId, const uint8_t *absLevels,
+                                StateMem &currStates, const int stateId, const int32_t initRemRegBins)
   {
-    uint8_t*    sbbFlags  = m_currSbbCtx[ currState.m_stateId ].sbbFlags;
-    uint8_t*    levels    = m_currSbbCtx[ currState.m_stateId ].levels;
-    std::size_t setCpSize = m_nbInfo[ scanInfo.scanIdx - 1 ].maxDist * sizeof(uint8_t);
-    if( prevState && prevState->m_refSbbCtxId >= 0 )
+    const int refSbbCtxId = ( prevStates ? prevStates->refSbbCtxId[prevId] : -1 );
+    if( refSbbCtxId >= 0 && --m_numRefs[ refSbbCtxId ] == 0 )
     {
-      ::memcpy( sbbFlags,                  m_prevSbbCtx[prevState->m_refSbbCtxId].sbbFlags,                  scanInfo.numSbb*sizeof(uint8_t) );
-      ::memcpy( levels + scanInfo.scanIdx, m_prevSbbCtx[prevState->m_refSbbCtxId].levels + scanInfo.scanIdx, setCpSize );
+      // the last state referring to a context set takes it over, the sets are swapped instead of copied
+      std::swap( m_currSbbCtx[ stateId ], m_prevSbbCtx[ refSbbCtxId ] );
     }
-    else
+    uint8_t*    sbbFlags  = m_currSbbCtx[ stateId ].sbbFlags;
+    uint8_t*    levels    = m_currSbbCtx[ stateId ].levels;
+    std::size_t setCpSize = m_nbInfo[ scanInfo.scanIdx - 1 ].maxDist * sizeof(uint8_t);
+    if( refSbbCtxId < 0 )
     {
       ::memset( sbbFlags,                  0, scanInfo.numSbb*sizeof(uint8_t) );
       ::memset( levels + scanInfo.scanIdx, 0, setCpSize );
     }
-    sbbFlags[ scanInfo.sbbPos ] = !!currState.m_numSigSbb;
-    ::memcpy( levels + scanInfo.scanIdx, currState.m_absLevelsAndCtxInit, scanInfo.sbbSize*sizeof(uint8_t) );
-
-    const int       sigNSbb   = ( ( scanInfo.nextSbbRight ? sbbFlags[ scanInfo.nextSbbRight ] : false ) || ( scanInfo.nextSbbBelow ? sbbFlags[ scanInfo.nextSbbBelow ] : false ) ? 1 : 0 );
-    currState.m_numSigSbb     = 0;
-    if (prevState)
+    else if( m_numRefs[ refSbbCtxId ] )
     {
-      currState.m_remRegBins = prevState->m_remRegBins;
+      ::memcpy( sbbFlags,                  m_prevSbbCtx[refSbbCtxId].sbbFlags,                  scanInfo.numSbb*sizeof(uint8_t) );
+      ::memcpy( levels + scanInfo.scanIdx, m_prevSbbCtx[refSbbCtxId].levels + scanInfo.scanIdx, setCpSize );
     }
-    else
-    {
-      int ctxBinSampleRatio = (scanInfo.chType == CHANNEL_TYPE_LUMA) ? MAX_TU_LEVEL_CTX_CODED_BIN_CONSTRAINT_LUMA : MAX_TU_LEVEL_CTX_CODED_BIN_CONSTRAINT_CHROMA;
-      currState.m_remRegBins = (currState.effWidth * currState.effHeight *ctxBinSampleRatio) / 16;
-    }
-    currState.m_goRicePar     = 0;
-    currState.m_refSbbCtxId   = currState.m_stateId;
-    currState.m_sbbFracBits   = m_sbbFlagBits[ sigNSbb ];
+    sbbFlags[ scanInfo.sbbPos ] = !!currStates.numSigSbb[ stateId ];
+    ::memcpy( levels + scanInfo.scanIdx, absLevels, scanInfo.sbbSize*sizeof(uint8_t) );
 
-    uint16_t          templateCtxInit[16];
+    const int       sigNSbb   = ( ( scanInfo.nextSbbRight ? sbbFlags[ scanInfo.nextSbbRight ] : false ) || ( scanInfo.nextSbbBelow ? sbbFlags[ scanInfo.nextSbbBelow ] : false ) ? 1 : 0 );
+    currStates.numSigSbb  [stateId] = 0;
+    currStates.remRegBins [stateId] = ( prevStates ? prevStates->remRegBins[prevId] : initRemRegBins );
+    currStates.goRicePar  [stateId] = 0;
+    currStates.refSbbCtxId[stateId] = stateId;
+    currStates.sbbBits [0][stateId] = m_sbbFlagBits[ sigNSbb ].intBits[0];
+    currStates.sbbBits [1][stateId] = m_sbbFlagBits[ sigNSbb ].intBits[1];
+
+    uint16_t*         templateCtxInit = m_currSbbCtx[ stateId ].ctxInit;
     const int         scanBeg   = scanInfo.scanIdx - scanInfo.sbbSize;
     const NbInfoOut*  nbOut     = m_nbInfo + scanBeg;
-    const uint8_t*    absLevels = levels   + scanBeg;
+    const uint8_t*    sbbLevels = levels   + scanBeg;
     for( int id = 0; id < scanInfo.sbbSize; id++, nbOut++ )
     {
       if( nbOut->num )
       {
         TCoeff sumAbs = 0, sumAbs1 = 0, sumNum = 0;
-#define UPDATE(k) {TCoeff t=absLevels[nbOut->outPos[k]]; sumAbs+=t; sumAbs1+=std::min<TCoeff>(4+(t&1),t); sumNum+=!!t; }
+#define UPDATE(k) {TCoeff t=sbbLevels[nbOut->outPos[k]]; sumAbs+=t; sumAbs1+=std::min<TCoeff>(4+(t&1),t); sumNum+=!!t; }
         UPDATE(0);
         if( nbOut->num > 1 )
         {
@@ -1301,8 +1119,106 @@ namespace DQIntern
         templateCtxInit[id] = 0;
       }
     }
-    ::memset( currState.m_absLevelsAndCtxInit,     0,               16*sizeof(uint8_t) );
-    ::memcpy( currState.m_absLevelsAndCtxInit + 8, templateCtxInit, 16*sizeof(uint16_t) );
+    for( int k = 0; k < 16; k++ )
+    {
+      currStates.absLevels[k][stateId] = 0;
+    }
+    currStates.ctxInit[stateId] = templateCtxInit;
+  }
+
+
+
+  static inline void checkRdCostsState( const StateMem& states, const int8_t stateId, const ScanPosType spt, const PQData& pqDataA, const PQData& pqDataB, Decision& decisionA, Decision& decisionB )
+  {
+    const int       goRicePar = states.goRicePar[stateId];
+    int64_t         rdCostA   = states.rdCost[stateId] + pqDataA.deltaDist;
+    int64_t         rdCostB   = states.rdCost[stateId] + pqDataB.deltaDist;
+    int64_t         rdCostZ   = states.rdCost[stateId];
+    if( states.remRegBins[stateId] >= 4 )
+    {
+      if( pqDataA.absLevel < 4 )
+        rdCostA += states.coeffBits[ pqDataA.absLevel ][stateId];
+      else
+      {
+        const unsigned value = ( pqDataA.absLevel - 4 ) >> 1;
+        rdCostA += states.coeffBits[ pqDataA.absLevel - ( value << 1 ) ][stateId] + g_goRiceBits[ value < RICEMAX ? value : RICEMAX - 1 ][goRicePar];
+      }
+      if( pqDataB.absLevel < 4 )
+        rdCostB += states.coeffBits[ pqDataB.absLevel ][stateId];
+      else
+      {
+        const unsigned value = ( pqDataB.absLevel - 4 ) >> 1;
+        rdCostB += states.coeffBits[ pqDataB.absLevel - ( value << 1 ) ][stateId] + g_goRiceBits[ value < RICEMAX ? value : RICEMAX - 1 ][goRicePar];
+      }
+      if( spt == SCAN_ISCSBB )
+      {
+        rdCostA += states.sigBits[1][stateId];
+        rdCostB += states.sigBits[1][stateId];
+        rdCostZ += states.sigBits[0][stateId];
+      }
+      else if( spt == SCAN_SOCSBB )
+      {
+        rdCostA += states.sbbBits[1][stateId] + states.sigBits[1][stateId];
+        rdCostB += states.sbbBits[1][stateId] + states.sigBits[1][stateId];
+        rdCostZ += states.sbbBits[1][stateId] + states.sigBits[0][stateId];
+      }
+      else if( states.numSigSbb[stateId] )
+      {
+        rdCostA += states.sigBits[1][stateId];
+        rdCostB += states.sigBits[1][stateId];
+        rdCostZ += states.sigBits[0][stateId];
+      }
+      else
+      {
+        rdCostZ = decisionA.rdCost;
+      }
+    }
+    else
+    {
+      const int goRiceZero = states.goRiceZero[stateId];
+      rdCostA += ( 1 << SCALE_BITS ) + g_goRiceBits[ pqDataA.absLevel <= goRiceZero ? pqDataA.absLevel - 1 : ( pqDataA.absLevel < RICEMAX ? pqDataA.absLevel : RICEMAX - 1 ) ][goRicePar];
+      rdCostB += ( 1 << SCALE_BITS ) + g_goRiceBits[ pqDataB.absLevel <= goRiceZero ? pqDataB.absLevel - 1 : ( pqDataB.absLevel < RICEMAX ? pqDataB.absLevel : RICEMAX - 1 ) ][goRicePar];
+      rdCostZ += g_goRiceBits[ goRiceZero ][goRicePar];
+    }
+    if( rdCostA < decisionA.rdCost )
+    {
+      decisionA.rdCost   = rdCostA;
+      decisionA.absLevel = pqDataA.absLevel;
+      decisionA.prevId   = stateId;
+    }
+    if( rdCostZ < decisionA.rdCost )
+    {
+      decisionA.rdCost   = rdCostZ;
+      decisionA.absLevel = 0;
+      decisionA.prevId   = stateId;
+    }
+    if( rdCostB < decisionB.rdCost )
+    {
+      decisionB.rdCost   = rdCostB;
+      decisionB.absLevel = pqDataB.absLevel;
+      decisionB.prevId   = stateId;
+    }
+  }
+
+  static inline void checkRdCostSkipSbb( const StateMem& states, const int8_t stateId, Decision& decision )
+  {
+    int64_t rdCost = states.rdCost[stateId] + states.sbbBits[0][stateId];
+    if( rdCost < decision.rdCost )
+    {
+      decision.rdCost   = rdCost;
+      decision.absLevel = 0;
+      decision.prevId   = 4+stateId;
+    }
+  }
+
+  static inline void checkRdCostStart( const int64_t rdCost, const PQData& pqData, Decision& decision )
+  {
+    if( rdCost < decision.rdCost )
+    {
+      decision.rdCost   = rdCost;
+      decision.absLevel = pqData.absLevel;
+      decision.prevId   = -1;
+    }
   }
 
 
@@ -1315,7 +1231,8 @@ namespace DQIntern
   class DepQuant : private RateEstimator
   {
   public:
-    DepQuant();
+    DepQuant( void ( *checkRdCosts )( const StateMem&, const StateMem&, const PQData*, const ScanPosType, const int64_t*, Decision* ),
+              void ( *updateStates )( const ScanInfo&, const StateRateTabs&, const StateMem&, StateMem&, const Decision* ) );
 
     void    quant   ( TransformUnit& tu, const CCoeffBuf& srcCoeff, const ComponentID compID, const QpParam& cQP, const double lambda, const Ctx& ctx, TCoeff& absSum, bool enableScalingLists, int* quantCoeff );
     void    dequant ( const TransformUnit& tu, CoeffBuf& recCoeff, const ComponentID compID, const QpParam& cQP, bool enableScalingLists, int* quantCoeff );
@@ -1323,30 +1240,42 @@ namespace DQIntern
   private:
     void    xDecideAndUpdate  ( const TCoeff absCoeff, const ScanInfo& scanInfo, bool zeroOut, int quantCoeff);
     void    xDecide           ( const ScanPosType spt, const TCoeff absCoeff, const int lastOffset, Decision* decisions, bool zeroOut, int quantCoeff );
+    void    xUpdateStateEOS   ( const ScanInfo& scanInfo, const int stateId, const Decision& decision );
+    int64_t xRdCostStart      ( const int32_t lastOffset, const PQData& pqData ) const;
 
   private:
-    CommonCtx   m_commonCtx;
-    State       m_allStates[ 12 ];
-    State*      m_currStates;
-    State*      m_prevStates;
-    State*      m_skipStates;
-    State       m_startState;
-    Quantizer   m_quant;
-    Decision    m_trellis[ MAX_TB_SIZEY * MAX_TB_SIZEY ][ 8 ];
+    CommonCtx     m_commonCtx;
+    StateMem      m_allStates[ 3 ];
+    StateMem*     m_currStates;
+    StateMem*     m_prevStates;
+    StateMem*     m_skipStates;
+    StateRateTabs m_rateTabs;
+    Quantizer     m_quant;
+    Decision      m_trellis[ MAX_TB_SIZEY * MAX_TB_SIZEY ][ 8 ];
+    void          ( *m_checkRdCosts )( const StateMem&, const StateMem&, const PQData*, const ScanPosType, const int64_t*, Decision* );
+    void          ( *m_updateStates )( const ScanInfo&, const StateRateTabs&, const StateMem&, StateMem&, const Decision* );
   };
 
 
-#define TINIT(x) {*this,m_commonCtx,x}
-  DepQuant::DepQuant()
+  DepQuant::DepQuant( void ( *checkRdCosts )( const StateMem&, const StateMem&, const PQData*, const ScanPosType, const int64_t*, Decision* ),
+                      void ( *updateStates )( const ScanInfo&, const StateRateTabs&, const StateMem&, StateMem&, const Decision* ) )
     : RateEstimator ()
     , m_commonCtx   ()
-    , m_allStates   {TINIT(0),TINIT(1),TINIT(2),TINIT(3),TINIT(0),TINIT(1),TINIT(2),TINIT(3),TINIT(0),TINIT(1),TINIT(2),TINIT(3)}
     , m_currStates  (  m_allStates      )
-    , m_prevStates  (  m_currStates + 4 )
-    , m_skipStates  (  m_prevStates + 4 )
-    , m_startState  TINIT(0)
-  {}
-#undef TINIT
+    , m_prevStates  (  m_currStates + 1 )
+    , m_skipStates  (  m_prevStates + 1 )
+    , m_checkRdCosts( checkRdCosts )
+    , m_updateStates( updateStates )
+  {
+    ::memset( m_allStates, 0, sizeof( m_allStates ) );
+    for( int stateId = 0; stateId < 4; stateId++ )
+    {
+      m_rateTabs.sigFracBits[stateId] = sigFlagBits( stateId );
+      m_rateTabs.goRiceZero [stateId] = g_auiGoRicePosCoeff0[ std::max( 0, stateId - 1 ) ];
+    }
+    m_rateTabs.gtxFracBits    = gtxFracBits( 0 );
+    m_rateTabs.initRemRegBins = 0;
+  }
 
 
   void DepQuant::dequant( const TransformUnit& tu,  CoeffBuf& recCoeff, const ComponentID compID, const QpParam& cQP, bool enableScalingLists, int* piDequantCoef )
@@ -1360,6 +1289,23 @@ namespace DQIntern
 #undef  DINIT
 
 
+  inline int64_t DepQuant::xRdCostStart( const int32_t lastOffset, const PQData& pqData ) const
+  {
+    // a path starts with the rates of the first gtx context set and the rice parameter 0
+    const CoeffFracBits& fracBits = m_rateTabs.gtxFracBits[0];
+    int64_t              rdCost   = pqData.deltaDist + lastOffset;
+    if (pqData.absLevel < 4)
+    {
+      rdCost += fracBits.bits[pqData.absLevel];
+    }
+    else
+    {
+      const unsigned value = (pqData.absLevel - 4) >> 1;
+      rdCost += fracBits.bits[pqData.absLevel - (value << 1)] + g_goRiceBits[value < RICEMAX ? value : RICEMAX-1][0];
+    }
+    return rdCost;
+  }
+
   void DepQuant::xDecide( const ScanPosType spt, const TCoeff absCoeff, const int lastOffset, Decision* decisions, bool zeroOut, int quanCoeff)
   {
     ::memcpy( decisions, startDec, 8*sizeof(Decision) );
@@ -1368,30 +1314,64 @@ namespace DQIntern
     {
       if( spt==SCAN_EOCSBB )
       {
-        m_skipStates[0].checkRdCostSkipSbbZeroOut( decisions[0] );
-        m_skipStates[1].checkRdCostSkipSbbZeroOut( decisions[1] );
-        m_skipStates[2].checkRdCostSkipSbbZeroOut( decisions[2] );
-        m_skipStates[3].checkRdCostSkipSbbZeroOut( decisions[3] );
+        for( int stateId = 0; stateId < 4; stateId++ )
+        {
+          decisions[stateId].rdCost   = m_skipStates->rdCost[stateId] + m_skipStates->sbbBits[0][stateId];
+          decisions[stateId].absLevel = 0;
+          decisions[stateId].prevId   = 4 + stateId;
+        }
       }
       return;
     }
 
     PQData  pqData[4];
     m_quant.preQuantCoeff( absCoeff, pqData, quanCoeff );
-    m_prevStates[0].checkRdCosts( spt, pqData[0], pqData[2], decisions[0], decisions[2]);
-    m_prevStates[1].checkRdCosts( spt, pqData[0], pqData[2], decisions[2], decisions[0]);
-    m_prevStates[2].checkRdCosts( spt, pqData[3], pqData[1], decisions[1], decisions[3]);
-    m_prevStates[3].checkRdCosts( spt, pqData[3], pqData[1], decisions[3], decisions[1]);
-    if( spt==SCAN_EOCSBB )
+    const int64_t startCost[2] = { xRdCostStart( lastOffset, pqData[0] ), xRdCostStart( lastOffset, pqData[2] ) };
+    m_checkRdCosts( *m_prevStates, *m_skipStates, pqData, spt, startCost, decisions );
+  }
+
+  inline void DepQuant::xUpdateStateEOS( const ScanInfo& scanInfo, const int stateId, const Decision& decision )
+  {
+    StateMem& currStates = *m_currStates;
+    currStates.rdCost[stateId] = decision.rdCost;
+    if( decision.prevId > -2 )
     {
-        m_skipStates[0].checkRdCostSkipSbb( decisions[0] );
-        m_skipStates[1].checkRdCostSkipSbb( decisions[1] );
-        m_skipStates[2].checkRdCostSkipSbb( decisions[2] );
-        m_skipStates[3].checkRdCostSkipSbb( decisions[3] );
-    }
+      const StateMem* prvStates = nullptr;
+      int             prvId     = decision.prevId;
+      uint8_t         absLevels[16];
+      if( prvId >= 4 )
+      {
+        CHECK( decision.absLevel != 0, "cannot happen" );
+        prvStates = m_skipStates;
+        prvId    -= 4;
+        currStates.numSigSbb[stateId] = 0;
+        ::memset( absLevels, 0, 16*sizeof(uint8_t) );
+      }
+      else if( prvId >= 0 )
+      {
+        prvStates = m_prevStates;
+        currStates.numSigSbb[stateId] = prvStates->numSigSbb[prvId] + !!decision.absLevel;
+        for( int k = 0; k < 16; k++ )
+        {
+          absLevels[k] = prvStates->absLevels[k][prvId];
+        }
+      }
+      else
+      {
+        currStates.numSigSbb[stateId] = 1;
+        ::memset( absLevels, 0, 16*sizeof(uint8_t) );
+      }
+      absLevels[ scanInfo.insidePos ] = (uint8_t)std::min<TCoeff>( 255, decision.absLevel );
+
+      m_commonCtx.update( scanInfo, prvStates, prvId, absLevels, currStates, stateId, m_rateTabs.initRemRegBins );
 
-    m_startState.checkRdCostStart( lastOffset, pqData[0], decisions[0] );
-    m_startState.checkRdCostStart( lastOffset, pqData[2], decisions[2] );
+      TCoeff  tinit   = currStates.ctxInit[stateId][ scanInfo.nextInsidePos ];
+      TCoeff  sumNum  =   tinit        & 7;
+      TCoeff  sumAbs1 = ( tinit >> 3 ) & 31;
+      TCoeff  sumGt1  = sumAbs1        - sumNum;
+      setSigFracBits  ( currStates, stateId, m_rateTabs.sigFracBits[stateId][ scanInfo.sigCtxOffsetNext + std::min( (sumAbs1+1)>>1, 3 ) ] );
+      setCoeffFracBits( currStates, stateId, m_rateTabs.gtxFracBits[ scanInfo.gtxCtxOffsetNext + ( sumGt1  < 4 ? sumGt1  : 4 ) ] );
+    }
   }
 
   void DepQuant::xDecideAndUpdate( const TCoeff absCoeff, const ScanInfo& scanInfo, bool zeroOut, int quantCoeff )
@@ -1407,52 +1387,16 @@ namespace DQIntern
       if( scanInfo.eosbb )
       {
         m_commonCtx.swap();
-        m_currStates[0].updateStateEOS( scanInfo, m_prevStates, m_skipStates, decisions[0] );
-        m_currStates[1].updateStateEOS( scanInfo, m_prevStates, m_skipStates, decisions[1] );
-        m_currStates[2].updateStateEOS( scanInfo, m_prevStates, m_skipStates, decisions[2] );
-        m_currStates[3].updateStateEOS( scanInfo, m_prevStates, m_skipStates, decisions[3] );
+        m_commonCtx.countRefs( *m_prevStates, *m_skipStates, decisions );
+        xUpdateStateEOS( scanInfo, 0, decisions[0] );
+        xUpdateStateEOS( scanInfo, 1, decisions[1] );
+        xUpdateStateEOS( scanInfo, 2, decisions[2] );
+        xUpdateStateEOS( scanInfo, 3, decisions[3] );
         ::memcpy( decisions+4, decisions, 4*sizeof(Decision) );
       }
       else if( !zeroOut )
       {
-        switch( scanInfo.nextNbInfoSbb.num )
-        {
-        case 0:
-          m_currStates[0].updateState<0>( scanInfo, m_prevStates, decisions[0] );
-          m_currStates[1].updateState<0>( scanInfo, m_prevStates, decisions[1] );
-          m_currStates[2].updateState<0>( scanInfo, m_prevStates, decisions[2] );
-          m_currStates[3].updateState<0>( scanInfo, m_prevStates, decisions[3] );
-          break;
-        case 1:
-          m_currStates[0].updateState<1>( scanInfo, m_prevStates, decisions[0] );
-          m_currStates[1].updateState<1>( scanInfo, m_prevStates, decisions[1] );
-          m_currStates[2].updateState<1>( scanInfo, m_prevStates, decisions[2] );
-          m_currStates[3].updateState<1>( scanInfo, m_prevStates, decisions[3] );
-          break;
-        case 2:
-          m_currStates[0].updateState<2>( scanInfo, m_prevStates, decisions[0] );
-          m_currStates[1].updateState<2>( scanInfo, m_prevStates, decisions[1] );
-          m_currStates[2].updateState<2>( scanInfo, m_prevStates, decisions[2] );
-          m_currStates[3].updateState<2>( scanInfo, m_prevStates, decisions[3] );
-          break;
-        case 3:
-          m_currStates[0].updateState<3>( scanInfo, m_prevStates, decisions[0] );
-          m_currStates[1].updateState<3>( scanInfo, m_prevStates, decisions[1] );
-          m_currStates[2].updateState<3>( scanInfo, m_prevStates, decisions[2] );
-          m_currStates[3].updateState<3>( scanInfo, m_prevStates, decisions[3] );
-          break;
-        case 4:
-          m_currStates[0].updateState<4>( scanInfo, m_prevStates, decisions[0] );
-          m_currStates[1].updateState<4>( scanInfo, m_prevStates, decisions[1] );
-          m_currStates[2].updateState<4>( scanInfo, m_prevStates, decisions[2] );
-          m_currStates[3].updateState<4>( scanInfo, m_prevStates, decisions[3] );
-          break;
-        default:
-          m_currStates[0].updateState<5>( scanInfo, m_prevStates, decisions[0] );
-          m_currStates[1].updateState<5>( scanInfo, m_prevStates, decisions[1] );
-          m_currStates[2].updateState<5>( scanInfo, m_prevStates, decisions[2] );
-          m_currStates[3].updateState<5>( scanInfo, m_prevStates, decisions[3] );
-        }
+        m_updateStates( scanInfo, m_rateTabs, *m_prevStates, *m_currStates, decisions );
       }
 
       if( scanInfo.spt == SCAN_SOCSBB )
@@ -1525,22 +1469,14 @@ namespace DQIntern
     //===== real init =====
     RateEstimator::initCtx( tuPars, tu, compID, ctx.getFracBitsAcess() );
     m_commonCtx.reset( tuPars, *this );
-    for( int k = 0; k < 12; k++ )
-    {
-      m_allStates[k].init();
-    }
-    m_startState.init();
-
-
-    int effectWidth = std::min(32, effWidth);
+    int effectWidth  = std::min(32, effWidth);
     int effectHeight = std::min(32, effHeight);
-    for (int k = 0; k < 12; k++)
+    int ctxBinSampleRatio = (tuPars.m_chType == CHANNEL_TYPE_LUMA) ? MAX_TU_LEVEL_CTX_CODED_BIN_CONSTRAINT_LUMA : MAX_TU_LEVEL_CTX_CODED_BIN_CONSTRAINT_CHROMA;
+    m_rateTabs.initRemRegBins = (effectWidth * effectHeight * ctxBinSampleRatio) / 16;
+    for( int k = 0; k < 3; k++ )
     {
-      m_allStates[k].effWidth = effectWidth;
-      m_allStates[k].effHeight = effectHeight;
+      initStates( m_allStates[k], m_rateTabs );
     }
-    m_startState.effWidth = effectWidth;
-    m_startState.effHeight = effectHeight;
 
     //===== populate trellis =====
     for( int scanIdx = firstTestPos; scanIdx >= 0; scanIdx-- )
@@ -1584,12 +1520,22 @@ namespace DQIntern
 
 
 
+#include <chrono>
+#include <cstdio>
+static struct DQTimer { double t = 0; ~DQTimer() { fprintf( stderr, "DQTIME %.3f\n", t ); } } g_dqTimer;
 //===== interface class =====
 DepQuant::DepQuant( const Quant* other, bool enc ) : QuantRDOQ( other )
 {
   const DepQuant* dq = dynamic_cast<const DepQuant*>( other );
   CHECK( other && !dq, "The DepQuant cast must be successfull!" );
-  p = new DQIntern::DepQuant();
+  m_checkRdCosts = checkRdCosts;
+  m_updateStates = updateStates;
+#if ENABLE_SIMD_OPT_DEPQUANT
+#ifdef TARGET_SIMD_X86
+  initDepQuantX86();
+#endif
+#endif
+  p = new DQIntern::DepQuant( m_checkRdCosts, m_updateStates );
   if( enc )
   {
     DQIntern::g_Rom.init();
@@ -1601,6 +1547,49 @@ DepQuant::~DepQuant()
   delete static_cast<DQIntern::DepQuant*>(p);
 }
 
+void DepQuant::checkRdCosts( const DQIntern::StateMem& prevStates, const DQIntern::StateMem& skipStates, const DQIntern::PQData* pqData,
+                             const DQIntern::ScanPosType spt, const int64_t* startCost, DQIntern::Decision* decisions )
+{
+  DQIntern::checkRdCostsState( prevStates, 0, spt, pqData[0], pqData[2], decisions[0], decisions[2] );
+  DQIntern::checkRdCostsState( prevStates, 1, spt, pqData[0], pqData[2], decisions[2], decisions[0] );
+  DQIntern::checkRdCostsState( prevStates, 2, spt, pqData[3], pqData[1], decisions[1], decisions[3] );
+  DQIntern::checkRdCostsState( prevStates, 3, spt, pqData[3], pqData[1], decisions[3], decisions[1] );
+  if( spt == DQIntern::SCAN_EOCSBB )
+  {
+    DQIntern::checkRdCostSkipSbb( skipStates, 0, decisions[0] );
+    DQIntern::checkRdCostSkipSbb( skipStates, 1, decisions[1] );
+    DQIntern::checkRdCostSkipSbb( skipStates, 2, decisions[2] );
+    DQIntern::checkRdCostSkipSbb( skipStates, 3, decisions[3] );
+  }
+  DQIntern::checkRdCostStart( startCost[0], pqData[0], decisions[0] );
+  DQIntern::checkRdCostStart( startCost[1], pqData[2], decisions[2] );
+}
+
+void DepQuant::updateStates( const DQIntern::ScanInfo& scanInfo, const DQIntern::StateRateTabs& rateTabs, const DQIntern::StateMem& prevStates,
+                             DQIntern::StateMem& currStates, const DQIntern::Decision* decisions )
+{
+  switch( scanInfo.nextNbInfoSbb.num )
+  {
+  case 0:
+    DQIntern::updateStates<0>( scanInfo, rateTabs, prevStates, currStates, decisions );
+    break;
+  case 1:
+    DQIntern::updateStates<1>( scanInfo, rateTabs, prevStates, currStates, decisions );
+    break;
+  case 2:
+    DQIntern::updateStates<2>( scanInfo, rateTabs, prevStates, currStates, decisions );
+    break;
+  case 3:
+    DQIntern::updateStates<3>( scanInfo, rateTabs, prevStates, currStates, decisions );
+    break;
+  case 4:
+    DQIntern::updateStates<4>( scanInfo, rateTabs, prevStates, currStates, decisions );
+    break;
+  default:
+    DQIntern::updateStates<5>( scanInfo, rateTabs, prevStates, currStates, decisions );
+  }
+}
+
 void DepQuant::quant( TransformUnit &tu, const ComponentID &compID, const CCoeffBuf &pSrc, TCoeff &uiAbsSum, const QpParam &cQP, const Ctx& ctx )
 {
   if( tu.cs->slice->getDepQuantEnabledFlag() && (tu.mtsIdx != MTS_SKIP || !isLuma(compID)) )
@@ -1617,7 +1606,9 @@ void DepQuant::quant( TransformUnit &tu, const ComponentID &compID, const CCoeff
     const uint32_t    log2TrWidth     = floorLog2(width);
     const uint32_t    log2TrHeight    = floorLog2(height);
     const bool        enableScalingLists = getUseScalingList(width, height, (tu.mtsIdx == MTS_SKIP && isLuma(compID)));
+auto t0 = std::chrono::steady_clock::now();
     static_cast<DQIntern::DepQuant*>(p)->quant( tu, pSrc, compID, cQP, Quant::m_dLambda, ctx, uiAbsSum, enableScalingLists, Quant::getQuantCoeff(scalingListType, qpRem, log2TrWidth, log2TrHeight) );
+    g_dqTimer.t += std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count();
   }
   else
   {
@@ -43,11 +43,87 @@
 #include "UnitPartitioner.h"
 #include "QuantRDOQ.h"
 
-extern long long int timeOfXSetGtxFlagBits;
-extern long long int timeOfXSetSigFlagBits;
-extern long long int timeOfXInitScanArrays;
+namespace DQIntern
+{
+  enum ScanPosType { SCAN_ISCSBB = 0, SCAN_SOCSBB = 1, SCAN_EOCSBB = 2 };
+
+  struct NbInfoSbb
+  {
+    uint8_t   num;
+    uint8_t   inPos[5];
+  };
+  struct CoeffFracBits
+  {
+    int32_t   bits[6];
+  };
+
+  struct ScanInfo
+  {
+    ScanInfo() {}
+    int           sbbSize;
+    int           numSbb;
+    int           scanIdx;
+    int           rasterPos;
+    int           sbbPos;
+    int           insidePos;
+    bool          eosbb;
+    ScanPosType   spt;
+    unsigned      sigCtxOffsetNext;
+    unsigned      gtxCtxOffsetNext;
+    int           nextInsidePos;
+    NbInfoSbb     nextNbInfoSbb;
+    int           nextSbbRight;
+    int           nextSbbBelow;
+    int           posX;
+    int           posY;
+    ChannelType   chType;
+    int           sbtInfo;
+    int           tuWidth;
+    int           tuHeight;
+  };
+
+  struct PQData
+  {
+    TCoeff  absLevel;
+    int64_t deltaDist;
+  };
+
+  struct Decision
+  {
+    int64_t rdCost;
+    TCoeff  absLevel;
+    int     prevId;
+  };
 
+  // The four states of a trellis stage, lane k of each member belongs to the state k. Keeping the states interleaved
+  // allows to evaluate their rate distortion costs and to update their contexts side by side.
+  struct StateMem
+  {
+    int64_t         rdCost     [4];
+    int32_t         remRegBins [4];
+    int32_t         sbbBits    [2][4];
+    int32_t         sigBits    [2][4];
+    int32_t         coeffBits  [6][4];
+    int8_t          numSigSbb  [4];
+    int8_t          refSbbCtxId[4];
+    int8_t          goRicePar  [4];
+    int8_t          goRiceZero [4];
+    uint8_t         absLevels  [16][4];
+    const uint16_t* ctxInit    [4];       // ctx init ids of the sub-block, shared by all states of a context set
+  };
 
+  // rate tables of a transform block for the context updates, indexed by the state where they differ
+  struct StateRateTabs
+  {
+    const BinFracBits*    sigFracBits[4];
+    const CoeffFracBits*  gtxFracBits;
+    const uint32_t*       goRiceZero [4];
+    int32_t               initRemRegBins;
+  };
+
+  extern const int32_t  g_goRiceBits[32][4];     // rice code lengths of the remainders, indexed by the remainder and the rice parameter
+  extern const uint16_t g_zeroCtxInit[16];
+}
 
 class DepQuant : public QuantRDOQ
 {
@@ -58,6 +134,26 @@ public:
   virtual void quant  ( TransformUnit &tu, const ComponentID &compID, const CCoeffBuf &pSrc, TCoeff &uiAbsSum, const QpParam &cQP, const Ctx& ctx );
   virtual void dequant( const TransformUnit &tu, CoeffBuf &dstCoeff, const ComponentID &compID, const QpParam &cQP );
 
+  // decisions of the four states for a coefficient, from the previous and the skip states and the costs of starting
+  // with the levels of pqData[0] and pqData[2]
+  static void checkRdCosts( const DQIntern::StateMem& prevStates, const DQIntern::StateMem& skipStates, const DQIntern::PQData* pqData,
+                            const DQIntern::ScanPosType spt, const int64_t* startCost, DQIntern::Decision* decisions );
+  // states after a coefficient inside a sub-block, from the previous states and the decisions
+  static void updateStates( const DQIntern::ScanInfo& scanInfo, const DQIntern::StateRateTabs& rateTabs, const DQIntern::StateMem& prevStates,
+                            DQIntern::StateMem& currStates, const DQIntern::Decision* decisions );
+
+protected:
+  void ( *m_checkRdCosts )( const DQIntern::StateMem& prevStates, const DQIntern::StateMem& skipStates, const DQIntern::PQData* pqData,
+                            const DQIntern::ScanPosType spt, const int64_t* startCost, DQIntern::Decision* decisions );
+  void ( *m_updateStates )( const DQIntern::ScanInfo& scanInfo, const DQIntern::StateRateTabs& rateTabs, const DQIntern::StateMem& prevStates,
+                            DQIntern::StateMem& currStates, const DQIntern::Decision* decisions );
+
+#ifdef TARGET_SIMD_X86
+  void initDepQuantX86();
+  template <X86_VEXT vext>
+  void _initDepQuantX86();
+#endif
+
 private:
   void* p;
 };
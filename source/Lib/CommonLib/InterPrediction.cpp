@@ -43,50 +43,16 @@
 #include "MCTS.h"
 
 #include "ApproximatAdderSubtraction.h"
+#include "Profiler.h"
 
 #include <memory.h>
 #include <algorithm>
 #include <iostream>
 #include <math.h>
 #include <limits>
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
 
 using namespace std;
 
-long long int timeOfSimdVerticalSobelFilter = 0;
-long long int timeOfSimdHorizontalSobelFilter = 0;
-long long int timeOfSimdEqualCoeffComputer   = 0;
-long long int timeOfXFinalPaddedMCForDMVR   = 0;
-long long int timeOfXProcessDMVR            = 0;
-long long int timeOfXBIPMVRefine                  = 0;
-long long int timeOfXPrefetch                  = 0;
-long long int timeOfXWeightedTriangleBlk_SSE = 0;
-long long int timeOfSimdInterpolateLuma10Bit2P16  = 0;
-long long int timeOfSimdInterpolateLuma10Bit2P4   = 0;
-long long int timeOfXPredAffineBlk           = 0;
-long long int timeOfXDMVRCost                = 0;
-long long int timeOfApplyBiOptFlow           = 0;
-long long int timeOfXAddBIOAvg4              = 0;
-long long int timeOfXBioGradFilter           = 0;
-long long int timeOfXSubPuBio                = 0;
-long long int timeOfXPredInterBlk            = 0;
-long long int timeOfRightShiftMSB                 = 0;
-long long int timeIsSubblockVectorSpreadOverLimit = 0;
-long long int timeOfSimdInterpolateN2_10BIT_M4    = 0;
-long long int timeOfSimdInterpolateLuma10Bit2P8   = 0;
-long long int timeOfXinitMC                       = 0;
-long long int timeOfSimdFilter                    = 0;
-long long int timeOfXPad                          = 0;
-long long int timeOfXSubPelErrorSrfc              = 0;
-long long int timeOfXDMVRSubPixelErrorSurface     = 0;
-long long int timeOfDiv_for_maxq7                 = 0;
-long long int timeOfUpdateCandList                = 0;
-
 //! \ingroup CommonLib
 //! \{
 
@@ -254,6 +220,10 @@ void InterPrediction::init( RdCost* pcRdCost, ChromaFormat chromaFormatIDC, cons
   }
 #if !JVET_J0090_MEMORY_BANDWITH_MEASURE
   m_if.initInterpolationFilter( true );
+  if( g_approxProfile.isActive( APPROX_SITE_MC ) )
+  {
+    m_if.setApproxAdder( g_approxProfile.adder );
+  }
 #endif
 
   if (m_storedMv == nullptr)
@@ -323,13 +293,14 @@ void InterPrediction::xSubPuMC( PredictionUnit& pu, PelUnitBuf& predBuf, const R
   }
 
   PredictionUnit subPu;
+  // the sub-PUs are predicted with a copy of the CU, the decoder parses the CUs next to it (affine context) at the same time
+  CodingUnit     subCu = *pu.cu;
 
   subPu.cs        = pu.cs;
-  subPu.cu        = pu.cu;
+  subPu.cu        = &subCu;
   subPu.mergeType = MRG_TYPE_DEFAULT_N;
 
-  bool isAffine = pu.cu->affine;
-  subPu.cu->affine = false;
+  subCu.affine    = false;
 
   // join sub-pus containing the same motion
   bool verMC = puSize.height > puSize.width;
@@ -379,12 +350,10 @@ void InterPrediction::xSubPuMC( PredictionUnit& pu, PelUnitBuf& predBuf, const R
     }
   }
   m_subPuMC = false;
-
-  pu.cu->affine = isAffine;
 }
 void InterPrediction::xSubPuBio(PredictionUnit& pu, PelUnitBuf& predBuf, const RefPicList &eRefPicList /*= REF_PIC_LIST_X*/, PelUnitBuf* yuvDstTmp /*= NULL*/)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xSubPuBio" );
   // compute the location of the current PU
   Position puPos = pu.lumaPos();
   Size puSize = pu.lumaSize();
@@ -435,9 +404,6 @@ void InterPrediction::xSubPuBio(PredictionUnit& pu, PelUnitBuf& predBuf, const R
       motionCompensation(subPu, subPredBuf, eRefPicList);
     }
   }
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfXSubPuBio          = timeOfXSubPuBio + duration.count();
 }
 
 void InterPrediction::xPredInterUni(const PredictionUnit& pu, const RefPicList& eRefPicList, PelUnitBuf& pcYuvPred, const bool& bi
@@ -656,7 +622,7 @@ void InterPrediction::xPredInterBlk ( const ComponentID& compID, const Predictio
                                      , int32_t srcPadStride
                                     )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xPredInterBlk" );
   JVET_J0090_SET_REF_PICTURE( refPic, compID );
   const ChromaFormat  chFmt = pu.chromaFormat;
   const bool          rndRes = !bi;
@@ -796,14 +762,11 @@ void InterPrediction::xPredInterBlk ( const ComponentID& compID, const Predictio
     dstBuf.stride = backupDstBufStride;
   }
   }
-  auto stop                    = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfXPredInterBlk          = timeOfXPredInterBlk + duration.count();
 }
 
 bool InterPrediction::isSubblockVectorSpreadOverLimit( int a, int b, int c, int d, int predType )
 {
-  auto start     = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::isSubblockVectorSpreadOverLimit" );
   int s4 = ( 4 << 11 );
   int filterTap = 6;
 
@@ -823,9 +786,6 @@ bool InterPrediction::isSubblockVectorSpreadOverLimit( int a, int b, int c, int
 
     if ( refBlkWidth * refBlkHeight > ( filterTap + 9 ) * ( filterTap + 9 ) )
     {
-      auto stop                = high_resolution_clock::now();
-      auto duration            = duration_cast<nanoseconds>(stop - start);
-      timeIsSubblockVectorSpreadOverLimit = timeIsSubblockVectorSpreadOverLimit + duration.count();
       return true;
     }
   }
@@ -846,9 +806,6 @@ bool InterPrediction::isSubblockVectorSpreadOverLimit( int a, int b, int c, int
 
     if ( refBlkWidth * refBlkHeight > ( filterTap + 9 ) * ( filterTap + 5 ) )
     {
-      auto stop                           = high_resolution_clock::now();
-      auto duration                       = duration_cast<nanoseconds>(stop - start);
-      timeIsSubblockVectorSpreadOverLimit = timeIsSubblockVectorSpreadOverLimit + duration.count();
       return true;
     }
 
@@ -866,15 +823,9 @@ bool InterPrediction::isSubblockVectorSpreadOverLimit( int a, int b, int c, int
 
     if ( refBlkWidth * refBlkHeight > ( filterTap + 5 ) * ( filterTap + 9 ) )
     {
-      auto stop                           = high_resolution_clock::now();
-      auto duration                       = duration_cast<nanoseconds>(stop - start);
-      timeIsSubblockVectorSpreadOverLimit = timeIsSubblockVectorSpreadOverLimit + duration.count();
       return true;
     }
   }
-  auto stop                           = high_resolution_clock::now();
-  auto duration                       = duration_cast<nanoseconds>(stop - start);
-  timeIsSubblockVectorSpreadOverLimit = timeIsSubblockVectorSpreadOverLimit + duration.count();
   return false;
 }
 
@@ -882,7 +833,7 @@ bool InterPrediction::isSubblockVectorSpreadOverLimit( int a, int b, int c, int
 
 void InterPrediction::xPredAffineBlk( const ComponentID& compID, const PredictionUnit& pu, const Picture* refPic, const Mv* _mv, PelUnitBuf& dstPic, const bool& bi, const ClpRng& clpRng, const std::pair<int, int> scalingRatio )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xPredAffineBlk" );
   JVET_J0090_SET_REF_PICTURE( refPic, compID );
   const ChromaFormat chFmt = pu.chromaFormat;
   int iScaleX = ::getComponentScaleX( compID, chFmt );
@@ -1220,7 +1171,10 @@ void InterPrediction::xPredAffineBlk( const ComponentID& compID, const Predictio
 
         PelBuf gradXBuf = gradXExt.subBuf(w, h, blockWidth + 2, blockHeight + 2);
         PelBuf gradYBuf = gradYExt.subBuf(w, h, blockWidth + 2, blockHeight + 2);
-        g_pelBufOP.profGradFilter(dstExtBuf.buf, dstExtBuf.stride, blockWidth + 2, blockHeight + 2, gradXBuf.stride, gradXBuf.buf, gradYBuf.buf, clpRng.bd);
+        {
+          PROFILE_KERNEL( "PelBufferOps::profGradFilter", blockWidth + 2, blockHeight + 2, clpRng.bd );
+          g_pelBufOP.profGradFilter(dstExtBuf.buf, dstExtBuf.stride, blockWidth + 2, blockHeight + 2, gradXBuf.stride, gradXBuf.buf, gradYBuf.buf, clpRng.bd);
+        }
 
         const int shiftNum = std::max<int>(2, (IF_INTERNAL_PREC - clpRng.bd));
         const Pel offset = (1 << (shiftNum - 1)) + IF_INTERNAL_OFFS;
@@ -1232,6 +1186,7 @@ void InterPrediction::xPredAffineBlk( const ComponentID& compID, const Predictio
 
         if (!bi)
         {
+          PROFILE_KERNEL( "PelBufferOps::applyPROF", blockWidth, blockHeight, clpRng.bd );
           g_pelBufOP.applyPROF(dstY, dstBuf.stride, src, dstExtBuf.stride, blockWidth, blockHeight, gX, gY, gradXBuf.stride, dMvScaleHor, dMvScaleVer, blockWidth, shiftNum, offset, clpRng);
         }
         else
@@ -1245,16 +1200,11 @@ void InterPrediction::xPredAffineBlk( const ComponentID& compID, const Predictio
     }
   }
   
-  auto stop = high_resolution_clock::now();
-  auto duration = duration_cast<nanoseconds>(stop - start);
-  long long int count    = duration.count();
-  timeOfXPredAffineBlk   = timeOfXPredAffineBlk + duration.count();
-   
 }
 
 void InterPrediction::applyBiOptFlow(const PredictionUnit &pu, const CPelUnitBuf &yuvSrc0, const CPelUnitBuf &yuvSrc1, const int &refIdx0, const int &refIdx1, PelUnitBuf &yuvDst, const BitDepths &clipBitDepths)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::applyBiOptFlow" );
 
   const int     height = yuvDst.Y().height;
   const int     width = yuvDst.Y().width;
@@ -1354,39 +1304,34 @@ void InterPrediction::applyBiOptFlow(const PredictionUnit &pu, const CPelUnitBuf
       xAddBIOAvg4(srcY0Temp, src0Stride, srcY1Temp, src1Stride, dstY0, dstStride, gradX0, gradX1, gradY0, gradY1, widthG, (1 << 2), (1 << 2), (int)tmpx, (int)tmpy, shiftNum, offset, clpRng);
     }  // xu
   }  // yu
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfApplyBiOptFlow     = timeOfApplyBiOptFlow + duration.count();
 }
 
 
 
 void InterPrediction::xAddBIOAvg4(const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, const Pel *gradX0, const Pel *gradX1, const Pel *gradY0, const Pel*gradY1, int gradStride, int width, int height, int tmpx, int tmpy, int shift, int offset, const ClpRng& clpRng)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xAddBIOAvg4" );
+  PROFILE_KERNEL( "PelBufferOps::addBIOAvg4", width, height, clpRng.bd );
 
   g_pelBufOP.addBIOAvg4(src0, src0Stride, src1, src1Stride, dst, dstStride, gradX0, gradX1, gradY0, gradY1, gradStride, width, height, tmpx, tmpy, shift, offset, clpRng);
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfXAddBIOAvg4        = timeOfXAddBIOAvg4 + duration.count();
 }
 
 void InterPrediction::xBioGradFilter(Pel* pSrc, int srcStride, int width, int height, int gradStride, Pel* gradX, Pel* gradY, int bitDepth)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xBioGradFilter" );
+  PROFILE_KERNEL( "PelBufferOps::bioGradFilter", width, height, bitDepth );
   g_pelBufOP.bioGradFilter(pSrc, srcStride, width, height, gradStride, gradX, gradY, bitDepth);
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfXBioGradFilter     = timeOfXBioGradFilter + duration.count();
 }
 
 void InterPrediction::xCalcBIOPar(const Pel* srcY0Temp, const Pel* srcY1Temp, const Pel* gradX0, const Pel* gradX1, const Pel* gradY0, const Pel* gradY1, int* dotProductTemp1, int* dotProductTemp2, int* dotProductTemp3, int* dotProductTemp5, int* dotProductTemp6, const int src0Stride, const int src1Stride, const int gradStride, const int widthG, const int heightG, int bitDepth)
 {
+  PROFILE_KERNEL( "PelBufferOps::calcBIOPar", widthG, heightG, bitDepth );
   g_pelBufOP.calcBIOPar(srcY0Temp, srcY1Temp, gradX0, gradX1, gradY0, gradY1, dotProductTemp1, dotProductTemp2, dotProductTemp3, dotProductTemp5, dotProductTemp6, src0Stride, src1Stride, gradStride, widthG, heightG, bitDepth);
 }
 
 void InterPrediction::xCalcBlkGradient(int sx, int sy, int    *arraysGx2, int     *arraysGxGy, int     *arraysGxdI, int     *arraysGy2, int     *arraysGydI, int     &sGx2, int     &sGy2, int     &sGxGy, int     &sGxdI, int     &sGydI, int width, int height, int unitSize)
 {
+  PROFILE_KERNEL( "PelBufferOps::calcBlkGradient", width, height, 0 );
   g_pelBufOP.calcBlkGradient(sx, sy, arraysGx2, arraysGxGy, arraysGxdI, arraysGy2, arraysGydI, sGx2, sGy2, sGxGy, sGxdI, sGydI, width, height, unitSize);
 }
 
@@ -1594,6 +1539,7 @@ void InterPrediction::xApplyBiPROF(const PredictionUnit &pu, const CPelBuf& pcYu
   const Pel* srcY1 = pcYuvSrc1.bufAt(0, 0);
   Pel* dstY = pcYuvDst.bufAt(0, 0);
 
+  PROFILE_KERNEL( "PelBufferOps::applyBiPROF", width, height, clpRng.bd );
   if(m_applyPROF[0] && m_applyPROF[1])
     g_pelBufOP.applyBiPROF[1](dstY, pcYuvDst.stride, srcY0, srcY1, pcYuvSrc0.stride, width, height, gX0, gY0, gX1, gY1, gradXExt0.stride, dMvX0, dMvY0, dMvX1, dMvY1, blockWidth, getGbiWeight(pu.cu->GBiIdx, REF_PIC_LIST_0), clpRng);
   else if (m_applyPROF[0])
@@ -1764,14 +1710,10 @@ void InterPrediction::motionCompensation( PredictionUnit &pu, const RefPicList &
 
 int InterPrediction::rightShiftMSB(int numer, int denom)
 {
-  auto start            = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::rightShiftMSB" );
 
   int output = numer >> floorLog2(denom);
 
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfRightShiftMSB   = timeOfRightShiftMSB + duration.count();
-  
   return output;
 }
 
@@ -1830,7 +1772,7 @@ void InterPrediction::weightedTriangleBlk( PredictionUnit &pu, const bool splitD
 
 void InterPrediction::xPrefetch(PredictionUnit& pu, PelUnitBuf &pcPad, RefPicList refId, bool forLuma)
 {
-  auto           startTimer = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xPrefetch" );
 
   int offset, width, height;
   Mv cMv;
@@ -1874,17 +1816,14 @@ void InterPrediction::xPrefetch(PredictionUnit& pu, PelUnitBuf &pcPad, RefPicLis
       Position Rec_offset = pu.blocks[compID].pos().offset(cMv.getHor() >> mvshiftTemp, cMv.getVer() >> mvshiftTemp);
       refBuf = refPic->getRecoBuf(CompArea((ComponentID)compID, pu.chromaFormat, Rec_offset, pu.blocks[compID].size()), wrapRef);
       PelBuf &dstBuf = pcPad.bufs[compID];
+      PROFILE_KERNEL( "PelBufferOps::copyBuffer", width, height, 0 );
       g_pelBufOP.copyBuffer((Pel *)refBuf.buf, refBuf.stride, ((Pel *)dstBuf.buf) + offset, dstBuf.stride, width, height);
     }
   }
-
-  auto stopTimer       = high_resolution_clock::now();
-  auto duration   = duration_cast<nanoseconds>(stopTimer - startTimer);
-  timeOfXPrefetch = timeOfXPrefetch + duration.count();
 }
 void InterPrediction::xPad(PredictionUnit& pu, PelUnitBuf &pcPad, RefPicList refId)
 {
-  auto start  = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xPad" );
   int offset = 0, width, height;
   int padsize;
   Mv cMv;
@@ -1902,16 +1841,14 @@ void InterPrediction::xPad(PredictionUnit& pu, PelUnitBuf &pcPad, RefPicList ref
 
     /*padding on all side of size DMVR_PAD_LENGTH*/
     {
+      PROFILE_KERNEL( "PelBufferOps::padding", width, height, 0 );
       g_pelBufOP.padding(pcPad.bufs[compID].buf + offset, pcPad.bufs[compID].stride, width, height, padsize);
     }
   }
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfXPad       = timeOfXPad + duration.count();
 }
 inline int32_t div_for_maxq7(int64_t N, int64_t D)
 {
-  auto    start = high_resolution_clock::now();
+  PROFILE_ZONE( "div_for_maxq7" );
 
   int32_t sign, q;
   sign = 0;
@@ -1941,10 +1878,6 @@ inline int32_t div_for_maxq7(int64_t N, int64_t D)
   if (N >= (D >> 1))
     q++;
 
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfDiv_for_maxq7 = timeOfDiv_for_maxq7 + duration.count();
-
   if (sign)
     return (-q);
   return(q);
@@ -1952,7 +1885,7 @@ inline int32_t div_for_maxq7(int64_t N, int64_t D)
 
 void xSubPelErrorSrfc(uint64_t *sadBuffer, int32_t *deltaMv)
 {
-  auto    start = high_resolution_clock::now();
+  PROFILE_ZONE( "xSubPelErrorSrfc" );
   int64_t numerator, denominator;
   int32_t mvDeltaSubPel;
   int32_t mvSubPelLvl = 4;/*1: half pel, 2: Qpel, 3:1/8, 4: 1/16*/
@@ -2003,16 +1936,12 @@ void xSubPelErrorSrfc(uint64_t *sadBuffer, int32_t *deltaMv)
       }
     }
 
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfXSubPelErrorSrfc = timeOfXSubPelErrorSrfc + duration.count();
-
   return;
 }
 
 void InterPrediction::xBIPMVRefine(int bd, Pel *pRefL0, Pel *pRefL1, uint64_t& minCost, int16_t *deltaMV, uint64_t *pSADsArray, int width, int height)
 {
-  auto          start       = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xBIPMVRefine" );
 
   const int32_t refStrideL0 = m_biLinearBufStride;
   const int32_t refStrideL1 = m_biLinearBufStride;
@@ -2039,10 +1968,6 @@ void InterPrediction::xBIPMVRefine(int bd, Pel *pRefL0, Pel *pRefL1, uint64_t& m
     }
   }
 
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfXBIPMVRefine    = timeOfXBIPMVRefine + duration.count();
-
 }
 
 void InterPrediction::xFinalPaddedMCForDMVR(PredictionUnit& pu, PelUnitBuf &pcYuvSrc0, PelUnitBuf &pcYuvSrc1, PelUnitBuf &pcPad0, PelUnitBuf &pcPad1, const bool bioApplied
@@ -2050,7 +1975,7 @@ void InterPrediction::xFinalPaddedMCForDMVR(PredictionUnit& pu, PelUnitBuf &pcYu
   , bool blockMoved
 )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xFinalPaddedMCForDMVR" );
   int offset, deltaIntMvX, deltaIntMvY;
 
   PelUnitBuf pcYUVTemp = pcYuvSrc0;
@@ -2116,29 +2041,23 @@ void InterPrediction::xFinalPaddedMCForDMVR(PredictionUnit& pu, PelUnitBuf &pcYu
     pcYUVTemp = pcYuvSrc1;
     pcPadTemp = pcPad1;
   }
-  auto stop                    = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfXFinalPaddedMCForDMVR  = timeOfXFinalPaddedMCForDMVR + duration.count();
 }
 
 uint64_t InterPrediction::xDMVRCost(int bitDepth, Pel* pOrg, uint32_t refStride, const Pel* pRef, uint32_t orgStride, int width, int height)
 {
-  auto      start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xDMVRCost" );
   DistParam cDistParam;
   cDistParam.applyWeight = false;
   cDistParam.useMR = false;
   m_pcRdCost->setDistParam(cDistParam, pOrg, pRef, orgStride, refStride, bitDepth, COMPONENT_Y, width, height, 1);
   uint64_t uiCost = cDistParam.distFunc(cDistParam);
-  auto     stop            = high_resolution_clock::now();
-  auto     duration        = duration_cast<nanoseconds>(stop - start);
-  timeOfXDMVRCost          = timeOfXDMVRCost + duration.count();
 
   return uiCost>>1;
 }
 
 void xDMVRSubPixelErrorSurface(bool notZeroCost, int16_t *totalDeltaMV, int16_t *deltaMV, uint64_t *pSADsArray)
 {
-  auto     start     = high_resolution_clock::now();
+  PROFILE_ZONE( "xDMVRSubPixelErrorSurface" );
 
   int sadStride = (((2 * DMVR_NUM_ITERATION) + 1));
   uint64_t sadbuffer[5];
@@ -2159,15 +2078,11 @@ void xDMVRSubPixelErrorSurface(bool notZeroCost, int16_t *totalDeltaMV, int16_t
     totalDeltaMV[1] += tempDeltaMv[1];
     //totalDeltaMV[1] = calculateSum(totalDeltaMV[1] , tempDeltaMv[1], 8, 7);
   }
-
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfXDMVRSubPixelErrorSurface = timeOfXDMVRSubPixelErrorSurface + duration.count();
 }
 
 void InterPrediction::xinitMC(PredictionUnit& pu, const ClpRngs &clpRngs)
 {
-  auto      start   = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xinitMC" );
   const int refIdx0 = pu.refIdx[0];
   const int refIdx1 = pu.refIdx[1];
   /*use merge MV as starting MV*/
@@ -2213,14 +2128,11 @@ void InterPrediction::xinitMC(PredictionUnit& pu, const ClpRngs &clpRngs)
     xPredInterBlk( COMPONENT_Y, pu, pu.cu->slice->getRefPic( REF_PIC_LIST_1, refIdx1 )->unscaledPic, mergeMVL1, yuvPredTempL1, true, clpRngs.comp[COMPONENT_Y], false, false, pu.cu->slice->getScalingRatio( REF_PIC_LIST_1, refIdx1 ), pu.lwidth() + ( 2 * DMVR_NUM_ITERATION ), pu.lheight() + ( 2 * DMVR_NUM_ITERATION ), true, ( (Pel *)srcBuf.buf ) + offset, srcBuf.stride );
     //xPredInterBlk( COMPONENT_Y, pu, pu.cu->slice->getRefPic( REF_PIC_LIST_1, refIdx1 )->unscaledPic, mergeMVL1, yuvPredTempL1, true, clpRngs.comp[COMPONENT_Y], false, false, pu.cu->slice->getScalingRatio( REF_PIC_LIST_1, refIdx1 ), calculateSum(pu.lwidth() , ( 2 * DMVR_NUM_ITERATION ), 8 ,7), calculateSum(pu.lheight() , ( 2 * DMVR_NUM_ITERATION ), 8 ,7), true, ( (Pel *)srcBuf.buf ) + offset, srcBuf.stride );
   }
-  auto stop       = high_resolution_clock::now();
-  auto duration   = duration_cast<nanoseconds>(stop - start);
-  timeOfXinitMC   = timeOfXinitMC + duration.count();
 }
 
 void InterPrediction::xProcessDMVR(PredictionUnit& pu, PelUnitBuf &pcYuvDst, const ClpRngs &clpRngs, const bool bioApplied)
 {
-  auto start          = high_resolution_clock::now();
+  PROFILE_ZONE( "InterPrediction::xProcessDMVR" );
   int iterationCount = 1;
   /*Always High Precision*/
   int mvShift = MV_FRACTIONAL_BITS_INTERNAL;
@@ -2387,9 +2299,6 @@ void InterPrediction::xProcessDMVR(PredictionUnit& pu, PelUnitBuf &pcYuvDst, con
     }
   }
   JVET_J0090_SET_CACHE_ENABLE(true);
-  auto stop                    = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfXProcessDMVR           = timeOfXProcessDMVR + duration.count();
 }
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
 void InterPrediction::cacheAssign( CacheModel *cache )
@@ -2397,6 +2306,10 @@ void InterPrediction::cacheAssign( CacheModel *cache )
   m_cacheModel = cache;
   m_if.cacheAssign( cache );
   m_if.initInterpolationFilter( !cache->isCacheEnable() );
+  if( g_approxProfile.isActive( APPROX_SITE_MC ) )
+  {
+    m_if.setApproxAdder( g_approxProfile.adder );
+  }
 }
 #endif
 
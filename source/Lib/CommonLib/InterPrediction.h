@@ -52,41 +52,6 @@
 
 #include "ApproximatAdderSubtraction.h"
 
-extern long long int timeOfSimdVerticalSobelFilter;
-extern long long int timeOfSimdHorizontalSobelFilter;
-extern long long int timeOfXFinalPaddedMCForDMVR;
-extern long long int timeOfXProcessDMVR;
-extern long long int timeOfXBIPMVRefine;
-extern long long int timeOfXPrefetch;
-extern long long int timeOfXWeightedTriangleBlk_SSE;
-extern long long int timeOfSimdInterpolateLuma10Bit2P16;
-extern long long int timeOfSimdInterpolateLuma10Bit2P4;
-extern long long int timeOfXPredAffineBlk;
-extern long long int timeOfXPredAffineBlk_1;
-extern long long int timeOfXPredAffineBlk_2;
-extern long long int timeOfXPredAffineBlk_3;
-extern long long int timeOfXPredAffineBlk_4;
-extern long long int timeOfXPredAffineBlk_5;
-extern long long int timeOfXPredAffineBlk_6;
-extern long long int timeOfSimdEqualCoeffComputer;
-extern long long int timeOfXDMVRCost;
-extern long long int timeOfApplyBiOptFlow;
-extern long long int timeOfXAddBIOAvg4;
-extern long long int timeOfXBioGradFilter;
-extern long long int timeOfXSubPuBio;
-extern long long int timeOfXPredInterBlk;
-extern long long int timeOfRightShiftMSB;
-extern long long int timeIsSubblockVectorSpreadOverLimit;
-extern long long int timeOfSimdInterpolateN2_10BIT_M4;
-extern long long int timeOfSimdInterpolateLuma10Bit2P8;
-extern long long int timeOfXinitMC;
-extern long long int timeOfSimdFilter;
-extern long long int timeOfXPad;
-extern long long int timeOfXSubPelErrorSrfc;
-extern long long int timeOfXDMVRSubPixelErrorSurface;
-extern long long int timeOfDiv_for_maxq7;
-extern long long int timeOfUpdateCandList;
-
 // forward declaration
 class Mv;
 
@@ -44,12 +44,8 @@
 #include "InterpolationFilter.h"
 
 #include "ChromaFormat.h"
-
-
-
-long long int timeOfWeightedTriangleBlk = 0;
-long long int timeOfFilterVer           = 0;
-long long int timeOfFilterHor           = 0;
+#include "ApproximatAdderSubtraction.h"
+#include "Profiler.h"
 
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
 CacheModel* InterpolationFilter::m_cacheModel;
@@ -218,6 +214,53 @@ InterpolationFilter::InterpolationFilter()
   m_filterCopy[1][1]   = filterCopy<true, true>;
 
   m_weightedTriangleBlk = xWeightedTriangleBlk;
+
+  std::memcpy( m_filterHorApprox[APPROX_ADDER_EXACT], m_filterHor, sizeof( m_filterHor ) );
+  std::memcpy( m_filterVerApprox[APPROX_ADDER_EXACT], m_filterVer, sizeof( m_filterVer ) );
+  xInitFilterApprox<APPROX_ADDER_LOA>();
+  xInitFilterApprox<APPROX_ADDER_TYPE1>();
+  xInitFilterApprox<APPROX_ADDER_TYPE2>();
+  xInitFilterApprox<APPROX_ADDER_TYPE3>();
+  xInitFilterApprox<APPROX_ADDER_TYPE4>();
+  xInitFilterApprox<APPROX_ADDER_TYPE5>();
+  xInitFilterApprox<APPROX_ADDER_M45_P35_A7>();
+  xInitFilterApprox<APPROX_ADDER_M45_P30_A6>();
+  xInitFilterApprox<APPROX_ADDER_M60_P25_A6>();
+  xInitFilterApprox<APPROX_ADDER_M95_P10_A5>();
+}
+
+template<int adder>
+void InterpolationFilter::xInitFilterApprox()
+{
+  m_filterHorApprox[adder][0][0][0] = filterApprox<8, false, false, false, adder>;
+  m_filterHorApprox[adder][0][0][1] = filterApprox<8, false, false, true,  adder>;
+  m_filterHorApprox[adder][0][1][0] = filterApprox<8, false, true,  false, adder>;
+  m_filterHorApprox[adder][0][1][1] = filterApprox<8, false, true,  true,  adder>;
+
+  m_filterHorApprox[adder][1][0][0] = filterApprox<4, false, false, false, adder>;
+  m_filterHorApprox[adder][1][0][1] = filterApprox<4, false, false, true,  adder>;
+  m_filterHorApprox[adder][1][1][0] = filterApprox<4, false, true,  false, adder>;
+  m_filterHorApprox[adder][1][1][1] = filterApprox<4, false, true,  true,  adder>;
+
+  m_filterHorApprox[adder][2][0][0] = filterApprox<2, false, false, false, adder>;
+  m_filterHorApprox[adder][2][0][1] = filterApprox<2, false, false, true,  adder>;
+  m_filterHorApprox[adder][2][1][0] = filterApprox<2, false, true,  false, adder>;
+  m_filterHorApprox[adder][2][1][1] = filterApprox<2, false, true,  true,  adder>;
+
+  m_filterVerApprox[adder][0][0][0] = filterApprox<8, true, false, false, adder>;
+  m_filterVerApprox[adder][0][0][1] = filterApprox<8, true, false, true,  adder>;
+  m_filterVerApprox[adder][0][1][0] = filterApprox<8, true, true,  false, adder>;
+  m_filterVerApprox[adder][0][1][1] = filterApprox<8, true, true,  true,  adder>;
+
+  m_filterVerApprox[adder][1][0][0] = filterApprox<4, true, false, false, adder>;
+  m_filterVerApprox[adder][1][0][1] = filterApprox<4, true, false, true,  adder>;
+  m_filterVerApprox[adder][1][1][0] = filterApprox<4, true, true,  false, adder>;
+  m_filterVerApprox[adder][1][1][1] = filterApprox<4, true, true,  true,  adder>;
+
+  m_filterVerApprox[adder][2][0][0] = filterApprox<2, true, false, false, adder>;
+  m_filterVerApprox[adder][2][0][1] = filterApprox<2, true, false, true,  adder>;
+  m_filterVerApprox[adder][2][1][0] = filterApprox<2, true, true,  false, adder>;
+  m_filterVerApprox[adder][2][1][1] = filterApprox<2, true, true,  true,  adder>;
 }
 
 
@@ -491,6 +534,80 @@ void InterpolationFilter::filter(const ClpRng& clpRng, Pel const *src, int srcSt
   }
 }
 
+/**
+ * \brief Apply FIR filter to a block of samples, accumulating the taps with an approximate adder
+ *
+ * Same as filter(), but every addition of the tap accumulation and the rounding offset goes through
+ * approximateSum<adder>(). The parameters of the lower-part OR adder are taken from g_approxAdderParam.
+ */
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// !!! NOTE !!!
+//
+//  This is the scalar version of the function.
+//  If you change the functionality here, consider to switch off the SIMD implementation of this function.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<int N, bool isVertical, bool isFirst, bool isLast, int adder>
+void InterpolationFilter::filterApprox(const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR)
+{
+  const int numberBits       = g_approxAdderParam.numberBits;
+  const int approximateCount = g_approxAdderParam.approximateCount;
+
+  Pel c[8];
+  for( int k = 0; k < N; k++ )
+  {
+    c[k] = coeff[k];
+  }
+
+  int cStride = ( isVertical ) ? srcStride : 1;
+  src -= ( N/2 - 1 ) * cStride;
+
+  int offset;
+  int headRoom = std::max<int>(2, (IF_INTERNAL_PREC - clpRng.bd));
+  int shift    = IF_FILTER_PREC;
+
+  if ( isLast )
+  {
+    shift += (isFirst) ? 0 : headRoom;
+    offset = 1 << (shift - 1);
+    offset += (isFirst) ? 0 : IF_INTERNAL_OFFS << IF_FILTER_PREC;
+  }
+  else
+  {
+    shift -= (isFirst) ? headRoom : 0;
+    offset = (isFirst) ? -IF_INTERNAL_OFFS << shift : 0;
+  }
+
+  if (biMCForDMVR)
+  {
+    shift  = isFirst ? IF_FILTER_PREC_BILINEAR - (IF_INTERNAL_PREC_BILINEAR - clpRng.bd) : 4;
+    offset = 1 << (shift - 1);
+  }
+
+  for( int row = 0; row < height; row++ )
+  {
+    for( int col = 0; col < width; col++ )
+    {
+      int sum = src[col] * c[0];
+      for( int k = 1; k < N; k++ )
+      {
+        sum = approximateSum<adder>( src[col + k * cStride] * c[k], sum, numberBits, approximateCount );
+      }
+
+      Pel val = approximateSum<adder>( sum, offset, numberBits, approximateCount ) >> shift;
+      if ( isLast )
+      {
+        val = ClipPel( val, clpRng );
+      }
+      dst[col] = val;
+    }
+
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
 /**
  * \brief Filter a block of samples (horizontal)
  *
@@ -508,7 +625,8 @@ void InterpolationFilter::filter(const ClpRng& clpRng, Pel const *src, int srcSt
 template<int N>
 void InterpolationFilter::filterHor(const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, bool isLast, TFilterCoeff const *coeff, bool biMCForDMVR)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterpolationFilter::filterHor" );
+  PROFILE_KERNEL( N == 8 ? "InterpolationFilter::filterHor8" : N == 4 ? "InterpolationFilter::filterHor4" : "InterpolationFilter::filterHor2", width, height, clpRng.bd );
   //#if ENABLE_SIMD_OPT_MCIF
   if( N == 8 )
   {
@@ -526,10 +644,6 @@ void InterpolationFilter::filterHor(const ClpRng& clpRng, Pel const *src, int sr
   {
     THROW( "Invalid tap number" );
   }
-
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfFilterHor  = timeOfFilterHor + duration.count();
 }
 
 /**
@@ -550,6 +664,7 @@ void InterpolationFilter::filterHor(const ClpRng& clpRng, Pel const *src, int sr
 template<int N>
 void InterpolationFilter::filterVer(const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, bool isFirst, bool isLast, TFilterCoeff const *coeff, bool biMCForDMVR)
 {
+  PROFILE_KERNEL( N == 8 ? "InterpolationFilter::filterVer8" : N == 4 ? "InterpolationFilter::filterVer4" : "InterpolationFilter::filterVer2", width, height, clpRng.bd );
 //#if ENABLE_SIMD_OPT_MCIF
   if( N == 8 )
   {
@@ -650,7 +765,7 @@ void InterpolationFilter::filterHor(const ComponentID compID, Pel const *src, in
  */
 void InterpolationFilter::filterVer(const ComponentID compID, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, int frac, bool isFirst, bool isLast, const ChromaFormat fmt, const ClpRng& clpRng, int nFilterIdx, bool biMCForDMVR, bool useAltHpelIf)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterpolationFilter::filterVer" );
 
   if( frac == 0 )
   {
@@ -692,15 +807,11 @@ void InterpolationFilter::filterVer(const ComponentID compID, Pel const *src, in
     CHECK( frac < 0 || csy >= 2 || ( frac << ( 1 - csy ) ) >= CHROMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS, "Invalid fraction" );
     filterVer<NTAPS_CHROMA>(clpRng, src, srcStride, dst, dstStride, width, height, isFirst, isLast, m_chromaFilter[frac << (1 - csy)], biMCForDMVR);
   }
-
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfFilterVer  = timeOfFilterVer + duration.count();
 }
 
 void InterpolationFilter::xWeightedTriangleBlk( const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const bool splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1 )
 {
-  auto    start      = high_resolution_clock::now();
+  PROFILE_ZONE( "InterpolationFilter::xWeightedTriangleBlk" );
 
   Pel*    dst        = predDst .get(compIdx).buf;
   Pel*    src0       = predSrc0.get(compIdx).buf;
@@ -773,9 +884,6 @@ void InterpolationFilter::xWeightedTriangleBlk( const PredictionUnit &pu, const
     weightedStartPos += weightedPosoffset;
     weightedEndPos   += weightedPosoffset;
   }
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfWeightedTriangleBlk = timeOfWeightedTriangleBlk + duration.count();
 }
 
 void InterpolationFilter::weightedTriangleBlk(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const bool splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1)
@@ -800,4 +908,13 @@ void InterpolationFilter::initInterpolationFilter( bool enable )
 #endif
 }
 
+/**
+ * \brief Use the approximate adder for the interpolation filters, must be called after initInterpolationFilter()
+ */
+void InterpolationFilter::setApproxAdder( ApproxAdderType adder )
+{
+  std::memcpy( m_filterHor, m_filterHorApprox[adder], sizeof( m_filterHor ) );
+  std::memcpy( m_filterVer, m_filterVerApprox[adder], sizeof( m_filterVer ) );
+}
+
 //! \}
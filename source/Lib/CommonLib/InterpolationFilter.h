@@ -42,11 +42,6 @@
 #include "CommonDef.h"
 #include "CacheModel.h"
 
-extern long long int timeOfWeightedTriangleBlk;
-extern long long int timeOfFilterVer;
-extern long long int timeOfFilterHor;
-
-
 //! \ingroup CommonLib
 //! \{
 
@@ -74,6 +69,8 @@ public:
 
   template<int N, bool isVertical, bool isFirst, bool isLast>
   static void filter(const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR);
+  template<int N, bool isVertical, bool isFirst, bool isLast, int adder>
+  static void filterApprox(const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR);
   template<int N>
   void filterHor(const ClpRng& clpRng, Pel const* src, int srcStride, Pel *dst, int dstStride, int width, int height, bool isLast, TFilterCoeff const *coeff, bool biMCForDMVR);
 
@@ -86,15 +83,21 @@ protected:
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   static CacheModel* m_cacheModel;
 #endif
+  template<int adder>
+  void xInitFilterApprox();
 public:
   InterpolationFilter();
   ~InterpolationFilter() {}
   void( *m_filterHor[3][2][2] )( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR);
   void( *m_filterVer[3][2][2] )( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR);
   void( *m_filterCopy[2][2] )  ( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, bool biMCForDMVR);
+  // [ApproxAdderType][taps][bFirst][bLast], the tap accumulation and rounding use the approximate adder
+  void( *m_filterHorApprox[NUM_APPROX_ADDER_TYPES][3][2][2] )( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR);
+  void( *m_filterVerApprox[NUM_APPROX_ADDER_TYPES][3][2][2] )( const ClpRng& clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR);
   void( *m_weightedTriangleBlk )(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const bool splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1);
 
   void initInterpolationFilter( bool enable );
+  void setApproxAdder( ApproxAdderType adder );
 #ifdef TARGET_SIMD_X86
   void initInterpolationFilterX86();
   template <X86_VEXT vext>
@@ -47,12 +47,7 @@
 #include <memory.h>
 
 #include "CommonLib/InterpolationFilter.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
+#include "Profiler.h"
 
 //! \ingroup CommonLib
 //! \{
@@ -61,8 +56,6 @@ using std::chrono::nanoseconds;
 // Tables
 // ====================================================================================================================
 
-long long int timeOfGeneIntrainterPred = 0;
-
 const uint8_t IntraPrediction::m_aucIntraFilter[MAX_INTRA_FILTER_DEPTHS] =
 {
   24, //   1xn
@@ -131,6 +124,18 @@ IntraPrediction::IntraPrediction()
 
   m_runTypeRD   = nullptr;
   m_runLengthRD = nullptr;
+
+  m_predAngFilter4Row = predAngFilter4Row;
+  m_predAngLinearRow  = predAngLinearRow;
+  m_predPlanar        = predPlanar;
+  m_pdpcPlanarDc      = pdpcPlanarDc;
+  m_transposeBlock    = transposeBlock;
+
+#if ENABLE_SIMD_OPT_INTRAPRED
+#ifdef TARGET_SIMD_X86
+  initIntraPredictionX86();
+#endif
+#endif
 }
 
 IntraPrediction::~IntraPrediction()
@@ -284,7 +289,7 @@ void IntraPrediction::predIntraAng( const ComponentID compId, PelBuf &piPred, co
 
   switch (uiDirMode)
   {
-    case(PLANAR_IDX): xPredIntraPlanar(srcBuf, piPred); break;
+    case(PLANAR_IDX): m_predPlanar(srcBuf, piPred); break;
     case(DC_IDX):     xPredIntraDc(srcBuf, piPred, channelType, false); break;
     case(BDPCM_IDX):  xPredIntraBDPCM(srcBuf, piPred, pu.cu->bdpcmMode, clpRng); break;
     default:          xPredIntraAng(srcBuf, piPred, channelType, clpRng); break;
@@ -298,18 +303,23 @@ void IntraPrediction::predIntraAng( const ComponentID compId, PelBuf &piPred, co
 
     if (uiDirMode == PLANAR_IDX || uiDirMode == DC_IDX)
     {
-      for (int y = 0; y < iHeight; y++)
-      {
-        const int wT   = 32 >> std::min(31, ((y << 1) >> scale));
-        const Pel left = srcBuf.at(y + 1, 1);
-        for (int x = 0; x < iWidth; x++)
-        {
-          const int wL    = 32 >> std::min(31, ((x << 1) >> scale));
-          const Pel top   = srcBuf.at(x + 1, 0);
-          const Pel val   = dstBuf.at(x, y);
-          dstBuf.at(x, y) = val + ((wL * (left - val) + wT * (top - val) + 32) >> 6);
-        }
-      }
+      m_pdpcPlanarDc(srcBuf, dstBuf, scale);
+    }
+  }
+}
+
+void IntraPrediction::pdpcPlanarDc( const CPelBuf &pSrc, PelBuf &pDst, const int scale )
+{
+  for (int y = 0; y < pDst.height; y++)
+  {
+    const int wT   = 32 >> std::min(31, ((y << 1) >> scale));
+    const Pel left = pSrc.at(y + 1, 1);
+    for (int x = 0; x < pDst.width; x++)
+    {
+      const int wL  = 32 >> std::min(31, ((x << 1) >> scale));
+      const Pel top = pSrc.at(x + 1, 0);
+      const Pel val = pDst.at(x, y);
+      pDst.at(x, y) = val + ((wL * (left - val) + wT * (top - val) + 32) >> 6);
     }
   }
 }
@@ -340,7 +350,7 @@ void IntraPrediction::predIntraChromaLM(const ComponentID compID, PelBuf &piPred
  */
 
 //NOTE: Bit-Limit - 24-bit source
-void IntraPrediction::xPredIntraPlanar( const CPelBuf &pSrc, PelBuf &pDst )
+void IntraPrediction::predPlanar( const CPelBuf &pSrc, PelBuf &pDst )
 {
   const uint32_t width  = pDst.width;
   const uint32_t height = pDst.height;
@@ -586,10 +596,7 @@ void IntraPrediction::xPredIntraAng( const CPelBuf &pSrc, PelBuf &pDst, const Ch
   {
     for( int y = 0; y < height; y++ )
     {
-      for( int x = 0; x < width; x++ )
-      {
-        pDsty[x] = refMain[x + 1];
-      }
+      memcpy( pDsty, refMain + 1, width * sizeof( Pel ) );
 
       if (m_ipaParam.applyPDPC)
       {
@@ -623,41 +630,18 @@ void IntraPrediction::xPredIntraAng( const CPelBuf &pSrc, PelBuf &pDst, const Ch
           const TFilterCoeff *const f =
             (useCubicFilter) ? InterpolationFilter::getChromaFilterTable(deltaFract) : g_intraGaussFilter[deltaFract];
 
-          for (int x = 0; x < width; x++)
-          {
-            Pel p[4];
-
-            p[0] = refMain[deltaInt + x];
-            p[1] = refMain[deltaInt + x + 1];
-            p[2] = refMain[deltaInt + x + 2];
-            p[3] = refMain[deltaInt + x + 3];
-
-            Pel val = (f[0] * p[0] + f[1] * p[1] + f[2] * p[2] + f[3] * p[3] + 32) >> 6;
-
-            pDsty[x] = ClipPel(val, clpRng);   // always clip even though not always needed
-          }
+          m_predAngFilter4Row(pDsty, refMain + deltaInt, width, f, clpRng);
         }
         else
         {
           // Do linear filtering
-          for (int x = 0; x < width; x++)
-          {
-            Pel p[2];
-
-            p[0] = refMain[deltaInt + x + 1];
-            p[1] = refMain[deltaInt + x + 2];
-
-            pDsty[x] = p[0] + ((deltaFract * (p[1] - p[0]) + 16) >> 5);
-          }
+          m_predAngLinearRow(pDsty, refMain + deltaInt + 1, width, deltaFract);
         }
       }
       else
       {
         // Just copy the integer samples
-        for( int x = 0; x < width; x++ )
-        {
-          pDsty[x] = refMain[x + deltaInt + 1];
-        }
+        memcpy( pDsty, refMain + deltaInt + 1, width * sizeof( Pel ) );
       }
       if (m_ipaParam.applyPDPC)
       {
@@ -679,14 +663,37 @@ void IntraPrediction::xPredIntraAng( const CPelBuf &pSrc, PelBuf &pDst, const Ch
   // Flip the block if this is the horizontal mode
   if( !bIsModeVer )
   {
-    for( int y = 0; y < height; y++ )
+    m_transposeBlock( pDstBuf, dstStride, pDst.buf, pDst.stride, width, height );
+  }
+}
+
+void IntraPrediction::predAngFilter4Row( Pel* dst, const Pel* ref, const int width, const TFilterCoeff* coeff, const ClpRng& clpRng )
+{
+  for (int x = 0; x < width; x++)
+  {
+    Pel val = (coeff[0] * ref[x] + coeff[1] * ref[x + 1] + coeff[2] * ref[x + 2] + coeff[3] * ref[x + 3] + 32) >> 6;
+
+    dst[x] = ClipPel(val, clpRng);   // always clip even though not always needed
+  }
+}
+
+void IntraPrediction::predAngLinearRow( Pel* dst, const Pel* ref, const int width, const int deltaFract )
+{
+  for (int x = 0; x < width; x++)
+  {
+    dst[x] = ref[x] + ((deltaFract * (ref[x + 1] - ref[x]) + 16) >> 5);
+  }
+}
+
+void IntraPrediction::transposeBlock( const Pel* src, const int srcStride, Pel* dst, const int dstStride, const int width, const int height )
+{
+  for( int y = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x++ )
     {
-      for( int x = 0; x < width; x++ )
-      {
-        pDst.at( y, x ) = pDstBuf[x];
-      }
-      pDstBuf += dstStride;
+      dst[x * dstStride + y] = src[x];
     }
+    src += srcStride;
   }
 }
 
@@ -792,8 +799,7 @@ void IntraPrediction::geneIntrainterPred(const CodingUnit &cu)
     return;
   }
 
-  
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "IntraPrediction::geneIntrainterPred" );
 
   const PredictionUnit* pu = cu.firstPU;
 
@@ -812,11 +818,6 @@ void IntraPrediction::geneIntrainterPred(const CodingUnit &cu)
     PelBuf tmpBuf = currCompID == 0 ? cu.cs->getPredBuf(*pu).Y() : (currCompID == 1 ? cu.cs->getPredBuf(*pu).Cb() : cu.cs->getPredBuf(*pu).Cr());
     switchBuffer(*pu, currCompID2, tmpBuf, getPredictorPtr2(currCompID2, 0));
   }
-
-  
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfGeneIntrainterPred = timeOfGeneIntrainterPred + duration.count();
 }
 
 inline bool isAboveLeftAvailable  ( const CodingUnit &cu, const ChannelType &chType, const Position &posLT );
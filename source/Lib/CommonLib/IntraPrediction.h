@@ -53,8 +53,6 @@
 // Class definition
 // ====================================================================================================================
 
-extern long long int timeOfGeneIntrainterPred;
-
 /// prediction class
 enum PredBuf
 {
@@ -126,7 +124,6 @@ protected:
   bool         *m_runTypeRD;
   Pel          *m_runLengthRD;
   // prediction
-  void xPredIntraPlanar           ( const CPelBuf &pSrc, PelBuf &pDst );
   void xPredIntraDc               ( const CPelBuf &pSrc, PelBuf &pDst, const ChannelType channelType, const bool enableBoundaryFilter = true );
   void xPredIntraAng              ( const CPelBuf &pSrc, PelBuf &pDst, const ChannelType channelType, const ClpRng& clpRng);
 
@@ -148,10 +145,30 @@ protected:
   void destroy                    ();
 
   void xGetLMParameters(const PredictionUnit &pu, const ComponentID compID, const CompArea& chromaArea, int& a, int& b, int& iShift);
+
+  void (*m_predAngFilter4Row)     ( Pel* dst, const Pel* ref, const int width, const TFilterCoeff* coeff, const ClpRng& clpRng );
+  void (*m_predAngLinearRow)      ( Pel* dst, const Pel* ref, const int width, const int deltaFract );
+  void (*m_predPlanar)            ( const CPelBuf &pSrc, PelBuf &pDst );
+  void (*m_pdpcPlanarDc)          ( const CPelBuf &pSrc, PelBuf &pDst, const int scale );
+  void (*m_transposeBlock)        ( const Pel* src, const int srcStride, Pel* dst, const int dstStride, const int width, const int height );
+
+#ifdef TARGET_SIMD_X86
+  void initIntraPredictionX86();
+  template <X86_VEXT vext>
+  void _initIntraPredictionX86();
+#endif
+
 public:
   IntraPrediction();
   virtual ~IntraPrediction();
 
+  // row and block kernels of the angular, planar and PDPC prediction
+  static void predAngFilter4Row   ( Pel* dst, const Pel* ref, const int width, const TFilterCoeff* coeff, const ClpRng& clpRng );
+  static void predAngLinearRow    ( Pel* dst, const Pel* ref, const int width, const int deltaFract );
+  static void predPlanar          ( const CPelBuf &pSrc, PelBuf &pDst );
+  static void pdpcPlanarDc        ( const CPelBuf &pSrc, PelBuf &pDst, const int scale );
+  static void transposeBlock      ( const Pel* src, const int srcStride, Pel* dst, const int dstStride, const int width, const int height );
+
   void init                       (ChromaFormat chromaFormatIDC, const unsigned bitDepthY);
 
   // Angular Intra
@@ -43,17 +43,7 @@
 #include "UnitPartitioner.h"
 #include "dtrace_codingstruct.h"
 #include "dtrace_buffer.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-long long int timeOfXCalcDQ = 0;
-long long int timeOfXUseStrongFiltering = 0;
-long long int timeOfXSetEdgefilterMultiple = 0;
-long long int timeOfxSetLoopfilterParam    = 0;
+#include "Profiler.h"
 
 //! \ingroup CommonLib
 //! \{
@@ -110,6 +100,14 @@ static bool isAvailableAbove( const CodingUnit& cu, const CodingUnit& cu2, const
 
 LoopFilter::LoopFilter()
 {
+  m_filterLumaEdge4  = filterLumaEdge4;
+  m_filterChromaEdge = filterChromaEdge;
+
+#if ENABLE_SIMD_OPT_DBF
+#ifdef TARGET_SIMD_X86
+  initLoopFilterX86();
+#endif
+#endif
 }
 
 LoopFilter::~LoopFilter()
@@ -175,87 +173,75 @@ void LoopFilter::loopFilterPic( CodingStructure& cs
 
   for( int y = 0; y < pcv.heightInCtus; y++ )
   {
-    for( int x = 0; x < pcv.widthInCtus; x++ )
-    {
-      memset( m_aapucBS       [EDGE_VER].data(), 0,     m_aapucBS       [EDGE_VER].byte_size() );
-      memset( m_aapbEdgeFilter[EDGE_VER].data(), false, m_aapbEdgeFilter[EDGE_VER].byte_size() );
-      memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
-      memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
-      memset( m_transformEdge, false, sizeof(m_transformEdge) );
-      m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
-      m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
+    loopFilterCtuRow( cs, EDGE_VER, y );
+  }
 
-      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
-      CodingUnit* firstCU = cs.getCU( ctuArea.lumaPos(), CH_L);
-      cs.slice = firstCU->slice;
+  // Vertical filtering
+  for( int y = 0; y < pcv.heightInCtus; y++ )
+  {
+    loopFilterCtuRow( cs, EDGE_HOR, y );
+  }
 
-      // CU-based deblocking
-      for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_L ), CH_L ) )
-      {
-        xDeblockCU( currCU, EDGE_VER );
-      }
+  DTRACE_PIC_COMP(D_REC_CB_LUMA_LF,   cs, cs.getRecoBuf(), COMPONENT_Y);
+  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cb);
+  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cr);
 
-      if( CS::isDualITree( cs ) )
-      {
-        memset( m_aapucBS       [EDGE_VER].data(), 0,     m_aapucBS       [EDGE_VER].byte_size() );
-        memset( m_aapbEdgeFilter[EDGE_VER].data(), false, m_aapbEdgeFilter[EDGE_VER].byte_size() );
-        memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
-        memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
-        memset( m_transformEdge, false, sizeof(m_transformEdge) );
+  DTRACE    ( g_trace_ctx, D_CRC, "LoopFilter" );
+  DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
+}
 
-        for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_C ), CH_C ) )
-        {
-          xDeblockCU( currCU, EDGE_VER );
-        }
-      }
-    }
-  }
+/**
+ - deblock the edges of one direction in the CTUs of a CTU row
+ .
+ The horizontal edges of a row modify the bottom lines of the row above, so the
+ vertical edges of a row have to be filtered before its horizontal edges and the
+ horizontal edges of the row above before them.
+ */
+void LoopFilter::loopFilterCtuRow( CodingStructure& cs, const DeblockEdgeDir edgeDir, const int ctuRow )
+{
+  const PreCalcValues& pcv = *cs.pcv;
+  m_shiftHor = ::getComponentScaleX( COMPONENT_Cb, cs.pcv->chrFormat );
+  m_shiftVer = ::getComponentScaleY( COMPONENT_Cb, cs.pcv->chrFormat );
 
-  // Vertical filtering
-  for( int y = 0; y < pcv.heightInCtus; y++ )
+  const int y = ctuRow;
+  for( int x = 0; x < pcv.widthInCtus; x++ )
   {
-    for( int x = 0; x < pcv.widthInCtus; x++ )
+    memset( m_aapucBS       [edgeDir].data(), 0,     m_aapucBS       [edgeDir].byte_size() );
+    memset( m_aapbEdgeFilter[edgeDir].data(), false, m_aapbEdgeFilter[edgeDir].byte_size() );
+    memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
+    memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
+    memset( m_transformEdge, false, sizeof(m_transformEdge) );
+    m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
+    m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
+
+    const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
+    CodingUnit* firstCU = cs.getCU( ctuArea.lumaPos(), CH_L);
+    if( cs.slice != firstCU->slice )
     {
-      memset( m_aapucBS       [EDGE_HOR].data(), 0,     m_aapucBS       [EDGE_HOR].byte_size() );
-      memset( m_aapbEdgeFilter[EDGE_HOR].data(), false, m_aapbEdgeFilter[EDGE_HOR].byte_size() );
+      // the rows of a single slice picture are filtered while the slice is decoded
+      cs.slice = firstCU->slice;
+    }
+
+    // CU-based deblocking (not CS::getArea(), the decoder filters while the parser changes cs.treeType)
+    for( auto &currCU : cs.traverseCUs( CS::isDualITree( cs ) ? ctuArea.singleChan( CH_L ) : ctuArea, CH_L ) )
+    {
+      xDeblockCU( currCU, edgeDir );
+    }
+
+    if( CS::isDualITree( cs ) )
+    {
+      memset( m_aapucBS       [edgeDir].data(), 0,     m_aapucBS       [edgeDir].byte_size() );
+      memset( m_aapbEdgeFilter[edgeDir].data(), false, m_aapbEdgeFilter[edgeDir].byte_size() );
       memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
       memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
       memset( m_transformEdge, false, sizeof(m_transformEdge) );
-      m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
-      m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
 
-      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
-      CodingUnit* firstCU = cs.getCU( ctuArea.lumaPos(), CH_L);
-      cs.slice = firstCU->slice;
-
-      // CU-based deblocking
-      for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_L ), CH_L ) )
+      for( auto &currCU : cs.traverseCUs( ctuArea.singleChan( CH_C ), CH_C ) )
       {
-        xDeblockCU( currCU, EDGE_HOR );
-      }
-
-      if( CS::isDualITree( cs ) )
-      {
-        memset( m_aapucBS       [EDGE_HOR].data(), 0,     m_aapucBS       [EDGE_HOR].byte_size() );
-        memset( m_aapbEdgeFilter[EDGE_HOR].data(), false, m_aapbEdgeFilter[EDGE_HOR].byte_size() );
-        memset( m_maxFilterLengthP, 0, sizeof(m_maxFilterLengthP) );
-        memset( m_maxFilterLengthQ, 0, sizeof(m_maxFilterLengthQ) );
-        memset( m_transformEdge, false, sizeof(m_transformEdge) );
-
-        for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_C ), CH_C ) )
-        {
-          xDeblockCU( currCU, EDGE_HOR );
-        }
+        xDeblockCU( currCU, edgeDir );
       }
     }
   }
-
-  DTRACE_PIC_COMP(D_REC_CB_LUMA_LF,   cs, cs.getRecoBuf(), COMPONENT_Y);
-  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cb);
-  DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cr);
-
-  DTRACE    ( g_trace_ctx, D_CRC, "LoopFilter" );
-  DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
 }
 
 
@@ -641,7 +627,7 @@ void LoopFilter::xSetEdgefilterMultiple( const CodingUnit&    cu,
                                          const bool           bValue,
                                          const bool           EdgeIdx )
 {
-  auto                 start = high_resolution_clock::now();
+  PROFILE_ZONE( "LoopFilter::xSetEdgefilterMultiple" );
   const PreCalcValues& pcv = *cu.cs->pcv;
 
   const unsigned uiAdd     = ( edgeDir == EDGE_VER ) ? pcv.partsInCtuWidth : 1;
@@ -658,22 +644,16 @@ void LoopFilter::xSetEdgefilterMultiple( const CodingUnit&    cu,
     // dont use calculateSum
     uiBsIdx += uiAdd;
   }
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfXSetEdgefilterMultiple = timeOfXSetEdgefilterMultiple + duration.count();
 }
 void LoopFilter::xSetLoopfilterParam( const CodingUnit& cu )
 {
-  auto         start = high_resolution_clock::now();
+  PROFILE_ZONE( "LoopFilter::xSetLoopfilterParam" );
   const Slice& slice = *cu.slice;
   const PPS&   pps   = *cu.cs->pps;
 
   if( slice.getDeblockingFilterDisable() )
   {
     m_stLFCUParam.leftEdge = m_stLFCUParam.topEdge = m_stLFCUParam.internalEdge = false;
-    auto stop        = high_resolution_clock::now();
-    auto duration    = duration_cast<nanoseconds>(stop - start);
-    timeOfxSetLoopfilterParam = timeOfxSetLoopfilterParam + duration.count();
     return;
   }
 
@@ -682,10 +662,6 @@ void LoopFilter::xSetLoopfilterParam( const CodingUnit& cu )
   m_stLFCUParam.internalEdge = true;
   m_stLFCUParam.leftEdge     = ( 0 < pos.x ) && isAvailableLeft ( cu, *cu.cs->getCU( pos.offset( -1,  0 ), cu.chType ), !slice.getLFCrossSliceBoundaryFlag(), !pps.getLoopFilterAcrossBricksEnabledFlag() );
   m_stLFCUParam.topEdge      = ( 0 < pos.y ) && isAvailableAbove( cu, *cu.cs->getCU( pos.offset(  0, -1 ), cu.chType ), !slice.getLFCrossSliceBoundaryFlag(), !pps.getLoopFilterAcrossBricksEnabledFlag() );
-
-  auto stop                 = high_resolution_clock::now();
-  auto duration             = duration_cast<nanoseconds>(stop - start);
-  timeOfxSetLoopfilterParam = timeOfxSetLoopfilterParam + duration.count();
 }
 
 unsigned LoopFilter::xGetBoundaryStrengthSingle ( const CodingUnit& cu, const DeblockEdgeDir edgeDir, const Position& localPos ) const
@@ -880,7 +856,7 @@ void LoopFilter::xEdgeFilterLuma( const CodingUnit& cu, const DeblockEdgeDir edg
   unsigned     uiNumParts   = ( ( ( edgeDir == EDGE_VER ) ? lumaArea.height / pcv.minCUHeight : lumaArea.width / pcv.minCUWidth ) );
   int          pelsInPart   = pcv.minCUWidth;
   unsigned     uiBsAbsIdx   = 0, uiBs = 0;
-  int          iOffset, iSrcStep;
+  int          iSrcStep;
 
   bool  bPartPNoFilter  = false;
   bool  bPartQNoFilter  = false;
@@ -894,7 +870,6 @@ void LoopFilter::xEdgeFilterLuma( const CodingUnit& cu, const DeblockEdgeDir edg
   {
     xoffset   = 0;
     yoffset   = pelsInPart;
-    iOffset   = 1;
     iSrcStep  = iStride;
     piTmpSrc += iEdge * pelsInPart;
     pos       = Position{ lumaArea.x + iEdge * pelsInPart, lumaArea.y - yoffset };
@@ -903,7 +878,6 @@ void LoopFilter::xEdgeFilterLuma( const CodingUnit& cu, const DeblockEdgeDir edg
   {
     xoffset   = pelsInPart;
     yoffset   = 0;
-    iOffset   = iStride;
     iSrcStep  = 1;
     piTmpSrc += iEdge*pelsInPart*iStride;
     pos       = Position{ lumaArea.x - xoffset, lumaArea.y + iEdge * pelsInPart };
@@ -984,126 +958,126 @@ void LoopFilter::xEdgeFilterLuma( const CodingUnit& cu, const DeblockEdgeDir edg
 
       const int iTc = bitDepthLuma < 10 ? ((sm_tcTable[iIndexTC] + 2) >> (10 - bitDepthLuma)) : ((sm_tcTable[iIndexTC]) << (bitDepthLuma - 10));
       const int iBeta     = sm_betaTable[iIndexB ] * iBitdepthScale;
-      const int iSideThreshold = ( iBeta + ( iBeta >> 1 ) ) >> 3;
-      const int iThrCut   = iTc * 10;
 
       const unsigned uiBlocksInPart = pelsInPart / 4 ? pelsInPart / 4 : 1;
 
-      for( int iBlkIdx = 0; iBlkIdx < uiBlocksInPart; iBlkIdx++ )
+      bPartPNoFilter = bPartQNoFilter = false;
+      if( ppsTransquantBypassEnabledFlag )
       {
-        const int dp0 = xCalcDP(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 0), iOffset);
-        const int dq0 = xCalcDQ(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 0), iOffset);
-        const int dp3 = xCalcDP(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 3), iOffset);
-        const int dq3 = xCalcDQ(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 3), iOffset);
-        int dp0L = dp0;
-        int dq0L = dq0;
-        int dp3L = dp3;
-        int dq3L = dq3;
-
-        if (sidePisLarge)
-        {
-          dp0L = (dp0L + xCalcDP(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 0) - 3 * iOffset, iOffset) + 1) >> 1;
-          dp3L = (dp3L + xCalcDP(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 3) - 3 * iOffset, iOffset) + 1) >> 1;
-        }
-        if (sideQisLarge)
-        {
-          dq0L = (dq0L + xCalcDQ(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 0) + 3 * iOffset, iOffset) + 1) >> 1;
-          dq3L = (dq3L + xCalcDQ(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + 3) + 3 * iOffset, iOffset) + 1) >> 1;
-        }
-        bool useLongtapFilter = false;
-        if (sidePisLarge || sideQisLarge)
-        {
-          int d0L = dp0L + dq0L;
-          int d3L = dp3L + dq3L;
-
-          int dpL = dp0L + dp3L;
-          int dqL = dq0L + dq3L;
-
-          int dL = d0L + d3L;
-
-          bPartPNoFilter = bPartQNoFilter = false;
-          if (ppsTransquantBypassEnabledFlag)
-          {
-            // check if each of PUs is lossless coded
-            bPartPNoFilter = bPartPNoFilter || cuP.transQuantBypass;
-            bPartQNoFilter = bPartQNoFilter || cuQ.transQuantBypass;
-          }
-          if (spsPaletteEnabledFlag)
-          {
-            // check if each of PUs is palette coded
-            bPartPNoFilter = bPartPNoFilter || CU::isPLT(cuP);
-            bPartQNoFilter = bPartQNoFilter || CU::isPLT(cuQ);
-          }
-
-          if (dL < iBeta)
-          {
-            const bool filterP = (dpL < iSideThreshold);
-            const bool filterQ = (dqL < iSideThreshold);
-
-            Pel* src0 = piTmpSrc + iSrcStep * (iIdx*pelsInPart + iBlkIdx * 4 + 0);
-            Pel* src3 = piTmpSrc + iSrcStep * (iIdx*pelsInPart + iBlkIdx * 4 + 3);
+        // check if each of PUs is lossless coded
+        bPartPNoFilter = bPartPNoFilter || cuP.transQuantBypass;
+        bPartQNoFilter = bPartQNoFilter || cuQ.transQuantBypass;
+      }
+      if( spsPaletteEnabledFlag )
+      {
+        // check if each of PUs is palette coded
+        bPartPNoFilter = bPartPNoFilter || CU::isPLT(cuP);
+        bPartQNoFilter = bPartQNoFilter || CU::isPLT(cuQ);
+      }
 
-            // adjust decision so that it is not read beyond p5 is maxFilterLengthP is 5 and q5 if maxFilterLengthQ is 5
-            const bool swL = xUseStrongFiltering(src0, iOffset, 2 * d0L, iBeta, iTc, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ)
-              && xUseStrongFiltering(src3, iOffset, 2 * d3L, iBeta, iTc, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ);
-            if (swL)
-            {
-              useLongtapFilter = true;
-              for (int i = 0; i < DEBLOCK_SMALLEST_BLOCK / 2; i++)
-              {
-                xPelFilterLuma(piTmpSrc + iSrcStep*(iIdx*pelsInPart + iBlkIdx * 4 + i), iOffset, iTc, swL, bPartPNoFilter, bPartQNoFilter, iThrCut, filterP, filterQ, clpRng, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ);
-              }
-            }
+      for( int iBlkIdx = 0; iBlkIdx < uiBlocksInPart; iBlkIdx++ )
+      {
+        m_filterLumaEdge4( piTmpSrc + iSrcStep * ( iIdx*pelsInPart + iBlkIdx * 4 ), iStride, edgeDir, iTc, iBeta, maxFilterLengthP, maxFilterLengthQ, sidePisLarge, sideQisLarge, bPartPNoFilter, bPartQNoFilter, clpRng );
+      }
+    }
+  }
+}
 
-          }
-        }
-        if (!useLongtapFilter)
-        {
-        const int d0 = dp0 + dq0;
-        const int d3 = dp3 + dq3;
+/**
+ - decisions and filtering of 4 lines of a luma edge
+ .
+ \param src              pointer to the first q0 sample
+ \param stride           stride of the picture
+ \param edgeDir          edge direction, the lines are rows for the vertical edges
+ \param tc, beta         filter parameters of the edge
+ \param maxFilterLengthP maximum number of modified samples on the P side
+ \param maxFilterLengthQ maximum number of modified samples on the Q side
+ \param sidePisLarge     P side may use the long filter
+ \param sideQisLarge     Q side may use the long filter
+ \param partPNoFilter    keep the P samples (lossless or palette coded)
+ \param partQNoFilter    keep the Q samples (lossless or palette coded)
+ */
+void LoopFilter::filterLumaEdge4( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int tc, const int beta, const int maxFilterLengthP, const int maxFilterLengthQ,
+                                  const bool sidePisLarge, const bool sideQisLarge, const bool partPNoFilter, const bool partQNoFilter, const ClpRng& clpRng )
+{
+  const int iOffset        = edgeDir == EDGE_VER ? 1 : stride;
+  const int iSrcStep       = edgeDir == EDGE_VER ? stride : 1;
+  const int iSideThreshold = ( beta + ( beta >> 1 ) ) >> 3;
+  const int iThrCut        = tc * 10;
+
+  const int dp0 = xCalcDP( src + iSrcStep * 0, iOffset );
+  const int dq0 = xCalcDQ( src + iSrcStep * 0, iOffset );
+  const int dp3 = xCalcDP( src + iSrcStep * 3, iOffset );
+  const int dq3 = xCalcDQ( src + iSrcStep * 3, iOffset );
+  int dp0L = dp0;
+  int dq0L = dq0;
+  int dp3L = dp3;
+  int dq3L = dq3;
+
+  if( sidePisLarge )
+  {
+    dp0L = ( dp0L + xCalcDP( src + iSrcStep * 0 - 3 * iOffset, iOffset ) + 1 ) >> 1;
+    dp3L = ( dp3L + xCalcDP( src + iSrcStep * 3 - 3 * iOffset, iOffset ) + 1 ) >> 1;
+  }
+  if( sideQisLarge )
+  {
+    dq0L = ( dq0L + xCalcDQ( src + iSrcStep * 0 + 3 * iOffset, iOffset ) + 1 ) >> 1;
+    dq3L = ( dq3L + xCalcDQ( src + iSrcStep * 3 + 3 * iOffset, iOffset ) + 1 ) >> 1;
+  }
 
-        const int dp = dp0 + dp3;
-        const int dq = dq0 + dq3;
-        const int d  = d0  + d3;
+  if( sidePisLarge || sideQisLarge )
+  {
+    const int d0L = dp0L + dq0L;
+    const int d3L = dp3L + dq3L;
+    const int dpL = dp0L + dp3L;
+    const int dqL = dq0L + dq3L;
+    const int dL  = d0L + d3L;
 
-        bPartPNoFilter = bPartQNoFilter = false;
-        if( ppsTransquantBypassEnabledFlag )
-        {
-          // check if each of PUs is lossless coded
-          bPartPNoFilter = bPartPNoFilter || cuP.transQuantBypass;
-          bPartQNoFilter = bPartQNoFilter || cuQ.transQuantBypass;
-        }
-        if( spsPaletteEnabledFlag)
-        {
-          // check if each of PUs is palette coded
-          bPartPNoFilter = bPartPNoFilter || CU::isPLT(cuP);
-          bPartQNoFilter = bPartQNoFilter || CU::isPLT(cuQ);
-        }
+    if( dL < beta )
+    {
+      const bool filterP = ( dpL < iSideThreshold );
+      const bool filterQ = ( dqL < iSideThreshold );
 
-        if( d < iBeta )
+      // adjust decision so that it is not read beyond p5 is maxFilterLengthP is 5 and q5 if maxFilterLengthQ is 5
+      const bool swL = xUseStrongFiltering( src + iSrcStep * 0, iOffset, 2 * d0L, beta, tc, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ )
+                    && xUseStrongFiltering( src + iSrcStep * 3, iOffset, 2 * d3L, beta, tc, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ );
+      if( swL )
+      {
+        for( int i = 0; i < DEBLOCK_SMALLEST_BLOCK / 2; i++ )
         {
-          bool bFilterP = false;
-          bool bFilterQ = false;
-          if (maxFilterLengthP > 1 && maxFilterLengthQ > 1)
-          {
-            bFilterP = (dp < iSideThreshold);
-            bFilterQ = (dq < iSideThreshold);
-          }
-          bool sw = false;
-          if (maxFilterLengthP > 2 && maxFilterLengthQ > 2)
-          {
-            sw = xUseStrongFiltering(piTmpSrc + iSrcStep * (iIdx*pelsInPart + iBlkIdx * 4 + 0), iOffset, 2 * d0, iBeta, iTc)
-              && xUseStrongFiltering(piTmpSrc + iSrcStep * (iIdx*pelsInPart + iBlkIdx * 4 + 3), iOffset, 2 * d3, iBeta, iTc);
-          }
-          for( int i = 0; i < DEBLOCK_SMALLEST_BLOCK / 2; i++ )
-          {
-            xPelFilterLuma( piTmpSrc + iSrcStep*( iIdx*pelsInPart + iBlkIdx * 4 + i ), iOffset, iTc, sw, bPartPNoFilter, bPartQNoFilter, iThrCut, bFilterP, bFilterQ, clpRng );
-          }
-        }
+          xPelFilterLuma( src + iSrcStep * i, iOffset, tc, swL, partPNoFilter, partQNoFilter, iThrCut, filterP, filterQ, clpRng, sidePisLarge, sideQisLarge, maxFilterLengthP, maxFilterLengthQ );
         }
+        return;
       }
     }
   }
+
+  const int d0 = dp0 + dq0;
+  const int d3 = dp3 + dq3;
+  const int dp = dp0 + dp3;
+  const int dq = dq0 + dq3;
+  const int d  = d0  + d3;
+
+  if( d < beta )
+  {
+    bool bFilterP = false;
+    bool bFilterQ = false;
+    if( maxFilterLengthP > 1 && maxFilterLengthQ > 1 )
+    {
+      bFilterP = ( dp < iSideThreshold );
+      bFilterQ = ( dq < iSideThreshold );
+    }
+    bool sw = false;
+    if( maxFilterLengthP > 2 && maxFilterLengthQ > 2 )
+    {
+      sw = xUseStrongFiltering( src + iSrcStep * 0, iOffset, 2 * d0, beta, tc )
+        && xUseStrongFiltering( src + iSrcStep * 3, iOffset, 2 * d3, beta, tc );
+    }
+    for( int i = 0; i < DEBLOCK_SMALLEST_BLOCK / 2; i++ )
+    {
+      xPelFilterLuma( src + iSrcStep * i, iOffset, tc, sw, partPNoFilter, partQNoFilter, iThrCut, bFilterP, bFilterQ, clpRng );
+    }
+  }
 }
 
 
@@ -1126,7 +1100,7 @@ void LoopFilter::xEdgeFilterChroma(const CodingUnit& cu, const DeblockEdgeDir ed
   const unsigned uiPelsInPartChromaH = pcv.minCUWidth  >> ::getComponentScaleX(COMPONENT_Cb, nChromaFormat);
   const unsigned uiPelsInPartChromaV = pcv.minCUHeight >> ::getComponentScaleY(COMPONENT_Cb, nChromaFormat);
 
-  int       iOffset, iSrcStep;
+  int       iSrcStep;
   unsigned  uiLoopLength;
 
   bool      bPartPNoFilter  = false;
@@ -1162,7 +1136,6 @@ void LoopFilter::xEdgeFilterChroma(const CodingUnit& cu, const DeblockEdgeDir ed
   {
     xoffset      = 0;
     yoffset      = uiNumPelsLuma;
-    iOffset      = 1;
     iSrcStep     = iStride;
     piTmpSrcCb  += iEdge*uiPelsInPartChromaH;
     piTmpSrcCr  += iEdge*uiPelsInPartChromaH;
@@ -1173,7 +1146,6 @@ void LoopFilter::xEdgeFilterChroma(const CodingUnit& cu, const DeblockEdgeDir ed
   {
     xoffset      = uiNumPelsLuma;
     yoffset      = 0;
-    iOffset      = iStride;
     iSrcStep     = 1;
     piTmpSrcCb  += iEdge*iStride*uiPelsInPartChromaV;
     piTmpSrcCr  += iEdge*iStride*uiPelsInPartChromaV;
@@ -1237,6 +1209,8 @@ void LoopFilter::xEdgeFilterChroma(const CodingUnit& cu, const DeblockEdgeDir ed
         largeBoundary = false;
       }
 
+      const int subSamplingShift = ( edgeDir == EDGE_VER ) ? m_shiftVer : m_shiftHor;
+
       for( int chromaIdx = 0; chromaIdx < 2; chromaIdx++ )
       {
         if ((bS[chromaIdx] == 2) || (largeBoundary && (bS[chromaIdx] == 1)))
@@ -1250,45 +1224,63 @@ void LoopFilter::xEdgeFilterChroma(const CodingUnit& cu, const DeblockEdgeDir ed
 
         const int iIndexTC = Clip3<int>(0, MAX_QP + DEFAULT_INTRA_TC_OFFSET, iQP + DEFAULT_INTRA_TC_OFFSET * (bS[chromaIdx] - 1) + (tcOffsetDiv2 << 1));
         const int iTc = sps.getBitDepth(CHANNEL_TYPE_CHROMA) < 10 ? ((sm_tcTable[iIndexTC] + 2) >> (10 - sps.getBitDepth(CHANNEL_TYPE_CHROMA))) : ((sm_tcTable[iIndexTC]) << (sps.getBitDepth(CHANNEL_TYPE_CHROMA) - 10));
-        bool useLongFilter = false;
-        if (largeBoundary)
-        {
         const int indexB = Clip3<int>(0, MAX_QP, iQP + (betaOffsetDiv2 << 1));
         const int beta = sm_betaTable[indexB] * iBitdepthScale;
 
-        const int dp0 = xCalcDP(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 0), iOffset);
-        const int dq0 = xCalcDQ(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 0), iOffset);
-        const int subSamplingShift = ( edgeDir == EDGE_VER ) ? m_shiftVer : m_shiftHor;
-        const int dp3 = ( subSamplingShift == 1 ) ? xCalcDP(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 1), iOffset) : xCalcDP(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 3), iOffset);
-        const int dq3 = ( subSamplingShift == 1 ) ? xCalcDQ(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 1), iOffset) : xCalcDQ(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 3), iOffset);
+        m_filterChromaEdge( piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength), iStride, edgeDir, uiLoopLength, subSamplingShift, iTc, beta, largeBoundary, bPartPNoFilter, bPartQNoFilter, clpRng );
+        }
+      }
+    }
+  }
+}
+
+/**
+ - decisions and filtering of the lines of a chroma edge
+ .
+ \param src              pointer to the first q0 sample
+ \param stride           stride of the picture
+ \param edgeDir          edge direction, the lines are rows for the vertical edges
+ \param numLines         number of lines
+ \param subSamplingShift chroma subsampling along the edge, selects the second line of the decision
+ \param tc, beta         filter parameters of the edge
+ \param largeBoundary    the blocks on both sides allow the strong filter
+ \param partPNoFilter    keep the P samples (lossless or palette coded)
+ \param partQNoFilter    keep the Q samples (lossless or palette coded)
+ */
+void LoopFilter::filterChromaEdge( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int numLines, const int subSamplingShift, const int tc, const int beta,
+                                   const bool largeBoundary, const bool partPNoFilter, const bool partQNoFilter, const ClpRng& clpRng )
+{
+  const int iOffset  = edgeDir == EDGE_VER ? 1 : stride;
+  const int iSrcStep = edgeDir == EDGE_VER ? stride : 1;
+
+  if( largeBoundary )
+  {
+    const int dp0 = xCalcDP( src, iOffset );
+    const int dq0 = xCalcDQ( src, iOffset );
+    const int dp3 = ( subSamplingShift == 1 ) ? xCalcDP( src + iSrcStep, iOffset ) : xCalcDP( src + iSrcStep * 3, iOffset );
+    const int dq3 = ( subSamplingShift == 1 ) ? xCalcDQ( src + iSrcStep, iOffset ) : xCalcDQ( src + iSrcStep * 3, iOffset );
 
-        const int d0 = dp0 + dq0;
-        const int d3 = dp3 + dq3;
-        const int d = d0 + d3;
+    const int d0 = dp0 + dq0;
+    const int d3 = dp3 + dq3;
+    const int d  = d0 + d3;
 
-          if (d < beta)
-          {
-            useLongFilter = true;
-            const bool sw = xUseStrongFiltering(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + 0), iOffset, 2 * d0, beta, iTc)
-                && xUseStrongFiltering(piTmpSrcChroma + iSrcStep*(iIdx*uiLoopLength + ( ( subSamplingShift == 1 ) ? 1 : 3 ) ), iOffset, 2 * d3, beta, iTc);
+    if( d < beta )
+    {
+      const bool sw = xUseStrongFiltering( src, iOffset, 2 * d0, beta, tc )
+                   && xUseStrongFiltering( src + iSrcStep * ( ( subSamplingShift == 1 ) ? 1 : 3 ), iOffset, 2 * d3, beta, tc );
 
-            for (unsigned step = 0; step < uiLoopLength; step++)
-            {
-              xPelFilterChroma(piTmpSrcChroma + iSrcStep*(step + iIdx*uiLoopLength), iOffset, iTc, sw, bPartPNoFilter, bPartQNoFilter, clpRng, largeBoundary);
-            }
-          }
-        }
-        if ( !useLongFilter )
-        {
-          for (unsigned step = 0; step < uiLoopLength; step++)
-          {
-            xPelFilterChroma(piTmpSrcChroma + iSrcStep*(step + iIdx*uiLoopLength), iOffset, iTc, false, bPartPNoFilter, bPartQNoFilter, clpRng, largeBoundary);
-          }
-        }
-        }
+      for( int step = 0; step < numLines; step++ )
+      {
+        xPelFilterChroma( src + iSrcStep * step, iOffset, tc, sw, partPNoFilter, partQNoFilter, clpRng, largeBoundary );
       }
+      return;
     }
   }
+
+  for( int step = 0; step < numLines; step++ )
+  {
+    xPelFilterChroma( src + iSrcStep * step, iOffset, tc, false, partPNoFilter, partQNoFilter, clpRng, largeBoundary );
+  }
 }
 
 
@@ -1307,7 +1299,7 @@ void LoopFilter::xEdgeFilterChroma(const CodingUnit& cu, const DeblockEdgeDir ed
  \param bFilterSecondQ  decision weak filter/no filter for partQ
  \param bitDepthLuma    luma bit depth
 */
-inline void LoopFilter::xBilinearFilter(Pel* srcP, Pel* srcQ, int offset, int refMiddle, int refP, int refQ, int numberPSide, int numberQSide, const int* dbCoeffsP, const int* dbCoeffsQ, int tc) const
+inline void LoopFilter::xBilinearFilter(Pel* srcP, Pel* srcQ, int offset, int refMiddle, int refP, int refQ, int numberPSide, int numberQSide, const int* dbCoeffsP, const int* dbCoeffsQ, int tc)
 {
     int src;
     const char tc7[7] = { 6, 5, 4, 3, 2, 1, 1};
@@ -1328,7 +1320,7 @@ inline void LoopFilter::xBilinearFilter(Pel* srcP, Pel* srcQ, int offset, int re
     }
 }
 
-inline void LoopFilter::xFilteringPandQ(Pel* src, int offset, int numberPSide, int numberQSide, int tc) const
+inline void LoopFilter::xFilteringPandQ(Pel* src, int offset, int numberPSide, int numberQSide, int tc)
 {
   CHECK(numberPSide <= 3 && numberQSide <= 3, "Short filtering in long filtering function");
   Pel* srcP = src-offset;
@@ -1402,7 +1394,7 @@ inline void LoopFilter::xFilteringPandQ(Pel* src, int offset, int numberPSide, i
   xBilinearFilter(srcP,srcQ,offset,refMiddle,refP,refQ,numberPSide,numberQSide,dbCoeffsP,dbCoeffsQ,tc);
 }
 
-inline void LoopFilter::xPelFilterLuma(Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const int iThrCut, const bool bFilterSecondP, const bool bFilterSecondQ, const ClpRng& clpRng, bool sidePisLarge, bool sideQisLarge, int maxFilterLengthP, int maxFilterLengthQ) const
+inline void LoopFilter::xPelFilterLuma(Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const int iThrCut, const bool bFilterSecondP, const bool bFilterSecondQ, const ClpRng& clpRng, bool sidePisLarge, bool sideQisLarge, int maxFilterLengthP, int maxFilterLengthQ)
 {
   int delta;
 
@@ -1502,7 +1494,7 @@ inline void LoopFilter::xPelFilterLuma(Pel* piSrc, const int iOffset, const int
  \param bPartQNoFilter  indicator to disable filtering on partQ
  \param bitDepthChroma  chroma bit depth
  */
-inline void LoopFilter::xPelFilterChroma( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng, const bool largeBoundary ) const
+inline void LoopFilter::xPelFilterChroma( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng, const bool largeBoundary )
 {
   int delta;
 
@@ -1561,9 +1553,9 @@ inline void LoopFilter::xPelFilterChroma( Pel* piSrc, const int iOffset, const i
  \param tc              tc value
  \param piSrc           pointer to picture data
  */
-inline bool LoopFilter::xUseStrongFiltering( Pel* piSrc, const int iOffset, const int d, const int beta, const int tc, bool sidePisLarge, bool sideQisLarge, int maxFilterLengthP, int maxFilterLengthQ ) const
+inline bool LoopFilter::xUseStrongFiltering( Pel* piSrc, const int iOffset, const int d, const int beta, const int tc, bool sidePisLarge, bool sideQisLarge, int maxFilterLengthP, int maxFilterLengthQ )
 {
-  auto      start    = high_resolution_clock::now();
+  PROFILE_ZONE( "LoopFilter::xUseStrongFiltering" );
 
   const Pel m4 = piSrc[ 0          ];
   const Pel m3 = piSrc[-iOffset    ];
@@ -1605,35 +1597,26 @@ inline bool LoopFilter::xUseStrongFiltering( Pel* piSrc, const int iOffset, cons
       sq3 = (sq3 + abs(m11 - m7) + 1) >> 1;
       //sq3 = (calculateSum(sq3 , abs(m11 - m7) + 1, 8, 7)) >> 1;
     }
-    auto stop        = high_resolution_clock::now();
-    auto duration    = duration_cast<nanoseconds>(stop - start);
-    timeOfXUseStrongFiltering = timeOfXUseStrongFiltering + duration.count();
 
     return ((sp3 + sq3) < (beta*3 >> 5)) && (d < (beta >> 2)) && (abs(m3 - m4) < ((tc * 5 + 1) >> 1));
     //return ((calculateSum(sp3 , sq3, 8, 7)) < (beta * 3 >> 5)) && (d < (beta >> 2)) && (abs(m3 - m4) < ((tc * 5 + 1) >> 1));
   }
   else {
-    auto stop                 = high_resolution_clock::now();
-    auto duration             = duration_cast<nanoseconds>(stop - start);
-    timeOfXUseStrongFiltering = timeOfXUseStrongFiltering + duration.count();
     return ((d_strong < (beta >> 3)) && (d < (beta >> 2)) && (abs(m3 - m4) < ((tc * 5 + 1) >> 1)));
   }
   
 }
 
-inline int LoopFilter::xCalcDP( Pel* piSrc, const int iOffset ) const
+inline int LoopFilter::xCalcDP( Pel* piSrc, const int iOffset )
 {
   return abs( piSrc[-iOffset * 3] - 2 * piSrc[-iOffset * 2] + piSrc[-iOffset] );
 }
 
-inline int LoopFilter::xCalcDQ( Pel* piSrc, const int iOffset ) const
+inline int LoopFilter::xCalcDQ( Pel* piSrc, const int iOffset )
 {
-  auto start  = high_resolution_clock::now();
+  PROFILE_ZONE( "LoopFilter::xCalcDQ" );
   int output = abs(piSrc[0] - 2 * piSrc[iOffset] + piSrc[iOffset * 2]);
 
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfXCalcDQ         = timeOfXCalcDQ + duration.count();
   return output;
 }
 
@@ -47,11 +47,6 @@
 
 #define DEBLOCK_SMALLEST_BLOCK  8
 
-extern long long int timeOfXCalcDQ;
-extern long long int timeOfXUseStrongFiltering;
-extern long long int timeOfXSetEdgefilterMultiple;
-extern long long int timeOfxSetLoopfilterParam;
-
 // ====================================================================================================================
 // Class definition
 // ====================================================================================================================
@@ -93,23 +88,38 @@ private:
   void xSetMaxFilterLengthPQFromTransformSizes( const DeblockEdgeDir edgeDir, const CodingUnit& cu, const TransformUnit& currTU );
   void xSetMaxFilterLengthPQForCodingSubBlocks( const DeblockEdgeDir edgeDir, const CodingUnit& cu, const PredictionUnit& currPU, const bool& mvSubBlocks, const int& subBlockSize, const Area& areaPu );
 
-  inline void xBilinearFilter     ( Pel* srcP, Pel* srcQ, int offset, int refMiddle, int refP, int refQ, int numberPSide, int numberQSide, const int* dbCoeffsP, const int* dbCoeffsQ, int tc ) const;
-  inline void xFilteringPandQ     ( Pel* src, int offset, int numberPSide, int numberQSide, int tc ) const;
-  inline void xPelFilterLuma      ( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const int iThrCut, const bool bFilterSecondP, const bool bFilterSecondQ, const ClpRng& clpRng, bool sidePisLarge = false, bool sideQisLarge = false, int maxFilterLengthP = 7, int maxFilterLengthQ = 7 ) const;
-  inline void xPelFilterChroma    ( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng, const bool largeBoundary ) const;
-  inline bool xUseStrongFiltering ( Pel* piSrc, const int iOffset, const int d, const int beta, const int tc, bool sidePisLarge = false, bool sideQisLarge = false, int maxFilterLengthP = 7, int maxFilterLengthQ = 7 ) const;//move the computation outside the function
+  static inline void xBilinearFilter     ( Pel* srcP, Pel* srcQ, int offset, int refMiddle, int refP, int refQ, int numberPSide, int numberQSide, const int* dbCoeffsP, const int* dbCoeffsQ, int tc );
+  static inline void xFilteringPandQ     ( Pel* src, int offset, int numberPSide, int numberQSide, int tc );
+  static inline void xPelFilterLuma      ( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const int iThrCut, const bool bFilterSecondP, const bool bFilterSecondQ, const ClpRng& clpRng, bool sidePisLarge = false, bool sideQisLarge = false, int maxFilterLengthP = 7, int maxFilterLengthQ = 7 );
+  static inline void xPelFilterChroma    ( Pel* piSrc, const int iOffset, const int tc, const bool sw, const bool bPartPNoFilter, const bool bPartQNoFilter, const ClpRng& clpRng, const bool largeBoundary );
+  static inline bool xUseStrongFiltering ( Pel* piSrc, const int iOffset, const int d, const int beta, const int tc, bool sidePisLarge = false, bool sideQisLarge = false, int maxFilterLengthP = 7, int maxFilterLengthQ = 7 );//move the computation outside the function
   inline unsigned BsSet(unsigned val, const ComponentID compIdx) const;
   inline unsigned BsGet(unsigned val, const ComponentID compIdx) const;
 
   inline bool isCrossedByVirtualBoundaries ( const int xPos, const int yPos, const int width, const int height, int& numHorVirBndry, int& numVerVirBndry, int horVirBndryPos[], int verVirBndryPos[], const PPS* pps );
   inline void xDeriveEdgefilterParam       ( const int xPos, const int yPos, const int numVerVirBndry, const int numHorVirBndry, const int verVirBndryPos[], const int horVirBndryPos[], bool &verEdgeFilter, bool &horEdgeFilter );
 
-  inline int xCalcDP              ( Pel* piSrc, const int iOffset ) const;
-  inline int xCalcDQ              ( Pel* piSrc, const int iOffset ) const;
+  static inline int xCalcDP              ( Pel* piSrc, const int iOffset );
+  static inline int xCalcDQ              ( Pel* piSrc, const int iOffset );
   static const uint16_t sm_tcTable[MAX_QP + 3];
   static const uint8_t sm_betaTable[MAX_QP + 1];
 
 public:
+  static void filterLumaEdge4     ( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int tc, const int beta, const int maxFilterLengthP, const int maxFilterLengthQ,
+                                    const bool sidePisLarge, const bool sideQisLarge, const bool partPNoFilter, const bool partQNoFilter, const ClpRng& clpRng );
+  static void filterChromaEdge    ( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int numLines, const int subSamplingShift, const int tc, const int beta,
+                                    const bool largeBoundary, const bool partPNoFilter, const bool partQNoFilter, const ClpRng& clpRng );
+
+  void (*m_filterLumaEdge4)       ( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int tc, const int beta, const int maxFilterLengthP, const int maxFilterLengthQ,
+                                    const bool sidePisLarge, const bool sideQisLarge, const bool partPNoFilter, const bool partQNoFilter, const ClpRng& clpRng );
+  void (*m_filterChromaEdge)      ( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int numLines, const int subSamplingShift, const int tc, const int beta,
+                                    const bool largeBoundary, const bool partPNoFilter, const bool partQNoFilter, const ClpRng& clpRng );
+
+#ifdef TARGET_SIMD_X86
+  void initLoopFilterX86();
+  template <X86_VEXT vext>
+  void _initLoopFilterX86();
+#endif
 
   LoopFilter();
   ~LoopFilter();
@@ -126,6 +136,8 @@ public:
   /// picture-level deblocking filter
   void loopFilterPic              ( CodingStructure& cs
                                     );
+  /// deblocking of one edge direction in a CTU row
+  void loopFilterCtuRow           ( CodingStructure& cs, const DeblockEdgeDir edgeDir, const int ctuRow );
 
   static int getBeta              ( const int qp )
   {
@@ -56,6 +56,14 @@ MatrixIntraPrediction::MatrixIntraPrediction():
   m_upsmpFactorHor( 0 ),
   m_upsmpFactorVer( 0 )
 {
+  m_reducedPredMatrixMul   = reducedPredMatrixMul;
+  m_predictionUpsampling1D = predictionUpsampling1D;
+
+#if ENABLE_SIMD_OPT_MIP
+#ifdef TARGET_SIMD_X86
+  initMatrixIntraPredictionX86();
+#endif
+#endif
 }
 
 
@@ -298,10 +306,10 @@ void MatrixIntraPrediction::predictionUpsampling(int* const dst, const int* cons
       int* const     horDst       = dst + ( m_upsmpFactorVer - 1 ) * m_blockSize.width;
       const SizeType horDstStride = m_upsmpFactorVer * m_blockSize.width;
 
-     predictionUpsampling1D( horDst, src, m_refSamplesLeft.data(),
-                             m_reducedPredictionSize.width, m_reducedPredictionSize.height,
-                             horSrcStep, horSrcStride, 1, horDstStride,
-                             m_upsmpFactorVer, m_upsmpFactorHor );
+     m_predictionUpsampling1D( horDst, src, m_refSamplesLeft.data(),
+                               m_reducedPredictionSize.width, m_reducedPredictionSize.height,
+                               horSrcStep, horSrcStride, 1, horDstStride,
+                               m_upsmpFactorVer, m_upsmpFactorHor );
 
       verSrc       = horDst;
       verSrcStep   = horDstStride;
@@ -313,10 +321,10 @@ void MatrixIntraPrediction::predictionUpsampling(int* const dst, const int* cons
       verSrcStep   = transpose ? 1 : m_blockSize.width;
       verSrcStride = transpose ? m_reducedPredictionSize.height : 1;
     }
-    predictionUpsampling1D( dst, verSrc, m_refSamplesTop.data(),
-                            m_reducedPredictionSize.height, m_blockSize.width,
-                            verSrcStep, verSrcStride, m_blockSize.width, 1,
-                            1, m_upsmpFactorVer );
+    m_predictionUpsampling1D( dst, verSrc, m_refSamplesTop.data(),
+                              m_reducedPredictionSize.height, m_blockSize.width,
+                              verSrcStep, verSrcStride, m_blockSize.width, 1,
+                              1, m_upsmpFactorVer );
   }
   else
   {
@@ -332,10 +340,10 @@ void MatrixIntraPrediction::predictionUpsampling(int* const dst, const int* cons
       const SizeType verDstStep   = m_blockSize.width;
       const SizeType verDstStride = m_upsmpFactorHor;
 
-      predictionUpsampling1D( verDst, src, m_refSamplesTop.data(),
-                              m_reducedPredictionSize.height, m_reducedPredictionSize.width,
-                              verSrcStep, verSrcStride, verDstStep, verDstStride,
-                              m_upsmpFactorHor, m_upsmpFactorVer );
+      m_predictionUpsampling1D( verDst, src, m_refSamplesTop.data(),
+                                m_reducedPredictionSize.height, m_reducedPredictionSize.width,
+                                verSrcStep, verSrcStride, verDstStep, verDstStride,
+                                m_upsmpFactorHor, m_upsmpFactorVer );
 
       horSrc = verDst;
       horSrcStep = verDstStride;
@@ -347,10 +355,10 @@ void MatrixIntraPrediction::predictionUpsampling(int* const dst, const int* cons
       horSrcStep   = transpose ? m_blockSize.height : 1;
       horSrcStride = transpose ? 1 : m_reducedPredictionSize.width;
     }
-    predictionUpsampling1D( dst, horSrc, m_refSamplesLeft.data(),
-                            m_reducedPredictionSize.width, m_blockSize.height,
-                            horSrcStep, horSrcStride, 1, m_blockSize.width,
-                            1, m_upsmpFactorHor );
+    m_predictionUpsampling1D( dst, horSrc, m_refSamplesLeft.data(),
+                              m_reducedPredictionSize.width, m_blockSize.height,
+                              horSrcStep, horSrcStride, 1, m_blockSize.width,
+                              1, m_upsmpFactorHor );
   }
 }
 
@@ -393,7 +401,6 @@ void MatrixIntraPrediction::computeReducedPred(int*const result, const int* cons
   const int offset = (1 << (shiftMatrix - 1)) - offsetMatrix * sum;
   CHECK(inputSize != 4 * (inputSize >> 2), "Error, input size not divisible by four");
 
-  const uint8_t *weight = matrix;
   const int   inputOffset = transpose ? m_inputOffsetTransp : m_inputOffset;
 
   const int intermediateWidth  = transpose ? m_reducedPredictionSize.height : m_reducedPredictionSize.width;
@@ -402,11 +409,35 @@ void MatrixIntraPrediction::computeReducedPred(int*const result, const int* cons
   const int yStep = leaveVerOut ? intermediateWidth : 0;
 
   const int redSize = (m_blockSize.width <= 8 && m_blockSize.height <= 8) ? 0 : 1;
+  m_reducedPredMatrixMul( resPtr, input, matrix, inputSize, redSize, intermediateWidth, intermediateHeight,
+                          xStep, yStep, offset, shiftMatrix, inputOffset, bitDepth );
+
+  // Re-transpose if no upsampling will be done.
+  if( transpose && !needUpsampling )
+  {
+    for( int y = 0; y < m_reducedPredictionSize.height; y++ )
+    {
+      for( int x = 0; x < m_reducedPredictionSize.width; x++ )
+      {
+        CHECKD( x * m_reducedPredictionSize.height + y >= m_reducedPredictionSize.area(), "error" );
+        result[ y * m_reducedPredictionSize.width + x ] = resPtr[ x * m_reducedPredictionSize.height + y ];
+      }
+    }
+  }
+}
+
+void MatrixIntraPrediction::reducedPredMatrixMul( int* const result, const int* const input, const uint8_t* matrix,
+                                                  const int inputSize, const int redSize, const int width, const int height,
+                                                  const int xStep, const int yStep, const int offset, const int shiftMatrix,
+                                                  const int inputOffset, const int bitDepth )
+{
+  const uint8_t *weight = matrix;
+
   if ( redSize ) weight += xStep-1;
   int posRes  = 0;
-  for (int y = 0; y < intermediateHeight; y++)
+  for (int y = 0; y < height; y++)
   {
-    for (int x = 0; x < intermediateWidth; x++)
+    for (int x = 0; x < width; x++)
     {
       if(redSize) weight -= xStep;
       int tmp0 = redSize ? 0 : (input[0] * weight[0]);
@@ -420,24 +451,11 @@ void MatrixIntraPrediction::computeReducedPred(int*const result, const int* cons
         tmp2 += input[i + 2] * weight[i + 2];
         tmp3 += input[i + 3] * weight[i + 3];
       }
-      resPtr[posRes++] = ClipBD<int>( ((tmp0 + tmp1 + tmp2 + tmp3 + offset) >> shiftMatrix) + inputOffset, bitDepth );
+      result[posRes++] = ClipBD<int>( ((tmp0 + tmp1 + tmp2 + tmp3 + offset) >> shiftMatrix) + inputOffset, bitDepth );
 
       weight  += xStep * inputSize;
     }
     weight  += yStep * (inputSize - redSize);
   }
-
-  // Re-transpose if no upsampling will be done.
-  if( transpose && !needUpsampling )
-  {
-    for( int y = 0; y < m_reducedPredictionSize.height; y++ )
-    {
-      for( int x = 0; x < m_reducedPredictionSize.width; x++ )
-      {
-        CHECKD( x * m_reducedPredictionSize.height + y >= m_reducedPredictionSize.area(), "error" );
-        result[ y * m_reducedPredictionSize.width + x ] = resPtr[ x * m_reducedPredictionSize.height + y ];
-      }
-    }
-  }
 }
 
@@ -53,6 +53,17 @@ public:
   void prepareInputForPred(const CPelBuf &pSrc, const Area& block, const int bitDepth);
   void predBlock(int* const result, const int modeIdx, const int bitDepth);
 
+  static void reducedPredMatrixMul( int* const result, const int* const input, const uint8_t* matrix,
+                                    const int inputSize, const int redSize, const int width, const int height,
+                                    const int xStep, const int yStep, const int offset, const int shiftMatrix,
+                                    const int inputOffset, const int bitDepth );
+  static void predictionUpsampling1D( int* const dst, const int* const src, const int* const bndry,
+                                      const SizeType srcSizeUpsmpDim, const SizeType srcSizeOrthDim,
+                                      const SizeType srcStep, const SizeType srcStride,
+                                      const SizeType dstStep, const SizeType dstStride,
+                                      const SizeType bndryStep,
+                                      const unsigned int upsmpFactor );
+
   private:
     static_vector<int, MIP_MAX_INPUT_SIZE> m_reducedBoundary;           // downsampled             boundary of a block
     static_vector<int, MIP_MAX_INPUT_SIZE> m_reducedBoundaryTransposed; // downsampled, transposed boundary of a block
@@ -74,12 +85,6 @@ public:
     static void doDownsampling( int* dst, const int* src, const SizeType srcLen, const SizeType dstLen );
 
     void predictionUpsampling( int* const dst, const int* const src, const bool transpose ) const;
-    static void predictionUpsampling1D( int* const dst, const int* const src, const int* const bndry,
-                                        const SizeType srcSizeUpsmpDim, const SizeType srcSizeOrthDim,
-                                        const SizeType srcStep, const SizeType srcStride,
-                                        const SizeType dstStep, const SizeType dstStride,
-                                        const SizeType bndryStep,
-                                        const unsigned int upsmpFactor );
 
     void getMatrixData(const uint8_t*& matrix, int &shiftMatrix, int &offsetMatrix, const int modeIdx) const;
 
@@ -90,6 +95,23 @@ public:
                              const bool leaveHorOut, const bool leaveVerOut,
                              const int shiftMatrix, const int offsetMatrix,
                              const bool transpose, const bool needUpsampling, const int bitDepth );
+
+    void (*m_reducedPredMatrixMul)  ( int* const result, const int* const input, const uint8_t* matrix,
+                                      const int inputSize, const int redSize, const int width, const int height,
+                                      const int xStep, const int yStep, const int offset, const int shiftMatrix,
+                                      const int inputOffset, const int bitDepth );
+    void (*m_predictionUpsampling1D)( int* const dst, const int* const src, const int* const bndry,
+                                      const SizeType srcSizeUpsmpDim, const SizeType srcSizeOrthDim,
+                                      const SizeType srcStep, const SizeType srcStride,
+                                      const SizeType dstStep, const SizeType dstStride,
+                                      const SizeType bndryStep,
+                                      const unsigned int upsmpFactor );
+
+#ifdef TARGET_SIMD_X86
+    void initMatrixIntraPredictionX86();
+    template <X86_VEXT vext>
+    void _initMatrixIntraPredictionX86();
+#endif
   };
 
 #endif //__MATRIXINTRAPPREDICTION__
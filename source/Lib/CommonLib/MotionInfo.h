@@ -41,12 +41,7 @@
 
 #include "CommonDef.h"
 #include "Mv.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
+#include "Profiler.h"
 
 //! \ingroup CommonLib
 //! \{
@@ -210,13 +205,10 @@ public:
                         , const int mvpIdx
   )
   {
-    auto start = high_resolution_clock::now();
+    PROFILE_ZONE( "GBiMotionParam::copyAffineMvFrom" );
     memcpy(m_mvAffine[bP4][uiRefList][uiRefIdx], racAffineMvs, 3 * sizeof(Mv));
     m_distAffine[bP4][uiRefList][uiRefIdx] = uiDist;
     m_mvpIdx[bP4][uiRefList][uiRefIdx]     = mvpIdx;
-    auto stop                              = high_resolution_clock::now();
-    auto duration                          = duration_cast<nanoseconds>(stop - start);
-    timeOfCopyAffineMvFrom                 = timeOfCopyAffineMvFrom + duration.count();
   }
 
   void copyAffineMvTo(Mv acAffineMvs[3], Distortion& ruiDist, uint32_t uiRefList, uint32_t uiRefIdx, int bP4
@@ -39,17 +39,7 @@
 
 #include "Common.h"
 #include "Slice.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-long long int timeOfRoundAffineMv = 0;
-long long int timeOfChangeAffinePrecInternal2Amvr = 0;
-long long int timeOfRoundAffinePrecInternal2Amvr  = 0;
-long long int timeOfCopyAffineMvFrom              = 0;
+#include "Profiler.h"
 
 const MvPrecision Mv::m_amvrPrecision[4] = { MV_PRECISION_QUARTER, MV_PRECISION_INT, MV_PRECISION_4PEL, MV_PRECISION_HALF }; // for cu.imv=0, 1, 2 and 3
 const MvPrecision Mv::m_amvrPrecAffine[3] = { MV_PRECISION_QUARTER, MV_PRECISION_SIXTEENTH, MV_PRECISION_INT }; // for cu.imv=0, 1 and 2
@@ -57,13 +47,10 @@ const MvPrecision Mv::m_amvrPrecIbc[3] = { MV_PRECISION_INT, MV_PRECISION_INT, M
 
 void roundAffineMv( int& mvx, int& mvy, int nShift )
 {
-  auto      start   = high_resolution_clock::now();
+  PROFILE_ZONE( "roundAffineMv" );
   const int nOffset = 1 << (nShift - 1);
   mvx = (mvx + nOffset - (mvx >= 0)) >> nShift;
   mvy = (mvy + nOffset - (mvy >= 0)) >> nShift;
-  auto stop = high_resolution_clock::now();
-  auto duration = duration_cast<nanoseconds>(stop - start);
-  timeOfRoundAffineMv = timeOfRoundAffineMv + duration.count();
 }
 
 void clipMv( Mv& rcMv, const Position& pos, const struct Size& size, const SPS& sps, const PPS& pps )
@@ -39,19 +39,7 @@
 #define __MV__
 
 #include "CommonDef.h"
-
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-
-extern long long int timeOfRoundAffineMv;
-extern long long int timeOfChangeAffinePrecInternal2Amvr;
-extern long long int timeOfRoundAffinePrecInternal2Amvr;
-extern long long int timeOfCopyAffineMvFrom;
+#include "Profiler.h"
 
 //! \ingroup CommonLib
 //! \{
@@ -234,13 +222,9 @@ public:
   // affine MV
   void changeAffinePrecInternal2Amvr(const int amvr)
   {
-    auto start = high_resolution_clock::now();
+    PROFILE_ZONE( "Mv::changeAffinePrecInternal2Amvr" );
 
     changePrecision(MV_PRECISION_INTERNAL, m_amvrPrecAffine[amvr]);
-
-    auto stop                = high_resolution_clock::now();
-    auto duration            = duration_cast<nanoseconds>(stop - start);
-    timeOfChangeAffinePrecInternal2Amvr = timeOfChangeAffinePrecInternal2Amvr + duration.count();
   }
 
   void changeAffinePrecAmvr2Internal(const int amvr)
@@ -250,11 +234,8 @@ public:
 
   void roundAffinePrecInternal2Amvr(const int amvr)
   {
-    auto start = high_resolution_clock::now();
+    PROFILE_ZONE( "Mv::roundAffinePrecInternal2Amvr" );
     roundToPrecision(MV_PRECISION_INTERNAL, m_amvrPrecAffine[amvr]);
-    auto stop                = high_resolution_clock::now();
-    auto duration            = duration_cast<nanoseconds>(stop - start);
-    timeOfRoundAffinePrecInternal2Amvr = timeOfRoundAffinePrecInternal2Amvr + duration.count();
   }
 
   // IBC block vector
@@ -139,6 +139,7 @@ int g_splitJobId( 0 );
 
 Scheduler::Scheduler() :
 #if ENABLE_WPP_PARALLELISM
+  m_firstDataId( 0 ),
   m_numWppThreads( 1 ),
   m_numWppDataInstances( 1 )
 #endif
@@ -235,14 +236,14 @@ unsigned Scheduler::getWppDataId( int lID ) const
 #if ENABLE_SPLIT_PARALLELISM
   if( m_numSplitThreads > 1 )
   {
-    return tId * NUM_RESERVERD_SPLIT_JOBS;
+    return m_firstDataId + tId * NUM_RESERVERD_SPLIT_JOBS;
   }
   else
   {
-    return tId;
+    return m_firstDataId + tId;
   }
 #else
-  return tId;
+  return m_firstDataId + tId;
 #endif
 }
 
@@ -272,8 +273,10 @@ unsigned Scheduler::getDataId() const
   {
     return getWppDataId();
   }
-#endif
+  return m_firstDataId;
+#else
   return 0;
+#endif
 }
 
 bool Scheduler::init( const int ctuYsize, const int ctuXsize, const int numWppThreadsRunning, const int numWppExtraLines, const int numSplitThreads )
@@ -282,8 +285,6 @@ bool Scheduler::init( const int ctuYsize, const int ctuXsize, const int numWppTh
   m_numSplitThreads = numSplitThreads;
 #endif
 #if ENABLE_WPP_PARALLELISM
-  m_firstNonFinishedLine    = 0;
-  m_numWppThreadsRunning    = 1;
   m_numWppDataInstances     = numWppThreadsRunning+numWppExtraLines;
   m_numWppThreads           = numWppThreadsRunning;
   m_ctuYsize                = ctuYsize;
@@ -302,7 +303,19 @@ bool Scheduler::init( const int ctuYsize, const int ctuXsize, const int numWppTh
     CHECK( m_SyncObjs.size() != ctuYsize, "");
   }
 
-  for( int i = 0; i < ctuYsize; i++ )
+  resetWpp();
+#endif
+
+  return true;
+}
+
+#if ENABLE_WPP_PARALLELISM
+void Scheduler::resetWpp()
+{
+  m_firstNonFinishedLine = 0;
+  m_numWppThreadsRunning = 1;
+
+  for( int i = 0; i < m_ctuYsize; i++ )
   {
     m_SyncObjs[i]->reset();
   }
@@ -310,18 +323,16 @@ bool Scheduler::init( const int ctuYsize, const int ctuXsize, const int numWppTh
   if( m_numWppThreads != m_numWppDataInstances )
   {
     m_LineDone.clear();
-    m_LineDone.resize(ctuYsize, -1);
+    m_LineDone.resize(m_ctuYsize, -1);
 
     m_LineProc.clear();
-    m_LineProc.resize(ctuYsize, false);
+    m_LineProc.resize(m_ctuYsize, false);
 
     m_SyncObjs[0]->set(0,0);
     m_LineProc[0]=true;
   }
-#endif
-
-  return true;
 }
+#endif
 
 
 int Scheduler::getNumPicInstances() const
@@ -340,9 +351,10 @@ void Scheduler::wait( const int ctuPosX, const int ctuPosY )
 {
   if( m_numWppThreads == m_numWppDataInstances )
   {
-    if( ctuPosY > 0 && ctuPosX+1 < m_ctuXsize)
+    if( ctuPosY > 0 )
     {
-      m_SyncObjs[ctuPosY-1]->wait( ctuPosX+1, ctuPosY-1 );
+      // top-right CTU, or the top one in the last column
+      m_SyncObjs[ctuPosY-1]->wait( std::min( ctuPosX+1, m_ctuXsize-1 ), ctuPosY-1 );
     }
     return;
   }
@@ -819,6 +831,7 @@ void Picture::create(const ChromaFormat &_chromaFormat, const Size &size, const
 #if !KEEP_PRED_AND_RESI_SIGNALS
 
   m_ctuArea = UnitArea( _chromaFormat, Area( Position{ 0, 0 }, Size( _maxCUSize, _maxCUSize ) ) );
+  m_picTempBuffers = false;
 #endif
   m_hashMap.clearAll();
 }
@@ -869,12 +882,13 @@ void Picture::destroy()
   }
 }
 
-void Picture::createTempBuffers( const unsigned _maxCUSize )
+void Picture::createTempBuffers( const unsigned _maxCUSize, const bool picTempBuffers )
 {
 #if KEEP_PRED_AND_RESI_SIGNALS
   const Area a( Position{ 0, 0 }, lumaSize() );
 #else
-  const Area a = m_ctuArea.Y();
+  m_picTempBuffers = picTempBuffers;
+  const Area a = picTempBuffers ? Area( Position{ 0, 0 }, lumaSize() ) : m_ctuArea.Y();
 #endif
 
 #if ENABLE_SPLIT_PARALLELISM
@@ -1452,7 +1466,7 @@ PelBuf Picture::getBuf( const CompArea &blk, const PictureType &type )
   const int jId = ( type == PIC_ORIGINAL || type == PIC_TRUE_ORIGINAL || type == PIC_ORIGINAL_INPUT || type == PIC_TRUE_ORIGINAL_INPUT ) ? 0 : scheduler.getSplitPicId();
 #endif
 #if !KEEP_PRED_AND_RESI_SIGNALS
-  if( type == PIC_RESIDUAL || type == PIC_PREDICTION )
+  if( ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) && !m_picTempBuffers )
   {
     CompArea localBlk = blk;
     localBlk.x &= ( cs->pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
@@ -1477,7 +1491,7 @@ const CPelBuf Picture::getBuf( const CompArea &blk, const PictureType &type ) co
 
 #endif
 #if !KEEP_PRED_AND_RESI_SIGNALS
-  if( type == PIC_RESIDUAL || type == PIC_PREDICTION )
+  if( ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) && !m_picTempBuffers )
   {
     CompArea localBlk = blk;
     localBlk.x &= ( cs->pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
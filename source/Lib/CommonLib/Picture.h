@@ -53,8 +53,8 @@
 #include "CommonLib/InterpolationFilter.h"
 
 #if ENABLE_WPP_PARALLELISM || ENABLE_SPLIT_PARALLELISM
-#if ENABLE_WPP_PARALLELISM
 #include <mutex>
+#if ENABLE_WPP_PARALLELISM
 class SyncObj;
 #endif
 
@@ -80,11 +80,16 @@ public:
   unsigned getWppDataId  ( int lId = CURR_THREAD_ID ) const;
   unsigned getWppThreadId() const;
   void     setWppThreadId( const int tId = CURR_THREAD_ID );
+  // the picture is encoded with the CU encoder stacks starting at firstDataId, see EncLib::getSliceEncoder
+  void     setFirstDataId( const int firstDataId ) { m_firstDataId = firstDataId; }
 #endif
   unsigned getDataId     () const;
   bool init              ( const int ctuYsize, const int ctuXsize, const int numWppThreadsRunning, const int numWppExtraLines, const int numSplitThreads );
   int  getNumPicInstances() const;
+  // guards the units temporarily added to the picture coding structure by the parallel jobs
+  std::mutex& getPicCsMutex() { return m_picCsMutex; }
 #if ENABLE_WPP_PARALLELISM
+  void resetWpp          ();
   void setReady          ( const int ctuPosX, const int ctuPosY );
   void wait              ( const int ctuPosX, const int ctuPosY );
 
@@ -93,6 +98,7 @@ private:
 
 private:
   int m_firstNonFinishedLine;
+  int m_firstDataId;
   int m_numWppThreads;
   int m_numWppThreadsRunning;
   int m_numWppDataInstances;
@@ -109,6 +115,8 @@ private:
   int   m_numSplitThreads;
   bool  m_hasParallelBuffer;
 #endif
+
+  std::mutex m_picCsMutex;
 };
 #endif
 
@@ -200,8 +208,12 @@ struct Picture : public UnitArea
   void create(const ChromaFormat &_chromaFormat, const Size &size, const unsigned _maxCUSize, const unsigned margin, const bool bDecoder);
   void destroy();
 
-  void createTempBuffers( const unsigned _maxCUSize );
+  // the prediction and residual buffers cover one CTU, or the whole picture when the CTUs are reconstructed in parallel
+  void createTempBuffers( const unsigned _maxCUSize, const bool picTempBuffers = false );
   void destroyTempBuffers();
+#if !KEEP_PRED_AND_RESI_SIGNALS
+  bool getCtuTempBuffers() const { return !m_picTempBuffers; }
+#endif
 
          PelBuf     getOrigBuf(const CompArea &blk);
   const CPelBuf     getOrigBuf(const CompArea &blk) const;
@@ -307,6 +319,7 @@ public:
 #if !KEEP_PRED_AND_RESI_SIGNALS
 private:
   UnitArea m_ctuArea;
+  bool     m_picTempBuffers;
 #endif
 
 #if ENABLE_SPLIT_PARALLELISM
@@ -0,0 +1,401 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     Profiler.cpp
+    \brief    Scoped zone profiler
+*/
+
+#include "Profiler.h"
+
+#if ENABLE_PROFILING
+
+#include <mutex>
+#include <fstream>
+#include <map>
+#include <algorithm>
+
+//! \ingroup CommonLib
+//! \{
+
+static std::mutex                                      s_profMutex;
+static std::vector<std::string>                        s_profZones;
+static std::vector<ProfThread*>                        s_profThreads;
+static size_t                                          s_profMaxTraceEvents = 0;
+static const ProfTicks                                 s_profStartTicks     = getProfTicks();
+static const std::chrono::steady_clock::time_point     s_profStartTime      = std::chrono::steady_clock::now();
+
+bool Profiler::m_kernelStats = false;
+
+// ====================================================================================================================
+// ProfThread
+// ====================================================================================================================
+
+ProfThread::ProfThread( int id )
+  : m_id            ( id )
+  , m_current       ( 0 )
+  , m_maxTraceEvents( 0 )
+{
+  m_nodes.reserve( 1024 );
+  m_nodes.push_back( ProfNode{ -1, -1, -1, -1, 0, 0, 0 } );
+}
+
+int ProfThread::xAddNode( int zone )
+{
+  const int node = ( int ) m_nodes.size();
+  m_nodes.push_back( ProfNode{ zone, m_current, -1, m_nodes[m_current].firstChild, 0, 0, 0 } );
+  m_nodes[m_current].firstChild = node;
+  return node;
+}
+
+// ====================================================================================================================
+// Profiler
+// ====================================================================================================================
+
+int Profiler::registerZone( const char* name )
+{
+  std::lock_guard<std::mutex> lock( s_profMutex );
+  for( int i = 0; i < ( int ) s_profZones.size(); i++ )
+  {
+    if( s_profZones[i] == name )
+    {
+      return i;
+    }
+  }
+  s_profZones.push_back( name );
+  return ( int ) s_profZones.size() - 1;
+}
+
+const char* Profiler::getZoneName( int zone )
+{
+  std::lock_guard<std::mutex> lock( s_profMutex );
+  return zone < 0 ? "total" : s_profZones[zone].c_str();
+}
+
+ProfThread* Profiler::xCreateThread()
+{
+  std::lock_guard<std::mutex> lock( s_profMutex );
+  ProfThread* thread = new ProfThread( ( int ) s_profThreads.size() );
+  thread->setMaxTraceEvents( s_profMaxTraceEvents );
+  s_profThreads.push_back( thread );
+  return thread;
+}
+
+void Profiler::enableTrace( size_t maxEvents )
+{
+  std::lock_guard<std::mutex> lock( s_profMutex );
+  s_profMaxTraceEvents = maxEvents;
+  for( ProfThread* thread : s_profThreads )
+  {
+    thread->setMaxTraceEvents( maxEvents );
+  }
+}
+
+double Profiler::getTicksPerSecond()
+{
+#if PROFILER_USE_RDTSC
+  const ProfTicks ticks   = getProfTicks() - s_profStartTicks;
+  const double    seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - s_profStartTime ).count();
+  return seconds > 0 ? ticks / seconds : 1e9;
+#else
+  return 1e9;
+#endif
+}
+
+// call tree of all threads merged by zone path
+struct ProfTreeNode
+{
+  int              zone;
+  uint64_t         calls;
+  ProfTicks        inclusive;
+  ProfTicks        children;
+  std::vector<int> childNodes;
+};
+
+static void xMergeCallTree( std::vector<ProfTreeNode>& tree, int dst, const std::vector<ProfNode>& nodes, int src )
+{
+  tree[dst].calls     += nodes[src].calls;
+  tree[dst].inclusive += nodes[src].inclusive;
+  tree[dst].children  += nodes[src].children;
+
+  for( int child = nodes[src].firstChild; child >= 0; child = nodes[child].nextSibling )
+  {
+    int merged = -1;
+    for( int c : tree[dst].childNodes )
+    {
+      if( tree[c].zone == nodes[child].zone )
+      {
+        merged = c;
+      }
+    }
+    if( merged < 0 )
+    {
+      merged = ( int ) tree.size();
+      tree.push_back( ProfTreeNode{ nodes[child].zone, 0, 0, 0, std::vector<int>() } );
+      tree[dst].childNodes.push_back( merged );
+    }
+    xMergeCallTree( tree, merged, nodes, child );
+  }
+}
+
+// returns the call tree of one thread or of all threads merged (nullptr), the root is the first node
+static std::vector<ProfTreeNode> xGetCallTree( const ProfThread* thread )
+{
+  std::vector<ProfTreeNode> tree( 1, ProfTreeNode{ -1, 0, 0, 0, std::vector<int>() } );
+  std::lock_guard<std::mutex> lock( s_profMutex );
+  for( const ProfThread* t : s_profThreads )
+  {
+    if( thread == nullptr || thread == t )
+    {
+      xMergeCallTree( tree, 0, t->getNodes(), 0 );
+    }
+  }
+  // the root is not a zone, its inclusive time is the sum of the top level zones
+  tree[0].inclusive = tree[0].children;
+  tree[0].calls     = 1;
+  return tree;
+}
+
+static void xPrintNode( FILE* fp, const std::vector<ProfTreeNode>& tree, int node, int depth, double msPerTick, double minPercent )
+{
+  const ProfTreeNode& n       = tree[node];
+  const double        percent = tree[0].inclusive ? 100.0 * n.inclusive / tree[0].inclusive : 0.0;
+  if( node && percent < minPercent )
+  {
+    return;
+  }
+  fprintf( fp, "%*s%-*s %12llu %14.3f %14.3f %7.2f\n", 2 * depth, "", 60 - 2 * std::min( depth, 20 ), Profiler::getZoneName( n.zone ),
+           ( unsigned long long ) n.calls, n.inclusive * msPerTick, ( n.inclusive - n.children ) * msPerTick, percent );
+  for( int child : n.childNodes )
+  {
+    xPrintNode( fp, tree, child, depth + 1, msPerTick, minPercent );
+  }
+}
+
+void Profiler::printCallTree( FILE* fp, double minPercent )
+{
+  const std::vector<ProfTreeNode> tree      = xGetCallTree( nullptr );
+  const double                    msPerTick = 1000.0 / getTicksPerSecond();
+
+  fprintf( fp, "\n%-60s %12s %14s %14s %7s\n", "zone", "calls", "incl. [ms]", "self [ms]", "[%]" );
+  xPrintNode( fp, tree, 0, 0, msPerTick, minPercent );
+}
+
+static void xWriteCsvNode( std::ostream& os, const std::vector<ProfTreeNode>& tree, int node, const std::string& parentPath, int threadId, double msPerTick )
+{
+  const ProfTreeNode& n    = tree[node];
+  const std::string   path = node ? parentPath + "/" + Profiler::getZoneName( n.zone ) : std::string( Profiler::getZoneName( n.zone ) );
+
+  os << threadId << "," << path << "," << n.calls << "," << n.inclusive * msPerTick << "," << ( n.inclusive - n.children ) * msPerTick << ","
+     << ( tree[0].inclusive ? 100.0 * n.inclusive / tree[0].inclusive : 0.0 ) << "\n";
+  for( int child : n.childNodes )
+  {
+    xWriteCsvNode( os, tree, child, path, threadId, msPerTick );
+  }
+}
+
+bool Profiler::writeCallTreeCsv( const std::string& fileName )
+{
+  std::ofstream os( fileName.c_str() );
+  if( !os )
+  {
+    return false;
+  }
+  const double msPerTick = 1000.0 / getTicksPerSecond();
+
+  std::vector<ProfThread*> threads;
+  {
+    std::lock_guard<std::mutex> lock( s_profMutex );
+    threads = s_profThreads;
+  }
+  os << "thread,path,calls,inclusive(ms),self(ms),inclusive(%)\n";
+  for( const ProfThread* thread : threads )
+  {
+    xWriteCsvNode( os, xGetCallTree( thread ), 0, "", thread->getId(), msPerTick );
+  }
+  return true;
+}
+
+static void xWriteJsonNode( std::ostream& os, const std::vector<ProfTreeNode>& tree, int node, int depth, double msPerTick )
+{
+  const ProfTreeNode& n = tree[node];
+  const std::string   indent( 2 * depth, ' ' );
+
+  os << indent << "{ \"name\": \"" << Profiler::getZoneName( n.zone ) << "\", \"calls\": " << n.calls << ", \"inclusive_ms\": " << n.inclusive * msPerTick
+     << ", \"self_ms\": " << ( n.inclusive - n.children ) * msPerTick << ", \"children\": [";
+  for( size_t i = 0; i < n.childNodes.size(); i++ )
+  {
+    os << ( i ? ",\n" : "\n" );
+    xWriteJsonNode( os, tree, n.childNodes[i], depth + 1, msPerTick );
+  }
+  os << ( n.childNodes.empty() ? "] }" : "\n" + indent + "] }" );
+}
+
+bool Profiler::writeCallTreeJson( const std::string& fileName )
+{
+  std::ofstream os( fileName.c_str() );
+  if( !os )
+  {
+    return false;
+  }
+  const double msPerTick = 1000.0 / getTicksPerSecond();
+
+  std::vector<ProfThread*> threads;
+  {
+    std::lock_guard<std::mutex> lock( s_profMutex );
+    threads = s_profThreads;
+  }
+  os << "{ \"threads\": [";
+  for( size_t i = 0; i < threads.size(); i++ )
+  {
+    os << ( i ? ",\n" : "\n" ) << "  { \"thread\": " << threads[i]->getId() << ", \"tree\":\n";
+    xWriteJsonNode( os, xGetCallTree( threads[i] ), 0, 2, msPerTick );
+    os << " }";
+  }
+  os << "\n] }\n";
+  return true;
+}
+
+bool Profiler::writeCallTree( const std::string& fileName )
+{
+  const size_t dot = fileName.find_last_of( '.' );
+  if( dot != std::string::npos && fileName.substr( dot ) == ".json" )
+  {
+    return writeCallTreeJson( fileName );
+  }
+  return writeCallTreeCsv( fileName );
+}
+
+bool Profiler::writeChromeTrace( const std::string& fileName )
+{
+  std::ofstream os( fileName.c_str() );
+  if( !os )
+  {
+    return false;
+  }
+  const double usPerTick = 1000000.0 / getTicksPerSecond();
+
+  std::lock_guard<std::mutex> lock( s_profMutex );
+  os << "{ \"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  bool first = true;
+  for( const ProfThread* thread : s_profThreads )
+  {
+    for( const ProfEvent& e : thread->getTrace() )
+    {
+      os << ( first ? "\n" : ",\n" ) << "{ \"name\": \"" << s_profZones[e.zone] << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << thread->getId()
+         << ", \"ts\": " << ( e.begin - s_profStartTicks ) * usPerTick << ", \"dur\": " << ( e.end - e.begin ) * usPerTick << " }";
+      first = false;
+    }
+  }
+  os << "\n] }\n";
+  return true;
+}
+
+// kernel histogram of all threads merged, ordered by zone name, width, height and bit depth
+struct ProfKernelRow
+{
+  std::string    name;
+  int            width;
+  int            height;
+  int            bitDepth;
+  ProfKernelStat stat;
+};
+
+static std::vector<ProfKernelRow> xGetKernelStats()
+{
+  std::map<uint64_t, ProfKernelStat> merged;
+  std::vector<ProfKernelRow>         rows;
+  std::lock_guard<std::mutex> lock( s_profMutex );
+  for( const ProfThread* thread : s_profThreads )
+  {
+    for( const auto& kernel : thread->getKernels() )
+    {
+      ProfKernelStat& stat = merged[kernel.first];
+      stat.calls += kernel.second.calls;
+      stat.ticks += kernel.second.ticks;
+    }
+  }
+  for( const auto& kernel : merged )
+  {
+    const uint64_t key = kernel.first;
+    rows.push_back( ProfKernelRow{ s_profZones[key >> 40], int( ( key >> 24 ) & 0xffff ), int( ( key >> 8 ) & 0xffff ), int( key & 0xff ), kernel.second } );
+  }
+  std::sort( rows.begin(), rows.end(), []( const ProfKernelRow& a, const ProfKernelRow& b )
+  {
+    return a.name != b.name ? a.name < b.name : a.width != b.width ? a.width < b.width : a.height != b.height ? a.height < b.height : a.bitDepth < b.bitDepth;
+  } );
+  return rows;
+}
+
+void Profiler::printKernelStats( FILE* fp, double minPercent )
+{
+  std::vector<ProfKernelRow> rows = xGetKernelStats();
+  ProfTicks                  total = 0;
+  for( const ProfKernelRow& row : rows )
+  {
+    total += row.stat.ticks;
+  }
+  // most expensive first
+  std::stable_sort( rows.begin(), rows.end(), []( const ProfKernelRow& a, const ProfKernelRow& b ) { return a.stat.ticks > b.stat.ticks; } );
+
+  fprintf( fp, "\n%-48s %6s %6s %3s %12s %16s %12s %7s\n", "kernel", "width", "height", "bd", "calls", getTicksName(), "per call", "[%]" );
+  for( const ProfKernelRow& row : rows )
+  {
+    const double percent = total ? 100.0 * row.stat.ticks / total : 0.0;
+    if( percent < minPercent )
+    {
+      continue;
+    }
+    fprintf( fp, "%-48s %6d %6d %3d %12llu %16llu %12.1f %7.2f\n", row.name.c_str(), row.width, row.height, row.bitDepth, ( unsigned long long ) row.stat.calls,
+             ( unsigned long long ) row.stat.ticks, double( row.stat.ticks ) / row.stat.calls, percent );
+  }
+}
+
+bool Profiler::writeKernelStatsCsv( const std::string& fileName )
+{
+  std::ofstream os( fileName.c_str() );
+  if( !os )
+  {
+    return false;
+  }
+  os << "kernel,width,height,bitdepth,calls," << getTicksName() << "," << getTicksName() << "/call\n";
+  for( const ProfKernelRow& row : xGetKernelStats() )
+  {
+    os << row.name << "," << row.width << "," << row.height << "," << row.bitDepth << "," << row.stat.calls << "," << row.stat.ticks << ","
+       << double( row.stat.ticks ) / row.stat.calls << "\n";
+  }
+  return true;
+}
+
+//! \}
+
+#endif
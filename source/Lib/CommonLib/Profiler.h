@@ -0,0 +1,280 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     Profiler.h
+    \brief    Scoped zone profiler (header)
+
+    A zone is opened with PROFILE_ZONE( "name" ) and closed at the end of the enclosing scope,
+    PROFILE_ZONE_BEGIN / PROFILE_ZONE_END are used for regions that do not match a scope.
+    Each thread records its own call tree (calls, inclusive and child ticks per node) and
+    optionally a list of events for the Chrome trace format. Everything is compiled out
+    when ENABLE_PROFILING is 0.
+
+    PROFILE_KERNEL( "name", width, height, bitDepth ) is used at the dispatch of the block
+    kernels. When enabled with Profiler::enableKernelStats(), calls and ticks are collected
+    per kernel and (width, height, bit depth), independent of the call tree.
+*/
+
+#ifndef __PROFILER__
+#define __PROFILER__
+
+#include "CommonDef.h"
+
+#if ENABLE_PROFILING
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <unordered_map>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) || defined( _M_IX86 )
+#define PROFILER_USE_RDTSC                                1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define PROFILER_USE_RDTSC                                0
+#endif
+
+//! \ingroup CommonLib
+//! \{
+
+typedef uint64_t ProfTicks;
+
+static inline ProfTicks getProfTicks()
+{
+#if PROFILER_USE_RDTSC
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+}
+
+struct ProfNode
+{
+  int       zone;           ///< index in the zone registry, -1 for the root
+  int       parent;         ///< parent node, -1 for the root
+  int       firstChild;
+  int       nextSibling;
+  uint64_t  calls;
+  ProfTicks inclusive;      ///< ticks spent in the zone, children included
+  ProfTicks children;       ///< ticks spent in the child zones
+};
+
+struct ProfEvent
+{
+  int       zone;
+  ProfTicks begin;
+  ProfTicks end;
+};
+
+struct ProfKernelStat
+{
+  uint64_t  calls;
+  ProfTicks ticks;
+};
+
+// key of the kernel histogram: zone | width | height | bit depth
+static inline uint64_t getProfKernelKey( int zone, int width, int height, int bitDepth )
+{
+  return ( uint64_t( zone ) << 40 ) | ( uint64_t( width & 0xffff ) << 24 ) | ( uint64_t( height & 0xffff ) << 8 ) | uint64_t( bitDepth & 0xff );
+}
+
+/// call tree and trace events of one thread
+class ProfThread
+{
+public:
+  ProfThread( int id );
+
+  int  enter( int zone )
+  {
+    int child = m_nodes[m_current].firstChild;
+    while( child >= 0 && m_nodes[child].zone != zone )
+    {
+      child = m_nodes[child].nextSibling;
+    }
+    if( child < 0 )
+    {
+      child = xAddNode( zone );
+    }
+    m_current = child;
+    return child;
+  }
+
+  void leave( int node, ProfTicks begin, ProfTicks end )
+  {
+    ProfNode& n = m_nodes[node];
+    n.calls++;
+    n.inclusive += end - begin;
+    m_nodes[n.parent].children += end - begin;
+    m_current = n.parent;
+    if( m_trace.size() < m_maxTraceEvents )
+    {
+      m_trace.push_back( ProfEvent{ n.zone, begin, end } );
+    }
+  }
+
+  void addKernel( int zone, int width, int height, int bitDepth, ProfTicks ticks )
+  {
+    ProfKernelStat& stat = m_kernels[getProfKernelKey( zone, width, height, bitDepth )];
+    stat.calls++;
+    stat.ticks += ticks;
+  }
+
+  int                           getId()    const { return m_id; }
+  const std::vector<ProfNode>&  getNodes() const { return m_nodes; }
+  const std::vector<ProfEvent>& getTrace() const { return m_trace; }
+  const std::unordered_map<uint64_t, ProfKernelStat>& getKernels() const { return m_kernels; }
+  void                          setMaxTraceEvents( size_t maxEvents ) { m_maxTraceEvents = maxEvents; }
+
+private:
+  int  xAddNode( int zone );
+
+  int                    m_id;
+  int                    m_current;
+  std::vector<ProfNode>  m_nodes;
+  std::vector<ProfEvent> m_trace;
+  size_t                 m_maxTraceEvents;
+  std::unordered_map<uint64_t, ProfKernelStat> m_kernels;
+};
+
+/// static zone registry, per thread data and the exports
+class Profiler
+{
+public:
+  static int         registerZone      ( const char* name );
+  static const char* getZoneName       ( int zone );
+  static ProfThread& getThread         ()
+  {
+    static thread_local ProfThread* thread = nullptr;
+    if( thread == nullptr )
+    {
+      thread = xCreateThread();
+    }
+    return *thread;
+  }
+
+  // records up to maxEvents events per thread for writeChromeTrace(), call before the profiled threads are running
+  static void        enableTrace       ( size_t maxEvents );
+  static double      getTicksPerSecond ();
+  static const char* getTicksName      () { return PROFILER_USE_RDTSC ? "cycles" : "ns"; }
+
+  // collects the PROFILE_KERNEL histogram, call before the kernel dispatch tables are initialized
+  static void        enableKernelStats ()       { m_kernelStats = true; }
+  static bool        getKernelStats    ()       { return m_kernelStats; }
+
+  static void        printCallTree     ( FILE* fp, double minPercent );
+  static bool        writeCallTreeCsv  ( const std::string& fileName );
+  static bool        writeCallTreeJson ( const std::string& fileName );
+  // JSON for a .json file name, CSV otherwise
+  static bool        writeCallTree     ( const std::string& fileName );
+  static bool        writeChromeTrace  ( const std::string& fileName );
+
+  // kernels below minPercent of the histogram ticks are not printed
+  static void        printKernelStats  ( FILE* fp, double minPercent );
+  static bool        writeKernelStatsCsv( const std::string& fileName );
+
+private:
+  static ProfThread* xCreateThread     ();
+
+  static bool        m_kernelStats;
+};
+
+class ProfScope
+{
+public:
+  ProfScope( int zone ) : m_thread( Profiler::getThread() ), m_node( m_thread.enter( zone ) ), m_begin( getProfTicks() ) {}
+  ~ProfScope() { stop(); }
+
+  void stop()
+  {
+    if( m_node >= 0 )
+    {
+      m_thread.leave( m_node, m_begin, getProfTicks() );
+      m_node = -1;
+    }
+  }
+
+private:
+  ProfThread& m_thread;
+  int         m_node;
+  ProfTicks   m_begin;
+};
+
+class ProfKernelScope
+{
+public:
+  ProfKernelScope( int zone, int width, int height, int bitDepth )
+    : m_zone( Profiler::getKernelStats() ? zone : -1 ), m_width( width ), m_height( height ), m_bitDepth( bitDepth ), m_begin( m_zone >= 0 ? getProfTicks() : 0 ) {}
+  ~ProfKernelScope()
+  {
+    if( m_zone >= 0 )
+    {
+      Profiler::getThread().addKernel( m_zone, m_width, m_height, m_bitDepth, getProfTicks() - m_begin );
+    }
+  }
+
+private:
+  int       m_zone;
+  int       m_width;
+  int       m_height;
+  int       m_bitDepth;
+  ProfTicks m_begin;
+};
+
+#define PROFILE_CONCAT_( a, b )                           a##b
+#define PROFILE_CONCAT( a, b )                            PROFILE_CONCAT_( a, b )
+#define PROFILE_ZONE( name )                              static const int PROFILE_CONCAT( profZone, __LINE__ ) = Profiler::registerZone( name ); \
+                                                          ProfScope PROFILE_CONCAT( profScope, __LINE__ )( PROFILE_CONCAT( profZone, __LINE__ ) )
+#define PROFILE_ZONE_BEGIN( scope, name )                 static const int scope##Zone = Profiler::registerZone( name ); ProfScope scope( scope##Zone )
+#define PROFILE_ZONE_END( scope )                         scope.stop()
+#define PROFILE_KERNEL( name, width, height, bitDepth )   static const int PROFILE_CONCAT( profKernel, __LINE__ ) = Profiler::registerZone( name ); \
+                                                          ProfKernelScope PROFILE_CONCAT( profKernelScope, __LINE__ )( PROFILE_CONCAT( profKernel, __LINE__ ), width, height, bitDepth )
+#define PROFILE_KERNEL_ID( zone, width, height, bitDepth ) ProfKernelScope PROFILE_CONCAT( profKernelScope, __LINE__ )( zone, width, height, bitDepth )
+
+//! \}
+
+#else
+
+#define PROFILE_ZONE( name )
+#define PROFILE_ZONE_BEGIN( scope, name )
+#define PROFILE_ZONE_END( scope )
+#define PROFILE_KERNEL( name, width, height, bitDepth )
+#define PROFILE_KERNEL_ID( zone, width, height, bitDepth )
+
+#endif
+
+#endif // __PROFILER__
@@ -130,6 +130,17 @@ QpParam::QpParam(const TransformUnit& tu, const ComponentID &compIDX, const int
 Quant::Quant( const Quant* other )
 {
   xInitScalingList( other );
+
+  m_quantBlock         = quantBlock;
+  m_dequantBlock       = dequantBlock;
+  m_hasNonZeroLevel    = hasNonZeroLevel;
+  m_estimateRdoqLevels = estimateRdoqLevels;
+
+#if ENABLE_SIMD_OPT_QUANT
+#ifdef TARGET_SIMD_X86
+  initQuantX86();
+#endif
+#endif
 }
 
 Quant::~Quant()
@@ -410,30 +421,7 @@ void Quant::dequant(const TransformUnit &tu,
     const uint32_t uiLog2TrHeight = floorLog2(uiHeight);
     int *piDequantCoef        = getDequantCoeff(scalingListType, QP_rem, uiLog2TrWidth, uiLog2TrHeight);
 
-    if(rightShift > 0)
-    {
-      const Intermediate_Int iAdd = (Intermediate_Int) 1 << (rightShift - 1);
-
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = ((Intermediate_Int(clipQCoef) * piDequantCoef[n]) + iAdd ) >> rightShift;
-
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
-    }
-    else
-    {
-      const int leftShift = -rightShift;
-
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * piDequantCoef[n]) << leftShift;
-
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
-    }
+    m_dequantBlock( piQCoef, piCoef, numSamplesInBlock, piDequantCoef, 0, rightShift, inputMinimum, inputMaximum, transformMinimum, transformMaximum );
   }
   else
   {
@@ -447,31 +435,94 @@ void Quant::dequant(const TransformUnit &tu,
     const Intermediate_Int inputMinimum        = -(1 << (targetInputBitDepth - 1));
     const Intermediate_Int inputMaximum        =  (1 << (targetInputBitDepth - 1)) - 1;
 
-    if (rightShift > 0)
-    {
-      const Intermediate_Int iAdd = (Intermediate_Int) 1 << (rightShift - 1);
+    m_dequantBlock( piQCoef, piCoef, numSamplesInBlock, nullptr, scale, rightShift, inputMinimum, inputMaximum, transformMinimum, transformMaximum );
+  }
+}
 
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * scale + iAdd) >> rightShift;
+void Quant::dequantBlock( const TCoeff* src, TCoeff* dst, const int numCoeffs, const int* dequantCoeff, const int scale, const int rightShift,
+                          const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff transformMinimum, const TCoeff transformMaximum )
+{
+  if( rightShift > 0 )
+  {
+    const Intermediate_Int iAdd = (Intermediate_Int) 1 << (rightShift - 1);
 
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
+    for( int n = 0; n < numCoeffs; n++ )
+    {
+      const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, src[n]));
+      const Intermediate_Int iCoeffQ   = ((Intermediate_Int(clipQCoef) * (dequantCoeff ? dequantCoeff[n] : scale)) + iAdd ) >> rightShift;
+
+      dst[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
     }
-    else
+  }
+  else
+  {
+    const int leftShift = -rightShift;
+
+    for( int n = 0; n < numCoeffs; n++ )
     {
-      const int leftShift = -rightShift;
+      const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, src[n]));
+      const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * (dequantCoeff ? dequantCoeff[n] : scale)) << leftShift;
 
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * scale) << leftShift;
+      dst[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
+    }
+  }
+}
 
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
+void Quant::quantBlock( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, TCoeff& absSum, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff,
+                        const int64_t add, const int qBits, const TCoeff entropyCodingMinimum, const TCoeff entropyCodingMaximum )
+{
+  const int qBits8 = qBits - 8;
+
+  for( int n = 0; n < numCoeffs; n++ )
+  {
+    const TCoeff iLevel   = src[n];
+    const TCoeff iSign    = (iLevel < 0 ? -1: 1);
+
+    const int64_t  tmpLevel = (int64_t)abs(iLevel) * (quantCoeff ? quantCoeff[n] : defaultQuantCoeff);
+
+    const TCoeff quantisedMagnitude = TCoeff((tmpLevel + add ) >> qBits);
+    deltaU[n] = (TCoeff)((tmpLevel - ((int64_t)quantisedMagnitude<<qBits) )>> qBits8);
+
+    absSum += quantisedMagnitude;
+    const TCoeff quantisedCoefficient = quantisedMagnitude * iSign;
+
+    dst[n] = Clip3<TCoeff>( entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient );
+  }
+}
+
+bool Quant::hasNonZeroLevel( const TCoeff* src, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits )
+{
+  for( int n = 0; n < numCoeffs; n++ )
+  {
+    const int64_t tmpLevel = (int64_t)abs(src[n]) * (quantCoeff ? quantCoeff[n] : defaultQuantCoeff);
+
+    if( TCoeff((tmpLevel + add) >> qBits) != 0 )
+    {
+      return true;
     }
   }
+  return false;
+}
+
+bool Quant::estimateRdoqLevels( const TCoeff* src, Intermediate_Int* levelDouble, TCoeff* maxAbsLevel, double* uncodedCost, const int numCoeffs, const int* quantCoeff,
+                                const double* errScale, const int defaultQuantCoeff, const double defaultErrScale, const int qBits, const TCoeff entropyCodingMaximum )
+{
+  bool nonZero = false;
+
+  for( int n = 0; n < numCoeffs; n++ )
+  {
+    const int64_t          tmpLevel     = int64_t(abs(src[n])) * (quantCoeff ? quantCoeff[n] : defaultQuantCoeff);
+    const Intermediate_Int lLevelDouble = (Intermediate_Int)std::min<int64_t>(tmpLevel, std::numeric_limits<Intermediate_Int>::max() - (Intermediate_Int(1) << (qBits - 1)));
+    const uint32_t         uiMaxAbsLevel = std::min<uint32_t>(uint32_t(entropyCodingMaximum), uint32_t((lLevelDouble + (Intermediate_Int(1) << (qBits - 1))) >> qBits));
+    const double           dErr         = double( lLevelDouble );
+
+    levelDouble[n] = lLevelDouble;
+    maxAbsLevel[n] = uiMaxAbsLevel;
+    uncodedCost[n] = dErr * dErr * (errScale ? errScale[n] : defaultErrScale);
+    nonZero       |= uiMaxAbsLevel > 0;
+  }
+
+  return nonZero;
 }
 
 void Quant::init( uint32_t uiMaxTrSize,
@@ -963,26 +1014,12 @@ void Quant::quant(TransformUnit &tu, const ComponentID &compID, const CCoeffBuf
     // QBits will be OK for any internal bit depth as the reduction in transform shift is balanced by an increase in Qp_per due to QpBDOffset
 
     const int64_t iAdd = int64_t(tu.cs->slice->isIRAP() ? 171 : 85) << int64_t(iQBits - 9);
-    const int qBits8 = iQBits - 8;
 
     const uint32_t lfnstIdx = tu.cu->lfnstIdx;
     const int maxNumberOfCoeffs = lfnstIdx > 0 ? ((( uiWidth == 4 && uiHeight == 4 ) || ( uiWidth == 8 && uiHeight == 8) ) ? 8 : 16) : piQCoef.area();
     memset( piQCoef.buf, 0, sizeof(TCoeff) * piQCoef.area() );
-    for (int uiBlockPos = 0; uiBlockPos < maxNumberOfCoeffs; uiBlockPos++ )
-    {
-      const TCoeff iLevel   = piCoef.buf[uiBlockPos];
-      const TCoeff iSign    = (iLevel < 0 ? -1: 1);
-
-      const int64_t  tmpLevel = (int64_t)abs(iLevel) * (enableScalingLists ? piQuantCoeff[uiBlockPos] : defaultQuantisationCoefficient);
-
-      const TCoeff quantisedMagnitude = TCoeff((tmpLevel + iAdd ) >> iQBits);
-      deltaU[uiBlockPos] = (TCoeff)((tmpLevel - ((int64_t)quantisedMagnitude<<iQBits) )>> qBits8);
-
-      uiAbsSum += quantisedMagnitude;
-      const TCoeff quantisedCoefficient = quantisedMagnitude * iSign;
-
-      piQCoef.buf[uiBlockPos] = Clip3<TCoeff>( entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient );
-    } // for n
+    m_quantBlock( piCoef.buf, piQCoef.buf, deltaU, uiAbsSum, maxNumberOfCoeffs, enableScalingLists ? piQuantCoeff : nullptr, defaultQuantisationCoefficient,
+                  iAdd, iQBits, entropyCodingMinimum, entropyCodingMaximum );
     if( tu.cu->bdpcmMode && isLuma(compID) )
     {
       fwdResDPCM( tu, compID );
@@ -1042,18 +1079,7 @@ bool Quant::xNeedRDOQ(TransformUnit &tu, const ComponentID &compID, const CCoeff
   // iAdd is different from the iAdd used in normal quantization
   const int64_t iAdd = int64_t(compID == COMPONENT_Y ? 171 : 256) << (iQBits - 9);
 
-  for (int uiBlockPos = 0; uiBlockPos < rect.area(); uiBlockPos++)
-  {
-    const TCoeff iLevel   = piCoef.buf[uiBlockPos];
-    const int64_t  tmpLevel = (int64_t)abs(iLevel) * (enableScalingLists ? piQuantCoeff[uiBlockPos] : defaultQuantisationCoefficient);
-    const TCoeff quantisedMagnitude = TCoeff((tmpLevel + iAdd ) >> iQBits);
-
-    if (quantisedMagnitude != 0)
-    {
-      return true;
-    }
-  } // for n
-  return false;
+  return m_hasNonZeroLevel( piCoef.buf, rect.area(), enableScalingLists ? piQuantCoeff : nullptr, defaultQuantisationCoefficient, iAdd, iQBits );
 }
 
 
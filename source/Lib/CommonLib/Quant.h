@@ -139,6 +139,15 @@ public:
   // de-quantization
   virtual void dequant           ( const TransformUnit &tu, CoeffBuf &dstCoeff, const ComponentID &compID, const QpParam &cQP );
 
+  // per coefficient kernels, quantCoeff/dequantCoeff/errScale are nullptr when no scaling list is used
+  static void quantBlock         ( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, TCoeff& absSum, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff,
+                                   const int64_t add, const int qBits, const TCoeff entropyCodingMinimum, const TCoeff entropyCodingMaximum );
+  static void dequantBlock       ( const TCoeff* src, TCoeff* dst, const int numCoeffs, const int* dequantCoeff, const int scale, const int rightShift,
+                                   const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff transformMinimum, const TCoeff transformMaximum );
+  static bool hasNonZeroLevel    ( const TCoeff* src, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits );
+  static bool estimateRdoqLevels ( const TCoeff* src, Intermediate_Int* levelDouble, TCoeff* maxAbsLevel, double* uncodedCost, const int numCoeffs, const int* quantCoeff,
+                                   const double* errScale, const int defaultQuantCoeff, const double defaultErrScale, const int qBits, const TCoeff entropyCodingMaximum );
+
 #if ENABLE_SPLIT_PARALLELISM
   virtual void copyState         ( const Quant& other );
 #endif
@@ -156,6 +165,20 @@ protected:
 #if T0196_SELECTIVE_RDOQ
   bool     m_useSelectiveRDOQ;
 #endif
+
+  void ( *m_quantBlock )        ( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, TCoeff& absSum, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff,
+                                  const int64_t add, const int qBits, const TCoeff entropyCodingMinimum, const TCoeff entropyCodingMaximum );
+  void ( *m_dequantBlock )      ( const TCoeff* src, TCoeff* dst, const int numCoeffs, const int* dequantCoeff, const int scale, const int rightShift,
+                                  const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff transformMinimum, const TCoeff transformMaximum );
+  bool ( *m_hasNonZeroLevel )   ( const TCoeff* src, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits );
+  bool ( *m_estimateRdoqLevels )( const TCoeff* src, Intermediate_Int* levelDouble, TCoeff* maxAbsLevel, double* uncodedCost, const int numCoeffs, const int* quantCoeff,
+                                  const double* errScale, const int defaultQuantCoeff, const double defaultErrScale, const int qBits, const TCoeff entropyCodingMaximum );
+
+#ifdef TARGET_SIMD_X86
+  void initQuantX86();
+  template <X86_VEXT vext>
+  void _initQuantX86();
+#endif
 private:
   void xInitScalingList   ( const Quant* other );
   void xDestroyScalingList();
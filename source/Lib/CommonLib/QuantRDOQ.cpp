@@ -44,20 +44,11 @@
 
 #include "dtrace_next.h"
 #include "dtrace_buffer.h"
+#include "Profiler.h"
 
 #include <stdlib.h>
 #include <limits>
 #include <memory.h>
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-
-long long int timeOfXGetCodedLevelTSPred = 0;
-
 
 struct coeffGroupRDStats
 {
@@ -626,12 +617,6 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
   TCoeff *deltaU       = m_deltaU;
 
   memset(piDstCoeff, 0, sizeof(*piDstCoeff) * uiMaxNumCoeff);
-  memset( m_pdCostCoeff,  0, sizeof( double ) *  uiMaxNumCoeff );
-  memset( m_pdCostSig,    0, sizeof( double ) *  uiMaxNumCoeff );
-  memset( m_rateIncUp,    0, sizeof( int    ) *  uiMaxNumCoeff );
-  memset( m_rateIncDown,  0, sizeof( int    ) *  uiMaxNumCoeff );
-  memset( m_sigRateDelta, 0, sizeof( int    ) *  uiMaxNumCoeff );
-  memset( m_deltaU,       0, sizeof( TCoeff ) *  uiMaxNumCoeff );
 
 
   const bool needSqrtAdjustment= TU::needsBlockSizeTrafoScale( tu, compID );
@@ -647,6 +632,31 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
   const TCoeff entropyCodingMinimum = -(1 << maxLog2TrDynamicRange);
   const TCoeff entropyCodingMaximum =  (1 << maxLog2TrDynamicRange) - 1;
 
+  // candidate levels and uncoded costs of the coefficients outside the zero-out region are never used
+  const int zeroOutWidth  = std::min<int>( JVET_C0024_ZERO_OUT_TH, uiWidth );
+  const int zeroOutHeight = std::min<int>( JVET_C0024_ZERO_OUT_TH, uiHeight );
+  bool      nonZeroLevel  = false;
+  for( int y = 0, numRows = zeroOutWidth == uiWidth ? 1 : zeroOutHeight; y < numRows; y++ )
+  {
+    const int offset = y * uiWidth;
+    nonZeroLevel |= m_estimateRdoqLevels( plSrcCoeff + offset, m_levelDouble + offset, m_maxAbsLevel + offset, m_uncodedCost + offset,
+                                          numRows == 1 ? zeroOutWidth * zeroOutHeight : zeroOutWidth,
+                                          enableScalingLists ? piQCoef + offset : nullptr, enableScalingLists ? pdErrScale + offset : nullptr,
+                                          defaultQuantisationCoefficient, defaultErrorScale, iQBits, entropyCodingMaximum );
+  }
+  if( !nonZeroLevel )
+  {
+    // all the coefficients are quantized to zero, there is no last position to estimate
+    return;
+  }
+
+  memset( m_pdCostCoeff,  0, sizeof( double ) *  uiMaxNumCoeff );
+  memset( m_pdCostSig,    0, sizeof( double ) *  uiMaxNumCoeff );
+  memset( m_rateIncUp,    0, sizeof( int    ) *  uiMaxNumCoeff );
+  memset( m_rateIncDown,  0, sizeof( int    ) *  uiMaxNumCoeff );
+  memset( m_sigRateDelta, 0, sizeof( int    ) *  uiMaxNumCoeff );
+  memset( m_deltaU,       0, sizeof( TCoeff ) *  uiMaxNumCoeff );
+
   CoeffCodingContext cctx(tu, compID, tu.cs->slice->getSignDataHidingEnabledFlag());
   const int    iCGSizeM1      = (1 << cctx.log2CGSize()) - 1;
 
@@ -696,16 +706,13 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
       uint32_t    uiBlkPos          = cctx.blockPos(iScanPos);
 
       // set coeff
-      const int    quantisationCoefficient = (enableScalingLists) ? piQCoef   [uiBlkPos]               : defaultQuantisationCoefficient;
       const double errorScale              = (enableScalingLists) ? pdErrScale[uiBlkPos]               : defaultErrorScale;
-      const int64_t  tmpLevel                = int64_t(abs(plSrcCoeff[ uiBlkPos ])) * quantisationCoefficient;
 
-      const Intermediate_Int lLevelDouble  = (Intermediate_Int)std::min<int64_t>(tmpLevel, std::numeric_limits<Intermediate_Int>::max() - (Intermediate_Int(1) << (iQBits - 1)));
+      const Intermediate_Int lLevelDouble  = m_levelDouble[ uiBlkPos ];
 
-      uint32_t uiMaxAbsLevel        = std::min<uint32_t>(uint32_t(entropyCodingMaximum), uint32_t((lLevelDouble + (Intermediate_Int(1) << (iQBits - 1))) >> iQBits));
+      uint32_t uiMaxAbsLevel        = m_maxAbsLevel[ uiBlkPos ];
 
-      const double dErr         = double( lLevelDouble );
-      pdCostCoeff0[ iScanPos ]  = dErr * dErr * errorScale;
+      pdCostCoeff0[ iScanPos ]  = m_uncodedCost[ uiBlkPos ];
       d64BlockUncodedCost      += pdCostCoeff0[ iScanPos ];
       piDstCoeff[ uiBlkPos ]    = uiMaxAbsLevel;
 
@@ -1650,7 +1657,7 @@ inline uint32_t QuantRDOQ::xGetCodedLevelTSPred(double&            rd64CodedCost
   const int          maxLog2TrDynamicRange
 ) const
 {
-  auto       start        = high_resolution_clock::now();
+  PROFILE_ZONE( "QuantRDOQ::xGetCodedLevelTSPred" );
   double currCostSig = 0;
   uint32_t   bestAbsLevel = 0;
   if (!isLast && coeffLevels[0] < 3)
@@ -1659,9 +1666,6 @@ inline uint32_t QuantRDOQ::xGetCodedLevelTSPred(double&            rd64CodedCost
     rd64CodedCost = rd64CodedCost0 + rd64CodedCostSig;
     if (coeffLevels[0] == 0)
     {
-      auto stop                  = high_resolution_clock::now();
-      auto duration              = duration_cast<nanoseconds>(stop - start);
-      timeOfXGetCodedLevelTSPred = timeOfXGetCodedLevelTSPred + duration.count();
 
       return bestAbsLevel;
     }
@@ -1693,9 +1697,6 @@ inline uint32_t QuantRDOQ::xGetCodedLevelTSPred(double&            rd64CodedCost
       rd64CodedCostSig = currCostSig;
     }
   }
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfXGetCodedLevelTSPred = timeOfXGetCodedLevelTSPred + duration.count();
 
   return bestAbsLevel;
 }
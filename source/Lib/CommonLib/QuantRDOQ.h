@@ -46,8 +46,6 @@
 
 #include "Quant.h"
 
-extern long long int timeOfXGetCodedLevelTSPred;
-
 //! \ingroup CommonLib
 //! \{
 
@@ -166,6 +164,9 @@ private:
   int    m_sigRateDelta       [MAX_TB_SIZEY * MAX_TB_SIZEY];
   TCoeff m_deltaU             [MAX_TB_SIZEY * MAX_TB_SIZEY];
   TCoeff m_fullCoeff          [MAX_TB_SIZEY * MAX_TB_SIZEY];
+  Intermediate_Int m_levelDouble[MAX_TB_SIZEY * MAX_TB_SIZEY]; // per coefficient results of the level estimation pre-pass, in raster order
+  TCoeff m_maxAbsLevel        [MAX_TB_SIZEY * MAX_TB_SIZEY];
+  double m_uncodedCost        [MAX_TB_SIZEY * MAX_TB_SIZEY];
   int   m_bdpcm;
   int   m_testedLevels;
 };// END CLASS DEFINITION QuantRDOQ
@@ -41,6 +41,7 @@
 
 #include "Rom.h"
 #include "UnitPartitioner.h"
+#include "Profiler.h"
 
 #include <limits>
 
@@ -176,10 +177,74 @@ void RdCost::init()
 
   m_motionLambda               = 0;
   m_iCostScale                 = 0;
+
+#if ENABLE_PROFILING
+  if( Profiler::getKernelStats() )
+  {
+    initDistFuncStats();
+  }
+#endif
 }
 
+#if ENABLE_PROFILING
+static const char* const g_distFuncName[DF_TOTAL_FUNCTIONS] =
+{
+  "RdCost::SSE",   "RdCost::SSE2",   "RdCost::SSE4",   "RdCost::SSE8",   "RdCost::SSE16",   "RdCost::SSE32",   "RdCost::SSE64",   "RdCost::SSE16N",
+  "RdCost::SAD",   "RdCost::SAD2",   "RdCost::SAD4",   "RdCost::SAD8",   "RdCost::SAD16",   "RdCost::SAD32",   "RdCost::SAD64",   "RdCost::SAD16N",
+  "RdCost::HAD",   "RdCost::HAD2",   "RdCost::HAD4",   "RdCost::HAD8",   "RdCost::HAD16",   "RdCost::HAD32",   "RdCost::HAD64",   "RdCost::HAD16N",
+  "RdCost::SAD12", "RdCost::SAD24",  "RdCost::SAD48",
+  "RdCost::MRSAD", "RdCost::MRSAD2", "RdCost::MRSAD4", "RdCost::MRSAD8", "RdCost::MRSAD16", "RdCost::MRSAD32", "RdCost::MRSAD64", "RdCost::MRSAD16N",
+  "RdCost::MRHAD", "RdCost::MRHAD2", "RdCost::MRHAD4", "RdCost::MRHAD8", "RdCost::MRHAD16", "RdCost::MRHAD32", "RdCost::MRHAD64", "RdCost::MRHAD16N",
+  "RdCost::MRSAD12", "RdCost::MRSAD24", "RdCost::MRSAD48",
+  "RdCost::SAD_FULL_NBIT",   "RdCost::SAD_FULL_NBIT2",  "RdCost::SAD_FULL_NBIT4",  "RdCost::SAD_FULL_NBIT8",
+  "RdCost::SAD_FULL_NBIT16", "RdCost::SAD_FULL_NBIT32", "RdCost::SAD_FULL_NBIT64", "RdCost::SAD_FULL_NBIT16N",
+  "RdCost::SSE_WTD",   "RdCost::SSE2_WTD",  "RdCost::SSE4_WTD",  "RdCost::SSE8_WTD",
+  "RdCost::SSE16_WTD", "RdCost::SSE32_WTD", "RdCost::SSE64_WTD", "RdCost::SSE16N_WTD",
+  "RdCost::DEFAULT_ORI",
+  "RdCost::SAD_INTERMEDIATE_BITDEPTH",
+};
+
+static FpDistFunc g_distFuncStats[DF_TOTAL_FUNCTIONS];  // the wrapped functions
+static int        g_distFuncZone [DF_TOTAL_FUNCTIONS];
+
+template<int DF>
+static Distortion xGetDistStats( const DistParam& rcDtParam )
+{
+  PROFILE_KERNEL_ID( g_distFuncZone[DF], rcDtParam.org.width, rcDtParam.org.height, rcDtParam.bitDepth );
+  return g_distFuncStats[DF]( rcDtParam );
+}
+
+template<int DF>
+struct DistFuncStats
+{
+  static void init( FpDistFunc* distFunc )
+  {
+    DistFuncStats<DF - 1>::init( distFunc );
+    g_distFuncStats[DF] = distFunc[DF];
+    g_distFuncZone [DF] = Profiler::registerZone( g_distFuncName[DF] );
+    distFunc[DF]        = distFunc[DF] ? xGetDistStats<DF> : nullptr;
+  }
+};
+
+template<>
+struct DistFuncStats<-1>
+{
+  static void init( FpDistFunc* ) {}
+};
+
+void RdCost::initDistFuncStats()
+{
+  // the table is shared by all instances, do not wrap twice
+  if( m_afpDistortFunc[DF_SAD] == xGetDistStats<DF_SAD> )
+  {
+    return;
+  }
+  DistFuncStats<DF_TOTAL_FUNCTIONS - 1>::init( m_afpDistortFunc );
+}
+#endif
+
 
-#if ENABLE_SPLIT_PARALLELISM
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
 
 void RdCost::copyState( const RdCost& other )
 {
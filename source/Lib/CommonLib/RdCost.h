@@ -151,6 +151,9 @@ public:
 
   // Distortion Functions
   void          init();
+#if ENABLE_PROFILING
+  static void   initDistFuncStats();  ///< routes m_afpDistortFunc through PROFILE_KERNEL, see Profiler::enableKernelStats()
+#endif
 #ifdef TARGET_SIMD_X86
   void          initRdCostX86();
   template <X86_VEXT vext>
@@ -273,7 +276,7 @@ public:
     return length;
   }
 
-#if ENABLE_SPLIT_PARALLELISM
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   void copyState( const RdCost& other );
 #endif
 
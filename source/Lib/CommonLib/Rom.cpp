@@ -37,20 +37,14 @@
 
 #include "Rom.h"
 #include "UnitTools.h"
+#include "ApproximatAdderSubtraction.h"
+#include "Profiler.h"
 
 #include <memory.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 #include <iomanip>
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-long long int timeOfInitROMer = 0;
 
 // ====================================================================================================================
 // Initialize / destroy functions
@@ -268,7 +262,7 @@ uint32_t g_log2SbbSize[MAX_CU_DEPTH + 1][MAX_CU_DEPTH + 1][2] =
 // initialize ROM variables
 void initROM()
 {
-  auto start     = high_resolution_clock::now();
+  PROFILE_ZONE( "initROM" );
   gp_sizeIdxInfo = new SizeIndexInfoLog2();
   gp_sizeIdxInfo->init(MAX_CU_SIZE);
 
@@ -469,9 +463,10 @@ void initROM()
 
   ::memset(g_isReusedUniMVsFilled, 0, sizeof(g_isReusedUniMVsFilled));
 
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfInitROMer  = timeOfInitROMer + duration.count();
+  initApproximateAdders();
+#if APPROX_ADDER_CHECK
+  CHECK(!checkApproximateAdders(), "Integer approximate adders do not match the string reference");
+#endif
 }
 
 void destroyROM()
@@ -52,8 +52,6 @@
 // Initialize / destroy functions
 // ====================================================================================================================
 
-extern long long int timeOfInitROMer;
-
 void         initROM();
 void         destroyROM();
 
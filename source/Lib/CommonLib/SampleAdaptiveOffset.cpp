@@ -42,20 +42,12 @@
 #include "CodingStructure.h"
 #include "CommonLib/dtrace_codingstruct.h"
 #include "CommonLib/dtrace_buffer.h"
+#include "Profiler.h"
 
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-long long int timeOfOffsetBlock = 0;
-long long int timeOfDeriveLoopFilterBoundaryAvailibility = 0;
 
 //! \ingroup CommonLib
 //! \{
@@ -121,6 +113,16 @@ const SAOBlkParam& SAOBlkParam::operator= (const SAOBlkParam& src)
 
 SampleAdaptiveOffset::SampleAdaptiveOffset()
 {
+  m_offsetEdgeRow = offsetEdgeRow;
+  m_offsetBandRow = offsetBandRow;
+  m_edgeStatsRow  = edgeStatsRow;
+  m_bandStatsRow  = bandStatsRow;
+
+#if ENABLE_SIMD_OPT_SAO
+#ifdef TARGET_SIMD_X86
+  initSampleAdaptiveOffsetX86();
+#endif
+#endif
 }
 
 
@@ -304,7 +306,14 @@ void SampleAdaptiveOffset::offsetBlock(const int channelBitDepth, const ClpRng&
                                           , bool isCtuCrossedByVirtualBoundaries, int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry
   )
 {
-  auto   start = high_resolution_clock::now();
+  PROFILE_ZONE( "SampleAdaptiveOffset::offsetBlock" );
+
+  if( !isCtuCrossedByVirtualBoundaries )
+  {
+    offsetBlockRows( channelBitDepth, clpRng, typeIdx, offset, srcBlk, resBlk, srcStride, resStride, width, height,
+                     isLeftAvail, isRightAvail, isAboveAvail, isBelowAvail, isAboveLeftAvail, isAboveRightAvail, isBelowLeftAvail, isBelowRightAvail );
+    return;
+  }
 
   int x,y, startX, startY, endX, endY, edgeType;
   int firstLineStartX, firstLineEndX, lastLineStartX, lastLineEndX;
@@ -561,10 +570,121 @@ void SampleAdaptiveOffset::offsetBlock(const int channelBitDepth, const ClpRng&
       THROW("Not a supported SAO types\n");
     }
   }
+}
+
+/**
+ - offsetBlock without virtual boundaries
+ .
+ Without the virtual boundaries the edge class of a sample only depends on its neighbours, so the signs
+ are derived per row instead of being carried from the row above. The sample ranges of the rows match
+ offsetBlock.
+ */
+void SampleAdaptiveOffset::offsetBlockRows(const int channelBitDepth, const ClpRng& clpRng, int typeIdx, int* offset
+                                          , const Pel* srcBlk, Pel* resBlk, int srcStride, int resStride,  int width, int height
+                                          , bool isLeftAvail,  bool isRightAvail, bool isAboveAvail, bool isBelowAvail, bool isAboveLeftAvail, bool isAboveRightAvail, bool isBelowLeftAvail, bool isBelowRightAvail
+  )
+{
+  const int startX = isLeftAvail  ? 0     : 1;
+  const int endX   = isRightAvail ? width : ( width - 1 );
 
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfOffsetBlock        = timeOfOffsetBlock + duration.count();
+  switch( typeIdx )
+  {
+  case SAO_TYPE_EO_0:
+    {
+      // every second row, as in offsetBlock
+      for( int y = 0; y < height; y++ )
+      {
+        const Pel* srcLine = srcBlk + 2 * y * srcStride;
+        m_offsetEdgeRow( srcLine, srcLine - 1, srcLine + 1, resBlk + 2 * y * resStride, startX, endX, offset, clpRng );
+      }
+    }
+    break;
+  case SAO_TYPE_EO_90:
+    {
+      const int startY = isAboveAvail ? 0      : 1;
+      const int endY   = isBelowAvail ? height : ( height - 1 );
+      for( int y = startY; y < endY; y++ )
+      {
+        const Pel* srcLine = srcBlk + y * srcStride;
+        m_offsetEdgeRow( srcLine, srcLine - srcStride, srcLine + srcStride, resBlk + y * resStride, 0, width, offset, clpRng );
+      }
+    }
+    break;
+  case SAO_TYPE_EO_135:
+  case SAO_TYPE_EO_45:
+    {
+      const bool is135  = typeIdx == SAO_TYPE_EO_135;
+      const int  shiftA = is135 ? -1 : 1;
+      for( int y = 0; y < height; y++ )
+      {
+        int lineStartX = startX;
+        int lineEndX   = endX;
+        if( y == 0 )
+        {
+          lineStartX = is135 ? ( isAboveLeftAvail ? 0 : 1 ) : ( isAboveAvail ? startX : ( width - 1 ) );
+          lineEndX   = is135 ? ( isAboveAvail ? endX : 1 ) : ( isAboveRightAvail ? width : ( width - 1 ) );
+        }
+        else if( y == height - 1 )
+        {
+          lineStartX = is135 ? ( isBelowAvail ? startX : ( width - 1 ) ) : ( isBelowLeftAvail ? 0 : 1 );
+          lineEndX   = is135 ? ( isBelowRightAvail ? width : ( width - 1 ) ) : ( isBelowAvail ? endX : 1 );
+        }
+        const Pel* srcLine = srcBlk + y * srcStride;
+        m_offsetEdgeRow( srcLine, srcLine - srcStride + shiftA, srcLine + srcStride - shiftA, resBlk + y * resStride, lineStartX, lineEndX, offset, clpRng );
+      }
+    }
+    break;
+  case SAO_TYPE_BO:
+    {
+      const int shiftBits = channelBitDepth - NUM_SAO_BO_CLASSES_LOG2;
+      for( int y = 0; y < height; y++ )
+      {
+        m_offsetBandRow( srcBlk + y * srcStride, resBlk + y * resStride, width, shiftBits, offset, clpRng );
+      }
+    }
+    break;
+  default:
+    {
+      THROW("Not a supported SAO types\n");
+    }
+  }
+}
+
+void SampleAdaptiveOffset::offsetEdgeRow( const Pel* src, const Pel* srcA, const Pel* srcB, Pel* res, const int startX, const int endX, const int* offset, const ClpRng& clpRng )
+{
+  for( int x = startX; x < endX; x++ )
+  {
+    const int edgeType = sgn( src[x] - srcA[x] ) + sgn( src[x] - srcB[x] );
+    res[x] = ClipPel<int>( src[x] + offset[edgeType + 2], clpRng );
+  }
+}
+
+void SampleAdaptiveOffset::offsetBandRow( const Pel* src, Pel* res, const int width, const int shiftBits, const int* offset, const ClpRng& clpRng )
+{
+  for( int x = 0; x < width; x++ )
+  {
+    res[x] = ClipPel<int>( src[x] + offset[src[x] >> shiftBits], clpRng );
+  }
+}
+
+void SampleAdaptiveOffset::edgeStatsRow( const Pel* src, const Pel* srcA, const Pel* srcB, const Pel* org, const int startX, const int endX, int64_t* diff, int64_t* count )
+{
+  for( int x = startX; x < endX; x++ )
+  {
+    const int edgeType = sgn( src[x] - srcA[x] ) + sgn( src[x] - srcB[x] ) + 2;
+    diff [edgeType] += org[x] - src[x];
+    count[edgeType]++;
+  }
+}
+
+void SampleAdaptiveOffset::bandStatsRow( const Pel* src, const Pel* org, const int startX, const int endX, const int shiftBits, int64_t* diff, int64_t* count )
+{
+  for( int x = startX; x < endX; x++ )
+  {
+    const int bandIdx = src[x] >> shiftBits;
+    diff [bandIdx] += org[x] - src[x];
+    count[bandIdx]++;
+  }
 }
 
 void SampleAdaptiveOffset::offsetCTU( const UnitArea& area, const CPelUnitBuf& src, PelUnitBuf& res, SAOBlkParam& saoblkParam, CodingStructure& cs)
@@ -686,6 +806,56 @@ void SampleAdaptiveOffset::SAOProcess( CodingStructure& cs, SAOBlkParam* saoBlkP
   xLosslessDisableProcess(cs);
 }
 
+void SampleAdaptiveOffset::SAOProcessCtuRow( CodingStructure& cs, SAOBlkParam* saoBlkParams, const int ctuRow )
+{
+  CHECK(!saoBlkParams, "No parameters present");
+
+  const PreCalcValues& pcv = *cs.pcv;
+  const uint32_t numberOfComponents = getNumberValidComponents(cs.area.chromaFormat);
+
+  // the merge candidates above were reconstructed with the previous CTU row
+  bool bAllDisabled = true;
+  for( int ctuRsAddr = ctuRow * pcv.widthInCtus; ctuRsAddr < ( ctuRow + 1 ) * pcv.widthInCtus; ctuRsAddr++ )
+  {
+    SAOBlkParam* mergeList[NUM_SAO_MERGE_TYPES] = { NULL };
+    getMergeList(cs, ctuRsAddr, saoBlkParams, mergeList);
+
+    reconstructBlkSAOParam(saoBlkParams[ctuRsAddr], mergeList);
+
+    for( uint32_t compIdx = 0; compIdx < numberOfComponents; compIdx++ )
+    {
+      if( saoBlkParams[ctuRsAddr][compIdx].modeIdc != SAO_MODE_OFF )
+      {
+        bAllDisabled = false;
+      }
+    }
+  }
+
+  // the deblocked samples of the row and of the top lines of the row below, the bottom line of the
+  // row above was copied before its offsets were applied
+  PelUnitBuf rec = cs.getRecoBuf();
+  const uint32_t yPos       = ctuRow * pcv.maxCUHeight;
+  const uint32_t copyHeight = std::min( pcv.maxCUHeight + 2, pcv.lumaHeight - yPos );
+  const UnitArea copyArea( cs.area.chromaFormat, Area( 0, yPos, pcv.lumaWidth, copyHeight ) );
+  m_tempBuf.getBuf( copyArea ).copyFrom( rec.subBuf( copyArea ) );
+
+  if (bAllDisabled)
+  {
+    return;
+  }
+
+  const uint32_t height = std::min( pcv.maxCUHeight, pcv.lumaHeight - yPos );
+  int ctuRsAddr = ctuRow * pcv.widthInCtus;
+  for( uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth )
+  {
+    const uint32_t width  = (xPos + pcv.maxCUWidth  > pcv.lumaWidth)  ? (pcv.lumaWidth - xPos)  : pcv.maxCUWidth;
+    const UnitArea area( cs.area.chromaFormat, Area(xPos , yPos, width, height) );
+
+    offsetCTU( area, m_tempBuf, rec, saoBlkParams[ctuRsAddr], cs);
+    ctuRsAddr++;
+  }
+}
+
 void SampleAdaptiveOffset::xLosslessDisableProcess(CodingStructure& cs)
 {
   const PreCalcValues& pcv = *cs.pcv;
@@ -776,7 +946,7 @@ void SampleAdaptiveOffset::deriveLoopFilterBoundaryAvailibility(CodingStructure&
   bool& isBelowRightAvail
   ) const
 {
-  auto              start        = high_resolution_clock::now();
+  PROFILE_ZONE( "SampleAdaptiveOffset::deriveLoopFilterBoundaryAvailibility" );
   const int width = cs.pcv->maxCUWidth;
   const int height = cs.pcv->maxCUHeight;
   const CodingUnit* cuCurr = cs.getCU(pos, CH_L);
@@ -839,10 +1009,6 @@ void SampleAdaptiveOffset::deriveLoopFilterBoundaryAvailibility(CodingStructure&
     isBelowLeftAvail  = (!isBelowLeftAvail)  ? false : CU::isSameTile(*cuCurr, *cuBelowLeft);
     isBelowRightAvail = (!isBelowRightAvail) ? false : CU::isSameTile(*cuCurr, *cuBelowRight);
   }
-
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfDeriveLoopFilterBoundaryAvailibility = timeOfDeriveLoopFilterBoundaryAvailibility + duration.count();
 }
 
 bool SampleAdaptiveOffset::isCrossedByVirtualBoundaries(const int xPos, const int yPos, const int width, const int height, int& numHorVirBndry, int& numVerVirBndry, int horVirBndryPos[], int verVirBndryPos[], const PPS* pps)
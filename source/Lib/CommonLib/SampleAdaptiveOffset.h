@@ -44,9 +44,6 @@
 //! \ingroup CommonLib
 //! \{
 
-extern long long int timeOfOffsetBlock;
-extern long long int timeOfDeriveLoopFilterBoundaryAvailibility;
-
 // ====================================================================================================================
 // Constants
 // ====================================================================================================================
@@ -69,6 +66,9 @@ public:
   virtual ~SampleAdaptiveOffset();
   void SAOProcess( CodingStructure& cs, SAOBlkParam* saoBlkParams
                    );
+  // SAO of one CTU row without the lossless restoration, the rows are processed in order, each one
+  // after the deblocking of the row below
+  void SAOProcessCtuRow( CodingStructure& cs, SAOBlkParam* saoBlkParams, const int ctuRow );
   void create( int picWidth, int picHeight, ChromaFormat format, uint32_t maxCUWidth, uint32_t maxCUHeight, uint32_t maxCUDepth, uint32_t lumaBitShift, uint32_t chromaBitShift );
   void destroy();
   static int getMaxOffsetQVal(const int channelBitDepth) { return (1<<(std::min<int>(channelBitDepth,MAX_SAO_TRUNCATED_BITDEPTH)-5))-1; } //Table 9-32, inclusive
@@ -89,6 +89,27 @@ protected:
                   , bool isLeftAvail, bool isRightAvail, bool isAboveAvail, bool isBelowAvail, bool isAboveLeftAvail, bool isAboveRightAvail, bool isBelowLeftAvail, bool isBelowRightAvail
                   , bool isCtuCrossedByVirtualBoundaries, int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry
     );
+  void offsetBlockRows(const int channelBitDepth, const ClpRng& clpRng, int typeIdx, int* offset, const Pel* srcBlk, Pel* resBlk, int srcStride, int resStride,  int width, int height
+                  , bool isLeftAvail, bool isRightAvail, bool isAboveAvail, bool isBelowAvail, bool isAboveLeftAvail, bool isAboveRightAvail, bool isBelowLeftAvail, bool isBelowRightAvail
+    );
+
+  // row kernels, the edge class of a sample is sgn( src[x] - srcA[x] ) + sgn( src[x] - srcB[x] ) and indexes offset, diff and count with a bias of 2
+  static void offsetEdgeRow( const Pel* src, const Pel* srcA, const Pel* srcB, Pel* res, const int startX, const int endX, const int* offset, const ClpRng& clpRng );
+  static void offsetBandRow( const Pel* src, Pel* res, const int width, const int shiftBits, const int* offset, const ClpRng& clpRng );
+  static void edgeStatsRow ( const Pel* src, const Pel* srcA, const Pel* srcB, const Pel* org, const int startX, const int endX, int64_t* diff, int64_t* count );
+  static void bandStatsRow ( const Pel* src, const Pel* org, const int startX, const int endX, const int shiftBits, int64_t* diff, int64_t* count );
+
+  void (*m_offsetEdgeRow)  ( const Pel* src, const Pel* srcA, const Pel* srcB, Pel* res, const int startX, const int endX, const int* offset, const ClpRng& clpRng );
+  void (*m_offsetBandRow)  ( const Pel* src, Pel* res, const int width, const int shiftBits, const int* offset, const ClpRng& clpRng );
+  void (*m_edgeStatsRow)   ( const Pel* src, const Pel* srcA, const Pel* srcB, const Pel* org, const int startX, const int endX, int64_t* diff, int64_t* count );
+  void (*m_bandStatsRow)   ( const Pel* src, const Pel* org, const int startX, const int endX, const int shiftBits, int64_t* diff, int64_t* count );
+
+#ifdef TARGET_SIMD_X86
+  void initSampleAdaptiveOffsetX86();
+  template <X86_VEXT vext>
+  void _initSampleAdaptiveOffsetX86();
+#endif
+
   void invertQuantOffsets(ComponentID compIdx, int typeIdc, int typeAuxInfo, int* dstOffsets, int* srcOffsets);
   void reconstructBlkSAOParam(SAOBlkParam& recParam, SAOBlkParam* mergeList[NUM_SAO_MERGE_TYPES]);
   int  getMergeList(CodingStructure& cs, int ctuRsAddr, SAOBlkParam* blkParams, SAOBlkParam* mergeList[NUM_SAO_MERGE_TYPES]);
@@ -42,14 +42,7 @@
 #include "dtrace_next.h"
 
 #include "UnitTools.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-long long int timeOfCreateExplicitReferencePictureSetFromReference = 0;
+#include "Profiler.h"
 
 //! \ingroup CommonLib
 //! \{
@@ -1282,7 +1275,7 @@ void Slice::checkConformanceForDRAP( uint32_t temporalId )
 
 void Slice::createExplicitReferencePictureSetFromReference(PicList& rcListPic, const ReferencePictureList *pRPL0, const ReferencePictureList *pRPL1)
 {
-  auto     start = high_resolution_clock::now();
+  PROFILE_ZONE( "Slice::createExplicitReferencePictureSetFromReference" );
   Picture* rpcPic;
   int pocCycle = 0;
 
@@ -1467,11 +1460,6 @@ void Slice::createExplicitReferencePictureSetFromReference(PicList& rcListPic, c
   pLocalRPL1->setLtrpInSliceHeaderFlag(pRPL1->getLtrpInSliceHeaderFlag());
   this->setRPL1idx(-1);
   this->setRPL1(pLocalRPL1);
-
-  
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfCreateExplicitReferencePictureSetFromReference = timeOfCreateExplicitReferencePictureSetFromReference + duration.count();
 }
 
 //! get AC and DC values for weighted pred
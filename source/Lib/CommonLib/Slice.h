@@ -54,8 +54,6 @@
 //! \{
 #include "CommonLib/MotionInfo.h"
 
-extern long long int timeOfCreateExplicitReferencePictureSetFromReference;
-
 struct MotionInfo;
 
 
@@ -2012,9 +2010,6 @@ public:
 protected:
   Picture*              xGetRefPic        (PicList& rcListPic, int poc);
   Picture*              xGetLongTermRefPic(PicList& rcListPic, int poc, bool pocHasMsb);
-public:
-  std::unordered_map< Position, std::unordered_map< Size, double> > m_mapPltCost;
-private:
 };// END CLASS DEFINITION Slice
 
 void calculateParameterSetChangedFlag(bool &bChanged, const std::vector<uint8_t> *pOldData, const std::vector<uint8_t> *pNewData);
@@ -82,6 +82,9 @@ public:
   void fwdLfnstNxN( int* src, int* dst, const uint32_t mode, const uint32_t index, const uint32_t size, int zeroOutSize );
   void invLfnstNxN( int* src, int* dst, const uint32_t mode, const uint32_t index, const uint32_t size, int zeroOutSize );
 
+  static void fwdLfnst( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize );
+  static void invLfnst( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize );
+
   uint32_t getLFNSTIntraMode( int wideAngPredMode );
   bool     getTransposeFlag ( uint32_t intraMode  );
 
@@ -135,6 +138,18 @@ private:
   void                      (**m_invICT)(PelBuf&,PelBuf&);
   std::pair<int64_t,int64_t>(**m_fwdICT)(const PelBuf&,const PelBuf&,PelBuf&,PelBuf&);
 
+  FwdTrans* m_fwdTrans[NUM_TRANS_TYPE][g_numTransformMatrixSizes];
+  InvTrans* m_invTrans[NUM_TRANS_TYPE][g_numTransformMatrixSizes];
+
+  void ( *m_fwdLfnst )( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize );
+  void ( *m_invLfnst )( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize );
+
+#ifdef TARGET_SIMD_X86
+  void initTrQuantX86();
+  template <X86_VEXT vext>
+  void _initTrQuantX86();
+#endif
+
 
   // forward Transform
   void xT               (const TransformUnit &tu, const ComponentID &compID, const CPelBuf &resi, CoeffBuf &dstCoeff, const int width, const int height);
@@ -127,6 +127,10 @@ typedef std::pair<int, int>  TrCost;
 #endif
 #endif
 
+#ifndef ENABLE_PROFILING
+#define ENABLE_PROFILING                                  1 ///< 1 = scoped profiling zones with call tree / Chrome trace export (see Profiler.h), 0 = compiled out
+#endif
+
 #define WCG_EXT                                           1
 #define WCG_WPSNR                                         WCG_EXT
 
@@ -142,6 +146,10 @@ typedef std::pair<int, int>  TrCost;
 
 #define INTRA_FULL_SEARCH                                 0 ///< enables full mode search for intra estimation
 
+#ifndef APPROX_ADDER_CHECK
+#define APPROX_ADDER_CHECK                                0 ///< 1 = exhaustively compare the integer approximate adders against the string reference in initROM() (takes several seconds)
+#endif
+
 // TODO: rename this macro to DECODER_DEBUG_BIT_STATISTICS (may currently cause merge issues with other branches)
 // This can be enabled by the makefile
 #ifndef RExt__DECODER_DEBUG_BIT_STATISTICS
@@ -192,6 +200,14 @@ typedef std::pair<int, int>  TrCost;
 #define ENABLE_SIMD_OPT_DIST                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the distortion calculations(SAD,SSE,HADAMARD), no impact on RD performance
 #define ENABLE_SIMD_OPT_AFFINE_ME                       ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for affine ME, no impact on RD performance
 #define ENABLE_SIMD_OPT_ALF                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for ALF
+#define ENABLE_SIMD_OPT_DBF                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the deblocking filter, no impact on RD performance
+#define ENABLE_SIMD_OPT_SAO                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for SAO, no impact on RD performance
+#define ENABLE_SIMD_OPT_INTRAPRED                       ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the intra prediction, no impact on RD performance
+#define ENABLE_SIMD_OPT_MIP                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the matrix intra prediction, no impact on RD performance
+#define ENABLE_SIMD_OPT_TRANSFORM                       ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the DCT-II, DST-VII and DCT-VIII transforms, no impact on RD performance
+#define ENABLE_SIMD_OPT_LFNST                           ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the low frequency non-separable transform, no impact on RD performance
+#define ENABLE_SIMD_OPT_QUANT                           ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the quantization, de-quantization and RDOQ level estimation, no impact on RD performance
+#define ENABLE_SIMD_OPT_DEPQUANT                        ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the rate distortion decisions of the dependent quantization trellis, no impact on RD performance
 #if ENABLE_SIMD_OPT_BUFFER
 #define ENABLE_SIMD_OPT_GBI                               1                                                 ///< SIMD optimization for GBi
 #endif
@@ -571,6 +587,32 @@ enum TransformDirection
   TRANSFORM_NUMBER_OF_DIRECTIONS = 2
 };
 
+/// adders of ApproximatAdderSubtraction.h
+enum ApproxAdderType
+{
+  APPROX_ADDER_EXACT = 0,       ///< exact addition
+  APPROX_ADDER_LOA,             ///< lower-part OR adder, calculateSum()
+  APPROX_ADDER_TYPE1,           ///< 8 bit adders, approximate8BitSum*()
+  APPROX_ADDER_TYPE2,
+  APPROX_ADDER_TYPE3,
+  APPROX_ADDER_TYPE4,
+  APPROX_ADDER_TYPE5,
+  APPROX_ADDER_M45_P35_A7,
+  APPROX_ADDER_M45_P30_A6,
+  APPROX_ADDER_M60_P25_A6,
+  APPROX_ADDER_M95_P10_A5,
+  NUM_APPROX_ADDER_TYPES
+};
+
+/// places where the approximate adder of the arithmetic profile is applied
+enum ApproxSite
+{
+  APPROX_SITE_MC = 0,           ///< interpolation filters and bi-prediction average
+  APPROX_SITE_GBI,              ///< weighted bi-prediction average (GBi)
+  APPROX_SITE_ME,               ///< sub-pel interpolation of the encoder motion search only
+  NUM_APPROX_SITES
+};
+
 /// supported ME search methods
 enum MESearchMethod
 {
@@ -1028,6 +1070,13 @@ struct WCGChromaQPControl
 };
 #endif
 
+struct ApproxProfile
+{
+  ApproxAdderType adder;        ///< adder used at the enabled sites
+  uint32_t        sites;        ///< bit mask of ApproxSite
+  bool isActive( ApproxSite site ) const { return adder != APPROX_ADDER_EXACT && ( sites >> site & 1 ) != 0; }
+};
+
 class ChromaCbfs
 {
 public:
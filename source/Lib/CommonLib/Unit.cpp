@@ -45,22 +45,7 @@
 #include "UnitPartitioner.h"
 
 #include "ChromaFormat.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-long long int timeOfContains = 0;
-long long int timeOfPredictionUnit = 0;
-long long int timeOfCalcBIOSums_SSE = 0;
-long long int timeOfAddBIOAvg4_SSE  = 0;
-long long int timeOfGradFilter_SSE  = 0;
-long long int timeOfTransformUnit   = 0;
-long long int timeOfCopyBufferSimd  = 0;
-long long int timeOfPaddingSimd     = 0;
-long long int timeOfRemoveWeightHighFreq_SSE = 0;
+#include "Profiler.h"
 
  // ---------------------------------------------------------------------------
  // block method definitions
@@ -173,7 +158,7 @@ UnitArea::UnitArea(const ChromaFormat _chromaFormat,       CompArea &&blkY,
 
 bool UnitArea::contains(const UnitArea& other) const
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "UnitArea::contains" );
   bool ret = true;
   bool any = false;
 
@@ -186,10 +171,6 @@ bool UnitArea::contains(const UnitArea& other) const
     }
   }
 
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfContains           = timeOfContains + duration.count();
-
   return any && ret;
 }
 
@@ -524,7 +505,7 @@ PredictionUnit::PredictionUnit(const ChromaFormat _chromaFormat, const Area &_ar
 
 void PredictionUnit::initData()
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "PredictionUnit::initData" );
   // intra data - need this default initialization for PCM
   intraDir[0] = DC_IDX;
   intraDir[1] = PLANAR_IDX;
@@ -569,10 +550,6 @@ void PredictionUnit::initData()
   shareParentSize.width = -1;
   shareParentSize.height = -1;
   mmvdEncOptMode = 0;
-
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfPredictionUnit     = timeOfPredictionUnit + duration.count();
 }
 
 PredictionUnit& PredictionUnit::operator=(const IntraPredictionData& predData)
@@ -715,7 +692,7 @@ CMotionBuf PredictionUnit::getMotionBuf() const
 
 TransformUnit::TransformUnit(const UnitArea& unit) : UnitArea(unit), cu(nullptr), cs(nullptr), chType( CH_L ), next( nullptr )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "TransformUnit::TransformUnit" );
   for( unsigned i = 0; i < MAX_NUM_TBLOCKS; i++ )
   {
     m_coeffs[i] = nullptr;
@@ -725,15 +702,11 @@ TransformUnit::TransformUnit(const UnitArea& unit) : UnitArea(unit), cu(nullptr)
   }
 
   initData();
-
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfTransformUnit   = timeOfTransformUnit + duration.count();
 }
 
 TransformUnit::TransformUnit(const ChromaFormat _chromaFormat, const Area &_area) : UnitArea(_chromaFormat, _area), cu(nullptr), cs(nullptr), chType( CH_L ), next( nullptr )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "TransformUnit::TransformUnit" );
   for( unsigned i = 0; i < MAX_NUM_TBLOCKS; i++ )
   {
     m_coeffs[i] = nullptr;
@@ -743,9 +716,6 @@ TransformUnit::TransformUnit(const ChromaFormat _chromaFormat, const Area &_area
   }
 
   initData();
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfTransformUnit   = timeOfTransformUnit + duration.count();
 }
 
 void TransformUnit::initData()
@@ -44,17 +44,6 @@
 #include "MotionInfo.h"
 #include "ChromaFormat.h"
 
-
-extern long long int timeOfContains;
-extern long long int timeOfPredictionUnit;
-extern long long int timeOfCalcBIOSums_SSE;
-extern long long int timeOfAddBIOAvg4_SSE;
-extern long long int timeOfGradFilter_SSE;
-extern long long int timeOfTransformUnit;
-extern long long int timeOfCopyBufferSimd;
-extern long long int timeOfPaddingSimd;
-extern long long int timeOfRemoveWeightHighFreq_SSE;
-
 // ---------------------------------------------------------------------------
 // tools
 // ---------------------------------------------------------------------------
@@ -154,6 +154,8 @@ void Partitioner::copyState( const Partitioner& other )
   currImplicitBtDepth
               = other.currImplicitBtDepth;
   chType      = other.chType;
+  treeType    = other.treeType;
+  modeType    = other.modeType;
 #ifdef _DEBUG
   m_currArea  = other.m_currArea;
 #endif
@@ -42,34 +42,10 @@
 #include "Unit.h"
 #include "Slice.h"
 #include "Picture.h"
+#include "Profiler.h"
 
 #include <utility>
 #include <algorithm>
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-long long int timeOfCheckDMVRCondition                            = 0;
-long long int timeOfSetAllAffineMv                                = 0;
-long long int timeOfGetAffineControlPointCand                     = 0;
-long long int timeOfFillAffineMvpCand                             = 0;
-long long int timeOfSetAllAffineMvField                           = 0;
-long long int timeOfGetAffineMergeCand                            = 0;
-long long int timeOfAddAffineMVPCandUnscaled                      = 0;
-long long int timeOfXInheritedAffineMv                            = 0;
-long long int timeOfGetAvailableAffineNeighboursForLeftPredictor  = 0;
-long long int timeOfGetAvailableAffineNeighboursForAbovePredictor = 0;
-long long int timeOfGetTriangleMergeCandidates                    = 0;
-long long int timeOfSpanTriangleMotionInfo                        = 0;
-long long int timeOfsGBiIdxCoded                                  = 0;
-long long int timeOfGetValidGbiIdx                                = 0;
-long long int timeOfIsBiPredFromDifferentDir                      = 0;
-long long int timeOfIsBiPredFromDifferentDirEqDistPoc             = 0;
-long long int timeOfSetRefinedMotionField                         = 0;
-long long int timeOfXCheckSimilarMotion                           = 0;
 
 // CS tools
 
@@ -87,43 +63,53 @@ UnitArea CS::getArea(const CodingStructure &cs, const UnitArea &area, const Chan
 {
   return isDualITree(cs) || cs.treeType != TREE_D ? area.singleChan(chType) : area;
 }
-void CS::setRefinedMotionField(CodingStructure &cs)
+static void xSetRefinedMotionField( CodingUnit& cu )
 {
-  auto start = high_resolution_clock::now();
-
-  for (CodingUnit *cu: cs.cus)
+  for (auto &pu: CU::traversePUs(cu))
   {
-    for (auto &pu: CU::traversePUs(*cu))
+    PredictionUnit subPu = pu;
+    int            dx, dy, x, y, num = 0;
+    dy             = std::min<int>(pu.lumaSize().height, DMVR_SUBCU_HEIGHT);
+    dx             = std::min<int>(pu.lumaSize().width, DMVR_SUBCU_WIDTH);
+    Position puPos = pu.lumaPos();
+    if (PU::checkDMVRCondition(pu))
     {
-      PredictionUnit subPu = pu;
-      int            dx, dy, x, y, num = 0;
-      dy             = std::min<int>(pu.lumaSize().height, DMVR_SUBCU_HEIGHT);
-      dx             = std::min<int>(pu.lumaSize().width, DMVR_SUBCU_WIDTH);
-      Position puPos = pu.lumaPos();
-      if (PU::checkDMVRCondition(pu))
+      for (y = puPos.y; y < (puPos.y + pu.lumaSize().height); y = y + dy)
       {
-        for (y = puPos.y; y < (puPos.y + pu.lumaSize().height); y = y + dy)
+        for (x = puPos.x; x < (puPos.x + pu.lumaSize().width); x = x + dx)
         {
-          for (x = puPos.x; x < (puPos.x + pu.lumaSize().width); x = x + dx)
-          {
-            subPu.UnitArea::operator=(UnitArea(pu.chromaFormat, Area(x, y, dx, dy)));
-            subPu.mv[0]             = pu.mv[0];
-            subPu.mv[1]             = pu.mv[1];
-            subPu.mv[REF_PIC_LIST_0] += pu.mvdL0SubPu[num];
-            subPu.mv[REF_PIC_LIST_1] -= pu.mvdL0SubPu[num];
-            subPu.mv[REF_PIC_LIST_0].clipToStorageBitDepth();
-            subPu.mv[REF_PIC_LIST_1].clipToStorageBitDepth();
-            pu.mvdL0SubPu[num].setZero();
-            num++;
-            PU::spanMotionInfo(subPu);
-          }
+          subPu.UnitArea::operator=(UnitArea(pu.chromaFormat, Area(x, y, dx, dy)));
+          subPu.mv[0]             = pu.mv[0];
+          subPu.mv[1]             = pu.mv[1];
+          subPu.mv[REF_PIC_LIST_0] += pu.mvdL0SubPu[num];
+          subPu.mv[REF_PIC_LIST_1] -= pu.mvdL0SubPu[num];
+          subPu.mv[REF_PIC_LIST_0].clipToStorageBitDepth();
+          subPu.mv[REF_PIC_LIST_1].clipToStorageBitDepth();
+          pu.mvdL0SubPu[num].setZero();
+          num++;
+          PU::spanMotionInfo(subPu);
         }
       }
     }
   }
-  auto stop                   = high_resolution_clock::now();
-  auto duration               = duration_cast<nanoseconds>(stop - start);
-  timeOfSetRefinedMotionField = timeOfSetRefinedMotionField + duration.count();
+}
+
+void CS::setRefinedMotionField(CodingStructure &cs)
+{
+  PROFILE_ZONE( "CS::setRefinedMotionField" );
+
+  for (CodingUnit *cu: cs.cus)
+  {
+    xSetRefinedMotionField( *cu );
+  }
+}
+
+void CS::setRefinedMotionField(CodingStructure &cs, const UnitArea &ctuArea)
+{
+  for( auto &cu: cs.traverseCUs( CS::isDualITree( cs ) ? ctuArea.singleChan( CH_L ) : ctuArea, CH_L ) )
+  {
+    xSetRefinedMotionField( cu );
+  }
 }
 // CU tools
 
@@ -679,7 +665,7 @@ int PU::getWideAngIntraMode(const TransformUnit &tu, const uint32_t dirMode, con
 bool PU::xCheckSimilarMotion(const int mergeCandIndex, const int prevCnt, const MergeCtx mergeCandList,
                              bool hasPruned[MRG_MAX_NUM_CANDS])
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::xCheckSimilarMotion" );
 
   for (uint32_t ui = 0; ui < prevCnt; ui++)
   {
@@ -701,9 +687,6 @@ bool PU::xCheckSimilarMotion(const int mergeCandIndex, const int prevCnt, const
         {
           hasPruned[ui] = true;
 
-          auto stop                 = high_resolution_clock::now();
-          auto duration             = duration_cast<nanoseconds>(stop - start);
-          timeOfXCheckSimilarMotion = timeOfXCheckSimilarMotion + duration.count();
           return true;
         }
       }
@@ -715,27 +698,21 @@ bool PU::xCheckSimilarMotion(const int mergeCandIndex, const int prevCnt, const
             && mergeCandList.mvFieldNeighbours[offset0].mv == mergeCandList.mvFieldNeighbours[offset1].mv)
         {
           hasPruned[ui]             = true;
-          auto stop                 = high_resolution_clock::now();
-          auto duration             = duration_cast<nanoseconds>(stop - start);
-          timeOfXCheckSimilarMotion = timeOfXCheckSimilarMotion + duration.count();
           return true;
         }
       }
     }
   }
 
-  auto stop                 = high_resolution_clock::now();
-  auto duration             = duration_cast<nanoseconds>(stop - start);
-  timeOfXCheckSimilarMotion = timeOfXCheckSimilarMotion + duration.count();
-
   return false;
 }
 
-bool PU::addMergeHMVPCand(const CodingStructure &cs, MergeCtx &mrgCtx, bool canFastExit, const int &mrgCandIdx,
+bool PU::addMergeHMVPCand(const PredictionUnit &pu, MergeCtx &mrgCtx, bool canFastExit, const int &mrgCandIdx,
                           const uint32_t maxNumMergeCandMin1, int &cnt, const int prevCnt, bool isAvailableSubPu,
                           unsigned subPuMvpPos, bool ibcFlag, bool isShared)
 {
-  const Slice &slice = *cs.slice;
+  const CodingStructure &cs    = *pu.cs;
+  const Slice           &slice = *cs.slice;
   MotionInfo   miNeighbor;
   bool         hasPruned[MRG_MAX_NUM_CANDS];
   memset(hasPruned, 0, MRG_MAX_NUM_CANDS * sizeof(bool));
@@ -743,7 +720,7 @@ bool PU::addMergeHMVPCand(const CodingStructure &cs, MergeCtx &mrgCtx, bool canF
   {
     hasPruned[subPuMvpPos] = true;
   }
-  auto &lut                = ibcFlag ? cs.motionLut.lutIbc : cs.motionLut.lut;
+  auto &lut                = ibcFlag ? cs.getMotionLut( pu ).lutIbc : cs.getMotionLut( pu ).lut;
   int   num_avai_candInLUT = (int) lut.size();
 
   for (int mrgIdx = 1; mrgIdx <= num_avai_candInLUT; mrgIdx++)
@@ -867,7 +844,7 @@ void PU::getIBCMergeCandidates(const PredictionUnit &pu, MergeCtx &mrgCtx, const
     bool isShared = ((pu.Y().lumaSize().width != pu.shareParentSize.width)
                      || (pu.Y().lumaSize().height != pu.shareParentSize.height));
 
-    bool bFound = addMergeHMVPCand(cs, mrgCtx, canFastExit, mrgCandIdx, maxNumMergeCandMin1, cnt, spatialCandPos,
+    bool bFound = addMergeHMVPCand(pu, mrgCtx, canFastExit, mrgCandIdx, maxNumMergeCandMin1, cnt, spatialCandPos,
                                    isAvailableSubPu, subPuMvpPos, true, isShared);
     if (bFound)
     {
@@ -1176,7 +1153,7 @@ void PU::getInterMergeCandidates(const PredictionUnit &pu, MergeCtx &mrgCtx, int
     bool     isAvailableSubPu = false;
     unsigned subPuMvpPos      = 0;
     bool     isShared         = false;
-    bool     bFound = addMergeHMVPCand(cs, mrgCtx, canFastExit, mrgCandIdx, maxNumMergeCandMin1, cnt, spatialCandPos,
+    bool     bFound = addMergeHMVPCand(pu, mrgCtx, canFastExit, mrgCandIdx, maxNumMergeCandMin1, cnt, spatialCandPos,
                                    isAvailableSubPu, subPuMvpPos, CU::isIBC(*pu.cu), isShared);
     if (bFound)
     {
@@ -1289,7 +1266,7 @@ void PU::getInterMergeCandidates(const PredictionUnit &pu, MergeCtx &mrgCtx, int
 }
 bool PU::checkDMVRCondition(const PredictionUnit &pu)
 {
-  auto            start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::checkDMVRCondition" );
   WPScalingParam *wp0;
   WPScalingParam *wp1;
   int             refIdx0 = pu.refIdx[REF_PIC_LIST_0];
@@ -1307,9 +1284,6 @@ bool PU::checkDMVRCondition(const PredictionUnit &pu)
   {
     return false;
   }
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfCheckDMVRCondition = timeOfCheckDMVRCondition + duration.count();
 }
 
 static int xGetDistScaleFactor(const int &iCurrPOC, const int &iCurrRefPOC, const int &iColPOC, const int &iColRefPOC)
@@ -1617,10 +1591,11 @@ void PU::getIbcMVPsEncOnly(PredictionUnit &pu, Mv *mvPred, int &nbPred)
     }
   }
 
-  size_t numAvaiCandInLUT = pu.cs->motionLut.lutIbc.size();
+  const auto &lutIbc           = pu.cs->getMotionLut( pu ).lutIbc;
+  size_t      numAvaiCandInLUT = lutIbc.size();
   for (uint32_t cand = 0; cand < numAvaiCandInLUT && nbPred < IBC_NUM_CANDIDATES; cand++)
   {
-    MotionInfo neibMi = pu.cs->motionLut.lutIbc[cand];
+    MotionInfo neibMi = lutIbc[cand];
     if (isAddNeighborMv(neibMi.bv, mvPred, nbPred))
     {
       mvPred[nbPred++] = neibMi.bv;
@@ -1826,7 +1801,7 @@ void PU::fillMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const in
 bool PU::addAffineMVPCandUnscaled(const PredictionUnit &pu, const RefPicList &refPicList, const int &refIdx,
                                   const Position &pos, const MvpDir &dir, AffineAMVPInfo &affiAMVPInfo)
 {
-  auto                  start  = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::addAffineMVPCandUnscaled" );
   CodingStructure &     cs     = *pu.cs;
   const PredictionUnit *neibPU = NULL;
   Position              neibPos;
@@ -1878,23 +1853,16 @@ bool PU::addAffineMVPCandUnscaled(const PredictionUnit &pu, const RefPicList &re
       affiAMVPInfo.mvCandLB[affiAMVPInfo.numCand] = outputAffineMv[2];
     }
     affiAMVPInfo.numCand++;
-    auto stop                      = high_resolution_clock::now();
-    auto duration                  = duration_cast<nanoseconds>(stop - start);
-    timeOfAddAffineMVPCandUnscaled = timeOfAddAffineMVPCandUnscaled + duration.count();
     return true;
   }
 
-  auto stop                      = high_resolution_clock::now();
-  auto duration                  = duration_cast<nanoseconds>(stop - start);
-  timeOfAddAffineMVPCandUnscaled = timeOfAddAffineMVPCandUnscaled + duration.count();
-
   return false;
 }
 
 void PU::xInheritedAffineMv(const PredictionUnit &pu, const PredictionUnit *puNeighbour, RefPicList eRefPicList,
                             Mv rcMv[3])
 {
-  auto start   = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::xInheritedAffineMv" );
   int  posNeiX = puNeighbour->Y().pos().x;
   int  posNeiY = puNeighbour->Y().pos().y;
   int  posCurX = pu.Y().pos().x;
@@ -1979,15 +1947,12 @@ void PU::xInheritedAffineMv(const PredictionUnit &pu, const PredictionUnit *puNe
     rcMv[2].ver = verTmp;
     rcMv[2].clipToStorageBitDepth();
   }
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfXInheritedAffineMv = timeOfXInheritedAffineMv + duration.count();
 }
 
 void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx,
                            AffineAMVPInfo &affiAMVPInfo)
 {
-  auto start           = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::fillAffineMvpCand" );
   affiAMVPInfo.numCand = 0;
 
   if (refIdx < 0)
@@ -2152,10 +2117,6 @@ void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, co
     affiAMVPInfo.mvCandRT[i].roundAffinePrecInternal2Amvr(pu.cu->imv);
     affiAMVPInfo.mvCandLB[i].roundAffinePrecInternal2Amvr(pu.cu->imv);
   }
-
-  auto stop               = high_resolution_clock::now();
-  auto duration           = duration_cast<nanoseconds>(stop - start);
-  timeOfFillAffineMvpCand = timeOfFillAffineMvpCand + duration.count();
 }
 
 bool PU::addMVPCandUnscaled(const PredictionUnit &pu, const RefPicList &eRefPicList, const int &iRefIdx,
@@ -2210,7 +2171,7 @@ void PU::addAMVPHMVPCand(const PredictionUnit &pu, const RefPicList eRefPicList,
   const Slice &slice = *(*pu.cs).slice;
 
   MotionInfo neibMi;
-  auto &     lut                = CU::isIBC(*pu.cu) ? pu.cs->motionLut.lutIbc : pu.cs->motionLut.lut;
+  auto &     lut                = CU::isIBC(*pu.cu) ? pu.cs->getMotionLut( pu ).lutIbc : pu.cs->getMotionLut( pu ).lut;
   int        num_avai_candInLUT = (int) lut.size();
   int        num_allowedCand    = std::min(MAX_NUM_HMVP_AVMPCANDS, num_avai_candInLUT);
 
@@ -2259,7 +2220,7 @@ bool PU::isBipredRestriction(const PredictionUnit &pu)
 void PU::getAffineControlPointCand(const PredictionUnit &pu, MotionInfo mi[4], bool isAvailable[4], int verIdx[4],
                                    int8_t gbiIdx, int modelIdx, int verNum, AffineMergeCtx &affMrgType)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::getAffineControlPointCand" );
   int  cuW   = pu.Y().width;
   int  cuH   = pu.Y().height;
   int  vx, vy;
@@ -2399,16 +2360,12 @@ void PU::getAffineControlPointCand(const PredictionUnit &pu, MotionInfo mi[4], b
   affMrgType.GBiIdx[affMrgType.numValidMergeCand]             = (dir == 3) ? gbiIdx : GBI_DEFAULT;
   affMrgType.numValidMergeCand++;
 
-  auto stop                       = high_resolution_clock::now();
-  auto duration                   = duration_cast<nanoseconds>(stop - start);
-  timeOfGetAffineControlPointCand = timeOfGetAffineControlPointCand + duration.count();
-
   return;
 }
 
 const int getAvailableAffineNeighboursForLeftPredictor(const PredictionUnit &pu, const PredictionUnit *npu[])
 {
-  auto           start = high_resolution_clock::now();
+  PROFILE_ZONE( "getAvailableAffineNeighboursForLeftPredictor" );
   const Position posLB = pu.Y().bottomLeft();
   int            num   = 0;
 
@@ -2416,10 +2373,6 @@ const int getAvailableAffineNeighboursForLeftPredictor(const PredictionUnit &pu,
   if (puLeftBottom && puLeftBottom->cu->affine && puLeftBottom->mergeType == MRG_TYPE_DEFAULT_N)
   {
     npu[num++]    = puLeftBottom;
-    auto stop     = high_resolution_clock::now();
-    auto duration = duration_cast<nanoseconds>(stop - start);
-    timeOfGetAvailableAffineNeighboursForLeftPredictor =
-      timeOfGetAvailableAffineNeighboursForLeftPredictor + duration.count();
     return num;
   }
 
@@ -2427,25 +2380,16 @@ const int getAvailableAffineNeighboursForLeftPredictor(const PredictionUnit &pu,
   if (puLeft && puLeft->cu->affine && puLeft->mergeType == MRG_TYPE_DEFAULT_N)
   {
     npu[num++]    = puLeft;
-    auto stop     = high_resolution_clock::now();
-    auto duration = duration_cast<nanoseconds>(stop - start);
-    timeOfGetAvailableAffineNeighboursForLeftPredictor =
-      timeOfGetAvailableAffineNeighboursForLeftPredictor + duration.count();
     return num;
   }
 
-  auto stop     = high_resolution_clock::now();
-  auto duration = duration_cast<nanoseconds>(stop - start);
-  timeOfGetAvailableAffineNeighboursForLeftPredictor =
-    timeOfGetAvailableAffineNeighboursForLeftPredictor + duration.count();
-
   return num;
 }
 
 const int getAvailableAffineNeighboursForAbovePredictor(const PredictionUnit &pu, const PredictionUnit *npu[],
                                                         int numAffNeighLeft)
 {
-  auto           start = high_resolution_clock::now();
+  PROFILE_ZONE( "getAvailableAffineNeighboursForAbovePredictor" );
   const Position posLT = pu.Y().topLeft();
   const Position posRT = pu.Y().topRight();
   int            num   = numAffNeighLeft;
@@ -2454,10 +2398,6 @@ const int getAvailableAffineNeighboursForAbovePredictor(const PredictionUnit &pu
   if (puAboveRight && puAboveRight->cu->affine && puAboveRight->mergeType == MRG_TYPE_DEFAULT_N)
   {
     npu[num++]    = puAboveRight;
-    auto stop     = high_resolution_clock::now();
-    auto duration = duration_cast<nanoseconds>(stop - start);
-    timeOfGetAvailableAffineNeighboursForAbovePredictor =
-      timeOfGetAvailableAffineNeighboursForAbovePredictor + duration.count();
     return num;
   }
 
@@ -2465,10 +2405,6 @@ const int getAvailableAffineNeighboursForAbovePredictor(const PredictionUnit &pu
   if (puAbove && puAbove->cu->affine && puAbove->mergeType == MRG_TYPE_DEFAULT_N)
   {
     npu[num++]    = puAbove;
-    auto stop     = high_resolution_clock::now();
-    auto duration = duration_cast<nanoseconds>(stop - start);
-    timeOfGetAvailableAffineNeighboursForAbovePredictor =
-      timeOfGetAvailableAffineNeighboursForAbovePredictor + duration.count();
     return num;
   }
 
@@ -2476,24 +2412,15 @@ const int getAvailableAffineNeighboursForAbovePredictor(const PredictionUnit &pu
   if (puAboveLeft && puAboveLeft->cu->affine && puAboveLeft->mergeType == MRG_TYPE_DEFAULT_N)
   {
     npu[num++]    = puAboveLeft;
-    auto stop     = high_resolution_clock::now();
-    auto duration = duration_cast<nanoseconds>(stop - start);
-    timeOfGetAvailableAffineNeighboursForAbovePredictor =
-      timeOfGetAvailableAffineNeighboursForAbovePredictor + duration.count();
     return num;
   }
 
-  auto stop     = high_resolution_clock::now();
-  auto duration = duration_cast<nanoseconds>(stop - start);
-  timeOfGetAvailableAffineNeighboursForAbovePredictor =
-    timeOfGetAvailableAffineNeighboursForAbovePredictor + duration.count();
-
   return num;
 }
 
 void PU::getAffineMergeCand(const PredictionUnit &pu, AffineMergeCtx &affMrgCtx, const int mrgCandIdx)
 {
-  auto                   start                 = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::getAffineMergeCand" );
   const CodingStructure &cs                    = *pu.cs;
   const Slice &          slice                 = *pu.cs->slice;
   const uint32_t         maxNumAffineMergeCand = slice.getMaxNumAffineMergeCand();
@@ -2789,14 +2716,11 @@ void PU::getAffineMergeCand(const PredictionUnit &pu, AffineMergeCtx &affMrgCtx,
     cnt++;
     affMrgCtx.numValidMergeCand++;
   }
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfGetAffineMergeCand = timeOfGetAffineMergeCand + duration.count();
 }
 
 void PU::setAllAffineMvField(PredictionUnit &pu, MvField *mvField, RefPicList eRefList)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::setAllAffineMvField" );
   // Set Mv
   Mv mv[3];
   for (int i = 0; i < 3; i++)
@@ -2809,14 +2733,11 @@ void PU::setAllAffineMvField(PredictionUnit &pu, MvField *mvField, RefPicList eR
   CHECK(mvField[0].refIdx != mvField[1].refIdx || mvField[0].refIdx != mvField[2].refIdx,
         "Affine mv corners don't have the same refIdx.");
   pu.refIdx[eRefList]       = mvField[0].refIdx;
-  auto stop                 = high_resolution_clock::now();
-  auto duration             = duration_cast<nanoseconds>(stop - start);
-  timeOfSetAllAffineMvField = timeOfSetAllAffineMvField + duration.count();
 }
 
 void PU::setAllAffineMv(PredictionUnit &pu, Mv affLT, Mv affRT, Mv affLB, RefPicList eRefList, bool clipCPMVs)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::setAllAffineMv" );
   int  width = pu.Y().width;
   int  shift = MAX_CU_DEPTH;
   if (clipCPMVs)
@@ -2899,10 +2820,6 @@ void PU::setAllAffineMv(PredictionUnit &pu, Mv affLT, Mv affRT, Mv affLB, RefPic
   pu.mvAffi[eRefList][0] = affLT;
   pu.mvAffi[eRefList][1] = affRT;
   pu.mvAffi[eRefList][2] = affLB;
-
-  auto stop            = high_resolution_clock::now();
-  auto duration        = duration_cast<nanoseconds>(stop - start);
-  timeOfSetAllAffineMv = timeOfSetAllAffineMv + duration.count();
 }
 
 void clipColPos(int &posX, int &posY, const PredictionUnit &pu)
@@ -3208,7 +3125,7 @@ void PU::applyImv(PredictionUnit &pu, MergeCtx &mrgCtx, InterPrediction *interPr
 
 bool PU::isBiPredFromDifferentDir(const PredictionUnit &pu)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::isBiPredFromDifferentDir" );
   if (pu.refIdx[0] >= 0 && pu.refIdx[1] >= 0)
   {
     const int iPOC0 = pu.cu->slice->getRefPOC(REF_PIC_LIST_0, pu.refIdx[0]);
@@ -3216,23 +3133,16 @@ bool PU::isBiPredFromDifferentDir(const PredictionUnit &pu)
     const int iPOC  = pu.cu->slice->getPOC();
     if ((iPOC - iPOC0) * (iPOC - iPOC1) < 0)
     {
-      auto stop                      = high_resolution_clock::now();
-      auto duration                  = duration_cast<nanoseconds>(stop - start);
-      timeOfIsBiPredFromDifferentDir = timeOfIsBiPredFromDifferentDir + duration.count();
       return true;
     }
   }
 
-  auto stop                      = high_resolution_clock::now();
-  auto duration                  = duration_cast<nanoseconds>(stop - start);
-  timeOfIsBiPredFromDifferentDir = timeOfIsBiPredFromDifferentDir + duration.count();
-
   return false;
 }
 
 bool PU::isBiPredFromDifferentDirEqDistPoc(const PredictionUnit &pu)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::isBiPredFromDifferentDirEqDistPoc" );
   if (pu.refIdx[0] >= 0 && pu.refIdx[1] >= 0)
   {
     const int poc0 = pu.cu->slice->getRefPOC(REF_PIC_LIST_0, pu.refIdx[0]);
@@ -3244,16 +3154,10 @@ bool PU::isBiPredFromDifferentDirEqDistPoc(const PredictionUnit &pu)
       if (abs(poc - poc0) == abs(poc - poc1))
       //if (abs(calculateSum(poc, -poc0, 8, 7)) == abs(calculateSum(poc , - poc1, 8, 7)))
       {
-        auto stop                               = high_resolution_clock::now();
-        auto duration                           = duration_cast<nanoseconds>(stop - start);
-        timeOfIsBiPredFromDifferentDirEqDistPoc = timeOfIsBiPredFromDifferentDirEqDistPoc + duration.count();
         return true;
       }
     }
   }
-  auto stop                               = high_resolution_clock::now();
-  auto duration                           = duration_cast<nanoseconds>(stop - start);
-  timeOfIsBiPredFromDifferentDirEqDistPoc = timeOfIsBiPredFromDifferentDirEqDistPoc + duration.count();
   return false;
 }
 
@@ -3273,7 +3177,7 @@ void PU::restrictBiPredMergeCandsOne(PredictionUnit &pu)
 
 void PU::getTriangleMergeCandidates(const PredictionUnit &pu, MergeCtx &triangleMrgCtx)
 {
-  auto     start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::getTriangleMergeCandidates" );
   MergeCtx tmpMergeCtx;
 
   const Slice &  slice           = *pu.cs->slice;
@@ -3333,15 +3237,12 @@ void PU::getTriangleMergeCandidates(const PredictionUnit &pu, MergeCtx &triangle
       }
     }
   }
-  auto stop                        = high_resolution_clock::now();
-  auto duration                    = duration_cast<nanoseconds>(stop - start);
-  timeOfGetTriangleMergeCandidates = timeOfGetTriangleMergeCandidates + duration.count();
 }
 
 void PU::spanTriangleMotionInfo(PredictionUnit &pu, MergeCtx &triangleMrgCtx, const bool splitDir,
                                 const uint8_t candIdx0, const uint8_t candIdx1)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "PU::spanTriangleMotionInfo" );
 
   pu.triangleSplitDir  = splitDir;
   pu.triangleMergeIdx0 = candIdx0;
@@ -3423,9 +3324,6 @@ void PU::spanTriangleMotionInfo(PredictionUnit &pu, MergeCtx &triangleMrgCtx, co
       }
     }
   }
-  auto stop                    = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfSpanTriangleMotionInfo = timeOfSpanTriangleMotionInfo + duration.count();
 }
 
 int32_t PU::mappingRefPic(const PredictionUnit &pu, int32_t refPicPoc, bool targetRefPicList)
@@ -3640,38 +3538,26 @@ void CU::adjustPredArea(CompArea &area)
 
 bool CU::isGBiIdxCoded(const CodingUnit &cu)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "CU::isGBiIdxCoded" );
 
   if (cu.cs->sps->getUseGBi() == false)
   {
     CHECK(cu.GBiIdx != GBI_DEFAULT, "Error: cu.GBiIdx != GBI_DEFAULT");
-    auto stop          = high_resolution_clock::now();
-    auto duration      = duration_cast<nanoseconds>(stop - start);
-    timeOfsGBiIdxCoded = timeOfCheckDMVRCondition + duration.count();
     return false;
   }
 
   if (cu.predMode == MODE_IBC)
   {
-    auto stop          = high_resolution_clock::now();
-    auto duration      = duration_cast<nanoseconds>(stop - start);
-    timeOfsGBiIdxCoded = timeOfCheckDMVRCondition + duration.count();
     return false;
   }
 
   if (cu.predMode == MODE_INTRA || cu.cs->slice->isInterP())
   {
-    auto stop          = high_resolution_clock::now();
-    auto duration      = duration_cast<nanoseconds>(stop - start);
-    timeOfsGBiIdxCoded = timeOfCheckDMVRCondition + duration.count();
     return false;
   }
 
   if (cu.lwidth() * cu.lheight() < GBI_SIZE_CONSTRAINT)
   {
-    auto stop          = high_resolution_clock::now();
-    auto duration      = duration_cast<nanoseconds>(stop - start);
-    timeOfsGBiIdxCoded = timeOfCheckDMVRCondition + duration.count();
     return false;
   }
 
@@ -3689,27 +3575,18 @@ bool CU::isGBiIdxCoded(const CodingUnit &cu)
       if ((wp0[COMPONENT_Y].bPresentFlag || wp0[COMPONENT_Cb].bPresentFlag || wp0[COMPONENT_Cr].bPresentFlag
            || wp1[COMPONENT_Y].bPresentFlag || wp1[COMPONENT_Cb].bPresentFlag || wp1[COMPONENT_Cr].bPresentFlag))
       {
-        auto stop          = high_resolution_clock::now();
-        auto duration      = duration_cast<nanoseconds>(stop - start);
-        timeOfsGBiIdxCoded = timeOfCheckDMVRCondition + duration.count();
         return false;
       }
-      auto stop          = high_resolution_clock::now();
-      auto duration      = duration_cast<nanoseconds>(stop - start);
-      timeOfsGBiIdxCoded = timeOfCheckDMVRCondition + duration.count();
       return true;
     }
   }
-  auto stop          = high_resolution_clock::now();
-  auto duration      = duration_cast<nanoseconds>(stop - start);
-  timeOfsGBiIdxCoded = timeOfCheckDMVRCondition + duration.count();
 
   return false;
 }
 
 uint8_t CU::getValidGbiIdx(const CodingUnit &cu)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "CU::getValidGbiIdx" );
 
   if (cu.firstPU->interDir == 3 && !cu.firstPU->mergeFlag)
   {
@@ -3728,10 +3605,6 @@ uint8_t CU::getValidGbiIdx(const CodingUnit &cu)
     CHECK(cu.GBiIdx != GBI_DEFAULT, " cu.GBiIdx != GBI_DEFAULT ");
   }
 
-  auto stop            = high_resolution_clock::now();
-  auto duration        = duration_cast<nanoseconds>(stop - start);
-  timeOfGetValidGbiIdx = timeOfGetValidGbiIdx + duration.count();
-
   return GBI_DEFAULT;
 }
 
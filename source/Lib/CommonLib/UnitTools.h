@@ -42,25 +42,7 @@
 #include "UnitPartitioner.h"
 #include "ContextModelling.h"
 #include "InterPrediction.h"
-
-extern long long int timeOfCheckDMVRCondition;
-extern long long int timeOfSetAllAffineMv;
-extern long long int timeOfGetAffineControlPointCand;
-extern long long int timeOfFillAffineMvpCand;
-extern long long int timeOfSetAllAffineMvField;
-extern long long int timeOfGetAffineMergeCand;
-extern long long int timeOfAddAffineMVPCandUnscaled;
-extern long long int timeOfXInheritedAffineMv;
-extern long long int timeOfGetAvailableAffineNeighboursForLeftPredictor;
-extern long long int timeOfGetAvailableAffineNeighboursForAbovePredictor;
-extern long long int timeOfGetTriangleMergeCandidates;
-extern long long int timeOfSpanTriangleMotionInfo;
-extern long long int timeOfsGBiIdxCoded;
-extern long long int timeOfGetValidGbiIdx;
-extern long long int timeOfIsBiPredFromDifferentDir;
-extern long long int timeOfIsBiPredFromDifferentDirEqDistPoc;
-extern long long int timeOfSetRefinedMotionField;
-extern long long int timeOfXCheckSimilarMotion;
+#include "Profiler.h"
 
 // CS tools
 namespace CS
@@ -69,6 +51,8 @@ namespace CS
   UnitArea getArea                    ( const CodingStructure &cs, const UnitArea &area, const ChannelType chType );
   bool   isDualITree                  ( const CodingStructure &cs );
   void   setRefinedMotionField(CodingStructure &cs);
+  // the CUs of one CTU, CTU by CTU after the deblocking of the CTUs next to it
+  void   setRefinedMotionField(CodingStructure &cs, const UnitArea &ctuArea);
 }
 
 
@@ -165,7 +149,7 @@ namespace PU
   bool addMVPCandUnscaled             (const PredictionUnit &pu, const RefPicList &eRefPicList, const int &iRefIdx, const Position &pos, const MvpDir &eDir, AMVPInfo &amvpInfo);
   void xInheritedAffineMv             ( const PredictionUnit &pu, const PredictionUnit* puNeighbour, RefPicList eRefPicList, Mv rcMv[3] );
   bool xCheckSimilarMotion(const int mergeCandIndex, const int prevCnt, const MergeCtx mergeCandList, bool hasPruned[MRG_MAX_NUM_CANDS]);
-  bool addMergeHMVPCand(const CodingStructure &cs, MergeCtx& mrgCtx, bool canFastExit, const int& mrgCandIdx, const uint32_t maxNumMergeCandMin1, int &cnt, const int prevCnt, bool isAvailableSubPu, unsigned subPuMvpPos
+  bool addMergeHMVPCand(const PredictionUnit &pu, MergeCtx& mrgCtx, bool canFastExit, const int& mrgCandIdx, const uint32_t maxNumMergeCandMin1, int &cnt, const int prevCnt, bool isAvailableSubPu, unsigned subPuMvpPos
     , bool ibcFlag
     , bool isShared
   );
@@ -231,7 +215,7 @@ template<typename T, size_t N>
 uint32_t updateCandList(T uiMode, double uiCost, static_vector<T, N>& candModeList, static_vector<double, N>& candCostList
   , size_t uiFastCandNum = N, int* iserttPos = nullptr)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "updateCandList" );
   CHECK( std::min( uiFastCandNum, candModeList.size() ) != std::min( uiFastCandNum, candCostList.size() ), "Sizes do not match!" );
   CHECK( uiFastCandNum > candModeList.capacity(), "The vector is to small to hold all the candidates!" );
 
@@ -258,10 +242,6 @@ uint32_t updateCandList(T uiMode, double uiCost, static_vector<T, N>& candModeLi
       *iserttPos = int(currSize - shift);
     }
 
-    auto stop        = high_resolution_clock::now();
-    auto duration    = duration_cast<nanoseconds>(stop - start);
-    timeOfUpdateCandList = timeOfUpdateCandList + duration.count();
-
     return 1;
   }
   else if( currSize < uiFastCandNum )
@@ -272,9 +252,6 @@ uint32_t updateCandList(T uiMode, double uiCost, static_vector<T, N>& candModeLi
     {
       *iserttPos = int(candModeList.size() - shift - 1);
     }
-    auto stop            = high_resolution_clock::now();
-    auto duration        = duration_cast<nanoseconds>(stop - start);
-    timeOfUpdateCandList = timeOfUpdateCandList + duration.count();
 
     return 1;
   }
@@ -282,9 +259,6 @@ uint32_t updateCandList(T uiMode, double uiCost, static_vector<T, N>& candModeLi
   {
     *iserttPos = -1;
   }
-  auto stop            = high_resolution_clock::now();
-  auto duration        = duration_cast<nanoseconds>(stop - start);
-  timeOfUpdateCandList = timeOfUpdateCandList + duration.count();
 
   return 0;
 }
@@ -43,14 +43,7 @@
 #include "CommonDefX86.h"
 #include "../AffineGradientSearch.h"
 #include "../../CommonLib/InterPrediction.h"
-
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
+#include "CommonLib/Profiler.h"
 
 
 //! \ingroup CommonLib
@@ -88,7 +81,7 @@ inter3 = _mm_add_epi64(inter0, inter3);
 template<X86_VEXT vext>
 static void simdHorizontalSobelFilter( Pel *const pPred, const int predStride, int *const pDerivate, const int derivateBufStride, const int width, const int height )
 {
-  auto    start = high_resolution_clock::now();
+  PROFILE_ZONE( "simdHorizontalSobelFilter" );
 
   __m128i mmPred[4];
   __m128i mm2xPred[2];
@@ -154,15 +147,12 @@ static void simdHorizontalSobelFilter( Pel *const pPred, const int predStride, i
   memcpy( pDerivate, pDerivate + derivateBufStride, width * sizeof( pDerivate[0] ) );
   memcpy( pDerivate + (height - 1) * derivateBufStride, pDerivate + (height - 2) * derivateBufStride, width * sizeof( pDerivate[0] )
   );
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfSimdHorizontalSobelFilter = timeOfSimdHorizontalSobelFilter + duration.count();
 }
 
 template<X86_VEXT vext>
 static void simdVerticalSobelFilter( Pel *const pPred, const int predStride, int *const pDerivate, const int derivateBufStride, const int width, const int height )
 {
-  auto    start = high_resolution_clock::now();
+  PROFILE_ZONE( "simdVerticalSobelFilter" );
   __m128i mmPred[4];
   __m128i mmIntermediates[6];
   __m128i mmDerivate[2];
@@ -227,16 +217,13 @@ static void simdVerticalSobelFilter( Pel *const pPred, const int predStride, int
 
   memcpy( pDerivate, pDerivate + derivateBufStride, width * sizeof( pDerivate[0] ) );
   memcpy( pDerivate + (height - 1) * derivateBufStride, pDerivate + (height - 2) * derivateBufStride, width * sizeof( pDerivate[0] ) );
-  auto stop = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfSimdVerticalSobelFilter = timeOfSimdVerticalSobelFilter + duration.count();
 }
 
 
 template<X86_VEXT vext>
 static void simdEqualCoeffComputer( Pel *pResidue, int residueStride, int **ppDerivate, int derivateBufStride, int64_t( *pEqualCoeff )[7], int width, int height, bool b6Param )
 {
-   auto start = high_resolution_clock::now();
+   PROFILE_ZONE( "simdEqualCoeffComputer" );
 
   __m128i mmFour;
   __m128i mmTmp[4];
@@ -347,10 +334,6 @@ static void simdEqualCoeffComputer( Pel *pResidue, int residueStride, int **ppDe
     idx1 -= (width);
     idx2 -= (width);
   }
-  
-  auto stop = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfSimdEqualCoeffComputer = timeOfSimdEqualCoeffComputer + duration.count();
 }
 
 
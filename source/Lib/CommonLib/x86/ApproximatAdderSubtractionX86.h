@@ -0,0 +1,197 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ApproximatAdderSubtractionX86.h
+    \brief    SIMD versions of the approximate adders, operating on 32 bit lanes
+*/
+
+#ifndef __APPROXIMATADDERSUBTRACTIONX86__
+#define __APPROXIMATADDERSUBTRACTIONX86__
+
+#include "CommonDefX86.h"
+#include "CommonLib/ApproximatAdderSubtraction.h"
+
+//! \ingroup CommonLib
+//! \{
+
+#ifdef TARGET_SIMD_X86
+
+struct ApproxSSEOps
+{
+  typedef __m128i T;
+  static inline T And   ( T a, T b )           { return _mm_and_si128   ( a, b ); }
+  static inline T Or    ( T a, T b )           { return _mm_or_si128    ( a, b ); }
+  static inline T Xor   ( T a, T b )           { return _mm_xor_si128   ( a, b ); }
+  static inline T AndNot( T a, T b )           { return _mm_andnot_si128( a, b ); }
+  static inline T Shl1  ( T a )                { return _mm_slli_epi32  ( a, 1 ); }
+  static inline T Set   ( int c )              { return _mm_set1_epi32  ( c ); }
+  static inline T Zero  ()                     { return _mm_setzero_si128(); }
+  static inline T Add   ( T a, T b )           { return _mm_add_epi32   ( a, b ); }
+  static inline T Sub   ( T a, T b )           { return _mm_sub_epi32   ( a, b ); }
+  static inline T Abs   ( T a )                { return _mm_abs_epi32   ( a ); }
+  static inline T Max   ( T a, T b )           { return _mm_max_epi32   ( a, b ); }
+  static inline T Min   ( T a, T b )           { return _mm_min_epi32   ( a, b ); }
+  static inline T CmpGt ( T a, T b )           { return _mm_cmpgt_epi32 ( a, b ); }
+  static inline T CmpEq ( T a, T b )           { return _mm_cmpeq_epi32 ( a, b ); }
+  static inline T Sel   ( T a, T b, T mask )   { return _mm_blendv_epi8 ( a, b, mask ); }
+  static inline T Srl   ( T a, __m128i count ) { return _mm_srl_epi32   ( a, count ); }
+  static inline T Sll   ( T a, __m128i count ) { return _mm_sll_epi32   ( a, count ); }
+  static inline T Sra   ( T a, __m128i count ) { return _mm_sra_epi32   ( a, count ); }
+  static inline T Mul   ( T a, T b )           { return _mm_mullo_epi32 ( a, b ); }
+  static inline T Trunc16( T a )               { return _mm_srai_epi32  ( _mm_slli_epi32( a, 16 ), 16 ); }
+
+  static const int lanes = 4;
+  static inline T    LoadPel ( const Pel *src )  { return _mm_cvtepi16_epi32( _mm_loadl_epi64( ( const __m128i* ) src ) ); }
+  static inline void StorePel( Pel *dst, T a )   { _mm_storel_epi64( ( __m128i* ) dst, _mm_packs_epi32( a, a ) ); }
+};
+
+#ifdef USE_AVX2
+struct ApproxAVX2Ops
+{
+  typedef __m256i T;
+  static inline T And   ( T a, T b )           { return _mm256_and_si256   ( a, b ); }
+  static inline T Or    ( T a, T b )           { return _mm256_or_si256    ( a, b ); }
+  static inline T Xor   ( T a, T b )           { return _mm256_xor_si256   ( a, b ); }
+  static inline T AndNot( T a, T b )           { return _mm256_andnot_si256( a, b ); }
+  static inline T Shl1  ( T a )                { return _mm256_slli_epi32  ( a, 1 ); }
+  static inline T Set   ( int c )              { return _mm256_set1_epi32  ( c ); }
+  static inline T Zero  ()                     { return _mm256_setzero_si256(); }
+  static inline T Add   ( T a, T b )           { return _mm256_add_epi32   ( a, b ); }
+  static inline T Sub   ( T a, T b )           { return _mm256_sub_epi32   ( a, b ); }
+  static inline T Abs   ( T a )                { return _mm256_abs_epi32   ( a ); }
+  static inline T Max   ( T a, T b )           { return _mm256_max_epi32   ( a, b ); }
+  static inline T Min   ( T a, T b )           { return _mm256_min_epi32   ( a, b ); }
+  static inline T CmpGt ( T a, T b )           { return _mm256_cmpgt_epi32 ( a, b ); }
+  static inline T CmpEq ( T a, T b )           { return _mm256_cmpeq_epi32 ( a, b ); }
+  static inline T Sel   ( T a, T b, T mask )   { return _mm256_blendv_epi8 ( a, b, mask ); }
+  static inline T Srl   ( T a, __m128i count ) { return _mm256_srl_epi32   ( a, count ); }
+  static inline T Sll   ( T a, __m128i count ) { return _mm256_sll_epi32   ( a, count ); }
+  static inline T Sra   ( T a, __m128i count ) { return _mm256_sra_epi32   ( a, count ); }
+  static inline T Mul   ( T a, T b )           { return _mm256_mullo_epi32 ( a, b ); }
+  static inline T Trunc16( T a )               { return _mm256_srai_epi32  ( _mm256_slli_epi32( a, 16 ), 16 ); }
+
+  static const int lanes = 8;
+  static inline T    LoadPel ( const Pel *src )  { return _mm256_cvtepi16_epi32( _mm_loadu_si128( ( const __m128i* ) src ) ); }
+  static inline void StorePel( Pel *dst, T a )   { _mm_storeu_si128( ( __m128i* ) dst, _mm_packs_epi32( _mm256_castsi256_si128( a ), _mm256_extracti128_si256( a, 1 ) ) ); }
+};
+#endif
+
+// loop invariant constants of the lower-part OR adder, derived once per kernel call from ApproxAdderParam
+template<typename OPS>
+struct ApproxLoaConsts
+{
+  typedef typename OPS::T T;
+
+  T       mask;           // numberBits
+  T       maskBalanced;   // max( numberBits, approximateCount )
+  T       lowerMask;
+  T       upperMaskSub;   // upper part without carry out
+  __m128i count;
+  __m128i carryCount;     // >= 32 disables the carry in
+
+  ApproxLoaConsts( const ApproxAdderParam &param )
+  {
+    const int numberBits       = param.numberBits;
+    const int approximateCount = std::max( param.approximateCount, 0 );
+    const int numBits          = std::max( numberBits, approximateCount );
+
+    mask         = OPS::Set( int( ( 1u << numberBits ) - 1 ) );
+    maskBalanced = OPS::Set( int( ( 1u << numBits ) - 1 ) );
+    lowerMask    = OPS::Set( approximateCount >= 32 ? -1 : int( ( 1u << approximateCount ) - 1 ) );
+    upperMaskSub = OPS::Set( approximateCount < numBits ? int( ( 1u << ( numBits - approximateCount ) ) - 1 ) : 0 );
+    count        = _mm_cvtsi32_si128( approximateCount );
+    carryCount   = _mm_cvtsi32_si128( approximateCount > 0 && approximateCount < numberBits ? approximateCount - 1 : 32 );
+  }
+};
+
+template<typename OPS>
+static inline typename OPS::T approximateAddVec( const typename OPS::T a, const typename OPS::T b, const ApproxLoaConsts<OPS> &c, const typename OPS::T upperMask )
+{
+  typedef typename OPS::T T;
+
+  const T lowerPart = OPS::And( OPS::Or( a, b ), c.lowerMask );
+  const T carry     = OPS::And( OPS::Srl( OPS::And( a, b ), c.carryCount ), OPS::Set( 1 ) );
+  T       upperPart = OPS::Add( OPS::Add( OPS::Srl( a, c.count ), OPS::Srl( b, c.count ) ), carry );
+  upperPart         = OPS::And( upperPart, upperMask );
+  return OPS::Or( OPS::Sll( upperPart, c.count ), lowerPart );
+}
+
+// vector counterpart of approximateSum<adder>(), bit exact per 32 bit lane
+template<typename OPS, int adder>
+static inline typename OPS::T approximateSumVec( const typename OPS::T a, const typename OPS::T b, const ApproxLoaConsts<OPS> &c )
+{
+  typedef typename OPS::T T;
+
+  if( adder == APPROX_ADDER_EXACT )
+  {
+    return OPS::Add( a, b );
+  }
+
+  const T zero   = OPS::Zero();
+  const T absOne = OPS::Abs( a );
+  const T absTwo = OPS::Abs( b );
+  const T isSub  = OPS::AndNot( OPS::Or( OPS::CmpEq( a, zero ), OPS::CmpEq( b, zero ) ), OPS::CmpGt( zero, OPS::Xor( a, b ) ) );
+  const T isNeg  = OPS::Or( OPS::And( OPS::CmpGt( absOne, absTwo ), OPS::CmpGt( zero, a ) ),
+                            OPS::And( OPS::CmpGt( absTwo, absOne ), OPS::CmpGt( zero, b ) ) );
+  const T absMax = OPS::Max( absOne, absTwo );
+  const T absMin = OPS::Min( absOne, absTwo );
+
+  T sum, diff;
+
+  if( adder == APPROX_ADDER_LOA )
+  {
+    const T maxBin = OPS::And( absMax, c.mask );
+    const T minBin = OPS::And( absMin, c.mask );
+    sum            = approximateAddVec<OPS>( maxBin, minBin, c, OPS::Set( -1 ) );
+    const T compl2 = approximateAddVec<OPS>( OPS::AndNot( minBin, c.maskBalanced ), OPS::Set( 1 ), c, c.upperMaskSub );
+    diff           = approximateAddVec<OPS>( maxBin, compl2, c, c.upperMaskSub );
+  }
+  else
+  {
+    const ApproxAdder8Bit type = ApproxAdder8Bit( adder - APPROX_ADDER_TYPE1 );
+    const T ff                 = OPS::Set( 0xff );
+    const T compl2             = OPS::And( OPS::Sub( zero, OPS::And( absMin, ff ) ), ff );
+
+    sum  = approximateAdder8BitGates<OPS, type>( OPS::And( absOne, ff ), OPS::And( absTwo, ff ) );
+    diff = OPS::And( approximateAdder8BitGates<OPS, type>( OPS::And( absMax, ff ), compl2 ), ff );
+  }
+
+  const T res = OPS::Sel( sum, diff, isSub );
+  return OPS::Sub( OPS::Xor( res, isNeg ), isNeg );
+}
+
+#endif // TARGET_SIMD_X86
+
+//! \}
+
+#endif // __APPROXIMATADDERSUBTRACTIONX86__
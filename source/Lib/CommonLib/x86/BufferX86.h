@@ -44,13 +44,8 @@
 #include "CommonLib/Unit.h"
 #include "CommonLib/Buffer.h"
 #include "CommonLib/InterpolationFilter.h"
-#include "CommonLib/ApproximatAdderSubtraction.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
+#include "ApproximatAdderSubtractionX86.h"
+#include "CommonLib/Profiler.h"
 
 #if ENABLE_SIMD_OPT_BUFFER
 #ifdef TARGET_SIMD_X86
@@ -127,7 +122,7 @@ void addAvg_SSE( const int16_t* src0, int src0Stride, const int16_t* src1, int s
 template<X86_VEXT vext>
 void copyBufferSimd(Pel *src, int srcStride, Pel *dst, int dstStride, int width, int height)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "copyBufferSimd" );
 
   if (width < 8)
   {
@@ -157,16 +152,12 @@ void copyBufferSimd(Pel *src, int srcStride, Pel *dst, int dstStride, int width,
       }
     }
   }
-
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfCopyBufferSimd  = timeOfCopyBufferSimd + duration.count();
 }
 
 template<X86_VEXT vext>
 void paddingSimd(Pel *dst, int stride, int width, int height, int padSize)
 {
-  auto   start    = high_resolution_clock::now();
+  PROFILE_ZONE( "paddingSimd" );
 
   size_t extWidth = width + 2 * padSize;
   CHECK(extWidth < 8, "width plus 2 times padding size must be at least 8");
@@ -244,16 +235,12 @@ void paddingSimd(Pel *dst, int stride, int width, int height, int padSize)
   {
     CHECK(false, "padding size must be 1 or 2");
   }
-
-  auto stop            = high_resolution_clock::now();
-  auto duration        = duration_cast<nanoseconds>(stop - start);
-  timeOfPaddingSimd    = timeOfPaddingSimd + duration.count();
 }
 
 template< X86_VEXT vext >
 void addBIOAvg4_SSE(const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, const Pel *gradX0, const Pel *gradX1, const Pel *gradY0, const Pel*gradY1, int gradStride, int width, int height, int tmpx, int tmpy, int shift, int offset, const ClpRng& clpRng)
 {
-  auto    start    = high_resolution_clock::now();
+  PROFILE_ZONE( "addBIOAvg4_SSE" );
   __m128i c        = _mm_unpacklo_epi16(_mm_set1_epi16(tmpx), _mm_set1_epi16(tmpy));
   __m128i vibdimin = _mm_set1_epi16(clpRng.min);
   __m128i vibdimax = _mm_set1_epi16(clpRng.max);
@@ -282,16 +269,12 @@ void addBIOAvg4_SSE(const Pel* src0, int src0Stride, const Pel* src1, int src1St
     dst += dstStride;       src0 += src0Stride;     src1 += src1Stride;
     gradX0 += gradStride; gradX1 += gradStride; gradY0 += gradStride; gradY1 += gradStride;
   }
-
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfAddBIOAvg4_SSE  = timeOfAddBIOAvg4_SSE + duration.count();
 }
 
 template< X86_VEXT vext >
 void calcBIOSums_SSE(const Pel* srcY0Tmp, const Pel* srcY1Tmp, Pel* gradX0, Pel* gradX1, Pel* gradY0, Pel* gradY1, int xu, int yu, const int src0Stride, const int src1Stride, const int widthG, const int bitDepth, int* sumAbsGX, int* sumAbsGY, int* sumDIX, int* sumDIY, int* sumSignGY_GX)
 {
-  auto start  = high_resolution_clock::now();
+  PROFILE_ZONE( "calcBIOSums_SSE" );
   int shift4 = std::max<int>(4, (bitDepth - 8));
   //int  shift4 = std::max<int>(4, (calculateSum(bitDepth, - 8, 8, 7)));
   int shift5 = std::max<int>(1, (bitDepth - 11));
@@ -366,10 +349,6 @@ void calcBIOSums_SSE(const Pel* srcY0Tmp, const Pel* srcY1Tmp, Pel* gradX0, Pel*
   sumSignGyGxTmp = _mm_add_epi32(sumSignGyGxTmp, _mm_shuffle_epi32(sumSignGyGxTmp, 0x4e));   // 01001110
   sumSignGyGxTmp = _mm_add_epi32(sumSignGyGxTmp, _mm_shuffle_epi32(sumSignGyGxTmp, 0xb1));   // 10110001
   *sumSignGY_GX  = _mm_cvtsi128_si32(sumSignGyGxTmp);
-
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfCalcBIOSums_SSE = timeOfCalcBIOSums_SSE + duration.count();
 }
 
 template< X86_VEXT vext >
@@ -579,7 +558,7 @@ void roundIntVector_SIMD(int* v, int size, unsigned int nShift, const int dmvLim
 template< X86_VEXT vext, bool PAD = true>
 void gradFilter_SSE(Pel* src, int srcStride, int width, int height, int gradStride, Pel* gradX, Pel* gradY, const int bitDepth)
 {
-  auto start    = high_resolution_clock::now();
+  PROFILE_ZONE( "gradFilter_SSE" );
   Pel* srcTmp = src + srcStride + 1;
   Pel* gradXTmp = gradX + gradStride + 1;
   Pel* gradYTmp = gradY + gradStride + 1;
@@ -659,10 +638,6 @@ void gradFilter_SSE(Pel* src, int srcStride, int width, int height, int gradStri
   ::memcpy(gradYTmp - gradStride, gradYTmp, sizeof(Pel)*(width));
   ::memcpy(gradYTmp + heightInside*gradStride, gradYTmp + (heightInside - 1)*gradStride, sizeof(Pel)*(width));
   }
-
-  auto stop            = high_resolution_clock::now();
-  auto duration        = duration_cast<nanoseconds>(stop - start);
-  timeOfGradFilter_SSE = timeOfGradFilter_SSE + duration.count();
 }
 
 template< X86_VEXT vext >
@@ -963,7 +938,7 @@ void reco_SSE( const int16_t* src0, int src0Stride, const int16_t* src1, int src
 template< X86_VEXT vext, int W >
 void removeWeightHighFreq_SSE(int16_t* src0, int src0Stride, const int16_t* src1, int src1Stride, int width, int height, int shift, int gbiWeight)
 {
-  auto start      = high_resolution_clock::now();
+  PROFILE_ZONE( "removeWeightHighFreq_SSE" );
   int normalizer = ((1 << 16) + (gbiWeight>0 ? (gbiWeight >> 1) : -(gbiWeight >> 1))) / gbiWeight;
   int weight0 = normalizer << g_GbiLog2WeightBase;
   int weight1 = (g_GbiWeightBase - gbiWeight)*normalizer;
@@ -1037,10 +1012,6 @@ void removeWeightHighFreq_SSE(int16_t* src0, int src0Stride, const int16_t* src1
   {
     THROW("Unsupported size");
   }
-
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfRemoveWeightHighFreq_SSE = timeOfRemoveWeightHighFreq_SSE + duration.count();
 }
 
 template< X86_VEXT vext, int W >
@@ -1244,12 +1215,110 @@ void linTf_SSE_entry( const Pel* src, int srcStride, Pel *dst, int dstStride, in
   }
 }
 
+template<typename OPS, bool weighted, int adder>
+void addAvgApprox_SIMD( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int shift, int offset, const ClpRng& clpRng )
+{
+  typedef typename OPS::T T;
+
+  const ApproxLoaConsts<OPS> loa( g_approxAdderParam );
+  const int     numberBits       = g_approxAdderParam.numberBits;
+  const int     approximateCount = g_approxAdderParam.approximateCount;
+  const int     widthSimd        = width - width % OPS::lanes;
+  const T       vW0              = OPS::Set( w0 );
+  const T       vW1              = OPS::Set( w1 );
+  const T       vOffset          = OPS::Set( offset );
+  const T       vMin             = OPS::Set( clpRng.min );
+  const T       vMax             = OPS::Set( clpRng.max );
+  const __m128i vShift           = _mm_cvtsi32_si128( shift );
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+    for( ; col < widthSimd; col += OPS::lanes )
+    {
+      T s0 = OPS::LoadPel( src0 + col );
+      T s1 = OPS::LoadPel( src1 + col );
+      if( weighted )
+      {
+        s0 = OPS::Mul( s0, vW0 );
+        s1 = OPS::Mul( s1, vW1 );
+      }
+      T val = approximateSumVec<OPS, adder>( approximateSumVec<OPS, adder>( s0, s1, loa ), vOffset, loa );
+      val   = OPS::Min( vMax, OPS::Max( vMin, OPS::Sra( val, vShift ) ) );
+      OPS::StorePel( dst + col, val );
+    }
+
+    for( ; col < width; col++ )
+    {
+      const int s0  = weighted ? src0[col] * w0 : src0[col];
+      const int s1  = weighted ? src1[col] * w1 : src1[col];
+      const int val = approximateSum<adder>( approximateSum<adder>( s0, s1, numberBits, approximateCount ), offset, numberBits, approximateCount );
+      dst[col]      = ClipPel( rightShift( val, shift ), clpRng );
+    }
+
+    src0 += src0Stride;
+    src1 += src1Stride;
+    dst  +=  dstStride;
+  }
+}
+
+template<X86_VEXT vext, int adder>
+void addAvgApprox_SSE( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int shift, int offset, const ClpRng& clpRng )
+{
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    addAvgApprox_SIMD<ApproxAVX2Ops, false, adder>( src0, src0Stride, src1, src1Stride, dst, dstStride, width, height, 1, 1, shift, offset, clpRng );
+    return;
+  }
+#endif
+  addAvgApprox_SIMD<ApproxSSEOps, false, adder>( src0, src0Stride, src1, src1Stride, dst, dstStride, width, height, 1, 1, shift, offset, clpRng );
+}
+
+template<X86_VEXT vext, int adder>
+void addWeightedAvgApprox_SSE( const Pel* src0, int src0Stride, const Pel* src1, int src1Stride, Pel *dst, int dstStride, int width, int height, int w0, int w1, int shift, int offset, const ClpRng& clpRng )
+{
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    addAvgApprox_SIMD<ApproxAVX2Ops, true, adder>( src0, src0Stride, src1, src1Stride, dst, dstStride, width, height, w0, w1, shift, offset, clpRng );
+    return;
+  }
+#endif
+  addAvgApprox_SIMD<ApproxSSEOps, true, adder>( src0, src0Stride, src1, src1Stride, dst, dstStride, width, height, w0, w1, shift, offset, clpRng );
+}
+
 template<X86_VEXT vext>
 void PelBufferOps::_initPelBufOpsX86()
 {
   addAvg8 = addAvg_SSE<vext, 8>;
   addAvg4 = addAvg_SSE<vext, 4>;
 
+  addAvgApprox[APPROX_ADDER_EXACT]              = addAvgApprox_SSE<vext, APPROX_ADDER_EXACT>;
+  addAvgApprox[APPROX_ADDER_LOA]                = addAvgApprox_SSE<vext, APPROX_ADDER_LOA>;
+  addAvgApprox[APPROX_ADDER_TYPE1]              = addAvgApprox_SSE<vext, APPROX_ADDER_TYPE1>;
+  addAvgApprox[APPROX_ADDER_TYPE2]              = addAvgApprox_SSE<vext, APPROX_ADDER_TYPE2>;
+  addAvgApprox[APPROX_ADDER_TYPE3]              = addAvgApprox_SSE<vext, APPROX_ADDER_TYPE3>;
+  addAvgApprox[APPROX_ADDER_TYPE4]              = addAvgApprox_SSE<vext, APPROX_ADDER_TYPE4>;
+  addAvgApprox[APPROX_ADDER_TYPE5]              = addAvgApprox_SSE<vext, APPROX_ADDER_TYPE5>;
+  addAvgApprox[APPROX_ADDER_M45_P35_A7]         = addAvgApprox_SSE<vext, APPROX_ADDER_M45_P35_A7>;
+  addAvgApprox[APPROX_ADDER_M45_P30_A6]         = addAvgApprox_SSE<vext, APPROX_ADDER_M45_P30_A6>;
+  addAvgApprox[APPROX_ADDER_M60_P25_A6]         = addAvgApprox_SSE<vext, APPROX_ADDER_M60_P25_A6>;
+  addAvgApprox[APPROX_ADDER_M95_P10_A5]         = addAvgApprox_SSE<vext, APPROX_ADDER_M95_P10_A5>;
+
+  addWeightedAvgApprox[APPROX_ADDER_EXACT]      = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_EXACT>;
+  addWeightedAvgApprox[APPROX_ADDER_LOA]        = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_LOA>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE1]      = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_TYPE1>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE2]      = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_TYPE2>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE3]      = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_TYPE3>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE4]      = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_TYPE4>;
+  addWeightedAvgApprox[APPROX_ADDER_TYPE5]      = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_TYPE5>;
+  addWeightedAvgApprox[APPROX_ADDER_M45_P35_A7] = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_M45_P35_A7>;
+  addWeightedAvgApprox[APPROX_ADDER_M45_P30_A6] = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_M45_P30_A6>;
+  addWeightedAvgApprox[APPROX_ADDER_M60_P25_A6] = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_M60_P25_A6>;
+  addWeightedAvgApprox[APPROX_ADDER_M95_P10_A5] = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_M95_P10_A5>;
+  addWeightedAvg                                = addWeightedAvgApprox_SSE<vext, APPROX_ADDER_EXACT>;
+
   addBIOAvg4      = addBIOAvg4_SSE<vext>;
   bioGradFilter   = gradFilter_SSE<vext>;
   calcBIOSums = calcBIOSums_SSE<vext>;
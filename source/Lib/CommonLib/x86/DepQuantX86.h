@@ -0,0 +1,383 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     DepQuantX86.h
+    \brief    SIMD version of the rate distortion decisions of the dependent quantization trellis
+*/
+
+#include "CommonDefX86.h"
+#include "../DepQuant.h"
+
+#ifdef TARGET_SIMD_X86
+#if defined _MSC_VER
+#include <tmmintrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+//! \ingroup CommonLib
+//! \{
+
+// rice code lengths g_goRiceBits[idx][goRicePar] of the four states
+template<X86_VEXT vext>
+static inline __m128i goRiceBits4( __m128i goRicePar, __m128i idx )
+{
+  const __m128i pos = _mm_add_epi32( _mm_slli_epi32( idx, 2 ), goRicePar );
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    return _mm_i32gather_epi32( &DQIntern::g_goRiceBits[0][0], pos, 4 );
+  }
+#endif
+  const int32_t* tab = &DQIntern::g_goRiceBits[0][0];
+  return _mm_setr_epi32( tab[_mm_extract_epi32( pos, 0 )], tab[_mm_extract_epi32( pos, 1 )], tab[_mm_extract_epi32( pos, 2 )], tab[_mm_extract_epi32( pos, 3 )] );
+}
+
+// Rates of level01 for the states 0 and 1 and of level23 for the states 2 and 3, coded with context coded bins. The
+// levels above 3 use the bits of 4 or 5, depending on their parity, and the rice code of the remainder, a row of the
+// rice code table shuffled with the rice parameters of the states.
+static inline __m128i regularBits4( const DQIntern::StateMem& states, const int level01, const int level23, const __m128i goRiceShuffle )
+{
+  const __m128i bits01 = _mm_loadu_si128( ( const __m128i* ) states.coeffBits[level01 < 4 ? level01 : 4 + ( level01 & 1 )] );
+  const __m128i bits23 = _mm_loadu_si128( ( const __m128i* ) states.coeffBits[level23 < 4 ? level23 : 4 + ( level23 & 1 )] );
+  __m128i       bits   = _mm_blend_epi16( bits01, bits23, 0xf0 );
+  if( level01 >= 4 || level23 >= 4 )
+  {
+    const int     value01 = std::max( 0, std::min( ( level01 - 4 ) >> 1, 31 ) );
+    const int     value23 = std::max( 0, std::min( ( level23 - 4 ) >> 1, 31 ) );
+    const __m128i rice01  = _mm_loadu_si128( ( const __m128i* ) DQIntern::g_goRiceBits[value01] );
+    const __m128i rice23  = _mm_loadu_si128( ( const __m128i* ) DQIntern::g_goRiceBits[value23] );
+    const __m128i rice    = _mm_shuffle_epi8( _mm_blend_epi16( level01 >= 4 ? rice01 : _mm_setzero_si128(), level23 >= 4 ? rice23 : _mm_setzero_si128(), 0xf0 ), goRiceShuffle );
+    bits = _mm_add_epi32( bits, rice );
+  }
+  return bits;
+}
+
+// rate of the levels for the states coding them in bypass mode only
+template<X86_VEXT vext>
+static inline __m128i bypassBits4( __m128i level, __m128i goRicePar, __m128i goRiceZero )
+{
+  const __m128i idx = _mm_blendv_epi8( _mm_min_epi32( level, _mm_set1_epi32( 31 ) ), _mm_sub_epi32( level, _mm_set1_epi32( 1 ) ),
+                                       _mm_cmpgt_epi32( _mm_add_epi32( goRiceZero, _mm_set1_epi32( 1 ) ), level ) );
+  return _mm_add_epi32( _mm_set1_epi32( 1 << SCALE_BITS ), goRiceBits4<vext>( goRicePar, idx ) );
+}
+
+// rdCost + deltaDist + bits of the two states in the low or the high half of the 32 bit lanes
+static inline __m128i rdCost2( __m128i rdCost, int64_t deltaDist, __m128i bits, bool high )
+{
+  const __m128i bits64 = _mm_cvtepi32_epi64( high ? _mm_unpackhi_epi64( bits, bits ) : bits );
+  return _mm_add_epi64( _mm_add_epi64( rdCost, _mm_set1_epi64x( deltaDist ) ), bits64 );
+}
+
+// Replaces the decisions of the two 64 bit lanes with the candidates of lower cost. All costs are below 2^62 plus the
+// rate of a coefficient and above minus 2^62, the sign of the 64 bit difference is the result of the comparison.
+static inline void selectDecisions2( __m128i& cost, __m128i& info, __m128i candCost, __m128i candInfo )
+{
+  const __m128i less = _mm_shuffle_epi32( _mm_srai_epi32( _mm_sub_epi64( candCost, cost ), 31 ), 0xf5 );
+  cost = _mm_blendv_epi8( cost, candCost, less );
+  info = _mm_blendv_epi8( info, candInfo, less );
+}
+
+// level in the low and id of the previous state in the high 32 bits, matching the layout of a decision
+static inline __m128i decisionInfo2( int level0, int prevId0, int level1, int prevId1 )
+{
+  return _mm_setr_epi32( level0, prevId0, level1, prevId1 );
+}
+
+template<X86_VEXT vext>
+static void simdCheckRdCosts( const DQIntern::StateMem& prevStates, const DQIntern::StateMem& skipStates, const DQIntern::PQData* pqData,
+                              const DQIntern::ScanPosType spt, const int64_t* startCost, DQIntern::Decision* decisions )
+{
+  static_assert( sizeof( DQIntern::Decision ) == 16, "A decision must fit into 128 bit" );
+
+  // the states 0 and 1 test the levels of pqData[0] (A) and pqData[2] (B), the states 2 and 3 the ones of pqData[3] (A) and pqData[1] (B)
+  const int       levelA0    = pqData[0].absLevel, levelA2 = pqData[3].absLevel;
+  const int       levelB0    = pqData[2].absLevel, levelB2 = pqData[1].absLevel;
+  const __m128i   levelA     = _mm_setr_epi32( levelA0, levelA0, levelA2, levelA2 );
+  const __m128i   levelB     = _mm_setr_epi32( levelB0, levelB0, levelB2, levelB2 );
+  const __m128i   remRegBins = _mm_loadu_si128( ( const __m128i* ) prevStates.remRegBins );
+  const __m128i   regular    = _mm_cmpgt_epi32( remRegBins, _mm_set1_epi32( 3 ) );
+  const __m128i   goRicePar  = _mm_cvtepi8_epi32( _mm_cvtsi32_si128( *( const int32_t* ) prevStates.goRicePar ) );
+  const __m128i   sig0       = _mm_loadu_si128( ( const __m128i* ) prevStates.sigBits[0] );
+  const __m128i   sig1       = _mm_loadu_si128( ( const __m128i* ) prevStates.sigBits[1] );
+
+  const __m128i   goRiceShuffle = _mm_add_epi8( _mm_slli_epi32( _mm_shuffle_epi8( goRicePar, _mm_setr_epi8( 0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12 ) ), 2 ),
+                                                _mm_setr_epi8( 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 ) );
+
+  __m128i bitsA  = regularBits4( prevStates, levelA0, levelA2, goRiceShuffle );
+  __m128i bitsB  = regularBits4( prevStates, levelB0, levelB2, goRiceShuffle );
+  __m128i bitsZ  = sig0;
+  __m128i validZ = _mm_set1_epi32( -1 );
+  if( spt == DQIntern::SCAN_SOCSBB )
+  {
+    const __m128i sbb1 = _mm_loadu_si128( ( const __m128i* ) prevStates.sbbBits[1] );
+    bitsA = _mm_add_epi32( bitsA, _mm_add_epi32( sbb1, sig1 ) );
+    bitsB = _mm_add_epi32( bitsB, _mm_add_epi32( sbb1, sig1 ) );
+    bitsZ = _mm_add_epi32( bitsZ, sbb1 );
+  }
+  else
+  {
+    __m128i sig = _mm_set1_epi32( -1 );
+    if( spt != DQIntern::SCAN_ISCSBB )
+    {
+      // without a significant coefficient in the sub-block, the last one is inferred and a zero level is no option
+      const __m128i numSigSbb = _mm_cvtepi8_epi32( _mm_cvtsi32_si128( *( const int32_t* ) prevStates.numSigSbb ) );
+      sig    = _mm_xor_si128( _mm_cmpeq_epi32( numSigSbb, _mm_setzero_si128() ), sig );
+      validZ = _mm_or_si128( sig, _mm_xor_si128( regular, validZ ) );
+    }
+    bitsA = _mm_add_epi32( bitsA, _mm_and_si128( sig, sig1 ) );
+    bitsB = _mm_add_epi32( bitsB, _mm_and_si128( sig, sig1 ) );
+  }
+  if( !_mm_test_all_ones( regular ) )
+  {
+    const __m128i goRiceZero = _mm_cvtepi8_epi32( _mm_cvtsi32_si128( *( const int32_t* ) prevStates.goRiceZero ) );
+    bitsA = _mm_blendv_epi8( bypassBits4<vext>( levelA, goRicePar, goRiceZero ), bitsA, regular );
+    bitsB = _mm_blendv_epi8( bypassBits4<vext>( levelB, goRicePar, goRiceZero ), bitsB, regular );
+    bitsZ = _mm_blendv_epi8( goRiceBits4<vext>( goRicePar, goRiceZero ), bitsZ, regular );
+  }
+
+  const __m128i rdCost01  = _mm_loadu_si128( ( const __m128i* ) prevStates.rdCost );
+  const __m128i rdCost23  = _mm_loadu_si128( ( const __m128i* ) ( prevStates.rdCost + 2 ) );
+  const __m128i costA01   = rdCost2( rdCost01, pqData[0].deltaDist, bitsA, false );
+  const __m128i costA23   = rdCost2( rdCost23, pqData[3].deltaDist, bitsA, true );
+  const __m128i costB01   = rdCost2( rdCost01, pqData[2].deltaDist, bitsB, false );
+  const __m128i costB23   = rdCost2( rdCost23, pqData[1].deltaDist, bitsB, true );
+  const __m128i noCost    = _mm_set1_epi64x( std::numeric_limits<int64_t>::max() >> 1 );
+  const __m128i validZ01  = _mm_cvtepi32_epi64( validZ );
+  const __m128i validZ23  = _mm_cvtepi32_epi64( _mm_unpackhi_epi64( validZ, validZ ) );
+  const __m128i costZ01   = _mm_blendv_epi8( noCost, rdCost2( rdCost01, 0, bitsZ, false ), validZ01 );
+  const __m128i costZ23   = _mm_blendv_epi8( noCost, rdCost2( rdCost23, 0, bitsZ, true  ), validZ23 );
+
+  // decisions 0 and 1 in the lanes of cost01 and info01, decisions 2 and 3 in the ones of cost23 and info23
+  const __m128i dec0   = _mm_loadu_si128( ( const __m128i* ) decisions );
+  const __m128i dec1   = _mm_loadu_si128( ( const __m128i* ) ( decisions + 1 ) );
+  const __m128i dec2   = _mm_loadu_si128( ( const __m128i* ) ( decisions + 2 ) );
+  const __m128i dec3   = _mm_loadu_si128( ( const __m128i* ) ( decisions + 3 ) );
+  __m128i       cost01 = _mm_unpacklo_epi64( dec0, dec1 );
+  __m128i       info01 = _mm_unpackhi_epi64( dec0, dec1 );
+  __m128i       cost23 = _mm_unpacklo_epi64( dec2, dec3 );
+  __m128i       info23 = _mm_unpackhi_epi64( dec2, dec3 );
+
+  // candidates in the order the scalar version tests them, so that the first of two equal costs is kept
+  selectDecisions2( cost01, info01, _mm_unpacklo_epi64( costA01, costA23 ), decisionInfo2( levelA0, 0, levelA2, 2 ) );
+  selectDecisions2( cost23, info23, _mm_unpacklo_epi64( costB01, costB23 ), decisionInfo2( levelB0, 0, levelB2, 2 ) );
+  selectDecisions2( cost01, info01, _mm_unpacklo_epi64( costZ01, costZ23 ), decisionInfo2( 0,       0, 0,       2 ) );
+  selectDecisions2( cost23, info23, _mm_unpackhi_epi64( costA01, costA23 ), decisionInfo2( levelA0, 1, levelA2, 3 ) );
+  selectDecisions2( cost01, info01, _mm_unpackhi_epi64( costB01, costB23 ), decisionInfo2( levelB0, 1, levelB2, 3 ) );
+  selectDecisions2( cost23, info23, _mm_unpackhi_epi64( costZ01, costZ23 ), decisionInfo2( 0,       1, 0,       3 ) );
+  if( spt == DQIntern::SCAN_EOCSBB )
+  {
+    const __m128i sbb0 = _mm_loadu_si128( ( const __m128i* ) skipStates.sbbBits[0] );
+    selectDecisions2( cost01, info01, rdCost2( _mm_loadu_si128( ( const __m128i* ) skipStates.rdCost ),       0, sbb0, false ), decisionInfo2( 0, 4, 0, 5 ) );
+    selectDecisions2( cost23, info23, rdCost2( _mm_loadu_si128( ( const __m128i* ) ( skipStates.rdCost + 2 ) ), 0, sbb0, true  ), decisionInfo2( 0, 6, 0, 7 ) );
+  }
+  selectDecisions2( cost01, info01, _mm_unpacklo_epi64( _mm_cvtsi64_si128( startCost[0] ), noCost ), decisionInfo2( levelA0, -1, 0, -2 ) );
+  selectDecisions2( cost23, info23, _mm_unpacklo_epi64( _mm_cvtsi64_si128( startCost[1] ), noCost ), decisionInfo2( levelB0, -1, 0, -2 ) );
+
+  _mm_storeu_si128( ( __m128i* ) decisions,         _mm_unpacklo_epi64( cost01, info01 ) );
+  _mm_storeu_si128( ( __m128i* ) ( decisions + 1 ), _mm_unpackhi_epi64( cost01, info01 ) );
+  _mm_storeu_si128( ( __m128i* ) ( decisions + 2 ), _mm_unpacklo_epi64( cost23, info23 ) );
+  _mm_storeu_si128( ( __m128i* ) ( decisions + 3 ), _mm_unpackhi_epi64( cost23, info23 ) );
+}
+
+// rate tables of the four states, rows k of the tables in the lanes of rows[k]
+template<typename T>
+static inline void transposeFracBits( const T* tab0, const T* tab1, const T* tab2, const T* tab3, __m128i* rows, const bool fourRows )
+{
+  const __m128i lo0 = _mm_unpacklo_epi32( _mm_loadl_epi64( ( const __m128i* ) tab0 ), _mm_loadl_epi64( ( const __m128i* ) tab1 ) );
+  const __m128i lo1 = _mm_unpacklo_epi32( _mm_loadl_epi64( ( const __m128i* ) tab2 ), _mm_loadl_epi64( ( const __m128i* ) tab3 ) );
+  rows[0] = _mm_unpacklo_epi64( lo0, lo1 );
+  rows[1] = _mm_unpackhi_epi64( lo0, lo1 );
+  if( fourRows )
+  {
+    const __m128i hi0 = _mm_unpacklo_epi32( _mm_loadl_epi64( ( const __m128i* ) ( tab0 + 2 ) ), _mm_loadl_epi64( ( const __m128i* ) ( tab1 + 2 ) ) );
+    const __m128i hi1 = _mm_unpacklo_epi32( _mm_loadl_epi64( ( const __m128i* ) ( tab2 + 2 ) ), _mm_loadl_epi64( ( const __m128i* ) ( tab3 + 2 ) ) );
+    rows[2] = _mm_unpacklo_epi64( hi0, hi1 );
+    rows[3] = _mm_unpackhi_epi64( hi0, hi1 );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdUpdateStates( const DQIntern::ScanInfo& scanInfo, const DQIntern::StateRateTabs& rateTabs, const DQIntern::StateMem& prevStates,
+                              DQIntern::StateMem& currStates, const DQIntern::Decision* decisions )
+{
+  const __m128i dec0     = _mm_loadu_si128( ( const __m128i* ) decisions );
+  const __m128i dec1     = _mm_loadu_si128( ( const __m128i* ) ( decisions + 1 ) );
+  const __m128i dec2     = _mm_loadu_si128( ( const __m128i* ) ( decisions + 2 ) );
+  const __m128i dec3     = _mm_loadu_si128( ( const __m128i* ) ( decisions + 3 ) );
+  _mm_storeu_si128( ( __m128i* ) currStates.rdCost,         _mm_unpacklo_epi64( dec0, dec1 ) );
+  _mm_storeu_si128( ( __m128i* ) ( currStates.rdCost + 2 ), _mm_unpacklo_epi64( dec2, dec3 ) );
+
+  const __m128  info01   = _mm_castsi128_ps( _mm_unpackhi_epi64( dec0, dec1 ) );
+  const __m128  info23   = _mm_castsi128_ps( _mm_unpackhi_epi64( dec2, dec3 ) );
+  const __m128i level    = _mm_castps_si128( _mm_shuffle_ps( info01, info23, 0x88 ) );
+  const __m128i prevId   = _mm_castps_si128( _mm_shuffle_ps( info01, info23, 0xdd ) );
+  const __m128i valid    = _mm_cmpgt_epi32( prevId, _mm_set1_epi32( -2 ) );
+  if( _mm_testz_si128( valid, valid ) )
+  {
+    return;
+  }
+  const __m128i fromPrev = _mm_cmpgt_epi32( prevId, _mm_set1_epi32( -1 ) );
+
+  // shuffles selecting for each state the lane of its previous state, in arrays of 8 and of 32 bit elements
+  const __m128i laneBytes = _mm_setr_epi8( 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12 );
+  const __m128i prevLane  = _mm_max_epi32( prevId, _mm_setzero_si128() );
+  const __m128i shuffle8  = _mm_add_epi8( _mm_shuffle_epi8( prevLane, laneBytes ), _mm_setr_epi8( 0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12 ) );
+  const __m128i shuffle32 = _mm_add_epi8( _mm_slli_epi32( _mm_shuffle_epi8( prevLane, _mm_setr_epi8( 0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12 ) ), 2 ),
+                                          _mm_setr_epi8( 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 ) );
+  const __m128i valid8    = _mm_shuffle_epi8( valid,    laneBytes );
+  const __m128i fromPrev8 = _mm_shuffle_epi8( fromPrev, laneBytes );
+
+  // number of remaining context coded bins
+  const __m128i three     = _mm_set1_epi32( 3 );
+  const __m128i ctxBins   = _mm_blendv_epi8( three, level, _mm_cmpgt_epi32( _mm_set1_epi32( 2 ), level ) );
+  const __m128i prvRem    = _mm_sub_epi32( _mm_shuffle_epi8( _mm_loadu_si128( ( const __m128i* ) prevStates.remRegBins ), shuffle32 ), _mm_set1_epi32( 1 ) );
+  const __m128i remFrom   = _mm_sub_epi32( prvRem, _mm_and_si128( _mm_cmpgt_epi32( prvRem, three ), ctxBins ) );
+  const __m128i remStart  = _mm_sub_epi32( _mm_set1_epi32( rateTabs.initRemRegBins ), ctxBins );
+  const __m128i remRegBins= _mm_blendv_epi8( _mm_loadu_si128( ( const __m128i* ) currStates.remRegBins ), _mm_blendv_epi8( remStart, remFrom, fromPrev ), valid );
+  _mm_storeu_si128( ( __m128i* ) currStates.remRegBins, remRegBins );
+
+  for( int k = 0; k < 2; k++ )
+  {
+    const __m128i sbbBits = _mm_shuffle_epi8( _mm_loadu_si128( ( const __m128i* ) prevStates.sbbBits[k] ), shuffle32 );
+    _mm_storeu_si128( ( __m128i* ) currStates.sbbBits[k], _mm_blendv_epi8( _mm_loadu_si128( ( const __m128i* ) currStates.sbbBits[k] ), sbbBits, fromPrev ) );
+  }
+
+  // numSigSbb and refSbbCtxId, the rice parameters are set below
+  const __m128i sigLevel  = _mm_shuffle_epi8( _mm_andnot_si128( _mm_cmpeq_epi32( level, _mm_setzero_si128() ), _mm_set1_epi32( 1 ) ),
+                                              _mm_setr_epi8( 0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 ) );
+  const __m128i prvCtx    = _mm_add_epi8( _mm_shuffle_epi8( _mm_loadu_si128( ( const __m128i* ) prevStates.numSigSbb ), shuffle8 ), sigLevel );
+  const __m128i startCtx  = _mm_setr_epi8( 1, 1, 1, 1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0 );
+  const __m128i ctxMask   = _mm_and_si128( valid8, _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0 ) );
+  _mm_storeu_si128( ( __m128i* ) currStates.numSigSbb, _mm_blendv_epi8( _mm_loadu_si128( ( const __m128i* ) currStates.numSigSbb ), _mm_blendv_epi8( startCtx, prvCtx, fromPrev8 ), ctxMask ) );
+
+  // levels of the sub-block, with the one of the current scan position
+  const __m128i level8    = _mm_shuffle_epi8( _mm_packus_epi16( _mm_packus_epi32( level, level ), _mm_setzero_si128() ), _mm_setr_epi8( 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 ) );
+  const __m128i levelMask = _mm_and_si128( valid8, _mm_cmpeq_epi8( _mm_set1_epi8( scanInfo.insidePos & 3 ), _mm_setr_epi8( 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3 ) ) );
+  for( int k = 0; k < 4; k++ )
+  {
+    __m128i absLevels = _mm_and_si128( _mm_shuffle_epi8( _mm_loadu_si128( ( const __m128i* ) prevStates.absLevels[4 * k] ), shuffle8 ), fromPrev8 );
+    absLevels = _mm_blendv_epi8( _mm_loadu_si128( ( const __m128i* ) currStates.absLevels[4 * k] ), absLevels, valid8 );
+    if( k == ( scanInfo.insidePos >> 2 ) )
+    {
+      absLevels = _mm_blendv_epi8( absLevels, level8, levelMask );
+    }
+    _mm_storeu_si128( ( __m128i* ) currStates.absLevels[4 * k], absLevels );
+  }
+
+  for( int stateId = 0; stateId < 4; stateId++ )
+  {
+    const int prvId = decisions[stateId].prevId;
+    if( prvId > -2 )
+    {
+      currStates.ctxInit[stateId] = ( prvId >= 0 ? prevStates.ctxInit[prvId] : DQIntern::g_zeroCtxInit );
+    }
+  }
+
+  // sums of the template, initialized with the part outside the sub-block
+  const int     nextPos   = scanInfo.nextInsidePos;
+  const __m128i tinit     = _mm_setr_epi32( currStates.ctxInit[0][nextPos], currStates.ctxInit[1][nextPos], currStates.ctxInit[2][nextPos], currStates.ctxInit[3][nextPos] );
+  __m128i       sumAbs    = _mm_srli_epi32( tinit, 8 );
+  __m128i       sumAbs1   = _mm_and_si128( _mm_srli_epi32( tinit, 3 ), _mm_set1_epi32( 31 ) );
+  __m128i       sumNum    = _mm_and_si128( tinit, _mm_set1_epi32( 7 ) );
+  for( int k = 0; k < scanInfo.nextNbInfoSbb.num; k++ )
+  {
+    const __m128i t = _mm_cvtepu8_epi32( _mm_cvtsi32_si128( *( const int32_t* ) currStates.absLevels[scanInfo.nextNbInfoSbb.inPos[k]] ) );
+    sumAbs  = _mm_add_epi32( sumAbs, t );
+    sumAbs1 = _mm_add_epi32( sumAbs1, _mm_min_epi32( _mm_add_epi32( _mm_set1_epi32( 4 ), _mm_and_si128( t, _mm_set1_epi32( 1 ) ) ), t ) );
+    sumNum  = _mm_sub_epi32( sumNum, _mm_cmpgt_epi32( t, _mm_setzero_si128() ) );
+  }
+
+  const __m128i regular   = _mm_and_si128( valid, _mm_cmpgt_epi32( remRegBins, three ) );
+  if( !_mm_testz_si128( regular, regular ) )
+  {
+    const __m128i sigIdx  = _mm_add_epi32( _mm_set1_epi32( scanInfo.sigCtxOffsetNext ), _mm_min_epi32( _mm_srai_epi32( _mm_add_epi32( sumAbs1, _mm_set1_epi32( 1 ) ), 1 ), three ) );
+    const __m128i gtxIdx  = _mm_add_epi32( _mm_set1_epi32( scanInfo.gtxCtxOffsetNext ), _mm_min_epi32( _mm_sub_epi32( sumAbs1, sumNum ), _mm_set1_epi32( 4 ) ) );
+    const uint32_t* sig0  = rateTabs.sigFracBits[0][_mm_extract_epi32( sigIdx, 0 )].intBits;
+    const uint32_t* sig1  = rateTabs.sigFracBits[1][_mm_extract_epi32( sigIdx, 1 )].intBits;
+    const uint32_t* sig2  = rateTabs.sigFracBits[2][_mm_extract_epi32( sigIdx, 2 )].intBits;
+    const uint32_t* sig3  = rateTabs.sigFracBits[3][_mm_extract_epi32( sigIdx, 3 )].intBits;
+    const int32_t* gtx0   = rateTabs.gtxFracBits[_mm_extract_epi32( gtxIdx, 0 )].bits;
+    const int32_t* gtx1   = rateTabs.gtxFracBits[_mm_extract_epi32( gtxIdx, 1 )].bits;
+    const int32_t* gtx2   = rateTabs.gtxFracBits[_mm_extract_epi32( gtxIdx, 2 )].bits;
+    const int32_t* gtx3   = rateTabs.gtxFracBits[_mm_extract_epi32( gtxIdx, 3 )].bits;
+    __m128i        rows[4];
+    transposeFracBits( sig0, sig1, sig2, sig3, rows, false );
+    for( int k = 0; k < 2; k++ )
+    {
+      _mm_storeu_si128( ( __m128i* ) currStates.sigBits[k], _mm_blendv_epi8( _mm_loadu_si128( ( const __m128i* ) currStates.sigBits[k] ), rows[k], regular ) );
+    }
+    transposeFracBits( gtx0, gtx1, gtx2, gtx3, rows, true );
+    for( int k = 0; k < 4; k++ )
+    {
+      _mm_storeu_si128( ( __m128i* ) currStates.coeffBits[k], _mm_blendv_epi8( _mm_loadu_si128( ( const __m128i* ) currStates.coeffBits[k] ), rows[k], regular ) );
+    }
+    transposeFracBits( gtx0 + 4, gtx1 + 4, gtx2 + 4, gtx3 + 4, rows, false );
+    for( int k = 0; k < 2; k++ )
+    {
+      _mm_storeu_si128( ( __m128i* ) currStates.coeffBits[4 + k], _mm_blendv_epi8( _mm_loadu_si128( ( const __m128i* ) currStates.coeffBits[4 + k] ), rows[k], regular ) );
+    }
+  }
+
+  // rice parameters, the states without context coded bins left also set the position of the zero level
+  const __m128i maxIdx    = _mm_set1_epi32( 31 );
+  const __m128i riceIdx   = _mm_blendv_epi8( _mm_min_epi32( sumAbs, maxIdx ), _mm_max_epi32( _mm_min_epi32( _mm_sub_epi32( sumAbs, _mm_set1_epi32( 4 * 5 ) ), maxIdx ), _mm_setzero_si128() ), regular );
+  const int     validMask = _mm_movemask_ps( _mm_castsi128_ps( valid ) );
+  const int     regMask   = _mm_movemask_ps( _mm_castsi128_ps( regular ) );
+  int32_t       idx[4];
+  _mm_storeu_si128( ( __m128i* ) idx, riceIdx );
+  for( int stateId = 0; stateId < 4; stateId++ )
+  {
+    if( validMask & ( 1 << stateId ) )
+    {
+      currStates.goRicePar[stateId] = g_auiGoRiceParsCoeff[idx[stateId]];
+      if( !( regMask & ( 1 << stateId ) ) )
+      {
+        currStates.goRiceZero[stateId] = rateTabs.goRiceZero[stateId][idx[stateId]];
+      }
+    }
+  }
+}
+
+template <X86_VEXT vext>
+void DepQuant::_initDepQuantX86()
+{
+  m_checkRdCosts = simdCheckRdCosts<vext>;
+  m_updateStates = simdUpdateStates<vext>;
+}
+
+template void DepQuant::_initDepQuantX86<SIMDX86>();
+
+//! \}
+
+#endif   // TARGET_SIMD_X86
@@ -44,13 +44,8 @@
 #include "../Rom.h"
 #include "../InterpolationFilter.h"
 #include "../../CommonLib/InterPrediction.h"
-#include "../../CommonLib/ApproximatAdderSubtraction.h"
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
+#include "ApproximatAdderSubtractionX86.h"
+#include "CommonLib/Profiler.h"
 
 //#include "../ChromaFormat.h"
 
@@ -989,7 +984,7 @@ static void simdInterpolateN2_M4(const int16_t *src, int srcStride, int16_t *dst
 static inline __m256i simdInterpolateLuma10Bit2P16(int16_t const *src1, int srcStride, __m256i *mmCoeff,
                                                    const __m256i &mmOffset, __m128i &mmShift)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "simdInterpolateLuma10Bit2P16" );
 
   __m256i sumLo;
   {
@@ -1001,10 +996,6 @@ static inline __m256i simdInterpolateLuma10Bit2P16(int16_t const *src1, int srcS
   }
   sumLo = _mm256_sra_epi16(_mm256_add_epi16(sumLo, mmOffset), mmShift);
 
-  auto stop                          = high_resolution_clock::now();
-  auto duration                      = duration_cast<nanoseconds>(stop - start);
-  timeOfSimdInterpolateLuma10Bit2P16 = timeOfSimdInterpolateLuma10Bit2P16 + duration.count();
-
   return (sumLo);
 }
 #endif
@@ -1012,7 +1003,7 @@ static inline __m256i simdInterpolateLuma10Bit2P16(int16_t const *src1, int srcS
 static inline __m128i simdInterpolateLuma10Bit2P8(int16_t const *src1, int srcStride, __m128i *mmCoeff,
                                                   const __m128i &mmOffset, __m128i &mmShift)
 {
-  auto    start = high_resolution_clock::now();
+  PROFILE_ZONE( "simdInterpolateLuma10Bit2P8" );
   __m128i sumLo;
   {
     __m128i mmPix  = _mm_loadu_si128((__m128i *) src1);
@@ -1022,16 +1013,13 @@ static inline __m128i simdInterpolateLuma10Bit2P8(int16_t const *src1, int srcSt
     sumLo          = _mm_add_epi16(lo0, lo1);
   }
   sumLo                             = _mm_sra_epi16(_mm_add_epi16(sumLo, mmOffset), mmShift);
-  auto stop                         = high_resolution_clock::now();
-  auto duration                     = duration_cast<nanoseconds>(stop - start);
-  timeOfSimdInterpolateLuma10Bit2P8 = timeOfSimdInterpolateLuma10Bit2P8 + duration.count();
   return (sumLo);
 }
 
 static inline __m128i simdInterpolateLuma10Bit2P4(int16_t const *src, int srcStride, __m128i *mmCoeff,
                                                   const __m128i &mmOffset, __m128i &mmShift)
 {
-  auto    start = high_resolution_clock::now();
+  PROFILE_ZONE( "simdInterpolateLuma10Bit2P4" );
   __m128i sumLo;
   {
     __m128i mmPix  = _mm_loadl_epi64((__m128i *) src);
@@ -1042,10 +1030,6 @@ static inline __m128i simdInterpolateLuma10Bit2P4(int16_t const *src, int srcStr
   }
   sumLo = _mm_sra_epi16(_mm_add_epi16(sumLo, mmOffset), mmShift);
 
-  auto stop                         = high_resolution_clock::now();
-  auto duration                     = duration_cast<nanoseconds>(stop - start);
-  timeOfSimdInterpolateLuma10Bit2P4 = timeOfSimdInterpolateLuma10Bit2P4 + duration.count();
-
   return sumLo;
 }
 
@@ -1054,7 +1038,7 @@ static void simdInterpolateN2_10BIT_M4(const int16_t *src, int srcStride, int16_
                                        int width, int height, int shift, int offset, const ClpRng &clpRng,
                                        int16_t const *c)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "simdInterpolateN2_10BIT_M4" );
 
   int     row, col;
   __m128i mmOffset = _mm_set1_epi16(offset);
@@ -1096,16 +1080,13 @@ static void simdInterpolateN2_10BIT_M4(const int16_t *src, int srcStride, int16_
     src += srcStride;
     dst += dstStride;
   }
-  auto stop                        = high_resolution_clock::now();
-  auto duration                    = duration_cast<nanoseconds>(stop - start);
-  timeOfSimdInterpolateN2_10BIT_M4 = timeOfSimdInterpolateN2_10BIT_M4 + duration.count();
 }
 
 template<X86_VEXT vext, int N, bool isVertical, bool isFirst, bool isLast>
 static void simdFilter(const ClpRng &clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width,
                        int height, TFilterCoeff const *coeff, bool biMCForDMVR)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "simdFilter" );
   int  row, col;
 
   Pel c[8];
@@ -1187,9 +1168,6 @@ static void simdFilter(const ClpRng &clpRng, Pel const *src, int srcStride, Pel
           simdInterpolateVerM8<vext, 8, isLast>(src, srcStride, dst, dstStride, width, height, shift, offset, clpRng,
                                                 c);
       }
-      auto stop        = high_resolution_clock::now();
-      auto duration    = duration_cast<nanoseconds>(stop - start);
-      timeOfSimdFilter = timeOfSimdFilter + duration.count();
 
       return;
     }
@@ -1201,9 +1179,6 @@ static void simdFilter(const ClpRng &clpRng, Pel const *src, int srcStride, Pel
       }
       else
         simdInterpolateVerM4<vext, 8, isLast>(src, srcStride, dst, dstStride, width, height, shift, offset, clpRng, c);
-      auto stop        = high_resolution_clock::now();
-      auto duration    = duration_cast<nanoseconds>(stop - start);
-      timeOfSimdFilter = timeOfSimdFilter + duration.count();
       return;
     }
     else if (N == 4 && !(width & 0x03))
@@ -1225,9 +1200,6 @@ static void simdFilter(const ClpRng &clpRng, Pel const *src, int srcStride, Pel
       }
       else
         simdInterpolateVerM4<vext, 4, isLast>(src, srcStride, dst, dstStride, width, height, shift, offset, clpRng, c);
-      auto stop        = high_resolution_clock::now();
-      auto duration    = duration_cast<nanoseconds>(stop - start);
-      timeOfSimdFilter = timeOfSimdFilter + duration.count();
       return;
     }
     else if (biMCForDMVR)
@@ -1236,9 +1208,6 @@ static void simdFilter(const ClpRng &clpRng, Pel const *src, int srcStride, Pel
       {
         simdInterpolateN2_10BIT_M4<vext, isLast>(src, srcStride, dst, dstStride, cStride, width, height, shift, offset,
                                                  clpRng, c);
-        auto stop        = high_resolution_clock::now();
-        auto duration    = duration_cast<nanoseconds>(stop - start);
-        timeOfSimdFilter = timeOfSimdFilter + duration.count();
         return;
       }
     }
@@ -1246,18 +1215,12 @@ static void simdFilter(const ClpRng &clpRng, Pel const *src, int srcStride, Pel
     {
       simdInterpolateN2_M8<vext, isLast>(src, srcStride, dst, dstStride, cStride, width, height, shift, offset, clpRng,
                                          c);
-      auto stop        = high_resolution_clock::now();
-      auto duration    = duration_cast<nanoseconds>(stop - start);
-      timeOfSimdFilter = timeOfSimdFilter + duration.count();
       return;
     }
     else if (N == 2 && !(width & 0x03))
     {
       simdInterpolateN2_M4<vext, isLast>(src, srcStride, dst, dstStride, cStride, width, height, shift, offset, clpRng,
                                          c);
-      auto stop        = high_resolution_clock::now();
-      auto duration    = duration_cast<nanoseconds>(stop - start);
-      timeOfSimdFilter = timeOfSimdFilter + duration.count();
       return;
     }
   }
@@ -1305,9 +1268,6 @@ static void simdFilter(const ClpRng &clpRng, Pel const *src, int srcStride, Pel
     src += srcStride;
     dst += dstStride;
   }
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfSimdFilter = timeOfSimdFilter + duration.count();
 }
 
 template<X86_VEXT vext>
@@ -1315,7 +1275,7 @@ void xWeightedTriangleBlk_SSE(const PredictionUnit &pu, const uint32_t width, co
                               const ComponentID compIdx, const bool splitDir, PelUnitBuf &predDst, PelUnitBuf &predSrc0,
                               PelUnitBuf &predSrc1)
 {
-  auto    start      = high_resolution_clock::now();
+  PROFILE_ZONE( "xWeightedTriangleBlk_SSE" );
   Pel *   dst        = predDst.get(compIdx).buf;
   Pel *   src0       = predSrc0.get(compIdx).buf;
   Pel *   src1       = predSrc1.get(compIdx).buf;
@@ -1420,9 +1380,149 @@ void xWeightedTriangleBlk_SSE(const PredictionUnit &pu, const uint32_t width, co
       weight += width;
     }
   }
-  auto stop                      = high_resolution_clock::now();
-  auto duration                  = duration_cast<nanoseconds>(stop - start);
-  timeOfXWeightedTriangleBlk_SSE = timeOfXWeightedTriangleBlk_SSE + duration.count();
+}
+
+template<typename OPS, int N, bool isVertical, bool isLast, int adder>
+static void simdInterpolateApprox(const ClpRng &clpRng, Pel const *src, int srcStride, int cStride, Pel *dst, int dstStride,
+                                  int width, int height, int shift, int offset, Pel const *c)
+{
+  typedef typename OPS::T T;
+
+  const ApproxLoaConsts<OPS> loa( g_approxAdderParam );
+  const int     numberBits       = g_approxAdderParam.numberBits;
+  const int     approximateCount = g_approxAdderParam.approximateCount;
+  const int     widthSimd        = width - width % OPS::lanes;
+  const T       vOffset          = OPS::Set( offset );
+  const T       vMin             = OPS::Set( clpRng.min );
+  const T       vMax             = OPS::Set( clpRng.max );
+  const __m128i vShift           = _mm_cvtsi32_si128( shift );
+
+  T vCoeff[N];
+  for( int k = 0; k < N; k++ )
+  {
+    vCoeff[k] = OPS::Set( c[k] );
+  }
+
+  for( int row = 0; row < height; row++ )
+  {
+    int col = 0;
+    for( ; col < widthSimd; col += OPS::lanes )
+    {
+      T sum = OPS::Mul( OPS::LoadPel( src + col ), vCoeff[0] );
+      for( int k = 1; k < N; k++ )
+      {
+        sum = approximateSumVec<OPS, adder>( OPS::Mul( OPS::LoadPel( src + col + k * cStride ), vCoeff[k] ), sum, loa );
+      }
+
+      T val = OPS::Trunc16( OPS::Sra( approximateSumVec<OPS, adder>( sum, vOffset, loa ), vShift ) );
+      if( isLast )
+      {
+        val = OPS::Min( vMax, OPS::Max( vMin, val ) );
+      }
+      OPS::StorePel( dst + col, val );
+    }
+
+    for( ; col < width; col++ )
+    {
+      int sum = src[col] * c[0];
+      for( int k = 1; k < N; k++ )
+      {
+        sum = approximateSum<adder>( src[col + k * cStride] * c[k], sum, numberBits, approximateCount );
+      }
+
+      Pel val = approximateSum<adder>( sum, offset, numberBits, approximateCount ) >> shift;
+      if( isLast )
+      {
+        val = ClipPel( val, clpRng );
+      }
+      dst[col] = val;
+    }
+
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+template<X86_VEXT vext, int N, bool isVertical, bool isFirst, bool isLast, int adder>
+static void simdFilterApprox(const ClpRng &clpRng, Pel const *src, int srcStride, Pel *dst, int dstStride, int width,
+                             int height, TFilterCoeff const *coeff, bool biMCForDMVR)
+{
+  Pel c[8];
+  for (int k = 0; k < N; k++)
+  {
+    c[k] = coeff[k];
+  }
+
+  int cStride = (isVertical) ? srcStride : 1;
+  src -= (N / 2 - 1) * cStride;
+
+  int offset;
+  int headRoom = std::max<int>(2, (IF_INTERNAL_PREC - clpRng.bd));
+  int shift    = IF_FILTER_PREC;
+
+  if (isLast)
+  {
+    shift += (isFirst) ? 0 : headRoom;
+    offset = 1 << (shift - 1);
+    offset += (isFirst) ? 0 : IF_INTERNAL_OFFS << IF_FILTER_PREC;
+  }
+  else
+  {
+    shift -= (isFirst) ? headRoom : 0;
+    offset = (isFirst) ? -IF_INTERNAL_OFFS << shift : 0;
+  }
+
+  if (biMCForDMVR)
+  {
+    shift  = isFirst ? IF_FILTER_PREC_BILINEAR - (IF_INTERNAL_PREC_BILINEAR - clpRng.bd) : 4;
+    offset = 1 << (shift - 1);
+  }
+
+#ifdef USE_AVX2
+  if (vext >= AVX2)
+  {
+    simdInterpolateApprox<ApproxAVX2Ops, N, isVertical, isLast, adder>(clpRng, src, srcStride, cStride, dst, dstStride,
+                                                                        width, height, shift, offset, c);
+    return;
+  }
+#endif
+  simdInterpolateApprox<ApproxSSEOps, N, isVertical, isLast, adder>(clpRng, src, srcStride, cStride, dst, dstStride, width,
+                                                                     height, shift, offset, c);
+}
+
+template<X86_VEXT vext, int adder>
+static void initFilterApproxX86(InterpolationFilter &ifilter)
+{
+  // [taps][bFirst][bLast]
+  ifilter.m_filterHorApprox[adder][0][0][0] = simdFilterApprox<vext, 8, false, false, false, adder>;
+  ifilter.m_filterHorApprox[adder][0][0][1] = simdFilterApprox<vext, 8, false, false, true, adder>;
+  ifilter.m_filterHorApprox[adder][0][1][0] = simdFilterApprox<vext, 8, false, true, false, adder>;
+  ifilter.m_filterHorApprox[adder][0][1][1] = simdFilterApprox<vext, 8, false, true, true, adder>;
+
+  ifilter.m_filterHorApprox[adder][1][0][0] = simdFilterApprox<vext, 4, false, false, false, adder>;
+  ifilter.m_filterHorApprox[adder][1][0][1] = simdFilterApprox<vext, 4, false, false, true, adder>;
+  ifilter.m_filterHorApprox[adder][1][1][0] = simdFilterApprox<vext, 4, false, true, false, adder>;
+  ifilter.m_filterHorApprox[adder][1][1][1] = simdFilterApprox<vext, 4, false, true, true, adder>;
+
+  ifilter.m_filterHorApprox[adder][2][0][0] = simdFilterApprox<vext, 2, false, false, false, adder>;
+  ifilter.m_filterHorApprox[adder][2][0][1] = simdFilterApprox<vext, 2, false, false, true, adder>;
+  ifilter.m_filterHorApprox[adder][2][1][0] = simdFilterApprox<vext, 2, false, true, false, adder>;
+  ifilter.m_filterHorApprox[adder][2][1][1] = simdFilterApprox<vext, 2, false, true, true, adder>;
+
+  ifilter.m_filterVerApprox[adder][0][0][0] = simdFilterApprox<vext, 8, true, false, false, adder>;
+  ifilter.m_filterVerApprox[adder][0][0][1] = simdFilterApprox<vext, 8, true, false, true, adder>;
+  ifilter.m_filterVerApprox[adder][0][1][0] = simdFilterApprox<vext, 8, true, true, false, adder>;
+  ifilter.m_filterVerApprox[adder][0][1][1] = simdFilterApprox<vext, 8, true, true, true, adder>;
+
+  ifilter.m_filterVerApprox[adder][1][0][0] = simdFilterApprox<vext, 4, true, false, false, adder>;
+  ifilter.m_filterVerApprox[adder][1][0][1] = simdFilterApprox<vext, 4, true, false, true, adder>;
+  ifilter.m_filterVerApprox[adder][1][1][0] = simdFilterApprox<vext, 4, true, true, false, adder>;
+  ifilter.m_filterVerApprox[adder][1][1][1] = simdFilterApprox<vext, 4, true, true, true, adder>;
+
+  ifilter.m_filterVerApprox[adder][2][0][0] = simdFilterApprox<vext, 2, true, false, false, adder>;
+  ifilter.m_filterVerApprox[adder][2][0][1] = simdFilterApprox<vext, 2, true, false, true, adder>;
+  ifilter.m_filterVerApprox[adder][2][1][0] = simdFilterApprox<vext, 2, true, true, false, adder>;
+  ifilter.m_filterVerApprox[adder][2][1][1] = simdFilterApprox<vext, 2, true, true, true, adder>;
 }
 
 template<X86_VEXT vext> void InterpolationFilter::_initInterpolationFilterX86()
@@ -1464,6 +1564,19 @@ template<X86_VEXT vext> void InterpolationFilter::_initInterpolationFilterX86()
   m_filterCopy[1][1] = simdFilterCopy<vext, true, true>;
 
   m_weightedTriangleBlk = xWeightedTriangleBlk_SSE<vext>;
+
+  std::memcpy( m_filterHorApprox[APPROX_ADDER_EXACT], m_filterHor, sizeof( m_filterHor ) );
+  std::memcpy( m_filterVerApprox[APPROX_ADDER_EXACT], m_filterVer, sizeof( m_filterVer ) );
+  initFilterApproxX86<vext, APPROX_ADDER_LOA>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_TYPE1>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_TYPE2>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_TYPE3>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_TYPE4>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_TYPE5>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_M45_P35_A7>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_M45_P30_A6>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_M60_P25_A6>( *this );
+  initFilterApproxX86<vext, APPROX_ADDER_M95_P10_A5>( *this );
 }
 
 template void InterpolationFilter::_initInterpolationFilterX86<SIMDX86>();
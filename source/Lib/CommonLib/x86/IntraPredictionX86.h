@@ -0,0 +1,386 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     IntraPredictionX86.h
+    \brief    SIMD kernels of the angular, planar and PDPC intra prediction
+*/
+
+#include "CommonDefX86.h"
+#include "../IntraPrediction.h"
+
+#ifdef TARGET_SIMD_X86
+#if defined _MSC_VER
+#include <tmmintrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+//! \ingroup CommonLib
+//! \{
+
+// 4-tap interpolation of one angular row, dst[x] = clip( ( sum f[k] * ref[x+k] + 32 ) >> 6 )
+template<X86_VEXT vext>
+static void simdPredAngFilter4Row( Pel* dst, const Pel* ref, const int width, const TFilterCoeff* coeff, const ClpRng& clpRng )
+{
+  if( width & 3 )
+  {
+    IntraPrediction::predAngFilter4Row( dst, ref, width, coeff, clpRng );
+    return;
+  }
+
+  const int c01 = ( coeff[0] & 0xffff ) | ( coeff[1] << 16 );
+  const int c23 = ( coeff[2] & 0xffff ) | ( coeff[3] << 16 );
+
+  int x = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i vc01   = _mm256_set1_epi32( c01 );
+    const __m256i vc23   = _mm256_set1_epi32( c23 );
+    const __m256i vrnd   = _mm256_set1_epi32( 32 );
+    const __m256i vmin   = _mm256_set1_epi16( clpRng.min );
+    const __m256i vmax   = _mm256_set1_epi16( clpRng.max );
+
+    for( ; x + 16 <= width; x += 16 )
+    {
+      const __m256i p0 = _mm256_loadu_si256( ( const __m256i* ) ( ref + x ) );
+      const __m256i p1 = _mm256_loadu_si256( ( const __m256i* ) ( ref + x + 1 ) );
+      const __m256i p2 = _mm256_loadu_si256( ( const __m256i* ) ( ref + x + 2 ) );
+      const __m256i p3 = _mm256_loadu_si256( ( const __m256i* ) ( ref + x + 3 ) );
+
+      __m256i lo = _mm256_add_epi32( _mm256_madd_epi16( _mm256_unpacklo_epi16( p0, p1 ), vc01 ), _mm256_madd_epi16( _mm256_unpacklo_epi16( p2, p3 ), vc23 ) );
+      __m256i hi = _mm256_add_epi32( _mm256_madd_epi16( _mm256_unpackhi_epi16( p0, p1 ), vc01 ), _mm256_madd_epi16( _mm256_unpackhi_epi16( p2, p3 ), vc23 ) );
+      lo = _mm256_srai_epi32( _mm256_add_epi32( lo, vrnd ), 6 );
+      hi = _mm256_srai_epi32( _mm256_add_epi32( hi, vrnd ), 6 );
+
+      const __m256i val = _mm256_min_epi16( vmax, _mm256_max_epi16( vmin, _mm256_packs_epi32( lo, hi ) ) );
+      _mm256_storeu_si256( ( __m256i* ) ( dst + x ), val );
+    }
+  }
+#endif
+
+  const __m128i vc01 = _mm_set1_epi32( c01 );
+  const __m128i vc23 = _mm_set1_epi32( c23 );
+  const __m128i vrnd = _mm_set1_epi32( 32 );
+  const __m128i vmin = _mm_set1_epi16( clpRng.min );
+  const __m128i vmax = _mm_set1_epi16( clpRng.max );
+
+  for( ; x + 8 <= width; x += 8 )
+  {
+    const __m128i p0 = _mm_loadu_si128( ( const __m128i* ) ( ref + x ) );
+    const __m128i p1 = _mm_loadu_si128( ( const __m128i* ) ( ref + x + 1 ) );
+    const __m128i p2 = _mm_loadu_si128( ( const __m128i* ) ( ref + x + 2 ) );
+    const __m128i p3 = _mm_loadu_si128( ( const __m128i* ) ( ref + x + 3 ) );
+
+    __m128i lo = _mm_add_epi32( _mm_madd_epi16( _mm_unpacklo_epi16( p0, p1 ), vc01 ), _mm_madd_epi16( _mm_unpacklo_epi16( p2, p3 ), vc23 ) );
+    __m128i hi = _mm_add_epi32( _mm_madd_epi16( _mm_unpackhi_epi16( p0, p1 ), vc01 ), _mm_madd_epi16( _mm_unpackhi_epi16( p2, p3 ), vc23 ) );
+    lo = _mm_srai_epi32( _mm_add_epi32( lo, vrnd ), 6 );
+    hi = _mm_srai_epi32( _mm_add_epi32( hi, vrnd ), 6 );
+
+    const __m128i val = _mm_min_epi16( vmax, _mm_max_epi16( vmin, _mm_packs_epi32( lo, hi ) ) );
+    _mm_storeu_si128( ( __m128i* ) ( dst + x ), val );
+  }
+
+  if( x < width )
+  {
+    const __m128i p0 = _mm_loadl_epi64( ( const __m128i* ) ( ref + x ) );
+    const __m128i p1 = _mm_loadl_epi64( ( const __m128i* ) ( ref + x + 1 ) );
+    const __m128i p2 = _mm_loadl_epi64( ( const __m128i* ) ( ref + x + 2 ) );
+    const __m128i p3 = _mm_loadl_epi64( ( const __m128i* ) ( ref + x + 3 ) );
+
+    __m128i lo = _mm_add_epi32( _mm_madd_epi16( _mm_unpacklo_epi16( p0, p1 ), vc01 ), _mm_madd_epi16( _mm_unpacklo_epi16( p2, p3 ), vc23 ) );
+    lo = _mm_srai_epi32( _mm_add_epi32( lo, vrnd ), 6 );
+
+    const __m128i val = _mm_min_epi16( vmax, _mm_max_epi16( vmin, _mm_packs_epi32( lo, lo ) ) );
+    _mm_storel_epi64( ( __m128i* ) ( dst + x ), val );
+  }
+}
+
+// linear interpolation of one angular row, written as ( ( 32 - d ) * p0 + d * p1 + 16 ) >> 5
+template<X86_VEXT vext>
+static void simdPredAngLinearRow( Pel* dst, const Pel* ref, const int width, const int deltaFract )
+{
+  if( width & 3 )
+  {
+    IntraPrediction::predAngLinearRow( dst, ref, width, deltaFract );
+    return;
+  }
+
+  const int c01 = ( 32 - deltaFract ) | ( deltaFract << 16 );
+
+  int x = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i vc01 = _mm256_set1_epi32( c01 );
+    const __m256i vrnd = _mm256_set1_epi32( 16 );
+
+    for( ; x + 16 <= width; x += 16 )
+    {
+      const __m256i p0 = _mm256_loadu_si256( ( const __m256i* ) ( ref + x ) );
+      const __m256i p1 = _mm256_loadu_si256( ( const __m256i* ) ( ref + x + 1 ) );
+
+      __m256i lo = _mm256_madd_epi16( _mm256_unpacklo_epi16( p0, p1 ), vc01 );
+      __m256i hi = _mm256_madd_epi16( _mm256_unpackhi_epi16( p0, p1 ), vc01 );
+      lo = _mm256_srai_epi32( _mm256_add_epi32( lo, vrnd ), 5 );
+      hi = _mm256_srai_epi32( _mm256_add_epi32( hi, vrnd ), 5 );
+
+      _mm256_storeu_si256( ( __m256i* ) ( dst + x ), _mm256_packs_epi32( lo, hi ) );
+    }
+  }
+#endif
+
+  const __m128i vc01 = _mm_set1_epi32( c01 );
+  const __m128i vrnd = _mm_set1_epi32( 16 );
+
+  for( ; x + 8 <= width; x += 8 )
+  {
+    const __m128i p0 = _mm_loadu_si128( ( const __m128i* ) ( ref + x ) );
+    const __m128i p1 = _mm_loadu_si128( ( const __m128i* ) ( ref + x + 1 ) );
+
+    __m128i lo = _mm_madd_epi16( _mm_unpacklo_epi16( p0, p1 ), vc01 );
+    __m128i hi = _mm_madd_epi16( _mm_unpackhi_epi16( p0, p1 ), vc01 );
+    lo = _mm_srai_epi32( _mm_add_epi32( lo, vrnd ), 5 );
+    hi = _mm_srai_epi32( _mm_add_epi32( hi, vrnd ), 5 );
+
+    _mm_storeu_si128( ( __m128i* ) ( dst + x ), _mm_packs_epi32( lo, hi ) );
+  }
+
+  if( x < width )
+  {
+    const __m128i p0 = _mm_loadl_epi64( ( const __m128i* ) ( ref + x ) );
+    const __m128i p1 = _mm_loadl_epi64( ( const __m128i* ) ( ref + x + 1 ) );
+
+    __m128i lo = _mm_madd_epi16( _mm_unpacklo_epi16( p0, p1 ), vc01 );
+    lo = _mm_srai_epi32( _mm_add_epi32( lo, vrnd ), 5 );
+
+    _mm_storel_epi64( ( __m128i* ) ( dst + x ), _mm_packs_epi32( lo, lo ) );
+  }
+}
+
+// planar prediction in 32 bit lanes, the vertical part is accumulated row by row
+template<X86_VEXT vext>
+static void simdPredPlanar( const CPelBuf &pSrc, PelBuf &pDst )
+{
+  const int width  = pDst.width;
+  const int height = pDst.height;
+
+  if( width < 4 || ( width & 3 ) )
+  {
+    IntraPrediction::predPlanar( pSrc, pDst );
+    return;
+  }
+
+  const int log2W      = floorLog2( width );
+  const int log2H      = floorLog2( height < 2 ? 2 : height );
+  const int offset     = 1 << ( log2W + log2H );
+  const int finalShift = 1 + log2W + log2H;
+
+  const Pel* top  = pSrc.buf + 1;
+  const Pel* left = pSrc.buf + pSrc.stride + 1;
+
+  const int bottomLeft = left[height];
+  const int topRight   = top[width];
+
+  // vertical part of the current row and its per row increment, (top << log2H) + (y + 1) * (bottomLeft - top)
+  int vert[MAX_CU_SIZE], bottom[MAX_CU_SIZE];
+  for( int x = 0; x < width; x++ )
+  {
+    bottom[x] = bottomLeft - top[x];
+    vert[x]   = top[x] << log2H;
+  }
+
+  const __m128i vrnd = _mm_set1_epi32( offset );
+  const __m128i vidx = _mm_setr_epi32( 1, 2, 3, 4 );
+  const __m128i vsh  = _mm_cvtsi32_si128( finalShift );
+
+  Pel* pred = pDst.buf;
+  for( int y = 0; y < height; y++, pred += pDst.stride )
+  {
+    // horizontal part, ((left << log2W) + (x + 1) * (topRight - left)) << log2H
+    const int horBase = ( int ) left[y] << log2W;
+    const int horStep = topRight - left[y];
+
+    int x = 0;
+#ifdef USE_AVX2
+    if( vext >= AVX2 && !( width & 7 ) )
+    {
+      const __m256i vrnd8 = _mm256_set1_epi32( offset );
+      const __m128i vsh8  = _mm_cvtsi32_si128( finalShift );
+      __m256i vhor = _mm256_add_epi32( _mm256_set1_epi32( horBase ), _mm256_mullo_epi32( _mm256_setr_epi32( 1, 2, 3, 4, 5, 6, 7, 8 ), _mm256_set1_epi32( horStep ) ) );
+      const __m256i vhorStep = _mm256_set1_epi32( horStep << 3 );
+
+      for( ; x < width; x += 8 )
+      {
+        __m256i v = _mm256_add_epi32( _mm256_loadu_si256( ( const __m256i* ) ( vert + x ) ), _mm256_loadu_si256( ( const __m256i* ) ( bottom + x ) ) );
+        _mm256_storeu_si256( ( __m256i* ) ( vert + x ), v );
+
+        __m256i sum = _mm256_add_epi32( _mm256_slli_epi32( vhor, log2H ), _mm256_slli_epi32( v, log2W ) );
+        sum = _mm256_sra_epi32( _mm256_add_epi32( sum, vrnd8 ), vsh8 );
+        sum = _mm256_permute4x64_epi64( _mm256_packs_epi32( sum, sum ), 0x08 );
+        _mm_storeu_si128( ( __m128i* ) ( pred + x ), _mm256_castsi256_si128( sum ) );
+
+        vhor = _mm256_add_epi32( vhor, vhorStep );
+      }
+      continue;
+    }
+#endif
+
+    __m128i vhor = _mm_add_epi32( _mm_set1_epi32( horBase ), _mm_mullo_epi32( vidx, _mm_set1_epi32( horStep ) ) );
+    const __m128i vhorStep = _mm_set1_epi32( horStep << 2 );
+
+    for( ; x < width; x += 4 )
+    {
+      __m128i v = _mm_add_epi32( _mm_loadu_si128( ( const __m128i* ) ( vert + x ) ), _mm_loadu_si128( ( const __m128i* ) ( bottom + x ) ) );
+      _mm_storeu_si128( ( __m128i* ) ( vert + x ), v );
+
+      __m128i sum = _mm_add_epi32( _mm_slli_epi32( vhor, log2H ), _mm_slli_epi32( v, log2W ) );
+      sum = _mm_sra_epi32( _mm_add_epi32( sum, vrnd ), vsh );
+      _mm_storel_epi64( ( __m128i* ) ( pred + x ), _mm_packs_epi32( sum, sum ) );
+
+      vhor = _mm_add_epi32( vhor, vhorStep );
+    }
+  }
+}
+
+// position dependent combination of the planar and DC prediction with the top and left references
+template<X86_VEXT vext>
+static void simdPdpcPlanarDc( const CPelBuf &pSrc, PelBuf &pDst, const int scale )
+{
+  const int width  = pDst.width;
+  const int height = pDst.height;
+
+  if( width & 3 )
+  {
+    IntraPrediction::pdpcPlanarDc( pSrc, pDst, scale );
+    return;
+  }
+
+  const Pel* top  = pSrc.buf + 1;
+  const Pel* left = pSrc.buf + pSrc.stride + 1;
+
+  Pel wL[MAX_CU_SIZE];
+  for( int x = 0; x < width; x++ )
+  {
+    wL[x] = 32 >> std::min( 31, ( ( x << 1 ) >> scale ) );
+  }
+
+  const __m128i vrnd = _mm_set1_epi32( 32 );
+
+  Pel* dst = pDst.buf;
+  for( int y = 0; y < height; y++, dst += pDst.stride )
+  {
+    const __m128i vwT   = _mm_set1_epi16( 32 >> std::min( 31, ( ( y << 1 ) >> scale ) ) );
+    const __m128i vleft = _mm_set1_epi16( left[y] );
+
+    int x = 0;
+    for( ; x + 8 <= width; x += 8 )
+    {
+      const __m128i val = _mm_loadu_si128( ( const __m128i* ) ( dst + x ) );
+      const __m128i dL  = _mm_sub_epi16( vleft, val );
+      const __m128i dT  = _mm_sub_epi16( _mm_loadu_si128( ( const __m128i* ) ( top + x ) ), val );
+      const __m128i w   = _mm_loadu_si128( ( const __m128i* ) ( wL + x ) );
+
+      __m128i lo = _mm_madd_epi16( _mm_unpacklo_epi16( dL, dT ), _mm_unpacklo_epi16( w, vwT ) );
+      __m128i hi = _mm_madd_epi16( _mm_unpackhi_epi16( dL, dT ), _mm_unpackhi_epi16( w, vwT ) );
+      lo = _mm_srai_epi32( _mm_add_epi32( lo, vrnd ), 6 );
+      hi = _mm_srai_epi32( _mm_add_epi32( hi, vrnd ), 6 );
+
+      _mm_storeu_si128( ( __m128i* ) ( dst + x ), _mm_add_epi16( val, _mm_packs_epi32( lo, hi ) ) );
+    }
+
+    if( x < width )
+    {
+      const __m128i val = _mm_loadl_epi64( ( const __m128i* ) ( dst + x ) );
+      const __m128i dL  = _mm_sub_epi16( vleft, val );
+      const __m128i dT  = _mm_sub_epi16( _mm_loadl_epi64( ( const __m128i* ) ( top + x ) ), val );
+      const __m128i w   = _mm_loadl_epi64( ( const __m128i* ) ( wL + x ) );
+
+      __m128i lo = _mm_madd_epi16( _mm_unpacklo_epi16( dL, dT ), _mm_unpacklo_epi16( w, vwT ) );
+      lo = _mm_srai_epi32( _mm_add_epi32( lo, vrnd ), 6 );
+
+      _mm_storel_epi64( ( __m128i* ) ( dst + x ), _mm_add_epi16( val, _mm_packs_epi32( lo, lo ) ) );
+    }
+  }
+}
+
+// dst[x * dstStride + y] = src[y * srcStride + x] in 4x4 tiles of 16 bit samples
+template<X86_VEXT vext>
+static void simdTransposeBlock( const Pel* src, const int srcStride, Pel* dst, const int dstStride, const int width, const int height )
+{
+  if( ( width & 3 ) || ( height & 3 ) )
+  {
+    IntraPrediction::transposeBlock( src, srcStride, dst, dstStride, width, height );
+    return;
+  }
+
+  for( int y = 0; y < height; y += 4 )
+  {
+    for( int x = 0; x < width; x += 4 )
+    {
+      const Pel* s = src + y * srcStride + x;
+
+      const __m128i r0 = _mm_loadl_epi64( ( const __m128i* ) ( s ) );
+      const __m128i r1 = _mm_loadl_epi64( ( const __m128i* ) ( s + srcStride ) );
+      const __m128i r2 = _mm_loadl_epi64( ( const __m128i* ) ( s + 2 * srcStride ) );
+      const __m128i r3 = _mm_loadl_epi64( ( const __m128i* ) ( s + 3 * srcStride ) );
+
+      const __m128i t01 = _mm_unpacklo_epi16( r0, r1 );
+      const __m128i t23 = _mm_unpacklo_epi16( r2, r3 );
+      const __m128i c01 = _mm_unpacklo_epi32( t01, t23 );
+      const __m128i c23 = _mm_unpackhi_epi32( t01, t23 );
+
+      Pel* d = dst + x * dstStride + y;
+      _mm_storel_epi64( ( __m128i* ) ( d ), c01 );
+      _mm_storel_epi64( ( __m128i* ) ( d + dstStride ), _mm_unpackhi_epi64( c01, c01 ) );
+      _mm_storel_epi64( ( __m128i* ) ( d + 2 * dstStride ), c23 );
+      _mm_storel_epi64( ( __m128i* ) ( d + 3 * dstStride ), _mm_unpackhi_epi64( c23, c23 ) );
+    }
+  }
+}
+
+template <X86_VEXT vext>
+void IntraPrediction::_initIntraPredictionX86()
+{
+  m_predAngFilter4Row = simdPredAngFilter4Row<vext>;
+  m_predAngLinearRow  = simdPredAngLinearRow<vext>;
+  m_predPlanar        = simdPredPlanar<vext>;
+  m_pdpcPlanarDc      = simdPdpcPlanarDc<vext>;
+  m_transposeBlock    = simdTransposeBlock<vext>;
+}
+
+template void IntraPrediction::_initIntraPredictionX86<SIMDX86>();
+
+//! \}
+
+#endif   // TARGET_SIMD_X86
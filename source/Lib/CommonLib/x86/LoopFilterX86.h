@@ -0,0 +1,458 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     LoopFilterX86.h
+    \brief    SIMD kernels of the deblocking filter
+*/
+
+#include "CommonDefX86.h"
+#include "../LoopFilter.h"
+
+#ifdef TARGET_SIMD_X86
+#if defined _MSC_VER
+#include <tmmintrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+//! \ingroup CommonLib
+//! \{
+
+// The kernels keep one line of the edge per 32 bit lane. The sample vectors are addressed relative to
+// the edge, v[k] holds q<k> for k >= 0 and p<-k-1> for k < 0. They are loaded and stored in groups of
+// four positions, p3..p0 and q0..q3, plus p7..p4 and q4..q7 for the sides using the long filters.
+
+template<X86_VEXT vext>
+static inline void loadEdgeGroup( const Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int numLines, const int pos, __m128i* v )
+{
+  if( edgeDir == EDGE_VER )
+  {
+    // the lines are rows, transpose 4x4 samples
+    const Pel*    row = src + pos;
+    const __m128i r0  = _mm_loadl_epi64( ( const __m128i* ) row );
+    const __m128i r1  = _mm_loadl_epi64( ( const __m128i* ) ( row + stride ) );
+    const __m128i r2  = numLines > 2 ? _mm_loadl_epi64( ( const __m128i* ) ( row + 2 * stride ) ) : _mm_setzero_si128();
+    const __m128i r3  = numLines > 2 ? _mm_loadl_epi64( ( const __m128i* ) ( row + 3 * stride ) ) : _mm_setzero_si128();
+    const __m128i t0  = _mm_unpacklo_epi16( r0, r1 );
+    const __m128i t1  = _mm_unpacklo_epi16( r2, r3 );
+    const __m128i c01 = _mm_unpacklo_epi32( t0, t1 );
+    const __m128i c23 = _mm_unpackhi_epi32( t0, t1 );
+
+    v[pos    ] = _mm_cvtepi16_epi32( c01 );
+    v[pos + 1] = _mm_cvtepi16_epi32( _mm_unpackhi_epi64( c01, c01 ) );
+    v[pos + 2] = _mm_cvtepi16_epi32( c23 );
+    v[pos + 3] = _mm_cvtepi16_epi32( _mm_unpackhi_epi64( c23, c23 ) );
+  }
+  else
+  {
+    for( int k = pos; k < pos + 4; k++ )
+    {
+      const Pel* line = src + k * stride;
+      v[k] = _mm_cvtepi16_epi32( numLines > 2 ? _mm_loadl_epi64( ( const __m128i* ) line ) : _mm_cvtsi32_si128( *( const int* ) line ) );
+    }
+  }
+}
+
+template<X86_VEXT vext>
+static inline void storeEdgeGroup( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int numLines, const int pos, const __m128i* v )
+{
+  if( edgeDir == EDGE_VER )
+  {
+    const __m128i c01 = _mm_packs_epi32( v[pos    ], v[pos + 1] );
+    const __m128i c23 = _mm_packs_epi32( v[pos + 2], v[pos + 3] );
+    const __m128i t0  = _mm_unpacklo_epi16( c01, c23 );
+    const __m128i t1  = _mm_unpackhi_epi16( c01, c23 );
+    const __m128i r01 = _mm_unpacklo_epi16( t0, t1 );
+    const __m128i r23 = _mm_unpackhi_epi16( t0, t1 );
+    Pel*          row = src + pos;
+
+    _mm_storel_epi64( ( __m128i* ) row, r01 );
+    _mm_storel_epi64( ( __m128i* ) ( row + stride ), _mm_unpackhi_epi64( r01, r01 ) );
+    if( numLines > 2 )
+    {
+      _mm_storel_epi64( ( __m128i* ) ( row + 2 * stride ), r23 );
+      _mm_storel_epi64( ( __m128i* ) ( row + 3 * stride ), _mm_unpackhi_epi64( r23, r23 ) );
+    }
+  }
+  else
+  {
+    for( int k = pos; k < pos + 4; k++ )
+    {
+      Pel*          line = src + k * stride;
+      const __m128i s    = _mm_packs_epi32( v[k], v[k] );
+      if( numLines > 2 )
+      {
+        _mm_storel_epi64( ( __m128i* ) line, s );
+      }
+      else
+      {
+        *( int* ) line = _mm_cvtsi128_si32( s );
+      }
+    }
+  }
+}
+
+// Clip3( org - range, org + range, val )
+static inline __m128i clipAround( const __m128i val, const __m128i org, const __m128i range )
+{
+  return _mm_min_epi32( _mm_max_epi32( val, _mm_sub_epi32( org, range ) ), _mm_add_epi32( org, range ) );
+}
+
+// abs( a - 2 * b + c )
+static inline __m128i secondDiff( const __m128i a, const __m128i b, const __m128i c )
+{
+  return _mm_abs_epi32( _mm_sub_epi32( _mm_add_epi32( a, c ), _mm_slli_epi32( b, 1 ) ) );
+}
+
+// sum of p<k> + q<k> for k = first..last
+static inline __m128i sumPQ( const __m128i* v, const int first, const int last )
+{
+  __m128i sum = _mm_setzero_si128();
+  for( int k = first; k <= last; k++ )
+  {
+    sum = _mm_add_epi32( sum, _mm_add_epi32( v[-k - 1], v[k] ) );
+  }
+  return sum;
+}
+
+// ( sum + round ) >> shift
+static inline __m128i roundShift( const __m128i sum, const int round, const int shift )
+{
+  return _mm_srai_epi32( _mm_add_epi32( sum, _mm_set1_epi32( round ) ), shift );
+}
+
+// bilinear long filter of one side, side[dir * pos] is the sample at distance pos from the edge
+static inline void filterLongSide( __m128i* side, const int dir, const int numSide, const __m128i refMiddle, const __m128i refSide, const int tc )
+{
+  static const int coeffs7[7] = { 59, 50, 41, 32, 23, 14, 5 };
+  static const int coeffs5[5] = { 58, 45, 32, 19, 6 };
+  static const int coeffs3[3] = { 53, 32, 11 };
+  static const int tc7[7]     = { 6, 5, 4, 3, 2, 1, 1 };
+  static const int tc3[3]     = { 6, 4, 2 };
+
+  const int* coeffs = numSide == 7 ? coeffs7 : ( numSide == 5 ? coeffs5 : coeffs3 );
+  const int* tcSide = numSide == 3 ? tc3 : tc7;
+
+  for( int pos = 0; pos < numSide; pos++ )
+  {
+    __m128i&      x   = side[dir * pos];
+    const __m128i sum = _mm_add_epi32( _mm_mullo_epi32( refMiddle, _mm_set1_epi32( coeffs[pos] ) ), _mm_mullo_epi32( refSide, _mm_set1_epi32( 64 - coeffs[pos] ) ) );
+    x = clipAround( roundShift( sum, 32, 6 ), x, _mm_set1_epi32( ( tc * tcSide[pos] ) >> 1 ) );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdFilterLumaEdge4( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int tc, const int beta, const int maxFilterLengthP, const int maxFilterLengthQ,
+                                 const bool sidePisLarge, const bool sideQisLarge, const bool partPNoFilter, const bool partQNoFilter, const ClpRng& clpRng )
+{
+  __m128i  buf[16];
+  __m128i* v = buf + 8;
+
+  loadEdgeGroup<vext>( src, stride, edgeDir, 4, -4, v );
+  loadEdgeGroup<vext>( src, stride, edgeDir, 4,  0, v );
+  if( sidePisLarge )
+  {
+    loadEdgeGroup<vext>( src, stride, edgeDir, 4, -8, v );
+  }
+  if( sideQisLarge )
+  {
+    loadEdgeGroup<vext>( src, stride, edgeDir, 4, 4, v );
+  }
+
+  const int sideThreshold = ( beta + ( beta >> 1 ) ) >> 3;
+  const int thrDist       = ( tc * 5 + 1 ) >> 1;
+  const __m128i dist      = _mm_abs_epi32( _mm_sub_epi32( v[-1], v[0] ) );
+  const __m128i dp        = secondDiff( v[-3], v[-2], v[-1] );
+  const __m128i dq        = secondDiff( v[0], v[1], v[2] );
+  const __m128i sp3       = _mm_abs_epi32( _mm_sub_epi32( v[-4], v[-1] ) );
+  const __m128i sq3       = _mm_abs_epi32( _mm_sub_epi32( v[3], v[0] ) );
+
+  int dist4[4];
+  _mm_storeu_si128( ( __m128i* ) dist4, dist );
+
+  if( sidePisLarge || sideQisLarge )
+  {
+    __m128i dpL  = dp;
+    __m128i dqL  = dq;
+    __m128i sp3L = sp3;
+    __m128i sq3L = sq3;
+    if( sidePisLarge )
+    {
+      dpL  = roundShift( _mm_add_epi32( dpL, secondDiff( v[-6], v[-5], v[-4] ) ), 1, 1 );
+      sp3L = roundShift( _mm_add_epi32( sp3L, _mm_abs_epi32( _mm_sub_epi32( v[-4], maxFilterLengthP == 5 ? v[-6] : v[-8] ) ) ), 1, 1 );
+    }
+    if( sideQisLarge )
+    {
+      dqL  = roundShift( _mm_add_epi32( dqL, secondDiff( v[3], v[4], v[5] ) ), 1, 1 );
+      sq3L = roundShift( _mm_add_epi32( sq3L, _mm_abs_epi32( _mm_sub_epi32( v[3], maxFilterLengthQ == 5 ? v[5] : v[7] ) ) ), 1, 1 );
+    }
+
+    int dL4[4];
+    int sL4[4];
+    _mm_storeu_si128( ( __m128i* ) dL4, _mm_add_epi32( dpL, dqL ) );
+    _mm_storeu_si128( ( __m128i* ) sL4, _mm_add_epi32( sp3L, sq3L ) );
+
+    if( dL4[0] + dL4[3] < beta )
+    {
+      const int  thrStrong = ( beta * 3 ) >> 5;
+      const bool swL       = sL4[0] < thrStrong && 2 * dL4[0] < ( beta >> 2 ) && dist4[0] < thrDist
+                          && sL4[3] < thrStrong && 2 * dL4[3] < ( beta >> 2 ) && dist4[3] < thrDist;
+      if( swL )
+      {
+        const int numP = sidePisLarge ? maxFilterLengthP : 3;
+        const int numQ = sideQisLarge ? maxFilterLengthQ : 3;
+
+        __m128i refMiddle;
+        if( numP == numQ )
+        {
+          refMiddle = numP == 5 ? roundShift( _mm_add_epi32( _mm_slli_epi32( sumPQ( v, 0, 2 ), 1 ), sumPQ( v, 3, 4 ) ), 8, 4 )
+                                : roundShift( _mm_add_epi32( _mm_slli_epi32( sumPQ( v, 0, 0 ), 1 ), sumPQ( v, 1, 6 ) ), 8, 4 );
+        }
+        else if( std::min( numP, numQ ) == 5 )
+        {
+          refMiddle = roundShift( _mm_add_epi32( _mm_slli_epi32( sumPQ( v, 0, 1 ), 1 ), sumPQ( v, 2, 5 ) ), 8, 4 );
+        }
+        else if( std::max( numP, numQ ) == 7 )
+        {
+          // the long side L and the short side S: 2 * ( L0 + S0 ) + S0 + 2 * ( S1 + S2 ) + L1 + S1 + L2 + ... + L6
+          const __m128i* lng    = numP == 7 ? v - 1 : v;
+          const __m128i* shrt   = numP == 7 ? v : v - 1;
+          const int      dirLng = numP == 7 ? -1 : 1;
+          const int      dirSht = -dirLng;
+          __m128i sum = _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( lng[0], shrt[0] ), 1 ), shrt[0] );
+          sum = _mm_add_epi32( sum, _mm_slli_epi32( _mm_add_epi32( shrt[dirSht], shrt[2 * dirSht] ), 1 ) );
+          sum = _mm_add_epi32( sum, shrt[dirSht] );
+          for( int k = 1; k < 7; k++ )
+          {
+            sum = _mm_add_epi32( sum, lng[k * dirLng] );
+          }
+          refMiddle = roundShift( sum, 8, 4 );
+        }
+        else
+        {
+          refMiddle = roundShift( sumPQ( v, 0, 3 ), 4, 3 );
+        }
+
+        const __m128i refP = roundShift( _mm_add_epi32( v[-numP], v[-numP - 1] ), 1, 1 );
+        const __m128i refQ = roundShift( _mm_add_epi32( v[numQ - 1], v[numQ] ), 1, 1 );
+        filterLongSide( v - 1, -1, numP, refMiddle, refP, tc );
+        filterLongSide( v,      1, numQ, refMiddle, refQ, tc );
+
+        if( !partPNoFilter )
+        {
+          storeEdgeGroup<vext>( src, stride, edgeDir, 4, -4, v );
+          if( numP > 4 )
+          {
+            storeEdgeGroup<vext>( src, stride, edgeDir, 4, -8, v );
+          }
+        }
+        if( !partQNoFilter )
+        {
+          storeEdgeGroup<vext>( src, stride, edgeDir, 4, 0, v );
+          if( numQ > 4 )
+          {
+            storeEdgeGroup<vext>( src, stride, edgeDir, 4, 4, v );
+          }
+        }
+        return;
+      }
+    }
+  }
+
+  int dp4[4];
+  int dq4[4];
+  _mm_storeu_si128( ( __m128i* ) dp4, dp );
+  _mm_storeu_si128( ( __m128i* ) dq4, dq );
+
+  const int d0 = dp4[0] + dq4[0];
+  const int d3 = dp4[3] + dq4[3];
+
+  if( d0 + d3 >= beta )
+  {
+    return;
+  }
+
+  bool filterP = false;
+  bool filterQ = false;
+  if( maxFilterLengthP > 1 && maxFilterLengthQ > 1 )
+  {
+    filterP = dp4[0] + dp4[3] < sideThreshold;
+    filterQ = dq4[0] + dq4[3] < sideThreshold;
+  }
+  bool sw = false;
+  if( maxFilterLengthP > 2 && maxFilterLengthQ > 2 )
+  {
+    int s4[4];
+    _mm_storeu_si128( ( __m128i* ) s4, _mm_add_epi32( sp3, sq3 ) );
+    sw = s4[0] < ( beta >> 3 ) && 2 * d0 < ( beta >> 2 ) && dist4[0] < thrDist
+      && s4[3] < ( beta >> 3 ) && 2 * d3 < ( beta >> 2 ) && dist4[3] < thrDist;
+  }
+
+  const __m128i p3 = v[-4], p2 = v[-3], p1 = v[-2], p0 = v[-1];
+  const __m128i q0 = v[ 0], q1 = v[ 1], q2 = v[ 2], q3 = v[ 3];
+  const __m128i vtc = _mm_set1_epi32( tc );
+
+  if( sw )
+  {
+    const __m128i p0q0 = _mm_add_epi32( p0, q0 );
+    const __m128i tc2  = _mm_slli_epi32( vtc, 1 );
+    const __m128i tc3  = _mm_add_epi32( tc2, vtc );
+
+    v[-1] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( p2, q1 ), _mm_slli_epi32( _mm_add_epi32( p1, p0q0 ), 1 ) ), 4, 3 ), p0, tc3 );
+    v[ 0] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( p1, q2 ), _mm_slli_epi32( _mm_add_epi32( q1, p0q0 ), 1 ) ), 4, 3 ), q0, tc3 );
+    v[-2] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( p2, p1 ), p0q0 ), 2, 2 ), p1, tc2 );
+    v[ 1] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( q1, q2 ), p0q0 ), 2, 2 ), q1, tc2 );
+    v[-3] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( p3, 1 ), _mm_add_epi32( _mm_slli_epi32( p2, 1 ), p2 ) ), _mm_add_epi32( p1, p0q0 ) ), 4, 3 ), p2, vtc );
+    v[ 2] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( q3, 1 ), _mm_add_epi32( _mm_slli_epi32( q2, 1 ), q2 ) ), _mm_add_epi32( q1, p0q0 ) ), 4, 3 ), q2, vtc );
+  }
+  else
+  {
+    const __m128i vmin  = _mm_set1_epi32( clpRng.min );
+    const __m128i vmax  = _mm_set1_epi32( clpRng.max );
+    const __m128i delta = _mm_srai_epi32( _mm_add_epi32( _mm_sub_epi32( _mm_mullo_epi32( _mm_sub_epi32( q0, p0 ), _mm_set1_epi32( 9 ) ),
+                                                                          _mm_mullo_epi32( _mm_sub_epi32( q1, p1 ), _mm_set1_epi32( 3 ) ) ), _mm_set1_epi32( 8 ) ), 4 );
+    const __m128i mask  = _mm_cmpgt_epi32( _mm_set1_epi32( tc * 10 ), _mm_abs_epi32( delta ) );
+    const __m128i dClip = clipAround( delta, _mm_setzero_si128(), vtc );
+
+    v[-1] = _mm_blendv_epi8( p0, _mm_min_epi32( _mm_max_epi32( _mm_add_epi32( p0, dClip ), vmin ), vmax ), mask );
+    v[ 0] = _mm_blendv_epi8( q0, _mm_min_epi32( _mm_max_epi32( _mm_sub_epi32( q0, dClip ), vmin ), vmax ), mask );
+
+    const __m128i tc2 = _mm_set1_epi32( tc >> 1 );
+    if( filterP )
+    {
+      const __m128i delta1 = clipAround( _mm_srai_epi32( _mm_add_epi32( _mm_sub_epi32( roundShift( _mm_add_epi32( p2, p0 ), 1, 1 ), p1 ), dClip ), 1 ), _mm_setzero_si128(), tc2 );
+      v[-2] = _mm_blendv_epi8( p1, _mm_min_epi32( _mm_max_epi32( _mm_add_epi32( p1, delta1 ), vmin ), vmax ), mask );
+    }
+    if( filterQ )
+    {
+      const __m128i delta2 = clipAround( _mm_srai_epi32( _mm_sub_epi32( _mm_sub_epi32( roundShift( _mm_add_epi32( q2, q0 ), 1, 1 ), q1 ), dClip ), 1 ), _mm_setzero_si128(), tc2 );
+      v[ 1] = _mm_blendv_epi8( q1, _mm_min_epi32( _mm_max_epi32( _mm_add_epi32( q1, delta2 ), vmin ), vmax ), mask );
+    }
+  }
+
+  if( !partPNoFilter )
+  {
+    storeEdgeGroup<vext>( src, stride, edgeDir, 4, -4, v );
+  }
+  if( !partQNoFilter )
+  {
+    storeEdgeGroup<vext>( src, stride, edgeDir, 4, 0, v );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdFilterChromaEdge( Pel* src, const int stride, const DeblockEdgeDir edgeDir, const int numLines, const int subSamplingShift, const int tc, const int beta,
+                                  const bool largeBoundary, const bool partPNoFilter, const bool partQNoFilter, const ClpRng& clpRng )
+{
+  // the second decision line has to be within the loaded lines
+  if( numLines != 4 && ( numLines != 2 || subSamplingShift != 1 ) )
+  {
+    LoopFilter::filterChromaEdge( src, stride, edgeDir, numLines, subSamplingShift, tc, beta, largeBoundary, partPNoFilter, partQNoFilter, clpRng );
+    return;
+  }
+
+  __m128i  buf[8];
+  __m128i* v = buf + 4;
+
+  loadEdgeGroup<vext>( src, stride, edgeDir, numLines, -4, v );
+  loadEdgeGroup<vext>( src, stride, edgeDir, numLines,  0, v );
+
+  const __m128i p3 = v[-4], p2 = v[-3], p1 = v[-2], p0 = v[-1];
+  const __m128i q0 = v[ 0], q1 = v[ 1], q2 = v[ 2], q3 = v[ 3];
+  const __m128i vtc = _mm_set1_epi32( tc );
+
+  bool sw = false;
+  if( largeBoundary )
+  {
+    const int line3 = subSamplingShift == 1 ? 1 : 3;
+
+    int d4[4];
+    _mm_storeu_si128( ( __m128i* ) d4, _mm_add_epi32( secondDiff( p2, p1, p0 ), secondDiff( q0, q1, q2 ) ) );
+
+    if( d4[0] + d4[line3] < beta )
+    {
+      int s4[4];
+      int dist4[4];
+      _mm_storeu_si128( ( __m128i* ) s4, _mm_add_epi32( _mm_abs_epi32( _mm_sub_epi32( p3, p0 ) ), _mm_abs_epi32( _mm_sub_epi32( q3, q0 ) ) ) );
+      _mm_storeu_si128( ( __m128i* ) dist4, _mm_abs_epi32( _mm_sub_epi32( p0, q0 ) ) );
+
+      const int thrDist = ( tc * 5 + 1 ) >> 1;
+      sw = s4[0]     < ( beta >> 3 ) && 2 * d4[0]     < ( beta >> 2 ) && dist4[0]     < thrDist
+        && s4[line3] < ( beta >> 3 ) && 2 * d4[line3] < ( beta >> 2 ) && dist4[line3] < thrDist;
+    }
+  }
+
+  if( sw )
+  {
+    const __m128i p0q0 = _mm_add_epi32( p0, q0 );
+
+    v[-3] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( _mm_mullo_epi32( p3, _mm_set1_epi32( 3 ) ), _mm_slli_epi32( p2, 1 ) ), _mm_add_epi32( p1, p0q0 ) ), 4, 3 ), p2, vtc );
+    v[-2] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( p3, p1 ), 1 ), p2 ), _mm_add_epi32( q1, p0q0 ) ), 4, 3 ), p1, vtc );
+    v[-1] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( _mm_add_epi32( p3, p2 ), _mm_add_epi32( p1, p0 ) ), _mm_add_epi32( _mm_add_epi32( p0q0, q1 ), q2 ) ), 4, 3 ), p0, vtc );
+    v[ 0] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( _mm_add_epi32( q3, q2 ), _mm_add_epi32( q1, q0 ) ), _mm_add_epi32( _mm_add_epi32( p0q0, p1 ), p2 ) ), 4, 3 ), q0, vtc );
+    v[ 1] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_add_epi32( q3, q1 ), 1 ), q2 ), _mm_add_epi32( p1, p0q0 ) ), 4, 3 ), q1, vtc );
+    v[ 2] = clipAround( roundShift( _mm_add_epi32( _mm_add_epi32( _mm_mullo_epi32( q3, _mm_set1_epi32( 3 ) ), _mm_slli_epi32( q2, 1 ) ), _mm_add_epi32( q1, p0q0 ) ), 4, 3 ), q2, vtc );
+  }
+  else
+  {
+    const __m128i vmin  = _mm_set1_epi32( clpRng.min );
+    const __m128i vmax  = _mm_set1_epi32( clpRng.max );
+    const __m128i delta = clipAround( _mm_srai_epi32( _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32( _mm_sub_epi32( q0, p0 ), 2 ), _mm_sub_epi32( p1, q1 ) ), _mm_set1_epi32( 4 ) ), 3 ),
+                                      _mm_setzero_si128(), vtc );
+
+    v[-1] = _mm_min_epi32( _mm_max_epi32( _mm_add_epi32( p0, delta ), vmin ), vmax );
+    v[ 0] = _mm_min_epi32( _mm_max_epi32( _mm_sub_epi32( q0, delta ), vmin ), vmax );
+  }
+
+  if( !partPNoFilter )
+  {
+    storeEdgeGroup<vext>( src, stride, edgeDir, numLines, -4, v );
+  }
+  if( !partQNoFilter )
+  {
+    storeEdgeGroup<vext>( src, stride, edgeDir, numLines, 0, v );
+  }
+}
+
+template <X86_VEXT vext>
+void LoopFilter::_initLoopFilterX86()
+{
+  m_filterLumaEdge4  = simdFilterLumaEdge4<vext>;
+  m_filterChromaEdge = simdFilterChromaEdge<vext>;
+}
+
+template void LoopFilter::_initLoopFilterX86<SIMDX86>();
+
+//! \}
+
+#endif   // TARGET_SIMD_X86
@@ -0,0 +1,298 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     MatrixIntraPredictionX86.h
+    \brief    SIMD kernels of the matrix intra prediction
+*/
+
+#include "CommonDefX86.h"
+#include "../MatrixIntraPrediction.h"
+
+#ifdef TARGET_SIMD_X86
+#if defined _MSC_VER
+#include <tmmintrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+//! \ingroup CommonLib
+//! \{
+
+// 8 weights of one matrix row as 16 bit, with the first matrix column left out the row is read one byte early
+static inline __m128i loadMipRow( const uint8_t* rowStart, const bool first, const int redSize )
+{
+  if( !redSize )
+  {
+    return _mm_cvtepu8_epi16( _mm_loadl_epi64( ( const __m128i* ) rowStart ) );
+  }
+  const __m128i row = first ? _mm_slli_si128( _mm_loadl_epi64( ( const __m128i* ) rowStart ), 1 ) : _mm_loadl_epi64( ( const __m128i* ) ( rowStart - 1 ) );
+  return _mm_cvtepu8_epi16( row );
+}
+
+template<X86_VEXT vext>
+static void simdReducedPredMatrixMul( int* const result, const int* const input, const uint8_t* matrix,
+                                      const int inputSize, const int redSize, const int width, const int height,
+                                      const int xStep, const int yStep, const int offset, const int shiftMatrix,
+                                      const int inputOffset, const int bitDepth )
+{
+  const int numOutputs = width * height;
+
+  if( ( width & 3 ) || ( inputSize != 4 && inputSize != 8 ) || ( inputSize == 4 && redSize ) )
+  {
+    MatrixIntraPrediction::reducedPredMatrixMul( result, input, matrix, inputSize, redSize, width, height,
+                                                 xStep, yStep, offset, shiftMatrix, inputOffset, bitDepth );
+    return;
+  }
+
+  // the input is the rebased boundary, input[0] is zero when the first matrix column is left out
+  const __m128i in = inputSize == 4 ? _mm_packs_epi32( _mm_loadu_si128( ( const __m128i* ) input ), _mm_loadu_si128( ( const __m128i* ) input ) )
+                                    : _mm_packs_epi32( _mm_loadu_si128( ( const __m128i* ) input ), _mm_loadu_si128( ( const __m128i* ) ( input + 4 ) ) );
+  const int     rowLen = inputSize - redSize;
+  const __m128i vsh    = _mm_cvtsi32_si128( shiftMatrix );
+
+  if( inputSize == 4 )
+  {
+    // 4 rows of 4 weights in one load, the rows are consecutive
+    const __m128i voff = _mm_set1_epi32( offset );
+    const __m128i vio  = _mm_set1_epi32( inputOffset );
+    const __m128i vmax = _mm_set1_epi32( ( 1 << bitDepth ) - 1 );
+
+    for( int k = 0; k < numOutputs; k += 4 )
+    {
+      const __m128i w  = _mm_loadu_si128( ( const __m128i* ) ( matrix + k * 4 ) );
+      const __m128i m0 = _mm_madd_epi16( _mm_cvtepu8_epi16( w ), in );
+      const __m128i m1 = _mm_madd_epi16( _mm_cvtepu8_epi16( _mm_srli_si128( w, 8 ) ), in );
+
+      __m128i sum = _mm_hadd_epi32( m0, m1 );
+      sum = _mm_add_epi32( _mm_sra_epi32( _mm_add_epi32( sum, voff ), vsh ), vio );
+      _mm_storeu_si128( ( __m128i* ) ( result + k ), _mm_min_epi32( vmax, _mm_max_epi32( _mm_setzero_si128(), sum ) ) );
+    }
+    return;
+  }
+
+  // matrix row of the output at ( x, y ), with leaveHorOut and leaveVerOut every other row is skipped
+  const uint8_t* rows[MIP_MAX_REDUCED_OUTPUT_SAMPLES];
+  for( int y = 0, k = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x++, k++ )
+    {
+      rows[k] = matrix + ( x * xStep + y * ( width * xStep + yStep ) ) * rowLen;
+    }
+  }
+
+  int k = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i in2  = _mm256_inserti128_si256( _mm256_castsi128_si256( in ), in, 1 );
+    const __m256i voff = _mm256_set1_epi32( offset );
+    const __m256i vio  = _mm256_set1_epi32( inputOffset );
+    const __m256i vmax = _mm256_set1_epi32( ( 1 << bitDepth ) - 1 );
+    const __m256i perm = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+
+    for( ; k + 8 <= numOutputs; k += 8 )
+    {
+      __m256i m[4];
+      for( int i = 0; i < 4; i++ )
+      {
+        const __m128i r0 = loadMipRow( rows[k + 2 * i],     k + 2 * i == 0, redSize );
+        const __m128i r1 = loadMipRow( rows[k + 2 * i + 1], false,          redSize );
+        m[i] = _mm256_madd_epi16( _mm256_inserti128_si256( _mm256_castsi128_si256( r0 ), r1, 1 ), in2 );
+      }
+
+      // the low lane holds the even and the high lane the odd outputs
+      __m256i sum = _mm256_hadd_epi32( _mm256_hadd_epi32( m[0], m[1] ), _mm256_hadd_epi32( m[2], m[3] ) );
+      sum = _mm256_permutevar8x32_epi32( sum, perm );
+      sum = _mm256_add_epi32( _mm256_sra_epi32( _mm256_add_epi32( sum, voff ), vsh ), vio );
+      _mm256_storeu_si256( ( __m256i* ) ( result + k ), _mm256_min_epi32( vmax, _mm256_max_epi32( _mm256_setzero_si256(), sum ) ) );
+    }
+  }
+#endif
+
+  const __m128i voff = _mm_set1_epi32( offset );
+  const __m128i vio  = _mm_set1_epi32( inputOffset );
+  const __m128i vmax = _mm_set1_epi32( ( 1 << bitDepth ) - 1 );
+
+  for( ; k < numOutputs; k += 4 )
+  {
+    const __m128i m0 = _mm_madd_epi16( loadMipRow( rows[k],     k == 0, redSize ), in );
+    const __m128i m1 = _mm_madd_epi16( loadMipRow( rows[k + 1], false,  redSize ), in );
+    const __m128i m2 = _mm_madd_epi16( loadMipRow( rows[k + 2], false,  redSize ), in );
+    const __m128i m3 = _mm_madd_epi16( loadMipRow( rows[k + 3], false,  redSize ), in );
+
+    __m128i sum = _mm_hadd_epi32( _mm_hadd_epi32( m0, m1 ), _mm_hadd_epi32( m2, m3 ) );
+    sum = _mm_add_epi32( _mm_sra_epi32( _mm_add_epi32( sum, voff ), vsh ), vio );
+    _mm_storeu_si128( ( __m128i* ) ( result + k ), _mm_min_epi32( vmax, _mm_max_epi32( _mm_setzero_si128(), sum ) ) );
+  }
+}
+
+static inline __m128i loadStrided( const int* src, const SizeType step )
+{
+  return step == 1 ? _mm_loadu_si128( ( const __m128i* ) src ) : _mm_setr_epi32( src[0], src[step], src[2 * step], src[3 * step] );
+}
+
+static inline void storeStrided( int* dst, const SizeType step, const __m128i val )
+{
+  if( step == 1 )
+  {
+    _mm_storeu_si128( ( __m128i* ) dst, val );
+  }
+  else
+  {
+    dst[0]        = _mm_cvtsi128_si32( val );
+    dst[step]     = _mm_extract_epi32( val, 1 );
+    dst[2 * step] = _mm_extract_epi32( val, 2 );
+    dst[3 * step] = _mm_extract_epi32( val, 3 );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdPredictionUpsampling1D( int* const dst, const int* const src, const int* const bndry,
+                                        const SizeType srcSizeUpsmpDim, const SizeType srcSizeOrthDim,
+                                        const SizeType srcStep, const SizeType srcStride,
+                                        const SizeType dstStep, const SizeType dstStride,
+                                        const SizeType bndryStep,
+                                        const unsigned int upsmpFactor )
+{
+  const int     log2UpsmpFactor = floorLog2( upsmpFactor );
+  const __m128i vrnd            = _mm_set1_epi32( 1 << ( log2UpsmpFactor - 1 ) );
+  const __m128i vsh             = _mm_cvtsi32_si128( log2UpsmpFactor );
+
+  if( dstStep == 1 && upsmpFactor >= 4 )
+  {
+    // the upsampled samples between two source samples, ( before * ( f - p ) + behind * p + rnd ) >> log2( f ) for p = 1..f
+    const __m128i vf = _mm_set1_epi32( upsmpFactor );
+
+    const int* srcLine   = src;
+    int*       dstLine   = dst;
+    const int* bndryLine = bndry + bndryStep - 1;
+    for( SizeType idxOrthDim = 0; idxOrthDim < srcSizeOrthDim; idxOrthDim++ )
+    {
+      int        before  = *bndryLine;
+      const int* behind  = srcLine;
+      int*       currDst = dstLine;
+      for( SizeType idxUpsmpDim = 0; idxUpsmpDim < srcSizeUpsmpDim; idxUpsmpDim++ )
+      {
+        const __m128i vbefore = _mm_set1_epi32( before );
+        const __m128i vbehind = _mm_set1_epi32( *behind );
+        for( int pos = 0; pos < upsmpFactor; pos += 4 )
+        {
+          const __m128i vpos = _mm_setr_epi32( pos + 1, pos + 2, pos + 3, pos + 4 );
+          __m128i val = _mm_add_epi32( _mm_mullo_epi32( vbefore, _mm_sub_epi32( vf, vpos ) ), _mm_mullo_epi32( vbehind, vpos ) );
+          val = _mm_sra_epi32( _mm_add_epi32( val, vrnd ), vsh );
+          _mm_storeu_si128( ( __m128i* ) ( currDst + pos ), val );
+        }
+        currDst += upsmpFactor;
+        before   = *behind;
+        behind  += srcStep;
+      }
+      srcLine   += srcStride;
+      dstLine   += dstStride;
+      bndryLine += bndryStep;
+    }
+  }
+  else if( dstStep == 1 && upsmpFactor == 2 && !( srcSizeUpsmpDim & 3 ) )
+  {
+    // every other sample is the rounded average of its neighbours, the others are copied
+    const __m128i vone = _mm_set1_epi32( 1 );
+
+    const int* srcLine   = src;
+    int*       dstLine   = dst;
+    const int* bndryLine = bndry + bndryStep - 1;
+    for( SizeType idxOrthDim = 0; idxOrthDim < srcSizeOrthDim; idxOrthDim++ )
+    {
+      int        before  = *bndryLine;
+      const int* behind  = srcLine;
+      int*       currDst = dstLine;
+      for( SizeType idxUpsmpDim = 0; idxUpsmpDim < srcSizeUpsmpDim; idxUpsmpDim += 4 )
+      {
+        const __m128i vbehind = loadStrided( behind, srcStep );
+        const __m128i vbefore = _mm_or_si128( _mm_slli_si128( vbehind, 4 ), _mm_cvtsi32_si128( before ) );
+        const __m128i avg     = _mm_srai_epi32( _mm_add_epi32( _mm_add_epi32( vbefore, vbehind ), vone ), 1 );
+        _mm_storeu_si128( ( __m128i* ) ( currDst ),     _mm_unpacklo_epi32( avg, vbehind ) );
+        _mm_storeu_si128( ( __m128i* ) ( currDst + 4 ), _mm_unpackhi_epi32( avg, vbehind ) );
+
+        before   = behind[3 * srcStep];
+        behind  += 4 * srcStep;
+        currDst += 8;
+      }
+      srcLine   += srcStride;
+      dstLine   += dstStride;
+      bndryLine += bndryStep;
+    }
+  }
+  else if( dstStep != 1 && !( srcSizeOrthDim & 3 ) )
+  {
+    // four lines of the orthogonal dimension at once, with the same arithmetic as the scalar kernel
+    for( SizeType idxOrthDim = 0; idxOrthDim < srcSizeOrthDim; idxOrthDim += 4 )
+    {
+      __m128i    vbefore = loadStrided( bndry + bndryStep - 1 + idxOrthDim * bndryStep, bndryStep );
+      const int* behind  = src + idxOrthDim * srcStride;
+      int*       currDst = dst + idxOrthDim * dstStride;
+      for( SizeType idxUpsmpDim = 0; idxUpsmpDim < srcSizeUpsmpDim; idxUpsmpDim++ )
+      {
+        const __m128i vbehind = loadStrided( behind, srcStride );
+
+        __m128i scaledBefore = _mm_sll_epi32( vbefore, vsh );
+        __m128i scaledBehind = _mm_setzero_si128();
+        for( unsigned int pos = 1; pos <= upsmpFactor; pos++ )
+        {
+          scaledBefore = _mm_sub_epi32( scaledBefore, vbefore );
+          scaledBehind = _mm_add_epi32( scaledBehind, vbehind );
+          storeStrided( currDst, dstStride, _mm_sra_epi32( _mm_add_epi32( _mm_add_epi32( scaledBefore, scaledBehind ), vrnd ), vsh ) );
+          currDst += dstStep;
+        }
+        vbefore = vbehind;
+        behind += srcStep;
+      }
+    }
+  }
+  else
+  {
+    MatrixIntraPrediction::predictionUpsampling1D( dst, src, bndry, srcSizeUpsmpDim, srcSizeOrthDim, srcStep, srcStride,
+                                                   dstStep, dstStride, bndryStep, upsmpFactor );
+  }
+}
+
+template <X86_VEXT vext>
+void MatrixIntraPrediction::_initMatrixIntraPredictionX86()
+{
+  m_reducedPredMatrixMul   = simdReducedPredMatrixMul<vext>;
+  m_predictionUpsampling1D = simdPredictionUpsampling1D<vext>;
+}
+
+template void MatrixIntraPrediction::_initMatrixIntraPredictionX86<SIMDX86>();
+
+//! \}
+
+#endif   // TARGET_SIMD_X86
@@ -0,0 +1,388 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     QuantX86.h
+    \brief    SIMD versions of the per coefficient quantization, de-quantization and RDOQ level estimation
+*/
+
+#include "CommonDefX86.h"
+#include "../Quant.h"
+
+#ifdef TARGET_SIMD_X86
+#if defined _MSC_VER
+#include <tmmintrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+//! \ingroup CommonLib
+//! \{
+
+// The scaled magnitudes |coeff| * scale need up to 64 bit, they are formed with the 32x32->64 bit multiplication of the
+// even and of the odd 32 bit lanes. Both are non-negative, so logical 64 bit shifts do.
+struct QuantSSEOps
+{
+  typedef __m128i T;
+  static const int lanes = 4;
+
+  static inline T    Load   ( const int* src )      { return _mm_loadu_si128( ( const __m128i* ) src ); }
+  static inline void Store  ( int* dst, T a )       { _mm_storeu_si128( ( __m128i* ) dst, a ); }
+  static inline T    Set    ( int c )               { return _mm_set1_epi32( c ); }
+  static inline T    Set64  ( int64_t c )           { return _mm_set1_epi64x( c ); }
+  static inline T    Zero   ()                      { return _mm_setzero_si128(); }
+  static inline T    Add    ( T a, T b )            { return _mm_add_epi32( a, b ); }
+  static inline T    Min    ( T a, T b )            { return _mm_min_epi32( a, b ); }
+  static inline T    Max    ( T a, T b )            { return _mm_max_epi32( a, b ); }
+  static inline T    Or     ( T a, T b )            { return _mm_or_si128( a, b ); }
+  static inline T    Abs    ( T a )                 { return _mm_abs_epi32( a ); }
+  static inline T    Sign   ( T a, T b )            { return _mm_sign_epi32( a, b ); }
+  static inline T    Mul    ( T a, T b )            { return _mm_mullo_epi32( a, b ); }
+  static inline T    Sra    ( T a, __m128i count )  { return _mm_sra_epi32( a, count ); }
+  static inline T    Sll    ( T a, __m128i count )  { return _mm_sll_epi32( a, count ); }
+  static inline bool IsZero ( T a )                 { return _mm_testz_si128( a, a ); }
+  static inline int  HSum   ( T a )
+  {
+    a = _mm_add_epi32( a, _mm_shuffle_epi32( a, 0x4e ) );
+    a = _mm_add_epi32( a, _mm_shuffle_epi32( a, 0xb1 ) );
+    return _mm_cvtsi128_si32( a );
+  }
+
+  static inline T    Add64  ( T a, T b )            { return _mm_add_epi64( a, b ); }
+  static inline T    Sub64  ( T a, T b )            { return _mm_sub_epi64( a, b ); }
+  static inline T    Srl64  ( T a, __m128i count )  { return _mm_srl_epi64( a, count ); }
+  static inline T    Sll64  ( T a, __m128i count )  { return _mm_sll_epi64( a, count ); }
+  static inline T    MulEven( T a, T b )            { return _mm_mul_epi32( a, b ); }
+  static inline T    MulOdd ( T a, T b )            { return _mm_mul_epi32( _mm_srli_epi64( a, 32 ), _mm_srli_epi64( b, 32 ) ); }
+  // low 32 bit of the 64 bit lanes of even and odd, back in the lane order of the 32 bit input
+  static inline T    Combine( T even, T odd )       { return _mm_blend_epi16( even, _mm_slli_epi64( odd, 32 ), 0xcc ); }
+  // a where a <= b, b elsewhere, for non-negative 64 bit lanes
+  static inline T    Min64  ( T a, T b )
+  {
+    const __m128i gt = _mm_shuffle_epi32( _mm_srai_epi32( _mm_sub_epi64( b, a ), 31 ), 0xf5 );
+    return _mm_blendv_epi8( a, b, gt );
+  }
+
+  // dErr * dErr * errScale of the levels
+  static inline void StoreCost( double* dst, T level, const double* errScale, const double defaultErrScale )
+  {
+    const __m128d d0 = _mm_cvtepi32_pd( level );
+    const __m128d d1 = _mm_cvtepi32_pd( _mm_unpackhi_epi64( level, level ) );
+    const __m128d s0 = errScale ? _mm_loadu_pd( errScale     ) : _mm_set1_pd( defaultErrScale );
+    const __m128d s1 = errScale ? _mm_loadu_pd( errScale + 2 ) : _mm_set1_pd( defaultErrScale );
+    _mm_storeu_pd( dst,     _mm_mul_pd( _mm_mul_pd( d0, d0 ), s0 ) );
+    _mm_storeu_pd( dst + 2, _mm_mul_pd( _mm_mul_pd( d1, d1 ), s1 ) );
+  }
+};
+
+#ifdef USE_AVX2
+struct QuantAVX2Ops
+{
+  typedef __m256i T;
+  static const int lanes = 8;
+
+  static inline T    Load   ( const int* src )      { return _mm256_loadu_si256( ( const __m256i* ) src ); }
+  static inline void Store  ( int* dst, T a )       { _mm256_storeu_si256( ( __m256i* ) dst, a ); }
+  static inline T    Set    ( int c )               { return _mm256_set1_epi32( c ); }
+  static inline T    Set64  ( int64_t c )           { return _mm256_set1_epi64x( c ); }
+  static inline T    Zero   ()                      { return _mm256_setzero_si256(); }
+  static inline T    Add    ( T a, T b )            { return _mm256_add_epi32( a, b ); }
+  static inline T    Min    ( T a, T b )            { return _mm256_min_epi32( a, b ); }
+  static inline T    Max    ( T a, T b )            { return _mm256_max_epi32( a, b ); }
+  static inline T    Or     ( T a, T b )            { return _mm256_or_si256( a, b ); }
+  static inline T    Abs    ( T a )                 { return _mm256_abs_epi32( a ); }
+  static inline T    Sign   ( T a, T b )            { return _mm256_sign_epi32( a, b ); }
+  static inline T    Mul    ( T a, T b )            { return _mm256_mullo_epi32( a, b ); }
+  static inline T    Sra    ( T a, __m128i count )  { return _mm256_sra_epi32( a, count ); }
+  static inline T    Sll    ( T a, __m128i count )  { return _mm256_sll_epi32( a, count ); }
+  static inline bool IsZero ( T a )                 { return _mm256_testz_si256( a, a ); }
+  static inline int  HSum   ( T a )
+  {
+    return QuantSSEOps::HSum( _mm_add_epi32( _mm256_castsi256_si128( a ), _mm256_extracti128_si256( a, 1 ) ) );
+  }
+
+  static inline T    Add64  ( T a, T b )            { return _mm256_add_epi64( a, b ); }
+  static inline T    Sub64  ( T a, T b )            { return _mm256_sub_epi64( a, b ); }
+  static inline T    Srl64  ( T a, __m128i count )  { return _mm256_srl_epi64( a, count ); }
+  static inline T    Sll64  ( T a, __m128i count )  { return _mm256_sll_epi64( a, count ); }
+  static inline T    MulEven( T a, T b )            { return _mm256_mul_epi32( a, b ); }
+  static inline T    MulOdd ( T a, T b )            { return _mm256_mul_epi32( _mm256_srli_epi64( a, 32 ), _mm256_srli_epi64( b, 32 ) ); }
+  static inline T    Combine( T even, T odd )       { return _mm256_blend_epi32( even, _mm256_slli_epi64( odd, 32 ), 0xaa ); }
+  static inline T    Min64  ( T a, T b )
+  {
+    return _mm256_blendv_epi8( a, b, _mm256_cmpgt_epi64( a, b ) );
+  }
+
+  static inline void StoreCost( double* dst, T level, const double* errScale, const double defaultErrScale )
+  {
+    const __m256d d0 = _mm256_cvtepi32_pd( _mm256_castsi256_si128( level ) );
+    const __m256d d1 = _mm256_cvtepi32_pd( _mm256_extracti128_si256( level, 1 ) );
+    const __m256d s0 = errScale ? _mm256_loadu_pd( errScale     ) : _mm256_set1_pd( defaultErrScale );
+    const __m256d s1 = errScale ? _mm256_loadu_pd( errScale + 4 ) : _mm256_set1_pd( defaultErrScale );
+    _mm256_storeu_pd( dst,     _mm256_mul_pd( _mm256_mul_pd( d0, d0 ), s0 ) );
+    _mm256_storeu_pd( dst + 4, _mm256_mul_pd( _mm256_mul_pd( d1, d1 ), s1 ) );
+  }
+};
+#endif
+
+template<typename OPS>
+static inline int quantBlockSIMD( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, TCoeff& absSum, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff,
+                                  const int64_t add, const int qBits, const TCoeff entropyCodingMinimum, const TCoeff entropyCodingMaximum )
+{
+  typedef typename OPS::T T;
+
+  const __m128i vqBits  = _mm_cvtsi32_si128( qBits );
+  const __m128i vqBits8 = _mm_cvtsi32_si128( qBits - 8 );
+  const T       vadd    = OPS::Set64( add );
+  const T       vmin    = OPS::Set( entropyCodingMinimum );
+  const T       vmax    = OPS::Set( entropyCodingMaximum );
+  T             vscale  = OPS::Set( defaultQuantCoeff );
+  T             vsum    = OPS::Zero();
+
+  int n = 0;
+  for( ; n + OPS::lanes <= numCoeffs; n += OPS::lanes )
+  {
+    const T level = OPS::Load( src + n );
+    const T absLevel = OPS::Abs( level );
+    if( quantCoeff )
+    {
+      vscale = OPS::Load( quantCoeff + n );
+    }
+
+    const T tmpEven   = OPS::MulEven( absLevel, vscale );
+    const T tmpOdd    = OPS::MulOdd ( absLevel, vscale );
+    const T qEven     = OPS::Srl64( OPS::Add64( tmpEven, vadd ), vqBits );
+    const T qOdd      = OPS::Srl64( OPS::Add64( tmpOdd,  vadd ), vqBits );
+    const T dEven     = OPS::Srl64( OPS::Sub64( tmpEven, OPS::Sll64( qEven, vqBits ) ), vqBits8 );
+    const T dOdd      = OPS::Srl64( OPS::Sub64( tmpOdd,  OPS::Sll64( qOdd,  vqBits ) ), vqBits8 );
+    const T magnitude = OPS::Combine( qEven, qOdd );
+
+    vsum = OPS::Add( vsum, magnitude );
+    OPS::Store( deltaU + n, OPS::Combine( dEven, dOdd ) );
+    OPS::Store( dst + n, OPS::Min( vmax, OPS::Max( vmin, OPS::Sign( magnitude, level ) ) ) );
+  }
+
+  absSum += OPS::HSum( vsum );
+  return n;
+}
+
+template<X86_VEXT vext>
+static void simdQuantBlock( const TCoeff* src, TCoeff* dst, TCoeff* deltaU, TCoeff& absSum, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff,
+                            const int64_t add, const int qBits, const TCoeff entropyCodingMinimum, const TCoeff entropyCodingMaximum )
+{
+  int n = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    n = quantBlockSIMD<QuantAVX2Ops>( src, dst, deltaU, absSum, numCoeffs, quantCoeff, defaultQuantCoeff, add, qBits, entropyCodingMinimum, entropyCodingMaximum );
+  }
+#endif
+  n += quantBlockSIMD<QuantSSEOps>( src + n, dst + n, deltaU + n, absSum, numCoeffs - n, quantCoeff ? quantCoeff + n : nullptr, defaultQuantCoeff, add, qBits,
+                                    entropyCodingMinimum, entropyCodingMaximum );
+  if( n < numCoeffs )
+  {
+    Quant::quantBlock( src + n, dst + n, deltaU + n, absSum, numCoeffs - n, quantCoeff ? quantCoeff + n : nullptr, defaultQuantCoeff, add, qBits,
+                       entropyCodingMinimum, entropyCodingMaximum );
+  }
+}
+
+template<typename OPS>
+static inline int dequantBlockSIMD( const TCoeff* src, TCoeff* dst, const int numCoeffs, const int* dequantCoeff, const int scale, const int rightShift,
+                                    const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff transformMinimum, const TCoeff transformMaximum )
+{
+  typedef typename OPS::T T;
+
+  // the input clipping keeps the products within 32 bit
+  const T       vinMin  = OPS::Set( inputMinimum );
+  const T       vinMax  = OPS::Set( inputMaximum );
+  const T       vtrMin  = OPS::Set( transformMinimum );
+  const T       vtrMax  = OPS::Set( transformMaximum );
+  const T       vadd    = OPS::Set( rightShift > 0 ? 1 << ( rightShift - 1 ) : 0 );
+  const __m128i vshift  = _mm_cvtsi32_si128( rightShift > 0 ? rightShift : -rightShift );
+  T             vscale  = OPS::Set( scale );
+
+  int n = 0;
+  for( ; n + OPS::lanes <= numCoeffs; n += OPS::lanes )
+  {
+    if( dequantCoeff )
+    {
+      vscale = OPS::Load( dequantCoeff + n );
+    }
+    const T clipQCoef = OPS::Min( vinMax, OPS::Max( vinMin, OPS::Load( src + n ) ) );
+    const T product   = OPS::Mul( clipQCoef, vscale );
+    const T coeffQ    = rightShift > 0 ? OPS::Sra( OPS::Add( product, vadd ), vshift ) : OPS::Sll( product, vshift );
+    OPS::Store( dst + n, OPS::Min( vtrMax, OPS::Max( vtrMin, coeffQ ) ) );
+  }
+  return n;
+}
+
+template<X86_VEXT vext>
+static void simdDequantBlock( const TCoeff* src, TCoeff* dst, const int numCoeffs, const int* dequantCoeff, const int scale, const int rightShift,
+                              const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff transformMinimum, const TCoeff transformMaximum )
+{
+  int n = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    n = dequantBlockSIMD<QuantAVX2Ops>( src, dst, numCoeffs, dequantCoeff, scale, rightShift, inputMinimum, inputMaximum, transformMinimum, transformMaximum );
+  }
+#endif
+  n += dequantBlockSIMD<QuantSSEOps>( src + n, dst + n, numCoeffs - n, dequantCoeff ? dequantCoeff + n : nullptr, scale, rightShift,
+                                      inputMinimum, inputMaximum, transformMinimum, transformMaximum );
+  if( n < numCoeffs )
+  {
+    Quant::dequantBlock( src + n, dst + n, numCoeffs - n, dequantCoeff ? dequantCoeff + n : nullptr, scale, rightShift,
+                         inputMinimum, inputMaximum, transformMinimum, transformMaximum );
+  }
+}
+
+template<typename OPS>
+static inline int hasNonZeroLevelSIMD( const TCoeff* src, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits, bool& nonZero )
+{
+  typedef typename OPS::T T;
+
+  const __m128i vqBits = _mm_cvtsi32_si128( qBits );
+  const T       vadd   = OPS::Set64( add );
+  T             vscale = OPS::Set( defaultQuantCoeff );
+
+  int n = 0;
+  for( ; n + OPS::lanes <= numCoeffs; n += OPS::lanes )
+  {
+    const T absLevel = OPS::Abs( OPS::Load( src + n ) );
+    if( quantCoeff )
+    {
+      vscale = OPS::Load( quantCoeff + n );
+    }
+    const T qEven = OPS::Srl64( OPS::Add64( OPS::MulEven( absLevel, vscale ), vadd ), vqBits );
+    const T qOdd  = OPS::Srl64( OPS::Add64( OPS::MulOdd ( absLevel, vscale ), vadd ), vqBits );
+    if( !OPS::IsZero( OPS::Combine( qEven, qOdd ) ) )
+    {
+      nonZero = true;
+      break;
+    }
+  }
+  return n;
+}
+
+template<X86_VEXT vext>
+static bool simdHasNonZeroLevel( const TCoeff* src, const int numCoeffs, const int* quantCoeff, const int defaultQuantCoeff, const int64_t add, const int qBits )
+{
+  bool nonZero = false;
+  int  n       = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    n = hasNonZeroLevelSIMD<QuantAVX2Ops>( src, numCoeffs, quantCoeff, defaultQuantCoeff, add, qBits, nonZero );
+  }
+#endif
+  if( !nonZero )
+  {
+    n += hasNonZeroLevelSIMD<QuantSSEOps>( src + n, numCoeffs - n, quantCoeff ? quantCoeff + n : nullptr, defaultQuantCoeff, add, qBits, nonZero );
+  }
+  return nonZero || ( n < numCoeffs && Quant::hasNonZeroLevel( src + n, numCoeffs - n, quantCoeff ? quantCoeff + n : nullptr, defaultQuantCoeff, add, qBits ) );
+}
+
+template<typename OPS>
+static inline int estimateRdoqLevelsSIMD( const TCoeff* src, Intermediate_Int* levelDouble, TCoeff* maxAbsLevel, double* uncodedCost, const int numCoeffs, const int* quantCoeff,
+                                          const double* errScale, const int defaultQuantCoeff, const double defaultErrScale, const int qBits, const TCoeff entropyCodingMaximum,
+                                          bool& nonZero )
+{
+  typedef typename OPS::T T;
+
+  const Intermediate_Int half = Intermediate_Int( 1 ) << ( qBits - 1 );
+  const __m128i vqBits = _mm_cvtsi32_si128( qBits );
+  const T       vlimit = OPS::Set64( std::numeric_limits<Intermediate_Int>::max() - half );
+  const T       vhalf  = OPS::Set( half );
+  const T       vmax   = OPS::Set( entropyCodingMaximum );
+  T             vscale = OPS::Set( defaultQuantCoeff );
+  T             vnz    = OPS::Zero();
+
+  int n = 0;
+  for( ; n + OPS::lanes <= numCoeffs; n += OPS::lanes )
+  {
+    const T absLevel = OPS::Abs( OPS::Load( src + n ) );
+    if( quantCoeff )
+    {
+      vscale = OPS::Load( quantCoeff + n );
+    }
+    const T tmpEven = OPS::Min64( OPS::MulEven( absLevel, vscale ), vlimit );
+    const T tmpOdd  = OPS::Min64( OPS::MulOdd ( absLevel, vscale ), vlimit );
+    const T level   = OPS::Combine( tmpEven, tmpOdd );
+    const T maxAbs  = OPS::Min( vmax, OPS::Sra( OPS::Add( level, vhalf ), vqBits ) );
+
+    vnz = OPS::Or( vnz, maxAbs );
+    OPS::Store( levelDouble + n, level );
+    OPS::Store( maxAbsLevel + n, maxAbs );
+    OPS::StoreCost( uncodedCost + n, level, errScale ? errScale + n : nullptr, defaultErrScale );
+  }
+
+  nonZero |= !OPS::IsZero( vnz );
+  return n;
+}
+
+template<X86_VEXT vext>
+static bool simdEstimateRdoqLevels( const TCoeff* src, Intermediate_Int* levelDouble, TCoeff* maxAbsLevel, double* uncodedCost, const int numCoeffs, const int* quantCoeff,
+                                    const double* errScale, const int defaultQuantCoeff, const double defaultErrScale, const int qBits, const TCoeff entropyCodingMaximum )
+{
+  bool nonZero = false;
+  int  n       = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    n = estimateRdoqLevelsSIMD<QuantAVX2Ops>( src, levelDouble, maxAbsLevel, uncodedCost, numCoeffs, quantCoeff, errScale, defaultQuantCoeff, defaultErrScale, qBits,
+                                              entropyCodingMaximum, nonZero );
+  }
+#endif
+  n += estimateRdoqLevelsSIMD<QuantSSEOps>( src + n, levelDouble + n, maxAbsLevel + n, uncodedCost + n, numCoeffs - n, quantCoeff ? quantCoeff + n : nullptr,
+                                            errScale ? errScale + n : nullptr, defaultQuantCoeff, defaultErrScale, qBits, entropyCodingMaximum, nonZero );
+  if( n < numCoeffs )
+  {
+    nonZero |= Quant::estimateRdoqLevels( src + n, levelDouble + n, maxAbsLevel + n, uncodedCost + n, numCoeffs - n, quantCoeff ? quantCoeff + n : nullptr,
+                                          errScale ? errScale + n : nullptr, defaultQuantCoeff, defaultErrScale, qBits, entropyCodingMaximum );
+  }
+  return nonZero;
+}
+
+template <X86_VEXT vext>
+void Quant::_initQuantX86()
+{
+  m_quantBlock         = simdQuantBlock<vext>;
+  m_dequantBlock       = simdDequantBlock<vext>;
+  m_hasNonZeroLevel    = simdHasNonZeroLevel<vext>;
+  m_estimateRdoqLevels = simdEstimateRdoqLevels<vext>;
+}
+
+template void Quant::_initQuantX86<SIMDX86>();
+
+//! \}
+
+#endif   // TARGET_SIMD_X86
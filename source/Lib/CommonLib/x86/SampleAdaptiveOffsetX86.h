@@ -0,0 +1,309 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SampleAdaptiveOffsetX86.h
+    \brief    SIMD kernels of the sample adaptive offset
+*/
+
+#include "CommonDefX86.h"
+#include "../SampleAdaptiveOffset.h"
+
+#ifdef TARGET_SIMD_X86
+#if defined _MSC_VER
+#include <tmmintrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+//! \ingroup CommonLib
+//! \{
+
+// sgn( c - a ) of 16 bit samples
+static inline __m128i signDiff( const __m128i c, const __m128i a )
+{
+  return _mm_sub_epi16( _mm_cmpgt_epi16( a, c ), _mm_cmpgt_epi16( c, a ) );
+}
+
+// byte indices of the 16 bit table entries idx, idx in 0..7
+static inline __m128i tableIdx( const __m128i idx )
+{
+  const __m128i idx2 = _mm_slli_epi16( idx, 1 );
+  return _mm_add_epi16( _mm_or_si128( idx2, _mm_slli_epi16( idx2, 8 ) ), _mm_set1_epi16( 0x0100 ) );
+}
+
+static inline int sumEpi32( const __m128i v )
+{
+  const __m128i s = _mm_add_epi32( v, _mm_shuffle_epi32( v, 0x4e ) );
+  return _mm_cvtsi128_si32( _mm_add_epi32( s, _mm_shuffle_epi32( s, 0xb1 ) ) );
+}
+
+#ifdef USE_AVX2
+static inline __m256i signDiff( const __m256i c, const __m256i a )
+{
+  return _mm256_sub_epi16( _mm256_cmpgt_epi16( a, c ), _mm256_cmpgt_epi16( c, a ) );
+}
+
+static inline __m256i tableIdx( const __m256i idx )
+{
+  const __m256i idx2 = _mm256_slli_epi16( idx, 1 );
+  return _mm256_add_epi16( _mm256_or_si256( idx2, _mm256_slli_epi16( idx2, 8 ) ), _mm256_set1_epi16( 0x0100 ) );
+}
+
+static inline __m128i foldEpi32( const __m256i v )
+{
+  return _mm_add_epi32( _mm256_castsi256_si128( v ), _mm256_extracti128_si256( v, 1 ) );
+}
+#endif
+
+template<X86_VEXT vext>
+static void simdOffsetEdgeRow( const Pel* src, const Pel* srcA, const Pel* srcB, Pel* res, const int startX, const int endX, const int* offset, const ClpRng& clpRng )
+{
+  // the offsets of the edge classes -2..2 as a shuffle table
+  const __m128i table = _mm_setr_epi16( offset[0], offset[1], offset[2], offset[3], offset[4], 0, 0, 0 );
+
+  int x = startX;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    const __m256i table256 = _mm256_broadcastsi128_si256( table );
+    const __m256i vmin     = _mm256_set1_epi16( clpRng.min );
+    const __m256i vmax     = _mm256_set1_epi16( clpRng.max );
+    const __m256i bias     = _mm256_set1_epi16( 2 );
+
+    for( ; x + 16 <= endX; x += 16 )
+    {
+      const __m256i c    = _mm256_loadu_si256( ( const __m256i* ) ( src  + x ) );
+      const __m256i a    = _mm256_loadu_si256( ( const __m256i* ) ( srcA + x ) );
+      const __m256i b    = _mm256_loadu_si256( ( const __m256i* ) ( srcB + x ) );
+      const __m256i edge = _mm256_add_epi16( _mm256_add_epi16( signDiff( c, a ), signDiff( c, b ) ), bias );
+      const __m256i off  = _mm256_shuffle_epi8( table256, tableIdx( edge ) );
+      _mm256_storeu_si256( ( __m256i* ) ( res + x ), _mm256_min_epi16( _mm256_max_epi16( _mm256_add_epi16( c, off ), vmin ), vmax ) );
+    }
+  }
+#endif
+  {
+    const __m128i vmin = _mm_set1_epi16( clpRng.min );
+    const __m128i vmax = _mm_set1_epi16( clpRng.max );
+    const __m128i bias = _mm_set1_epi16( 2 );
+
+    for( ; x + 8 <= endX; x += 8 )
+    {
+      const __m128i c    = _mm_loadu_si128( ( const __m128i* ) ( src  + x ) );
+      const __m128i a    = _mm_loadu_si128( ( const __m128i* ) ( srcA + x ) );
+      const __m128i b    = _mm_loadu_si128( ( const __m128i* ) ( srcB + x ) );
+      const __m128i edge = _mm_add_epi16( _mm_add_epi16( signDiff( c, a ), signDiff( c, b ) ), bias );
+      const __m128i off  = _mm_shuffle_epi8( table, tableIdx( edge ) );
+      _mm_storeu_si128( ( __m128i* ) ( res + x ), _mm_min_epi16( _mm_max_epi16( _mm_add_epi16( c, off ), vmin ), vmax ) );
+    }
+  }
+
+  for( ; x < endX; x++ )
+  {
+    const int edgeType = sgn( src[x] - srcA[x] ) + sgn( src[x] - srcB[x] );
+    res[x] = ClipPel<int>( src[x] + offset[edgeType + 2], clpRng );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdOffsetBandRow( const Pel* src, Pel* res, const int width, const int shiftBits, const int* offset, const ClpRng& clpRng )
+{
+  // only a few bands carry an offset, add them band by band
+  int bands[NUM_SAO_BO_CLASSES];
+  int numBands = 0;
+  for( int i = 0; i < NUM_SAO_BO_CLASSES; i++ )
+  {
+    if( offset[i] )
+    {
+      bands[numBands++] = i;
+    }
+  }
+
+  const __m128i vmin = _mm_set1_epi16( clpRng.min );
+  const __m128i vmax = _mm_set1_epi16( clpRng.max );
+
+  int x = 0;
+  for( ; x + 8 <= width; x += 8 )
+  {
+    const __m128i c    = _mm_loadu_si128( ( const __m128i* ) ( src + x ) );
+    const __m128i band = _mm_srai_epi16( c, shiftBits );
+    __m128i       sum  = c;
+    for( int i = 0; i < numBands; i++ )
+    {
+      sum = _mm_add_epi16( sum, _mm_and_si128( _mm_cmpeq_epi16( band, _mm_set1_epi16( bands[i] ) ), _mm_set1_epi16( offset[bands[i]] ) ) );
+    }
+    _mm_storeu_si128( ( __m128i* ) ( res + x ), _mm_min_epi16( _mm_max_epi16( sum, vmin ), vmax ) );
+  }
+
+  for( ; x < width; x++ )
+  {
+    res[x] = ClipPel<int>( src[x] + offset[src[x] >> shiftBits], clpRng );
+  }
+}
+
+template<X86_VEXT vext>
+static void simdEdgeStatsRow( const Pel* src, const Pel* srcA, const Pel* srcB, const Pel* org, const int startX, const int endX, int64_t* diff, int64_t* count )
+{
+  // per class sums of org - src in 32 bit lanes and the negated counts in 16 bit lanes
+  __m128i diffSum[NUM_SAO_EO_CLASSES];
+  __m128i cntSum [NUM_SAO_EO_CLASSES];
+  for( int k = 0; k < NUM_SAO_EO_CLASSES; k++ )
+  {
+    diffSum[k] = _mm_setzero_si128();
+    cntSum [k] = _mm_setzero_si128();
+  }
+
+  int x = startX;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    __m256i diffSum256[NUM_SAO_EO_CLASSES];
+    __m256i cntSum256 [NUM_SAO_EO_CLASSES];
+    for( int k = 0; k < NUM_SAO_EO_CLASSES; k++ )
+    {
+      diffSum256[k] = _mm256_setzero_si256();
+      cntSum256 [k] = _mm256_setzero_si256();
+    }
+    const __m256i ones = _mm256_set1_epi16( 1 );
+
+    for( ; x + 16 <= endX; x += 16 )
+    {
+      const __m256i c    = _mm256_loadu_si256( ( const __m256i* ) ( src  + x ) );
+      const __m256i a    = _mm256_loadu_si256( ( const __m256i* ) ( srcA + x ) );
+      const __m256i b    = _mm256_loadu_si256( ( const __m256i* ) ( srcB + x ) );
+      const __m256i o    = _mm256_loadu_si256( ( const __m256i* ) ( org  + x ) );
+      const __m256i edge = _mm256_add_epi16( signDiff( c, a ), signDiff( c, b ) );
+      const __m256i d    = _mm256_sub_epi16( o, c );
+      for( int k = 0; k < NUM_SAO_EO_CLASSES; k++ )
+      {
+        const __m256i mask = _mm256_cmpeq_epi16( edge, _mm256_set1_epi16( k - 2 ) );
+        diffSum256[k] = _mm256_add_epi32( diffSum256[k], _mm256_madd_epi16( _mm256_and_si256( d, mask ), ones ) );
+        cntSum256 [k] = _mm256_sub_epi16( cntSum256[k], mask );
+      }
+    }
+    for( int k = 0; k < NUM_SAO_EO_CLASSES; k++ )
+    {
+      diffSum[k] = foldEpi32( diffSum256[k] );
+      cntSum [k] = foldEpi32( _mm256_madd_epi16( cntSum256[k], ones ) );
+    }
+  }
+  else
+#endif
+  {
+    const __m128i ones = _mm_set1_epi16( 1 );
+
+    for( ; x + 8 <= endX; x += 8 )
+    {
+      const __m128i c    = _mm_loadu_si128( ( const __m128i* ) ( src  + x ) );
+      const __m128i a    = _mm_loadu_si128( ( const __m128i* ) ( srcA + x ) );
+      const __m128i b    = _mm_loadu_si128( ( const __m128i* ) ( srcB + x ) );
+      const __m128i o    = _mm_loadu_si128( ( const __m128i* ) ( org  + x ) );
+      const __m128i edge = _mm_add_epi16( signDiff( c, a ), signDiff( c, b ) );
+      const __m128i d    = _mm_sub_epi16( o, c );
+      for( int k = 0; k < NUM_SAO_EO_CLASSES; k++ )
+      {
+        const __m128i mask = _mm_cmpeq_epi16( edge, _mm_set1_epi16( k - 2 ) );
+        diffSum[k] = _mm_add_epi32( diffSum[k], _mm_madd_epi16( _mm_and_si128( d, mask ), ones ) );
+        cntSum [k] = _mm_sub_epi16( cntSum[k], mask );
+      }
+    }
+    for( int k = 0; k < NUM_SAO_EO_CLASSES; k++ )
+    {
+      cntSum[k] = _mm_madd_epi16( cntSum[k], ones );
+    }
+  }
+
+  for( int k = 0; k < NUM_SAO_EO_CLASSES; k++ )
+  {
+    diff [k] += sumEpi32( diffSum[k] );
+    count[k] += sumEpi32( cntSum[k] );
+  }
+
+  for( ; x < endX; x++ )
+  {
+    const int edgeType = sgn( src[x] - srcA[x] ) + sgn( src[x] - srcB[x] ) + 2;
+    diff [edgeType] += org[x] - src[x];
+    count[edgeType]++;
+  }
+}
+
+template<X86_VEXT vext>
+static void simdBandStatsRow( const Pel* src, const Pel* org, const int startX, const int endX, const int shiftBits, int64_t* diff, int64_t* count )
+{
+  // the band indices and differences are derived 8 samples at a time and gathered in 32 bit histograms
+  int     diffHist [NUM_SAO_BO_CLASSES] = { 0 };
+  int     countHist[NUM_SAO_BO_CLASSES] = { 0 };
+  int16_t band[8];
+  int16_t d[8];
+
+  int x = startX;
+  for( ; x + 8 <= endX; x += 8 )
+  {
+    const __m128i c = _mm_loadu_si128( ( const __m128i* ) ( src + x ) );
+    const __m128i o = _mm_loadu_si128( ( const __m128i* ) ( org + x ) );
+    _mm_storeu_si128( ( __m128i* ) band, _mm_srai_epi16( c, shiftBits ) );
+    _mm_storeu_si128( ( __m128i* ) d, _mm_sub_epi16( o, c ) );
+    for( int i = 0; i < 8; i++ )
+    {
+      diffHist [band[i]] += d[i];
+      countHist[band[i]]++;
+    }
+  }
+
+  for( ; x < endX; x++ )
+  {
+    const int bandIdx = src[x] >> shiftBits;
+    diffHist [bandIdx] += org[x] - src[x];
+    countHist[bandIdx]++;
+  }
+
+  for( int i = 0; i < NUM_SAO_BO_CLASSES; i++ )
+  {
+    diff [i] += diffHist[i];
+    count[i] += countHist[i];
+  }
+}
+
+template <X86_VEXT vext>
+void SampleAdaptiveOffset::_initSampleAdaptiveOffsetX86()
+{
+  m_offsetEdgeRow = simdOffsetEdgeRow<vext>;
+  m_offsetBandRow = simdOffsetBandRow<vext>;
+  m_edgeStatsRow  = simdEdgeStatsRow<vext>;
+  m_bandStatsRow  = simdBandStatsRow<vext>;
+}
+
+template void SampleAdaptiveOffset::_initSampleAdaptiveOffsetX86<SIMDX86>();
+
+//! \}
+
+#endif   // TARGET_SIMD_X86
@@ -0,0 +1,597 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2017, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TrQuantX86.h
+    \brief    SIMD versions of the 1-D DCT-II, DST-VII and DCT-VIII transforms and of the LFNST
+*/
+
+#include "CommonDefX86.h"
+#include "../TrQuant.h"
+#include "../TrQuant_EMT.h"
+#include "../Rom.h"
+
+#ifdef TARGET_SIMD_X86
+#if defined _MSC_VER
+#include <tmmintrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+//! \ingroup CommonLib
+//! \{
+
+// 32 bit lane operations, one lane per transformed line
+struct TrSSEOps
+{
+  typedef __m128i T;
+  static inline T Set ( int c )                 { return _mm_set1_epi32  ( c ); }
+  static inline T Zero()                        { return _mm_setzero_si128(); }
+  static inline T Add ( T a, T b )              { return _mm_add_epi32   ( a, b ); }
+  static inline T Sub ( T a, T b )              { return _mm_sub_epi32   ( a, b ); }
+  static inline T Mul ( T a, T b )              { return _mm_mullo_epi32 ( a, b ); }
+  static inline T Min ( T a, T b )              { return _mm_min_epi32   ( a, b ); }
+  static inline T Max ( T a, T b )              { return _mm_max_epi32   ( a, b ); }
+  static inline T Sra ( T a, __m128i count )    { return _mm_sra_epi32   ( a, count ); }
+
+  static const int lanes = 4;
+  static inline T    Load ( const TCoeff* src )     { return _mm_loadu_si128( ( const __m128i* ) src ); }
+  static inline void Store( TCoeff* dst, T a )      { _mm_storeu_si128( ( __m128i* ) dst, a ); }
+
+  // 4x4 transpose, v[c] holds sample c of the lines 0..3
+  static inline void Transpose( T* v )
+  {
+    const __m128i t0 = _mm_unpacklo_epi32( v[0], v[1] );
+    const __m128i t1 = _mm_unpacklo_epi32( v[2], v[3] );
+    const __m128i t2 = _mm_unpackhi_epi32( v[0], v[1] );
+    const __m128i t3 = _mm_unpackhi_epi32( v[2], v[3] );
+    v[0] = _mm_unpacklo_epi64( t0, t1 );
+    v[1] = _mm_unpackhi_epi64( t0, t1 );
+    v[2] = _mm_unpacklo_epi64( t2, t3 );
+    v[3] = _mm_unpackhi_epi64( t2, t3 );
+  }
+  // samples 0..3 of each line, the lines are stride apart
+  static inline void LoadTransposed( const TCoeff* src, const int stride, T* v )
+  {
+    for( int l = 0; l < 4; l++ )
+    {
+      v[l] = _mm_loadu_si128( ( const __m128i* ) ( src + l * stride ) );
+    }
+    Transpose( v );
+  }
+  static inline void StoreTransposed( TCoeff* dst, const int stride, const T* v )
+  {
+    __m128i t[4] = { v[0], v[1], v[2], v[3] };
+    Transpose( t );
+    for( int l = 0; l < 4; l++ )
+    {
+      _mm_storeu_si128( ( __m128i* ) ( dst + l * stride ), t[l] );
+    }
+  }
+};
+
+#ifdef USE_AVX2
+struct TrAVX2Ops
+{
+  typedef __m256i T;
+  static inline T Set ( int c )                 { return _mm256_set1_epi32  ( c ); }
+  static inline T Zero()                        { return _mm256_setzero_si256(); }
+  static inline T Add ( T a, T b )              { return _mm256_add_epi32   ( a, b ); }
+  static inline T Sub ( T a, T b )              { return _mm256_sub_epi32   ( a, b ); }
+  static inline T Mul ( T a, T b )              { return _mm256_mullo_epi32 ( a, b ); }
+  static inline T Min ( T a, T b )              { return _mm256_min_epi32   ( a, b ); }
+  static inline T Max ( T a, T b )              { return _mm256_max_epi32   ( a, b ); }
+  static inline T Sra ( T a, __m128i count )    { return _mm256_sra_epi32   ( a, count ); }
+
+  static const int lanes = 8;
+  static inline T    Load ( const TCoeff* src )     { return _mm256_loadu_si256( ( const __m256i* ) src ); }
+  static inline void Store( TCoeff* dst, T a )      { _mm256_storeu_si256( ( __m256i* ) dst, a ); }
+
+  // the lines 0..3 are transposed in the low and the lines 4..7 in the high lane
+  static inline void LoadTransposed( const TCoeff* src, const int stride, T* v )
+  {
+    __m128i lo[4], hi[4];
+    TrSSEOps::LoadTransposed( src,              stride, lo );
+    TrSSEOps::LoadTransposed( src + 4 * stride, stride, hi );
+    for( int c = 0; c < 4; c++ )
+    {
+      v[c] = _mm256_inserti128_si256( _mm256_castsi128_si256( lo[c] ), hi[c], 1 );
+    }
+  }
+  static inline void StoreTransposed( TCoeff* dst, const int stride, const T* v )
+  {
+    __m128i lo[4], hi[4];
+    for( int c = 0; c < 4; c++ )
+    {
+      lo[c] = _mm256_castsi256_si128( v[c] );
+      hi[c] = _mm256_extracti128_si256( v[c], 1 );
+    }
+    TrSSEOps::StoreTransposed( dst,              stride, lo );
+    TrSSEOps::StoreTransposed( dst + 4 * stride, stride, hi );
+  }
+};
+#endif
+
+// Partial butterfly of the n-point DCT-II inside the N-point one, the rows ( N / n ) * r of the N-point matrix
+// belong to it. The lanes are computed with wrapping 32 bit arithmetic, so any order of the sums gives the same
+// results as the scalar butterflies.
+template<typename OPS, int n>
+struct TrDCT2Butterfly
+{
+  typedef typename OPS::T T;
+
+  // res[r] = sum_k M[r][k] * in[k] for the rows r < rowLimit
+  static inline void fwd( const T* in, T* res, const TMatrixCoeff* M, const int N, const int rowLimit )
+  {
+    T E[n / 2], O[n / 2];
+    for( int k = 0; k < n / 2; k++ )
+    {
+      E[k] = OPS::Add( in[k], in[n - 1 - k] );
+      O[k] = OPS::Sub( in[k], in[n - 1 - k] );
+    }
+
+    const int step = N / n;
+    for( int r = step; r < rowLimit; r += 2 * step )
+    {
+      const TMatrixCoeff* m = M + r * N;
+      T acc = OPS::Mul( O[0], OPS::Set( m[0] ) );
+      for( int k = 1; k < n / 2; k++ )
+      {
+        acc = OPS::Add( acc, OPS::Mul( O[k], OPS::Set( m[k] ) ) );
+      }
+      res[r] = acc;
+    }
+
+    TrDCT2Butterfly<OPS, n / 2>::fwd( E, res, M, N, rowLimit );
+  }
+
+  // out[j] = sum_r M[r][j] * in[r] for the inputs r < kLimit
+  static inline void inv( const T* in, T* out, const TMatrixCoeff* M, const int N, const int kLimit )
+  {
+    T E[n / 2], O[n / 2];
+    for( int j = 0; j < n / 2; j++ )
+    {
+      O[j] = OPS::Zero();
+    }
+
+    const int step = N / n;
+    for( int r = step; r < kLimit; r += 2 * step )
+    {
+      const TMatrixCoeff* m = M + r * N;
+      for( int j = 0; j < n / 2; j++ )
+      {
+        O[j] = OPS::Add( O[j], OPS::Mul( in[r], OPS::Set( m[j] ) ) );
+      }
+    }
+
+    TrDCT2Butterfly<OPS, n / 2>::inv( in, E, M, N, kLimit );
+
+    for( int j = 0; j < n / 2; j++ )
+    {
+      out[j]         = OPS::Add( E[j], O[j] );
+      out[n - 1 - j] = OPS::Sub( E[j], O[j] );
+    }
+  }
+};
+
+template<typename OPS>
+struct TrDCT2Butterfly<OPS, 1>
+{
+  typedef typename OPS::T T;
+
+  static inline void fwd( const T* in, T* res, const TMatrixCoeff* M, const int N, const int rowLimit )
+  {
+    res[0] = OPS::Mul( in[0], OPS::Set( M[0] ) );
+  }
+  static inline void inv( const T* in, T* out, const TMatrixCoeff* M, const int N, const int kLimit )
+  {
+    out[0] = OPS::Mul( in[0], OPS::Set( M[0] ) );
+  }
+};
+
+// forward transform of OPS::lanes lines, src points to the first sample of the first line and dst to its first coefficient
+template<typename OPS, int N, bool isDCT2>
+static inline void fwdTransLines( const TCoeff* src, TCoeff* dst, const int shift, const int line, const int numRows, const TMatrixCoeff* M )
+{
+  typedef typename OPS::T T;
+
+  T col[N], res[N];
+  for( int k = 0; k < N; k += 4 )
+  {
+    OPS::LoadTransposed( src + k, N, col + k );
+  }
+
+  if( isDCT2 )
+  {
+    TrDCT2Butterfly<OPS, N>::fwd( col, res, M, N, numRows );
+  }
+  else
+  {
+    for( int r = 0; r < numRows; r++ )
+    {
+      const TMatrixCoeff* m = M + r * N;
+      T acc = OPS::Mul( col[0], OPS::Set( m[0] ) );
+      for( int k = 1; k < N; k++ )
+      {
+        acc = OPS::Add( acc, OPS::Mul( col[k], OPS::Set( m[k] ) ) );
+      }
+      res[r] = acc;
+    }
+  }
+
+  const T       add   = OPS::Set( shift > 0 ? 1 << ( shift - 1 ) : 0 );
+  const __m128i count = _mm_cvtsi32_si128( shift );
+  for( int r = 0; r < numRows; r++ )
+  {
+    OPS::Store( dst + r * line, OPS::Sra( OPS::Add( res[r], add ), count ) );
+  }
+}
+
+// inverse transform of OPS::lanes lines, src points to the first coefficient of the first line and dst to its first sample
+template<typename OPS, int N, bool isDCT2>
+static inline void invTransLines( const TCoeff* src, TCoeff* dst, const int shift, const int line, const int kLimit, const TMatrixCoeff* M,
+                                  const TCoeff outputMinimum, const TCoeff outputMaximum )
+{
+  typedef typename OPS::T T;
+
+  T in[N], out[N];
+  for( int k = 0; k < kLimit; k++ )
+  {
+    in[k] = OPS::Load( src + k * line );
+  }
+
+  if( isDCT2 )
+  {
+    TrDCT2Butterfly<OPS, N>::inv( in, out, M, N, kLimit );
+  }
+  else
+  {
+    for( int j = 0; j < N; j++ )
+    {
+      T acc = OPS::Zero();
+      for( int k = 0; k < kLimit; k++ )
+      {
+        acc = OPS::Add( acc, OPS::Mul( in[k], OPS::Set( M[k * N + j] ) ) );
+      }
+      out[j] = acc;
+    }
+  }
+
+  const T       add   = OPS::Set( 1 << ( shift - 1 ) );
+  const T       vmin  = OPS::Set( outputMinimum );
+  const T       vmax  = OPS::Set( outputMaximum );
+  const __m128i count = _mm_cvtsi32_si128( shift );
+  for( int j = 0; j < N; j++ )
+  {
+    out[j] = OPS::Min( vmax, OPS::Max( vmin, OPS::Sra( OPS::Add( out[j], add ), count ) ) );
+  }
+  for( int j = 0; j < N; j += 4 )
+  {
+    OPS::StoreTransposed( dst + j, N, out + j );
+  }
+}
+
+static inline const TMatrixCoeff* getTrMatrix( const int trType, const int N, const int dir )
+{
+  switch( trType )
+  {
+  case DCT2:
+    return N == 4 ? g_trCoreDCT2P4[dir][0] : N == 8 ? g_trCoreDCT2P8[dir][0] : N == 16 ? g_trCoreDCT2P16[dir][0] : N == 32 ? g_trCoreDCT2P32[dir][0] : g_trCoreDCT2P64[dir][0];
+  case DCT8:
+    return N == 4 ? g_trCoreDCT8P4[dir][0] : N == 8 ? g_trCoreDCT8P8[dir][0] : N == 16 ? g_trCoreDCT8P16[dir][0] : g_trCoreDCT8P32[dir][0];
+  default:
+    return N == 4 ? g_trCoreDST7P4[dir][0] : N == 8 ? g_trCoreDST7P8[dir][0] : N == 16 ? g_trCoreDST7P16[dir][0] : g_trCoreDST7P32[dir][0];
+  }
+}
+
+template<X86_VEXT vext, int trType, int N, FwdTrans* scalarTrans>
+static void simdFwdTrans( const TCoeff *src, TCoeff *dst, int shift, int line, int iSkipLine, int iSkipLine2 )
+{
+  const int reducedLine = line - iSkipLine;
+  if( reducedLine & 3 )
+  {
+    scalarTrans( src, dst, shift, line, iSkipLine, iSkipLine2 );
+    return;
+  }
+
+  // Like the scalar kernels, only the matrix based ones (DST-VII/DCT-VIII from 8 points) and the 64-point DCT-II zero
+  // out the iSkipLine2 highest coefficients, the latter computing at most 32 of them when iSkipLine2 is set.
+  const bool zeroOut = ( trType != DCT2 && N > 4 ) || N == 64;
+  const int  cutoff  = zeroOut ? N - iSkipLine2 : N;
+  const int  numRows = N == 64 && iSkipLine2 ? std::min( cutoff, 32 ) : cutoff;
+
+  const TMatrixCoeff* M = getTrMatrix( trType, N, TRANSFORM_FORWARD );
+
+  int i = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    for( ; i + TrAVX2Ops::lanes <= reducedLine; i += TrAVX2Ops::lanes )
+    {
+      fwdTransLines<TrAVX2Ops, N, trType == DCT2>( src + i * N, dst + i, shift, line, numRows, M );
+    }
+  }
+#endif
+  for( ; i < reducedLine; i += TrSSEOps::lanes )
+  {
+    fwdTransLines<TrSSEOps, N, trType == DCT2>( src + i * N, dst + i, shift, line, numRows, M );
+  }
+
+  if( iSkipLine )
+  {
+    for( int r = 0; r < cutoff; r++ )
+    {
+      memset( dst + r * line + reducedLine, 0, sizeof( TCoeff ) * iSkipLine );
+    }
+  }
+  if( zeroOut && iSkipLine2 )
+  {
+    memset( dst + line * cutoff, 0, sizeof( TCoeff ) * line * iSkipLine2 );
+  }
+}
+
+template<X86_VEXT vext, int trType, int N, InvTrans* scalarTrans>
+static void simdInvTrans( const TCoeff *src, TCoeff *dst, int shift, int line, int iSkipLine, int iSkipLine2, const TCoeff outputMinimum, const TCoeff outputMaximum )
+{
+  const int reducedLine = line - iSkipLine;
+  if( reducedLine & 3 )
+  {
+    scalarTrans( src, dst, shift, line, iSkipLine, iSkipLine2, outputMinimum, outputMaximum );
+    return;
+  }
+
+  // coefficients that take part, the 8-point matrix kernels leave out the iSkipLine2 highest ones and the 64-point
+  // DCT-II the upper half when at least 32 are zeroed out
+  const int kLimit = ( trType != DCT2 && N == 8 ) ? N - iSkipLine2 : ( N == 64 && iSkipLine2 >= 32 ) ? 32 : N;
+
+  const TMatrixCoeff* M = getTrMatrix( trType, N, TRANSFORM_INVERSE );
+
+  int i = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    for( ; i + TrAVX2Ops::lanes <= reducedLine; i += TrAVX2Ops::lanes )
+    {
+      invTransLines<TrAVX2Ops, N, trType == DCT2>( src + i, dst + i * N, shift, line, kLimit, M, outputMinimum, outputMaximum );
+    }
+  }
+#endif
+  for( ; i < reducedLine; i += TrSSEOps::lanes )
+  {
+    invTransLines<TrSSEOps, N, trType == DCT2>( src + i, dst + i * N, shift, line, kLimit, M, outputMinimum, outputMaximum );
+  }
+
+  if( iSkipLine )
+  {
+    memset( dst + reducedLine * N, 0, ( iSkipLine * N ) * sizeof( TCoeff ) );
+  }
+}
+
+// packs the n 32 bit values of src to 16 bit, returns false if any of them does not fit
+static inline bool packLfnstInput( const TCoeff* src, __m128i* src16, const int n )
+{
+  __m128i vmin = _mm_set1_epi32( std::numeric_limits<int16_t>::max() );
+  __m128i vmax = _mm_set1_epi32( std::numeric_limits<int16_t>::min() );
+  for( int i = 0; i < n; i += 8 )
+  {
+    const __m128i a = _mm_loadu_si128( ( const __m128i* ) ( src + i ) );
+    const __m128i b = _mm_loadu_si128( ( const __m128i* ) ( src + i + 4 ) );
+    vmin      = _mm_min_epi32( vmin, _mm_min_epi32( a, b ) );
+    vmax      = _mm_max_epi32( vmax, _mm_max_epi32( a, b ) );
+    src16[i >> 3] = _mm_packs_epi32( a, b );
+  }
+  const __m128i outOfRange = _mm_or_si128( _mm_cmplt_epi32( vmin, _mm_set1_epi32( std::numeric_limits<int16_t>::min() ) ),
+                                           _mm_cmpgt_epi32( vmax, _mm_set1_epi32( std::numeric_limits<int16_t>::max() ) ) );
+  return _mm_testz_si128( outOfRange, outOfRange );
+}
+
+template<X86_VEXT vext>
+static void simdFwdLfnst( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize )
+{
+  __m128i src16[6];
+  if( !packLfnstInput( src, src16, trSize ) )
+  {
+    TrQuant::fwdLfnst( src, dst, trMat, trSize, zeroOutSize );
+    return;
+  }
+
+  const int     numChunks = trSize >> 3;
+  const __m128i vadd      = _mm_set1_epi32( 64 );
+
+  // four output coefficients per iteration, the horizontal adds fold the madd partial sums of the four rows
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    __m256i src16x2[3];
+    for( int k = 0; k < numChunks; k += 2 )
+    {
+      src16x2[k >> 1] = _mm256_inserti128_si256( _mm256_castsi128_si256( src16[k] ), src16[k + 1], 1 );
+    }
+
+    for( int j = 0; j < zeroOutSize; j += 4 )
+    {
+      __m256i acc[4];
+      for( int r = 0; r < 4; r++ )
+      {
+        const int8_t* m = trMat + ( j + r ) * trSize;
+        acc[r] = _mm256_madd_epi16( src16x2[0], _mm256_cvtepi8_epi16( _mm_loadu_si128( ( const __m128i* ) m ) ) );
+        for( int k = 2; k < numChunks; k += 2 )
+        {
+          acc[r] = _mm256_add_epi32( acc[r], _mm256_madd_epi16( src16x2[k >> 1], _mm256_cvtepi8_epi16( _mm_loadu_si128( ( const __m128i* ) ( m + 8 * k ) ) ) ) );
+        }
+      }
+      __m256i sum = _mm256_hadd_epi32( _mm256_hadd_epi32( acc[0], acc[1] ), _mm256_hadd_epi32( acc[2], acc[3] ) );
+      __m128i res = _mm_add_epi32( _mm256_castsi256_si128( sum ), _mm256_extracti128_si256( sum, 1 ) );
+      _mm_storeu_si128( ( __m128i* ) ( dst + j ), _mm_srai_epi32( _mm_add_epi32( res, vadd ), 7 ) );
+    }
+  }
+  else
+#endif
+  {
+    for( int j = 0; j < zeroOutSize; j += 4 )
+    {
+      __m128i acc[4];
+      for( int r = 0; r < 4; r++ )
+      {
+        const int8_t* m = trMat + ( j + r ) * trSize;
+        acc[r] = _mm_madd_epi16( src16[0], _mm_cvtepi8_epi16( _mm_loadl_epi64( ( const __m128i* ) m ) ) );
+        for( int k = 1; k < numChunks; k++ )
+        {
+          acc[r] = _mm_add_epi32( acc[r], _mm_madd_epi16( src16[k], _mm_cvtepi8_epi16( _mm_loadl_epi64( ( const __m128i* ) ( m + 8 * k ) ) ) ) );
+        }
+      }
+      __m128i res = _mm_hadd_epi32( _mm_hadd_epi32( acc[0], acc[1] ), _mm_hadd_epi32( acc[2], acc[3] ) );
+      _mm_storeu_si128( ( __m128i* ) ( dst + j ), _mm_srai_epi32( _mm_add_epi32( res, vadd ), 7 ) );
+    }
+  }
+
+  ::memset( dst + zeroOutSize, 0, ( trSize - zeroOutSize ) * sizeof( TCoeff ) );
+}
+
+template<X86_VEXT vext>
+static void simdInvLfnst( const TCoeff* src, TCoeff* dst, const int8_t* trMat, const int trSize, const int zeroOutSize )
+{
+  __m128i src16[2];
+  if( !packLfnstInput( src, src16, zeroOutSize ) )
+  {
+    TrQuant::invLfnst( src, dst, trMat, trSize, zeroOutSize );
+    return;
+  }
+
+  const int     numChunks = trSize >> 4;
+  const __m128i vadd      = _mm_set1_epi32( 64 );
+  const __m128i vmin      = _mm_set1_epi32( std::numeric_limits<int16_t>::min() );
+  const __m128i vmax      = _mm_set1_epi32( std::numeric_limits<int16_t>::max() );
+
+  // two input coefficients per iteration, the rows i and i + 1 of the matrix are interleaved to pair with them in madd
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    __m256i acc[6];
+    for( int c = 0; c < 2 * numChunks; c++ )
+    {
+      acc[c] = _mm256_setzero_si256();
+    }
+    for( int i = 0; i < zeroOutSize; i += 2 )
+    {
+      const __m256i vsrc = _mm256_set1_epi32( ( src[i] & 0xffff ) | ( ( uint32_t ) src[i + 1] << 16 ) );
+      const int8_t* m0   = trMat + i * trSize;
+      const int8_t* m1   = m0 + trSize;
+      for( int c = 0; c < numChunks; c++ )
+      {
+        const __m128i a = _mm_loadu_si128( ( const __m128i* ) ( m0 + 16 * c ) );
+        const __m128i b = _mm_loadu_si128( ( const __m128i* ) ( m1 + 16 * c ) );
+        acc[2 * c    ] = _mm256_add_epi32( acc[2 * c    ], _mm256_madd_epi16( vsrc, _mm256_cvtepi8_epi16( _mm_unpacklo_epi8( a, b ) ) ) );
+        acc[2 * c + 1] = _mm256_add_epi32( acc[2 * c + 1], _mm256_madd_epi16( vsrc, _mm256_cvtepi8_epi16( _mm_unpackhi_epi8( a, b ) ) ) );
+      }
+    }
+    const __m256i vadd256 = _mm256_set1_epi32( 64 );
+    const __m256i vmin256 = _mm256_set1_epi32( std::numeric_limits<int16_t>::min() );
+    const __m256i vmax256 = _mm256_set1_epi32( std::numeric_limits<int16_t>::max() );
+    for( int c = 0; c < 2 * numChunks; c++ )
+    {
+      const __m256i res = _mm256_srai_epi32( _mm256_add_epi32( acc[c], vadd256 ), 7 );
+      _mm256_storeu_si256( ( __m256i* ) ( dst + 8 * c ), _mm256_min_epi32( vmax256, _mm256_max_epi32( vmin256, res ) ) );
+    }
+  }
+  else
+#endif
+  {
+    __m128i acc[12];
+    for( int c = 0; c < 4 * numChunks; c++ )
+    {
+      acc[c] = _mm_setzero_si128();
+    }
+    for( int i = 0; i < zeroOutSize; i += 2 )
+    {
+      const __m128i vsrc = _mm_set1_epi32( ( src[i] & 0xffff ) | ( ( uint32_t ) src[i + 1] << 16 ) );
+      const int8_t* m0   = trMat + i * trSize;
+      const int8_t* m1   = m0 + trSize;
+      for( int c = 0; c < numChunks; c++ )
+      {
+        const __m128i a  = _mm_loadu_si128( ( const __m128i* ) ( m0 + 16 * c ) );
+        const __m128i b  = _mm_loadu_si128( ( const __m128i* ) ( m1 + 16 * c ) );
+        const __m128i lo = _mm_unpacklo_epi8( a, b );
+        const __m128i hi = _mm_unpackhi_epi8( a, b );
+        acc[4 * c    ] = _mm_add_epi32( acc[4 * c    ], _mm_madd_epi16( vsrc, _mm_cvtepi8_epi16( lo ) ) );
+        acc[4 * c + 1] = _mm_add_epi32( acc[4 * c + 1], _mm_madd_epi16( vsrc, _mm_cvtepi8_epi16( _mm_srli_si128( lo, 8 ) ) ) );
+        acc[4 * c + 2] = _mm_add_epi32( acc[4 * c + 2], _mm_madd_epi16( vsrc, _mm_cvtepi8_epi16( hi ) ) );
+        acc[4 * c + 3] = _mm_add_epi32( acc[4 * c + 3], _mm_madd_epi16( vsrc, _mm_cvtepi8_epi16( _mm_srli_si128( hi, 8 ) ) ) );
+      }
+    }
+    for( int c = 0; c < 4 * numChunks; c++ )
+    {
+      const __m128i res = _mm_srai_epi32( _mm_add_epi32( acc[c], vadd ), 7 );
+      _mm_storeu_si128( ( __m128i* ) ( dst + 4 * c ), _mm_min_epi32( vmax, _mm_max_epi32( vmin, res ) ) );
+    }
+  }
+}
+
+template <X86_VEXT vext>
+void TrQuant::_initTrQuantX86()
+{
+#if ENABLE_SIMD_OPT_TRANSFORM
+  m_fwdTrans[DCT2][1] = simdFwdTrans<vext, DCT2,  4, fastForwardDCT2_B4 >;
+  m_fwdTrans[DCT2][2] = simdFwdTrans<vext, DCT2,  8, fastForwardDCT2_B8 >;
+  m_fwdTrans[DCT2][3] = simdFwdTrans<vext, DCT2, 16, fastForwardDCT2_B16>;
+  m_fwdTrans[DCT2][4] = simdFwdTrans<vext, DCT2, 32, fastForwardDCT2_B32>;
+  m_fwdTrans[DCT2][5] = simdFwdTrans<vext, DCT2, 64, fastForwardDCT2_B64>;
+  m_fwdTrans[DCT8][2] = simdFwdTrans<vext, DCT8,  8, fastForwardDCT8_B8 >;
+  m_fwdTrans[DCT8][3] = simdFwdTrans<vext, DCT8, 16, fastForwardDCT8_B16>;
+  m_fwdTrans[DCT8][4] = simdFwdTrans<vext, DCT8, 32, fastForwardDCT8_B32>;
+  m_fwdTrans[DST7][2] = simdFwdTrans<vext, DST7,  8, fastForwardDST7_B8 >;
+  m_fwdTrans[DST7][3] = simdFwdTrans<vext, DST7, 16, fastForwardDST7_B16>;
+  m_fwdTrans[DST7][4] = simdFwdTrans<vext, DST7, 32, fastForwardDST7_B32>;
+
+  m_invTrans[DCT2][1] = simdInvTrans<vext, DCT2,  4, fastInverseDCT2_B4 >;
+  m_invTrans[DCT2][2] = simdInvTrans<vext, DCT2,  8, fastInverseDCT2_B8 >;
+  m_invTrans[DCT2][3] = simdInvTrans<vext, DCT2, 16, fastInverseDCT2_B16>;
+  m_invTrans[DCT2][4] = simdInvTrans<vext, DCT2, 32, fastInverseDCT2_B32>;
+  m_invTrans[DCT2][5] = simdInvTrans<vext, DCT2, 64, fastInverseDCT2_B64>;
+  m_invTrans[DCT8][2] = simdInvTrans<vext, DCT8,  8, fastInverseDCT8_B8 >;
+  m_invTrans[DCT8][3] = simdInvTrans<vext, DCT8, 16, fastInverseDCT8_B16>;
+  m_invTrans[DCT8][4] = simdInvTrans<vext, DCT8, 32, fastInverseDCT8_B32>;
+  m_invTrans[DST7][2] = simdInvTrans<vext, DST7,  8, fastInverseDST7_B8 >;
+  m_invTrans[DST7][3] = simdInvTrans<vext, DST7, 16, fastInverseDST7_B16>;
+  m_invTrans[DST7][4] = simdInvTrans<vext, DST7, 32, fastInverseDST7_B32>;
+#endif
+#if ENABLE_SIMD_OPT_LFNST
+  m_fwdLfnst = simdFwdLfnst<vext>;
+  m_invLfnst = simdInvLfnst<vext>;
+#endif
+}
+
+template void TrQuant::_initTrQuantX86<SIMDX86>();
+
+//! \}
+
+#endif   // TARGET_SIMD_X86
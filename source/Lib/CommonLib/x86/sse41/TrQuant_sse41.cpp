@@ -0,0 +1 @@
+#include "../TrQuantX86.h"
@@ -43,15 +43,7 @@
 #include "CommonLib/SampleAdaptiveOffset.h"
 #include "CommonLib/dtrace_next.h"
 #include "CommonLib/Picture.h"
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-long long int timeOfCoding_tree = 0;
-long long int timeOfMvp_flag    = 0;
+#include "CommonLib/Profiler.h"
 
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
 #include "CommonLib/CodingStatistics.h"
@@ -144,7 +136,7 @@ void CABACReader::remaining_bytes( bool noTrailingBytesExpected )
 
 bool CABACReader::coding_tree_unit( CodingStructure& cs, const UnitArea& area, int (&qps)[2], unsigned ctuRsAddr )
 {
-  auto            start = high_resolution_clock::now();
+  PROFILE_ZONE( "CABACReader::coding_tree_unit" );
 
   CUCtx cuCtx( qps[CH_L] );
   QTBTPartitioner partitioner;
@@ -236,10 +228,6 @@ bool CABACReader::coding_tree_unit( CodingStructure& cs, const UnitArea& area, i
   DTRACE_COND( ctuRsAddr == 0, g_trace_ctx, D_QP_PER_CTU, "\n%4d %2d", cs.picture->poc, cs.slice->getSliceQpBase() );
   DTRACE     (                 g_trace_ctx, D_QP_PER_CTU, " %3d",           qps[CH_L] - cs.slice->getSliceQpBase() );
 
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfCoding_tree = timeOfCoding_tree + duration.count();
-
   return isLast;
 }
 
@@ -2463,16 +2451,13 @@ void CABACReader::ref_idx( PredictionUnit &pu, RefPicList eRefList )
 
 void CABACReader::mvp_flag( PredictionUnit& pu, RefPicList eRefList )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "CABACReader::mvp_flag" );
   RExt__DECODER_DEBUG_BIT_STATISTICS_CREATE_SET( STATS__CABAC_BITS__MVP_IDX );
 
   unsigned mvp_idx = m_BinDecoder.decodeBin( Ctx::MVPIdx() );
   DTRACE( g_trace_ctx, D_SYNTAX, "mvp_flag() value=%d pos=(%d,%d)\n", mvp_idx, pu.lumaPos().x, pu.lumaPos().y );
   pu.mvpIdx [eRefList] = mvp_idx;
   DTRACE( g_trace_ctx, D_SYNTAX, "mvpIdx(refList:%d)=%d\n", eRefList, mvp_idx );
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfMvp_flag   = timeOfMvp_flag + duration.count();
 }
 
 
@@ -44,9 +44,6 @@
 #include "CommonLib/MotionInfo.h"
 #include "CommonLib/UnitPartitioner.h"
 
-extern long long int timeOfCoding_tree;
-extern long long int timeOfMvp_flag;
-
 class CABACReader
 {
 public:
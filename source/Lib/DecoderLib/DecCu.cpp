@@ -51,15 +51,9 @@
 #if K0149_BLOCK_STATISTICS
 #include "CommonLib/ChromaFormat.h"
 #include "CommonLib/dtrace_blockstatistics.h"
+#include "CommonLib/Profiler.h"
 #endif
 
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
 //! \ingroup DecoderLib
 //! \{
 
@@ -67,10 +61,6 @@ using std::chrono::nanoseconds;
 // Constructor / destructor / create / destroy
 // ====================================================================================================================
 
-long long int timeOfXIntraRecBlk = 0;
-long long int timeOfXDecodeInterTexture = 0;
-long long int timeOfXReconIntraQT       = 0;
-
 DecCu::DecCu()
 {
   m_tmpStorageLCU = NULL;
@@ -131,7 +121,8 @@ void DecCu::decompressCtu( CodingStructure& cs, const UnitArea& ctuArea )
     Position prevTmpPos;
     prevTmpPos.x = -1; prevTmpPos.y = -1;
 
-    for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, chType ), chType ) )
+    // not CS::getArea(), the parser may be in a local dual tree of a CTU after this one
+    for( auto &currCU : cs.traverseCUs( CS::isDualITree( cs ) ? ctuArea.singleChan( chType ) : ctuArea, chType ) )
     {
       if(currCU.Y().valid())
       {
@@ -198,7 +189,7 @@ void DecCu::xIntraRecBlk( TransformUnit& tu, const ComponentID compID )
     return;
   }
 
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "DecCu::xIntraRecBlk" );
 
         CodingStructure &cs = *tu.cs;
   const CompArea &area      = tu.blocks[compID];
@@ -361,15 +352,11 @@ void DecCu::xIntraRecBlk( TransformUnit& tu, const ComponentID compID )
     cs.picture->getPredBuf(area).copyFrom(piPred);
   }
 #endif
-
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfXIntraRecBlk    = timeOfXIntraRecBlk + duration.count();
 }
 
 void DecCu::xReconIntraQT( CodingUnit &cu )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "DecCu::xReconIntraQT" );
   if (CU::isPLT(cu))
   {
     if (cu.isSepTree())
@@ -387,9 +374,6 @@ void DecCu::xReconIntraQT( CodingUnit &cu )
     {
       xReconPLT(cu, COMPONENT_Y, 3);
     }
-    auto stop        = high_resolution_clock::now();
-    auto duration    = duration_cast<nanoseconds>(stop - start);
-    timeOfXReconIntraQT = timeOfXReconIntraQT + duration.count();
 
     return;
   }
@@ -402,9 +386,6 @@ void DecCu::xReconIntraQT( CodingUnit &cu )
       xIntraRecQT( cu, ChannelType( chType ) );
     }
   }
-  auto stop           = high_resolution_clock::now();
-  auto duration       = duration_cast<nanoseconds>(stop - start);
-  timeOfXReconIntraQT = timeOfXReconIntraQT + duration.count();
 }
 
 void DecCu::xReconPLT(CodingUnit &cu, ComponentID compBegin, uint32_t numComp)
@@ -575,7 +556,7 @@ void DecCu::xReconInter(CodingUnit &cu)
     {
       MotionInfo mi = pu.getMotionInfo();
       mi.GBiIdx = (mi.interDir == 3) ? cu.GBiIdx : GBI_DEFAULT;
-      cu.cs->addMiToLut(CU::isIBC(cu) ? cu.cs->motionLut.lutIbc : cu.cs->motionLut.lut, mi );
+      cu.cs->addMiToLut(CU::isIBC(cu) ? cu.cs->getMotionLut( cu ).lutIbc : cu.cs->getMotionLut( cu ).lut, mi );
     }
   }
 
@@ -709,7 +690,7 @@ void DecCu::xDecodeInterTexture(CodingUnit &cu)
     return;
   }
 
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "DecCu::xDecodeInterTexture" );
 
   const uint32_t uiNumVaildComp = getNumberValidComponents(cu.chromaFormat);
 
@@ -730,9 +711,6 @@ void DecCu::xDecodeInterTexture(CodingUnit &cu)
       xDecodeInterTU( currTU, compID );
     }
   }
-  auto stop        = high_resolution_clock::now();
-  auto duration    = duration_cast<nanoseconds>(stop - start);
-  timeOfXDecodeInterTexture = timeOfXDecodeInterTexture + duration.count();
 }
 
 void DecCu::xDeriveCUMV( CodingUnit &cu )
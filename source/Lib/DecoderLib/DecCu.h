@@ -56,10 +56,6 @@
 // Class definition
 // ====================================================================================================================
 
-extern long long int timeOfXIntraRecBlk;
-extern long long int timeOfXDecodeInterTexture;
-extern long long int timeOfXReconIntraQT;
-
 /// CU decoder class
 class DecCu
 {
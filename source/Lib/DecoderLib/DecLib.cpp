@@ -42,6 +42,8 @@
 #include "CommonLib/dtrace_buffer.h"
 #include "CommonLib/Buffer.h"
 #include "CommonLib/UnitTools.h"
+#include "CommonLib/ApproximatAdderSubtraction.h"
+#include "CommonLib/Profiler.h"
 
 #include <fstream>
 #include <stdio.h>
@@ -381,16 +383,18 @@ DecLib::DecLib()
   , m_parameterSetManager()
   , m_apcSlicePilot(NULL)
   , m_SEIs()
-  , m_cIntraPred()
-  , m_cInterPred()
-  , m_cTrQuant()
+  , m_numThreads(1)
+  , m_cIntraPred(nullptr)
+  , m_cInterPred(nullptr)
+  , m_cTrQuant(nullptr)
   , m_cSliceDecoder()
-  , m_cCuDecoder()
+  , m_cCuDecoder(nullptr)
   , m_HLSReader()
   , m_seiReader()
   , m_cLoopFilter()
   , m_cSAO()
   , m_cReshaper()
+  , m_cRdCost(nullptr)
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   , m_cacheModel()
 #endif
@@ -432,6 +436,12 @@ void DecLib::create()
 {
   m_apcSlicePilot = new Slice;
   m_uiSliceSegmentIdx = 0;
+#if ENABLE_PROFILING
+  if( Profiler::getKernelStats() )
+  {
+    RdCost::initDistFuncStats();
+  }
+#endif
 }
 
 void DecLib::destroy()
@@ -440,6 +450,31 @@ void DecLib::destroy()
   m_apcSlicePilot = NULL;
 
   m_cSliceDecoder.destroy();
+
+  for( int tId = 0; m_cCuDecoder && tId < m_numThreads; tId++ )
+  {
+    m_cCuDecoder[tId].destoryDecCuReshaprBuf();
+  }
+  delete[] m_cIntraPred;
+  delete[] m_cInterPred;
+  delete[] m_cTrQuant;
+  delete[] m_cCuDecoder;
+  delete[] m_cRdCost;
+  m_cIntraPred = nullptr;
+  m_cInterPred = nullptr;
+  m_cTrQuant   = nullptr;
+  m_cCuDecoder = nullptr;
+  m_cRdCost    = nullptr;
+  m_cCuReshaper.clear();
+}
+
+/**
+ - select the approximate arithmetic profile, the MC and GBI sites have to match the encoder
+ */
+void DecLib::setApproxProfile( ApproxAdderType adder, int numberBits, int approximateCount, uint32_t sites )
+{
+  ::setApproxProfile( adder, numberBits, approximateCount, sites & ~( 1u << APPROX_SITE_ME ) );
+  g_pelBufOP.initApproxProfile( g_approxProfile );
 }
 
 void DecLib::init(
@@ -448,11 +483,18 @@ void DecLib::init(
 #endif
 )
 {
-  m_cSliceDecoder.init( &m_CABACDecoder, &m_cCuDecoder );
+  m_cIntraPred = new IntraPrediction[m_numThreads];
+  m_cInterPred = new InterPrediction[m_numThreads];
+  m_cTrQuant   = new TrQuant        [m_numThreads];
+  m_cCuDecoder = new DecCu          [m_numThreads];
+  m_cRdCost    = new RdCost         [m_numThreads];
+  m_cCuReshaper.resize( m_numThreads - 1 );
+
+  m_cSliceDecoder.init( &m_CABACDecoder, m_cCuDecoder, &m_cLoopFilter, &m_cSAO, &m_cALF, &m_cReshaper, m_numThreads );
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   m_cacheModel.create( cacheCfgFileName );
   m_cacheModel.clear( );
-  m_cInterPred.cacheAssign( &m_cacheModel );
+  m_cInterPred[0].cacheAssign( &m_cacheModel );
 #endif
   DTRACE_UPDATE( g_trace_ctx, std::make_pair( "final", 1 ) );
 }
@@ -477,7 +519,10 @@ void DecLib::deletePicBuffer ( )
   m_cacheModel.reportSequence( );
   m_cacheModel.destroy( );
 #endif
-  m_cCuDecoder.destoryDecCuReshaprBuf();
+  for( int tId = 0; m_cCuDecoder && tId < m_numThreads; tId++ )
+  {
+    m_cCuDecoder[tId].destoryDecCuReshaprBuf();
+  }
   m_cReshaper.destroy();
 }
 
@@ -555,13 +600,24 @@ void DecLib::executeLoopFilters()
 
   CodingStructure& cs = *m_pcPic->cs;
 
+  // a picture with a single slice is filtered CTU row by CTU row behind the reconstruction
+  const bool rowFiltered = m_cSliceDecoder.finishLoopFilters();
+
   if (cs.sps->getUseReshaper() && m_cReshaper.getSliceReshaperInfo().getUseSliceReshaper())
   {
       CHECK((m_cReshaper.getRecReshaped() == false), "Rec picture is not reshaped!");
-      m_pcPic->getRecoBuf(COMPONENT_Y).rspSignal(m_cReshaper.getInvLUT());
+      if( !rowFiltered )
+      {
+        m_pcPic->getRecoBuf(COMPONENT_Y).rspSignal(m_cReshaper.getInvLUT());
+      }
       m_cReshaper.setRecReshaped(false);
       m_cSAO.setReshaper(&m_cReshaper);
   }
+  if( rowFiltered )
+  {
+    m_pcPic->cs->slice->stopProcessingTimer();
+    return;
+  }
   // deblocking filter
   m_cLoopFilter.loopFilterPic( cs );
   CS::setRefinedMotionField(cs);
@@ -903,7 +959,8 @@ void DecLib::xActivateParameterSets()
     m_apcSlicePilot->applyReferencePictureListBasedMarking(m_cListPic, m_apcSlicePilot->getRPL0(), m_apcSlicePilot->getRPL1());
     m_pcPic->finalInit( *sps, *pps, apss, lmcsAPS, scalinglistAPS );
     m_parameterSetManager.getPPS(m_apcSlicePilot->getPPSId())->setNumBricksInPic((int)m_pcPic->brickMap->bricks.size());
-    m_pcPic->createTempBuffers( m_pcPic->cs->pps->pcv->maxCUWidth );
+    // the CTUs reconstructed in parallel need their own prediction and residual buffers
+    m_pcPic->createTempBuffers( m_pcPic->cs->pps->pcv->maxCUWidth, m_numThreads > 1 );
     m_pcPic->cs->createCoeffs();
 
     m_pcPic->allocateNewSlice();
@@ -931,8 +988,11 @@ void DecLib::xActivateParameterSets()
     // Initialise the various objects for the new set of settings
     m_cSAO.create( pps->getPicWidthInLumaSamples(), pps->getPicHeightInLumaSamples(), sps->getChromaFormatIdc(), sps->getMaxCUWidth(), sps->getMaxCUHeight(), sps->getMaxCodingDepth(), pps->getPpsRangeExtension().getLog2SaoOffsetScale( CHANNEL_TYPE_LUMA ), pps->getPpsRangeExtension().getLog2SaoOffsetScale( CHANNEL_TYPE_CHROMA ) );
     m_cLoopFilter.create( sps->getMaxCodingDepth() );
-    m_cIntraPred.init( sps->getChromaFormatIdc(), sps->getBitDepth( CHANNEL_TYPE_LUMA ) );
-    m_cInterPred.init( &m_cRdCost, sps->getChromaFormatIdc(), sps->getMaxCUHeight() );
+    for( int tId = 0; tId < m_numThreads; tId++ )
+    {
+      m_cIntraPred[tId].init( sps->getChromaFormatIdc(), sps->getBitDepth( CHANNEL_TYPE_LUMA ) );
+      m_cInterPred[tId].init( &m_cRdCost[tId], sps->getChromaFormatIdc(), sps->getMaxCUHeight() );
+    }
     if (sps->getUseReshaper())
     {
       m_cReshaper.createDec(sps->getBitDepth(CHANNEL_TYPE_LUMA));
@@ -962,15 +1022,18 @@ void DecLib::xActivateParameterSets()
     m_SEIs.clear();
 
     // Recursive structure
-    m_cCuDecoder.init( &m_cTrQuant, &m_cIntraPred, &m_cInterPred );
-    if (sps->getUseReshaper())
+    for( int tId = 0; tId < m_numThreads; tId++ )
     {
-      m_cCuDecoder.initDecCuReshaper(&m_cReshaper, sps->getChromaFormatIdc());
-    }
-    m_cTrQuant.init( nullptr, sps->getMaxTbSize(), false, false, false, false );
+      m_cCuDecoder[tId].init( &m_cTrQuant[tId], &m_cIntraPred[tId], &m_cInterPred[tId] );
+      if (sps->getUseReshaper())
+      {
+        m_cCuDecoder[tId].initDecCuReshaper(tId == 0 ? &m_cReshaper : &m_cCuReshaper[tId - 1], sps->getChromaFormatIdc());
+      }
+      m_cTrQuant[tId].init( nullptr, sps->getMaxTbSize(), false, false, false, false );
 
-    // RdCost
-    m_cRdCost.setCostMode ( COST_STANDARD_LOSSY ); // not used in decoder side RdCost stuff -> set to default
+      // RdCost
+      m_cRdCost[tId].setCostMode ( COST_STANDARD_LOSSY ); // not used in decoder side RdCost stuff -> set to default
+    }
 
     m_cSliceDecoder.create();
 
@@ -1484,26 +1547,29 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
     }
     pcSlice->checkConformanceForDRAP(nalu.m_temporalId);
 
-  Quant *quant = m_cTrQuant.getQuant();
-
-  if( pcSlice->getSPS()->getScalingListFlag() )
+  for( int tId = 0; tId < m_numThreads; tId++ )
   {
-    ScalingList scalingList;
-    if( pcSlice->getscalingListPresentFlag() )
+    Quant *quant = m_cTrQuant[tId].getQuant();
+
+    if( pcSlice->getSPS()->getScalingListFlag() )
     {
-      APS* scalingListAPS = pcSlice->getscalingListAPS();
-      scalingList = scalingListAPS->getScalingList();
+      ScalingList scalingList;
+      if( pcSlice->getscalingListPresentFlag() )
+      {
+        APS* scalingListAPS = pcSlice->getscalingListAPS();
+        scalingList = scalingListAPS->getScalingList();
+      }
+      else
+      {
+        scalingList.setDefaultScalingList();
+      }
+      quant->setScalingListDec( scalingList );
+      quant->setUseScalingList( true );
     }
     else
     {
-      scalingList.setDefaultScalingList();
+      quant->setUseScalingList( false );
     }
-    quant->setScalingListDec( scalingList );
-    quant->setUseScalingList( true );
-  }
-  else
-  {
-    quant->setUseScalingList( false );
   }
 
 
@@ -1572,6 +1638,10 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
     m_cReshaper.setCTUFlag(false);
     m_cReshaper.setRecReshaped(false);
   }
+  for( auto &reshaper: m_cCuReshaper )
+  {
+    reshaper = m_cReshaper;
+  }
 
   //  Decode a picture
   m_cSliceDecoder.decompressSlice( pcSlice, &( nalu.getBitstream() ), ( m_pcPic->poc == getDebugPOC() ? getDebugCTU() : -1 ) );
@@ -84,12 +84,13 @@ private:
 
   int                     m_iTargetLayer;                       ///< target stream layer to be decoded
 
-  // functional classes
-  IntraPrediction         m_cIntraPred;
-  InterPrediction         m_cInterPred;
-  TrQuant                 m_cTrQuant;
+  // functional classes, the CU reconstruction classes exist once per slice decoder thread
+  int                     m_numThreads;
+  IntraPrediction        *m_cIntraPred;
+  InterPrediction        *m_cInterPred;
+  TrQuant                *m_cTrQuant;
   DecSlice                m_cSliceDecoder;
-  DecCu                   m_cCuDecoder;
+  DecCu                  *m_cCuDecoder;
   HLSyntaxReader          m_HLSReader;
   CABACDecoder            m_CABACDecoder;
   SEIReader               m_seiReader;
@@ -97,9 +98,10 @@ private:
   SampleAdaptiveOffset    m_cSAO;
   AdaptiveLoopFilter      m_cALF;
   Reshape                 m_cReshaper;                        ///< reshaper class
+  std::vector<Reshape>    m_cCuReshaper;                      ///< copies of the reshaper for the CU decoders 1 .. m_numThreads-1
   HRD                     m_HRD;
   // decoder side RD cost computation
-  RdCost                  m_cRdCost;                      ///< RD cost computation class
+  RdCost                 *m_cRdCost;                      ///< RD cost computation class
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   CacheModel              m_cacheModel;
 #endif
@@ -139,6 +141,10 @@ public:
   void  destroy ();
 
   void  setDecodedPictureHashSEIEnabled(int enabled) { m_decodedPictureHashSEIEnabled=enabled; }
+  void  setApproxProfile( ApproxAdderType adder, int numberBits, int approximateCount, uint32_t sites );
+  // threads of the slice decoder, to be set before init()
+  void  setNumThreads   ( int numThreads ) { m_numThreads = numThreads; }
+  int   getNumThreads   ()           const { return m_numThreads; }
 
   void  init(
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
@@ -49,11 +49,33 @@
 //////////////////////////////////////////////////////////////////////
 
 DecSlice::DecSlice()
+  : m_CABACDecoder  ( nullptr )
+  , m_pcCuDecoder   ( nullptr )
+  , m_numThreads    ( 1 )
+  , m_quit          ( false )
+  , m_cs            ( nullptr )
+  , m_sliceStamp    ( 0 )
+  , m_numReleased   ( 0 )
+  , m_numDone       ( 0 )
+  , m_nextRow       ( 0 )
+  , m_parseDone     ( false )
+  , m_pcLoopFilter  ( nullptr )
+  , m_pcSAO         ( nullptr )
+  , m_pcALF         ( nullptr )
+  , m_pcReshape     ( nullptr )
+  , m_rowFilter     ( false )
+  , m_rowFilterReshape( false )
+  , m_rowFilterSAO  ( false )
+  , m_rowFilterALF  ( false )
+  , m_filterBusy    ( false )
+  , m_filterStep    ( 0 )
+  , m_numRowsDone   ( 0 )
 {
 }
 
 DecSlice::~DecSlice()
 {
+  destroy();
 }
 
 void DecSlice::create()
@@ -62,12 +84,34 @@ void DecSlice::create()
 
 void DecSlice::destroy()
 {
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_quit = true;
+    m_cond.notify_all();
+  }
+  for( auto &thread: m_threads )
+  {
+    thread.join();
+  }
+  m_threads.clear();
+  m_quit = false;
 }
 
-void DecSlice::init( CABACDecoder* cabacDecoder, DecCu* pcCuDecoder )
+void DecSlice::init( CABACDecoder* cabacDecoder, DecCu* pcCuDecoder, LoopFilter* pcLoopFilter, SampleAdaptiveOffset* pcSAO, AdaptiveLoopFilter* pcALF, Reshape* pcReshape, int numThreads )
 {
   m_CABACDecoder    = cabacDecoder;
   m_pcCuDecoder     = pcCuDecoder;
+  m_pcLoopFilter    = pcLoopFilter;
+  m_pcSAO           = pcSAO;
+  m_pcALF           = pcALF;
+  m_pcReshape       = pcReshape;
+  m_numThreads      = numThreads;
+
+  CHECK( !m_threads.empty(), "Slice decoder already initialized" );
+  for( int tId = 1; tId < m_numThreads; tId++ )
+  {
+    m_threads.push_back( std::thread( &DecSlice::xReconstructionThread, this, tId ) );
+  }
 }
 
 void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int debugCTU )
@@ -129,6 +173,22 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
 
   DTRACE( g_trace_ctx, D_HEADER, "=========== POC: %d ===========\n", slice->getPOC() );
 
+  // reconstruct the CTUs in parallel to the parsing, the IBC reference buffer requires the CTU order
+  const bool parallelRecon = m_numThreads > 1 && !sps->getIBCFlag() && debugCTU < 0;
+  if( parallelRecon )
+  {
+    xStartReconstruction( cs, tileMap.getCtuBsToRsAddrMap( startCtuTsAddr ) );
+  }
+  else
+  {
+    cs.motionLutRows.clear();
+  }
+
+  // the in-loop filters follow the reconstruction CTU row by CTU row when the slice covers the picture
+  const bool rowFilter = m_numThreads > 1 && debugCTU < 0 && startCtuTsAddr == 0 && slice->getSliceCurEndCtuTsAddr() == numCtusInFrame
+                         && !cs.pps->getTransquantBypassEnabledFlag();
+  xStartRowFilter( cs, rowFilter );
+
 
   // for every CTU in the slice segment...
   bool isLastCtuOfSliceSegment = false;
@@ -137,6 +197,7 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   uint32_t endSliceRsRow = tileMap.getCtuBsToRsAddrMap(slice->getSliceCurEndCtuTsAddr() - 1) / widthInCtus;
   uint32_t endSliceRsCol = tileMap.getCtuBsToRsAddrMap(slice->getSliceCurEndCtuTsAddr() - 1) % widthInCtus;
   unsigned subStrmId = 0;
+  unsigned lastCtuRsAddr = 0;
   for( unsigned ctuTsAddr = startCtuTsAddr; !isLastCtuOfSliceSegment && ctuTsAddr < numCtusInFrame; ctuTsAddr++ )
   {
     const unsigned  ctuRsAddr             = tileMap.getCtuBsToRsAddrMap(ctuTsAddr);
@@ -190,7 +251,8 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
       resetGbiCodingOrder(true, cs);
     }
 
-    if ((cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag()) && ctuXPosInCtus == tileXPosInCtus)
+    const bool resetLut = ( cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag() ) && ctuXPosInCtus == tileXPosInCtus;
+    if( resetLut && !parallelRecon )
     {
       cs.motionLut.lut.resize(0);
       cs.motionLut.lutIbc.resize(0);
@@ -209,7 +271,23 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
     }
     isLastCtuOfSliceSegment = cabacReader.coding_tree_unit( cs, ctuArea, pic->m_prevQP, ctuRsAddr );
 
-    m_pcCuDecoder->decompressCtu( cs, ctuArea );
+    lastCtuRsAddr = ctuRsAddr;
+
+    if( parallelRecon )
+    {
+      xPushCtu( tileMap, ctuRsAddr, resetLut );
+    }
+    else
+    {
+      m_pcCuDecoder->decompressCtu( cs, ctuArea );
+
+      if( rowFilter )
+      {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        xCtuDone( ctuRsAddr );
+        m_cond.notify_all();
+      }
+    }
 
     if( ctuXPosInCtus == tileXPosInCtus && wavefrontsEnabled )
     {
@@ -239,6 +317,11 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   }
   CHECK( !isLastCtuOfSliceSegment, "Last CTU of slice segment not signalled as such" );
 
+  if( parallelRecon )
+  {
+    xFinishReconstruction( *slice, lastCtuRsAddr );
+  }
+
   // deallocate all created substreams, including internal buffers.
   for( auto substr: ppcSubstreams )
   {
@@ -247,4 +330,312 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   slice->stopProcessingTimer();
 }
 
+void DecSlice::xReserveUnits( CodingStructure& cs )
+{
+  // the units are added by the parser while the reconstruction and filter threads access them,
+  // the unit vectors must not be reallocated (at most one unit per 4x4 luma and 2x2 chroma samples)
+  const size_t maxNumUnits = cs.area.Y().area() / 16 + ( cs.area.chromaFormat == CHROMA_400 ? 0 : cs.area.Cb().area() / 4 );
+  cs.cus.reserve( maxNumUnits );
+  cs.pus.reserve( maxNumUnits );
+  cs.tus.reserve( maxNumUnits );
+}
+
+void DecSlice::xStartReconstruction( CodingStructure& cs, unsigned startCtuRsAddr )
+{
+  const unsigned numCtusInFrame = cs.pcv->sizeInCtus;
+
+  m_cs = &cs;
+  if( m_ctuParsed.size() != numCtusInFrame || ++m_sliceStamp == 0 )
+  {
+    m_ctuParsed.assign( numCtusInFrame, 0 );
+    m_ctuDone  .assign( numCtusInFrame, 0 );
+    m_sliceStamp = 1;
+  }
+
+  // the HMVP table of the first CTU row continues the previous slice, the other rows start at a brick column
+  cs.motionLutRows.resize( cs.pcv->heightInCtus );
+  cs.motionLutRows[startCtuRsAddr / cs.pcv->widthInCtus] = cs.motionLut;
+
+  xReserveUnits( cs );
+
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_ctuTasks.clear();
+  m_ctuTasks.reserve( numCtusInFrame );
+  m_rowTasks.clear();
+  m_numReleased = 0;
+  m_numDone     = 0;
+  m_nextRow     = 0;
+  m_parseDone   = false;
+}
+
+void DecSlice::xPushCtu( const BrickMap& tileMap, unsigned ctuRsAddr, bool resetLut )
+{
+  const unsigned widthInCtus   = m_cs->pcv->widthInCtus;
+  const Brick&   brick         = tileMap.bricks[tileMap.getBrickIdxRsMap( ctuRsAddr )];
+  const unsigned brickXPosInCtus = brick.getFirstCtuRsAddr() % widthInCtus;
+  const unsigned brickYPosInCtus = brick.getFirstCtuRsAddr() / widthInCtus;
+  const unsigned ctuXPosInCtus = ctuRsAddr % widthInCtus;
+  const unsigned ctuYPosInCtus = ctuRsAddr / widthInCtus;
+
+  CtuTask task;
+  task.rsAddr        = ctuRsAddr;
+  task.resetLut      = resetLut;
+  task.newRow        = m_ctuTasks.empty() || m_ctuTasks.back().rsAddr + 1 != ctuRsAddr || ctuXPosInCtus == brickXPosInCtus;
+  task.waitRsAddr[0] = -1;
+  task.waitRsAddr[1] = -1;
+
+  // above-right CTU (above CTU at the right brick border), no prediction across the bricks
+  if( ctuYPosInCtus > brickYPosInCtus )
+  {
+    const unsigned aboveXPosInCtus = std::min( ctuXPosInCtus + 1, brickXPosInCtus + brick.getWidthInCtus() - 1 );
+    const unsigned aboveRsAddr     = ( ctuYPosInCtus - 1 ) * widthInCtus + aboveXPosInCtus;
+    if( m_ctuParsed[aboveRsAddr] == m_sliceStamp )
+    {
+      task.waitRsAddr[0] = aboveRsAddr;
+    }
+  }
+  // last CTU of the previous brick, the intra reference samples (CodingStructure::isDecomp) of the sequential
+  // decoding include the preceding bricks but none of the following, the HMVP table of the CTU row is shared too
+  if( ctuRsAddr == brick.getFirstCtuRsAddr() && !m_ctuTasks.empty() )
+  {
+    task.waitRsAddr[1] = m_ctuTasks.back().rsAddr;
+  }
+  m_ctuParsed[ctuRsAddr] = m_sliceStamp;
+
+  // the CU, PU and TU lists of a CTU are linked to the next CTU, the previous CTU is complete now
+  std::unique_lock<std::mutex> lock( m_mutex );
+  if( task.newRow )
+  {
+    m_rowTasks.push_back( unsigned( m_ctuTasks.size() ) );
+  }
+  m_ctuTasks.push_back( task );
+  m_numReleased = m_ctuTasks.size() - 1;
+  m_cond.notify_all();
+}
+
+void DecSlice::xFinishReconstruction( const Slice& slice, unsigned lastCtuRsAddr )
+{
+  CodingStructure& cs = *m_cs;
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_numReleased = m_ctuTasks.size();
+    m_parseDone   = true;
+    m_cond.notify_all();
+
+    // help with the remaining CTU rows
+    while( m_numDone < m_ctuTasks.size() )
+    {
+      if( xRowAvailable() )
+      {
+        xReconstructRow( 0, lock );
+      }
+      else if( xFilterAvailable() )
+      {
+        xRunFilterStep( lock );
+      }
+      else
+      {
+        m_cond.wait( lock );
+      }
+    }
+  }
+
+  // the following slice continues with the HMVP table of the last CTU
+  if( slice.getSliceType() != I_SLICE )
+  {
+    cs.motionLut = cs.motionLutRows[lastCtuRsAddr / cs.pcv->widthInCtus];
+  }
+}
+
+void DecSlice::xReconstructionThread( int tId )
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+  while( true )
+  {
+    m_cond.wait( lock, [this] { return m_quit || xRowAvailable() || xFilterAvailable(); } );
+    if( m_quit )
+    {
+      return;
+    }
+    if( xRowAvailable() )
+    {
+      xReconstructRow( tId, lock );
+    }
+    else
+    {
+      xRunFilterStep( lock );
+    }
+  }
+}
+
+void DecSlice::xReconstructRow( int tId, std::unique_lock<std::mutex>& lock )
+{
+  CodingStructure& cs        = *m_cs;
+  const unsigned widthInCtus = cs.pcv->widthInCtus;
+  const unsigned maxCUSize   = cs.pcv->maxCUWidth;
+  size_t idx                 = m_rowTasks[m_nextRow++];
+
+  do
+  {
+    const CtuTask task = m_ctuTasks[idx];
+    auto isDone = [this]( int rsAddr ) { return rsAddr < 0 || m_ctuDone[rsAddr] == m_sliceStamp; };
+    m_cond.wait( lock, [&] { return m_quit || ( isDone( task.waitRsAddr[0] ) && isDone( task.waitRsAddr[1] ) ); } );
+    if( m_quit )
+    {
+      return;
+    }
+    lock.unlock();
+
+    const UnitArea ctuArea( cs.area.chromaFormat, Area( ( task.rsAddr % widthInCtus ) * maxCUSize, ( task.rsAddr / widthInCtus ) * maxCUSize, maxCUSize, maxCUSize ) );
+    if( task.resetLut )
+    {
+      LutMotionCand& motionLut = cs.getMotionLut( ctuArea );
+      motionLut.lut   .resize( 0 );
+      motionLut.lutIbc.resize( 0 );
+    }
+    m_pcCuDecoder[tId].decompressCtu( cs, ctuArea );
+
+    lock.lock();
+    m_ctuDone[task.rsAddr] = m_sliceStamp;
+    m_numDone++;
+    xCtuDone( task.rsAddr );
+    m_cond.notify_all();
+
+    idx++;
+    m_cond.wait( lock, [&] { return m_quit || m_parseDone || idx < m_numReleased; } );
+  }
+  while( !m_quit && idx < m_numReleased && !m_ctuTasks[idx].newRow );
+}
+
+void DecSlice::xStartRowFilter( CodingStructure& cs, bool rowFilter )
+{
+  std::unique_lock<std::mutex> lock( m_mutex );
+  m_cond.wait( lock, [this] { return !m_filterBusy; } );
+  m_rowFilter = false;
+  if( !rowFilter )
+  {
+    return;
+  }
+
+  m_cs               = &cs;
+  m_rowFilterReshape = cs.sps->getUseReshaper() && m_pcReshape->getSliceReshaperInfo().getUseSliceReshaper();
+  m_rowFilterSAO     = cs.sps->getSAOEnabledFlag();
+  m_rowFilterALF     = cs.sps->getALFEnabledFlag() && cs.slice->getTileGroupAlfEnabledFlag( COMPONENT_Y ) && m_pcALF->ALFProcessStart( cs );
+  m_filterStep       = 0;
+  m_numRowsDone      = 0;
+  m_rowNumCtusDone.assign( cs.pcv->heightInCtus, 0 );
+  xReserveUnits( cs );
+  m_rowFilter        = true;
+}
+
+void DecSlice::xCtuDone( unsigned ctuRsAddr )
+{
+  if( !m_rowFilter )
+  {
+    return;
+  }
+  const unsigned widthInCtus  = m_cs->pcv->widthInCtus;
+  const int      heightInCtus = m_cs->pcv->heightInCtus;
+  if( ++m_rowNumCtusDone[ctuRsAddr / widthInCtus] == widthInCtus )
+  {
+    while( m_numRowsDone < heightInCtus && m_rowNumCtusDone[m_numRowsDone] == widthInCtus )
+    {
+      m_numRowsDone++;
+    }
+  }
+}
+
+void DecSlice::xRunFilterStep( std::unique_lock<std::mutex>& lock )
+{
+  const int step = m_filterStep++;
+  m_filterBusy   = true;
+  lock.unlock();
+
+  xFilterStep( step );
+
+  lock.lock();
+  m_filterBusy = false;
+  m_cond.notify_all();
+}
+
+/**
+ - filter step of the CTU rows, step r is run when the CTU rows 0 .. r are reconstructed (and the remaining
+   steps up to heightInCtus + 2 at the end of the picture):
+   - inverse luma mapping and deblocking of row r-1, the intra prediction of row r used its unfiltered samples
+   - refined motion field of row r-2, the deblocking of the rows next to it used the unrefined motion vectors
+   - SAO of row r-2, the deblocking of row r-1 modified its bottom lines
+   - ALF of row r-3, the row below is final after its SAO
+ .
+ */
+void DecSlice::xFilterStep( int step )
+{
+  CodingStructure&     cs           = *m_cs;
+  const PreCalcValues& pcv          = *cs.pcv;
+  const int            heightInCtus = pcv.heightInCtus;
+
+  auto ctuRowArea = [&]( int ctuRow )
+  {
+    const int yPos = ctuRow * pcv.maxCUHeight;
+    return UnitArea( cs.area.chromaFormat, Area( 0, yPos, pcv.lumaWidth, std::min<int>( pcv.maxCUHeight, pcv.lumaHeight - yPos ) ) );
+  };
+
+  const int dbRow = step - 1;
+  if( dbRow >= 0 && dbRow < heightInCtus )
+  {
+    if( m_rowFilterReshape )
+    {
+      cs.getRecoBuf( ctuRowArea( dbRow ).Y() ).rspSignal( m_pcReshape->getInvLUT() );
+    }
+    m_pcLoopFilter->loopFilterCtuRow( cs, EDGE_VER, dbRow );
+    m_pcLoopFilter->loopFilterCtuRow( cs, EDGE_HOR, dbRow );
+  }
+
+  const int saoRow = step - 2;
+  if( saoRow >= 0 && saoRow < heightInCtus )
+  {
+    for( int x = 0; x < pcv.widthInCtus; x++ )
+    {
+      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, saoRow << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUHeight ) );
+      CS::setRefinedMotionField( cs, ctuArea );
+    }
+
+    if( m_rowFilterSAO )
+    {
+      m_pcSAO->SAOProcessCtuRow( cs, cs.picture->getSAO(), saoRow );
+    }
+    if( m_rowFilterALF )
+    {
+      m_pcALF->ALFProcessCopyCtuRow( cs, saoRow );
+    }
+  }
+
+  const int alfRow = step - 3;
+  if( m_rowFilterALF && alfRow >= 0 && alfRow < heightInCtus )
+  {
+    m_pcALF->ALFProcessCtuRow( cs, alfRow );
+  }
+}
+
+bool DecSlice::finishLoopFilters()
+{
+  int step = 0;
+  {
+    std::unique_lock<std::mutex> lock( m_mutex );
+    if( !m_rowFilter )
+    {
+      return false;
+    }
+    m_cond.wait( lock, [this] { return !m_filterBusy; } );
+    CHECK( m_numRowsDone != int( m_cs->pcv->heightInCtus ), "Picture not completely reconstructed" );
+    m_rowFilter = false;
+    step        = m_filterStep;
+  }
+
+  for( ; step < int( m_cs->pcv->heightInCtus ) + 3; step++ )
+  {
+    xFilterStep( step );
+  }
+  return true;
+}
+
 //! \}
@@ -44,9 +44,17 @@
 
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/BitStream.h"
+#include "CommonLib/LoopFilter.h"
+#include "CommonLib/SampleAdaptiveOffset.h"
+#include "CommonLib/AdaptiveLoopFilter.h"
+#include "CommonLib/Reshape.h"
 #include "DecCu.h"
 #include "CABACReader.h"
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 //! \ingroup DecoderLib
 //! \{
 
@@ -58,21 +66,81 @@
 class DecSlice
 {
 private:
+  // a CTU released for the reconstruction, the CTU rows of a brick are reconstructed by one thread each,
+  // the bricks one after another
+  struct CtuTask
+  {
+    unsigned      rsAddr;
+    int           waitRsAddr[2];                        ///< CTUs of the slice to be reconstructed before, -1 for none
+    bool          newRow;                               ///< first CTU of a CTU row of the brick
+    bool          resetLut;                             ///< the HMVP table of the CTU row is reset
+  };
+
   // access channel
   CABACDecoder*   m_CABACDecoder;
-  DecCu*          m_pcCuDecoder;
+  DecCu*          m_pcCuDecoder;                        ///< one CU decoder per thread
 
   Ctx             m_entropyCodingSyncContextState;      ///< context storage for state of contexts at the wavefront/WPP/entropy-coding-sync second CTU of tile-row
 
+  // parallel reconstruction, the CTUs are parsed in the calling thread (CU decoder 0) which afterwards helps
+  // the reconstruction threads (CU decoders 1 .. m_numThreads-1)
+  int                       m_numThreads;
+  std::vector<std::thread>  m_threads;
+  std::mutex                m_mutex;
+  std::condition_variable   m_cond;
+  bool                      m_quit;
+  CodingStructure*          m_cs;
+  unsigned                  m_sliceStamp;               ///< marks the CTUs parsed and reconstructed in the current slice
+  std::vector<unsigned>     m_ctuParsed;                ///< slice stamp per CTU
+  std::vector<unsigned>     m_ctuDone;                  ///< slice stamp per CTU
+  std::vector<CtuTask>      m_ctuTasks;                 ///< in decoding order, reserved for the whole picture
+  std::vector<unsigned>     m_rowTasks;                 ///< index of the first task of each brick CTU row
+  size_t                    m_numReleased;
+  size_t                    m_numDone;
+  size_t                    m_nextRow;
+  bool                      m_parseDone;
+
+  // in-loop filters of a picture with a single slice, applied CTU row by CTU row behind the reconstruction
+  // by the threads above (see xFilterStep), the steps are run one at a time in order
+  LoopFilter*               m_pcLoopFilter;
+  SampleAdaptiveOffset*     m_pcSAO;
+  AdaptiveLoopFilter*       m_pcALF;
+  Reshape*                  m_pcReshape;
+  bool                      m_rowFilter;
+  bool                      m_rowFilterReshape;
+  bool                      m_rowFilterSAO;
+  bool                      m_rowFilterALF;
+  bool                      m_filterBusy;
+  int                       m_filterStep;
+  int                       m_numRowsDone;              ///< leading CTU rows of the picture completely reconstructed
+  std::vector<unsigned>     m_rowNumCtusDone;
+
 public:
   DecSlice();
   virtual ~DecSlice();
 
-  void  init              ( CABACDecoder* cabacDecoder, DecCu* pcMbDecoder );
+  void  init              ( CABACDecoder* cabacDecoder, DecCu* pcCuDecoder, LoopFilter* pcLoopFilter, SampleAdaptiveOffset* pcSAO, AdaptiveLoopFilter* pcALF, Reshape* pcReshape, int numThreads = 1 );
   void  create            ();
   void  destroy           ();
 
   void  decompressSlice   ( Slice* slice, InputBitstream* bitstream, int debugCTU );
+  /// applies the in-loop filters still due for the picture, false when it is not filtered by CTU rows
+  bool  finishLoopFilters ();
+
+private:
+  void  xReserveUnits         ( CodingStructure& cs );
+  void  xStartReconstruction  ( CodingStructure& cs, unsigned startCtuRsAddr );
+  void  xPushCtu              ( const BrickMap& tileMap, unsigned ctuRsAddr, bool resetLut );
+  void  xFinishReconstruction ( const Slice& slice, unsigned lastCtuRsAddr );
+  void  xReconstructionThread ( int tId );
+  void  xReconstructRow       ( int tId, std::unique_lock<std::mutex>& lock );
+  bool  xRowAvailable         () const { return m_nextRow < m_rowTasks.size() && m_rowTasks[m_nextRow] < m_numReleased; }
+
+  void  xStartRowFilter       ( CodingStructure& cs, bool rowFilter );
+  void  xCtuDone              ( unsigned ctuRsAddr );
+  void  xRunFilterStep        ( std::unique_lock<std::mutex>& lock );
+  void  xFilterStep           ( int step );
+  bool  xFilterAvailable      () const { return m_rowFilter && !m_filterBusy && m_filterStep < m_numRowsDone; }
 };
 
 //! \}
@@ -42,20 +42,11 @@
 
 #include "CommonLib/UnitTools.h"
 #include "CommonLib/dtrace_buffer.h"
+#include "CommonLib/Profiler.h"
 
 #include <map>
 #include <algorithm>
 #include <limits>
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-long long int timeOfAffine_amvr_mode = 0;
-long long int timeOfCu_gbi_flag      = 0;
-
 
 //! \ingroup EncoderLib
 //! \{
@@ -846,7 +837,7 @@ void CABACWriter::cu_pred_data( const CodingUnit& cu )
 
 void CABACWriter::cu_gbi_flag(const CodingUnit& cu)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "CABACWriter::cu_gbi_flag" );
 
   if(!CU::isGBiIdxCoded(cu))
   {
@@ -880,10 +871,6 @@ void CABACWriter::cu_gbi_flag(const CodingUnit& cu)
   }
 
   DTRACE(g_trace_ctx, D_SYNTAX, "cu_gbi_flag() gbi_idx=%d\n", cu.GBiIdx ? 1 : 0);
-
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfCu_gbi_flag        = timeOfCu_gbi_flag + duration.count();
 }
 
 void CABACWriter::xWriteTruncBinCode(uint32_t symbol, uint32_t maxSymbol)
@@ -2021,7 +2008,7 @@ void CABACWriter::imv_mode( const CodingUnit& cu )
 
 void CABACWriter::affine_amvr_mode( const CodingUnit& cu )
 {
-  auto       start = high_resolution_clock::now();
+  PROFILE_ZONE( "CABACWriter::affine_amvr_mode" );
   const SPS* sps = cu.slice->getSPS();
 
   if( !sps->getAffineAmvrEnabledFlag() || !cu.affine )
@@ -2043,10 +2030,6 @@ void CABACWriter::affine_amvr_mode( const CodingUnit& cu )
     DTRACE( g_trace_ctx, D_SYNTAX, "affine_amvr_mode() value=%d ctx=%d\n", (cu.imv > 1), 3 );
   }
   DTRACE( g_trace_ctx, D_SYNTAX, "affine_amvr_mode() IMVFlag=%d\n", cu.imv );
-
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfAffine_amvr_mode   = timeOfAffine_amvr_mode + duration.count();
 }
 
 void CABACWriter::merge_idx( const PredictionUnit& pu )
@@ -42,10 +42,6 @@
 #include "CommonLib/ContextModelling.h"
 #include "BinEncoder.h"
 
-extern long long int timeOfAffine_amvr_mode;
-extern long long int timeOfCu_gbi_flag;
-
-
 //! \ingroup EncoderLib
 //! \{
 
@@ -650,11 +650,13 @@ protected:
 #if ENABLE_SPLIT_PARALLELISM
   int         m_numSplitThreads;
   bool        m_forceSingleSplitThread;
+  int         m_splitParallelCuSize;
 #endif
 #if ENABLE_WPP_PARALLELISM
   int         m_numWppThreads;
   int         m_numWppExtraLines;
   bool        m_ensureWppBitEqual;
+  int         m_numFrameThreads;
 #endif
 
   bool        m_alf;                                          ///< Adaptive Loop Filter
@@ -678,6 +680,11 @@ protected:
   int         m_switchPocPeriod;
   int         m_upscaledOutput;
 
+  ApproxAdderType m_approxAdder;
+  int         m_approxWidth;
+  int         m_approxBits;
+  uint32_t    m_approxSites;
+
 public:
   EncCfg()
   : m_tileColumnWidth()
@@ -1642,6 +1649,8 @@ public:
   int          getNumSplitThreads()                            const { return m_numSplitThreads; }
   void         setForceSingleSplitThread( bool b )                   { m_forceSingleSplitThread = b; }
   int          getForceSingleSplitThread()                     const { return m_forceSingleSplitThread; }
+  void         setSplitParallelCuSize( int n )                       { m_splitParallelCuSize = n; }
+  int          getSplitParallelCuSize()                        const { return m_splitParallelCuSize; }
 #endif
 #if ENABLE_WPP_PARALLELISM
   void         setNumWppThreads( int n )                             { m_numWppThreads = n; }
@@ -1650,6 +1659,8 @@ public:
   int          getNumWppExtraLines()                           const { return m_numWppExtraLines; }
   void         setEnsureWppBitEqual( bool b)                         { m_ensureWppBitEqual = b; }
   bool         getEnsureWppBitEqual()                          const { return m_ensureWppBitEqual; }
+  void         setNumFrameThreads( int n )                           { m_numFrameThreads = n; }
+  int          getNumFrameThreads()                            const { return m_numFrameThreads; }
 #endif
   void         setUseALF( bool b ) { m_alf = b; }
   bool         getUseALF()                                      const { return m_alf; }
@@ -1687,6 +1698,15 @@ public:
   void        setSwitchPocPeriod( int p )                            { m_switchPocPeriod = p;}
   void        setUpscaledOutput( int b )                             { m_upscaledOutput = b; }
   int         getUpscaledOutput()                              const { return m_upscaledOutput; }
+
+  void        setApproxAdder( ApproxAdderType adder )                { m_approxAdder = adder; }
+  ApproxAdderType getApproxAdder()                             const { return m_approxAdder; }
+  void        setApproxWidth( int i )                                { m_approxWidth = i; }
+  int         getApproxWidth()                                 const { return m_approxWidth; }
+  void        setApproxBits( int i )                                 { m_approxBits = i; }
+  int         getApproxBits()                                  const { return m_approxBits; }
+  void        setApproxSites( uint32_t sites )                       { m_approxSites = sites; }
+  uint32_t    getApproxSites()                                 const { return m_approxSites; }
 };
 
 //! \}
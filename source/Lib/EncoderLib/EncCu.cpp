@@ -48,29 +48,17 @@
 
 
 #include "CommonLib/dtrace_buffer.h"
+#include "CommonLib/Profiler.h"
 
 #include <stdio.h>
 #include <cmath>
 #include <algorithm>
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
 
 #if ENABLE_WPP_PARALLELISM
 #include <mutex>
 extern std::recursive_mutex g_cache_mutex;
 #endif
 
-long long int timeOfXCheckRDCostMergeTriangle2Nx2N = 0;
-long long int timeOfXCheckRDCostAffineMerge2Nx2N   = 0;
-long long int timeOfXCheckRDCostInterIMV           = 0;
-
-
-
-
 //! \ingroup EncoderLib
 //! \{
 
@@ -280,7 +268,11 @@ void EncCu::init( EncLib* pcEncLib, const SPS& sps PARL_PARAM( const int tId ) )
   m_CABACEstimator->setEncCu(this);
   m_CtxCache           = pcEncLib->getCtxCache( PARL_PARAM0( tId ) );
   m_pcRateCtrl         = pcEncLib->getRateCtrl();
+#if ENABLE_WPP_PARALLELISM
+  m_pcSliceEncoder     = pcEncLib->getSliceEncoder( tId / pcEncLib->getNumCuEncStacksPerSliceEncoder() );
+#else
   m_pcSliceEncoder     = pcEncLib->getSliceEncoder();
+#endif
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   m_pcEncLib           = pcEncLib;
   m_dataId             = tId;
@@ -314,7 +306,7 @@ void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsign
   m_modeCtrl->initCTUEncoding( *cs.slice );
   cs.treeType = TREE_D;
 
-  cs.slice->m_mapPltCost.clear();
+  m_modeCtrl->clearPltCost();
 #if ENABLE_SPLIT_PARALLELISM
   if( m_pcEncCfg->getNumSplitThreads() > 1 )
   {
@@ -388,11 +380,16 @@ void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsign
   tempCS->prevQP[CH_L] = bestCS->prevQP[CH_L] = prevQP[CH_L];
 
   xCompressCU(tempCS, bestCS, partitioner);
-  cs.slice->m_mapPltCost.clear();
+  m_modeCtrl->clearPltCost();
   // all signals were already copied during compression if the CTU was split - at this point only the structures are copied to the top level CS
   const bool copyUnsplitCTUSignals = bestCS->cus.size() == 1;
-  cs.useSubStructure(*bestCS, partitioner.chType, CS::getArea(*bestCS, area, partitioner.chType), copyUnsplitCTUSignals,
-                     false, false, copyUnsplitCTUSignals);
+  {
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+    std::lock_guard<std::mutex> picCsLock( cs.picture->scheduler.getPicCsMutex() );
+#endif
+    cs.useSubStructure(*bestCS, partitioner.chType, CS::getArea(*bestCS, area, partitioner.chType), copyUnsplitCTUSignals,
+                       false, false, copyUnsplitCTUSignals);
+  }
 
   if (CS::isDualITree (cs) && isChromaEnabled (cs.pcv->chrFormat))
   {
@@ -409,6 +406,9 @@ void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsign
     xCompressCU(tempCS, bestCS, partitioner);
 
     const bool copyUnsplitCTUSignals = bestCS->cus.size() == 1;
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+    std::lock_guard<std::mutex> picCsLock( cs.picture->scheduler.getPicCsMutex() );
+#endif
     cs.useSubStructure(*bestCS, partitioner.chType, CS::getArea(*bestCS, area, partitioner.chType),
                        copyUnsplitCTUSignals, false, false, copyUnsplitCTUSignals);
   }
@@ -609,8 +609,32 @@ void EncCu::xCompressCU( CodingStructure*& tempCS, CodingStructure*& bestCS, Par
     bestCS->sharedBndSize.width = bestCS->area.lwidth();
     bestCS->sharedBndSize.height = bestCS->area.lheight();
   }
+  const SPS &sps      = *tempCS->sps;
 #if ENABLE_SPLIT_PARALLELISM
   CHECK( m_dataId != tempCS->picture->scheduler.getDataId(), "Working in the wrong dataId!" );
+#endif
+  // the SBT save/load buffers of all the jobs are reset before the CTU can be split into parallel jobs
+  if( partitioner.currQtDepth == 0 && partitioner.currMtDepth == 0 && !tempCS->slice->isIntra() && ( sps.getUseSBT() || sps.getUseInterMTS() )
+#if ENABLE_SPLIT_PARALLELISM
+    && tempCS->picture->scheduler.getSplitJobId() == 0
+#endif
+    )
+  {
+    auto slsSbt = dynamic_cast<SaveLoadEncInfoSbt*>( m_modeCtrl );
+    int maxSLSize = sps.getUseSBT() ? tempCS->slice->getSPS()->getMaxSbtSize() : MTS_INTER_MAX_CU_SIZE;
+    slsSbt->resetSaveloadSbt( maxSLSize );
+#if ENABLE_SPLIT_PARALLELISM
+    if (m_pcEncCfg->getNumSplitThreads() > 1)
+    {
+      for (int jId = 1; jId < NUM_RESERVERD_SPLIT_JOBS; jId++)
+      {
+        auto slsSbt = dynamic_cast<SaveLoadEncInfoSbt *>(m_pcEncLib->getCuEncoder(jId)->m_modeCtrl);
+        slsSbt->resetSaveloadSbt(maxSLSize);
+      }
+    }
+#endif
+  }
+#if ENABLE_SPLIT_PARALLELISM
 
   if( m_pcEncCfg->getNumSplitThreads() != 1 && tempCS->picture->scheduler.getSplitJobId() == 0 )
   {
@@ -660,7 +684,6 @@ void EncCu::xCompressCU( CodingStructure*& tempCS, CodingStructure*& bestCS, Par
 
   Slice&   slice      = *tempCS->slice;
   const PPS &pps      = *tempCS->pps;
-  const SPS &sps      = *tempCS->sps;
   const uint32_t uiLPelX  = tempCS->area.Y().lumaPos().x;
   const uint32_t uiTPelY  = tempCS->area.Y().lumaPos().y;
 
@@ -670,23 +693,6 @@ void EncCu::xCompressCU( CodingStructure*& tempCS, CodingStructure*& bestCS, Par
   const UnitArea currCsArea = clipArea( CS::getArea( *bestCS, bestCS->area, partitioner.chType ), *tempCS->picture );
 
   m_modeCtrl->initCULevel( partitioner, *tempCS );
-  if( partitioner.currQtDepth == 0 && partitioner.currMtDepth == 0 && !tempCS->slice->isIntra() && ( sps.getUseSBT() || sps.getUseInterMTS() ) )
-  {
-    auto slsSbt = dynamic_cast<SaveLoadEncInfoSbt*>( m_modeCtrl );
-    int maxSLSize = sps.getUseSBT() ? tempCS->slice->getSPS()->getMaxSbtSize() : MTS_INTER_MAX_CU_SIZE;
-    slsSbt->resetSaveloadSbt( maxSLSize );
-#if ENABLE_SPLIT_PARALLELISM
-    CHECK( tempCS->picture->scheduler.getSplitJobId() != 0, "The SBT search reset need to happen in sequential region." );
-    if (m_pcEncCfg->getNumSplitThreads() > 1)
-    {
-      for (int jId = 1; jId < NUM_RESERVERD_SPLIT_JOBS; jId++)
-      {
-        auto slsSbt = dynamic_cast<SaveLoadEncInfoSbt *>(m_pcEncLib->getCuEncoder(jId)->m_modeCtrl);
-        slsSbt->resetSaveloadSbt(maxSLSize);
-      }
-    }
-#endif
-  }
   m_sbtCostSave[0] = m_sbtCostSave[1] = MAX_DOUBLE;
 
   m_CurrCtx->start = m_CABACEstimator->getCtx();
@@ -1542,6 +1548,10 @@ void EncCu::xCheckModeSplit(CodingStructure *&tempCS, CodingStructure *&bestCS,
       }
     }
     assert( tempCS->treeType == TREE_L );
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+    // the luma units stay in the picture CS during the chroma search, other jobs must not add or remove units meanwhile
+    std::unique_lock<std::mutex> picCsLock( tempCS->picture->scheduler.getPicCsMutex() );
+#endif
     uint32_t numCuPuTu[6];
     tempCS->picture->cs->getNumCuPuTuOffset( numCuPuTu );
     tempCS->picture->cs->useSubStructure( *tempCS, partitioner.chType, CS::getArea( *tempCS, partitioner.currArea(), partitioner.chType ), false, true, false, false );
@@ -1571,6 +1581,9 @@ void EncCu::xCheckModeSplit(CodingStructure *&tempCS, CodingStructure *&bestCS,
     bestCSChroma->releaseIntermediateData();
     //tempCS->picture->cs->releaseIntermediateData();
     tempCS->picture->cs->clearCuPuTuIdxMap( partitioner.currArea(), numCuPuTu[0], numCuPuTu[1], numCuPuTu[2], numCuPuTu + 3 );
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+    picCsLock.unlock();
+#endif
 
     m_CurrCtx--;
 
@@ -2048,7 +2061,7 @@ void EncCu::xCheckPLT(CodingStructure *&tempCS, CodingStructure *&bestCS, Partit
   tempCS->useDbCost = m_pcEncCfg->getUseEncDbOpt();
 
   const Area currCuArea = cu.block(getFirstComponentOfChannel(partitioner.chType));
-  cu.slice->m_mapPltCost[currCuArea.pos()][currCuArea.size()] = tempCS->cost;
+  m_modeCtrl->setPltCost( currCuArea, tempCS->cost );
 #if WCG_EXT
   DTRACE_MODE_COST(*tempCS, m_pcRdCost->getLambda(true));
 #else
@@ -2770,7 +2783,7 @@ void EncCu::xCheckRDCostMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&
 
 void EncCu::xCheckRDCostMergeTriangle2Nx2N( CodingStructure *&tempCS, CodingStructure *&bestCS, Partitioner &partitioner, const EncTestMode& encTestMode )
 {
-  auto         start = high_resolution_clock::now();
+  PROFILE_ZONE( "EncCu::xCheckRDCostMergeTriangle2Nx2N" );
   const Slice &slice = *tempCS->slice;
   const SPS &sps = *tempCS->sps;
 
@@ -2998,14 +3011,11 @@ void EncCu::xCheckRDCostMergeTriangle2Nx2N( CodingStructure *&tempCS, CodingStru
   {
     xCalDebCost( *bestCS, partitioner );
   }
-  auto stop                    = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfXCheckRDCostMergeTriangle2Nx2N = timeOfXCheckRDCostMergeTriangle2Nx2N + duration.count();
 }
 
 void EncCu::xCheckRDCostAffineMerge2Nx2N( CodingStructure *&tempCS, CodingStructure *&bestCS, Partitioner &partitioner, const EncTestMode& encTestMode )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "EncCu::xCheckRDCostAffineMerge2Nx2N" );
   if( m_modeCtrl->getFastDeltaQp() )
   {
     return;
@@ -3291,10 +3301,6 @@ void EncCu::xCheckRDCostAffineMerge2Nx2N( CodingStructure *&tempCS, CodingStruct
     xCalDebCost( *bestCS, partitioner );
   }
 
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfXCheckRDCostAffineMerge2Nx2N = timeOfXCheckRDCostAffineMerge2Nx2N + duration.count();
-
 }
 //////////////////////////////////////////////////////////////////////////////////////////////
 // ibc merge/skip mode check
@@ -3750,7 +3756,7 @@ void EncCu::xCheckRDCostInter( CodingStructure *&tempCS, CodingStructure *&bestC
 
 bool EncCu::xCheckRDCostInterIMV(CodingStructure *&tempCS, CodingStructure *&bestCS, Partitioner &partitioner, const EncTestMode& encTestMode, double &bestIntPelCost)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "EncCu::xCheckRDCostInterIMV" );
   int iIMV = int( ( encTestMode.opts & ETO_IMV ) >> ETO_IMV_SHIFT );
   m_pcInterSearch->setAffineModeSelected(false);
   // Only Half-Pel, int-Pel, 4-Pel and fast 4-Pel allowed
@@ -3853,9 +3859,6 @@ bool EncCu::xCheckRDCostInterIMV(CodingStructure *&tempCS, CodingStructure *&bes
   }
   else
   {
-    auto stop                = high_resolution_clock::now();
-    auto duration            = duration_cast<nanoseconds>(stop - start);
-    timeOfXCheckRDCostInterIMV = timeOfXCheckRDCostInterIMV + duration.count();
     return false;
   }
 
@@ -3936,9 +3939,6 @@ bool EncCu::xCheckRDCostInterIMV(CodingStructure *&tempCS, CodingStructure *&bes
   {
     xCalDebCost( *bestCS, partitioner );
   }
-  auto stop                  = high_resolution_clock::now();
-  auto duration              = duration_cast<nanoseconds>(stop - start);
-  timeOfXCheckRDCostInterIMV = timeOfXCheckRDCostInterIMV + duration.count();
   return tempCS->slice->getSPS()->getAffineAmvrEnabledFlag() ? validMode : true;
 }
 
@@ -58,10 +58,6 @@
 //! \ingroup EncoderLib
 //! \{
 
-extern long long int timeOfXCheckRDCostMergeTriangle2Nx2N;
-extern long long int timeOfXCheckRDCostAffineMerge2Nx2N;
-extern long long int timeOfXCheckRDCostInterIMV;
-
 class EncLib;
 class HLSWriter;
 class EncSlice;
@@ -223,7 +219,6 @@ protected:
 #endif
   bool xIsGBiSkip(const CodingUnit& cu)
   {
-    auto start = high_resolution_clock::now();
     if (cu.slice->getSliceType() != B_SLICE)
     {
       return true;
@@ -55,21 +55,14 @@
 #include "CommonLib/UnitTools.h"
 #include "CommonLib/dtrace_codingstruct.h"
 #include "CommonLib/dtrace_buffer.h"
+#include "CommonLib/Profiler.h"
 
 #include "DecoderLib/DecLib.h"
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
 
 #define ENCODE_SUB_SET 0
 
 using namespace std;
 
-long long int timeOfCompressGOP = 0;
-
 //! \ingroup EncoderLib
 //! \{
 
@@ -143,6 +136,9 @@ EncGOP::EncGOP()
   m_isUseLTRef = false;
   m_isPrepareLTRef = true;
   m_lastLTRefPoc = 0;
+#if ENABLE_WPP_PARALLELISM
+  m_frameStep = 0;
+#endif
 }
 
 EncGOP::~EncGOP()
@@ -1887,16 +1883,12 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
                         , bool isEncodeLtRef
 )
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "EncGOP::compressGOP" );
 
   // TODO: Split this function up.
 
-  Picture*        pcPic = NULL;
-  Slice*      pcSlice;
   OutputBitstream  *pcBitstreamRedirect;
   pcBitstreamRedirect = new OutputBitstream;
-  AccessUnit::iterator  itLocationToPushSliceHeaderNALU; // used to store location where NALU containing slice header is to be inserted
-  Picture* scaledRefPic[MAX_NUM_REF] = {};
 
   xInitGOP(iPOCLast, iNumPicRcvd, isField
          , isEncodeLtRef
@@ -1921,12 +1913,26 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
     m_pcCfg->setEncodedFlag(iGOPid, false);
   }
 
-  for ( int iGOPid=0; iGOPid < m_iGopSize; iGOPid++ )
+  // encodes the picture at iGOPid, numFrames > 0 when it is the frameIdx-th picture of a batch encoded by the frame threads
+  auto encodePicture = [&]( int iGOPid, int frameIdx, int numFrames )
   {
-    if (m_pcCfg->getEfficientFieldIRAPEnabled())
+    Picture*        pcPic = NULL;
+    Slice*      pcSlice;
+    Picture* scaledRefPic[MAX_NUM_REF] = {};
+
+#if ENABLE_WPP_PARALLELISM
+    // the frame threads use the slice encoders and CU encoder stacks following the sequential ones
+    const int sliceEncIdx = numFrames > 0 ? 1 + frameIdx : 0;
+    const int firstDataId = sliceEncIdx * m_pcEncLib->getNumCuEncStacksPerSliceEncoder();
+    if( numFrames > 0 )
     {
-      iGOPid=effFieldIRAPMap.adjustGOPid(iGOPid);
+      xWaitFrameStep( frameIdx );
     }
+    m_pcSliceEncoder = m_pcEncLib->getSliceEncoder( sliceEncIdx );
+    m_pcReshaper     = m_pcEncLib->getReshaper();
+#elif ENABLE_SPLIT_PARALLELISM
+    const int firstDataId = 0;
+#endif
 
     //-- For time output for each slice
     auto beforeTime = std::chrono::steady_clock::now();
@@ -1963,11 +1969,8 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
     }
     if (pocCurr / multipleFactor >= m_pcCfg->getFramesToBeEncoded())
     {
-      if (m_pcCfg->getEfficientFieldIRAPEnabled())
-      {
-        iGOPid=effFieldIRAPMap.restoreGOPid(iGOPid);
-      }
-      continue;
+      CHECK( numFrames > 0, "Pictures beyond the end of the sequence are not part of a batch" );
+      return;
     }
 
     if( getNalUnitType(pocCurr, m_iLastIDR, isField) == NAL_UNIT_CODED_SLICE_IDR_W_RADL || getNalUnitType(pocCurr, m_iLastIDR, isField) == NAL_UNIT_CODED_SLICE_IDR_N_LP )
@@ -2012,6 +2015,9 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
     pcPic->scheduler.init( pcPic->cs->pcv->heightInCtus, pcPic->cs->pcv->widthInCtus, 1                          , 0                             , m_pcCfg->getNumSplitThreads() );
 #elif ENABLE_WPP_PARALLELISM
     pcPic->scheduler.init( pcPic->cs->pcv->heightInCtus, pcPic->cs->pcv->widthInCtus, m_pcCfg->getNumWppThreads(), m_pcCfg->getNumWppExtraLines(), 1                             );
+#endif
+#if ENABLE_WPP_PARALLELISM
+    pcPic->scheduler.setFirstDataId( firstDataId );
 #endif
     pcPic->createTempBuffers( pcPic->cs->pps->pcv->maxCUWidth );
     pcPic->cs->createCoeffs();
@@ -2288,7 +2294,12 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
     }
     else
     {
+#if ENABLE_WPP_PARALLELISM
+      // the table of the last finished picture is kept in the first slice encoder
+      pcSlice->setEncCABACTableIdx( m_pcEncLib->getSliceEncoder()->getEncCABACTableIdx() );
+#else
       pcSlice->setEncCABACTableIdx( m_pcSliceEncoder->getEncCABACTableIdx() );
+#endif
     }
 
     if (pcSlice->getSliceType() == B_SLICE)
@@ -2619,10 +2630,28 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
       pcSlice->setscalingListAPS( scalingListAPS );
     }
 
+#if ENABLE_WPP_PARALLELISM
+    if( numFrames > 0 )
+    {
+      // the CU encoders of the frame thread work on a copy of the LMCS state of the picture
+      *m_pcEncLib->getReshaper( firstDataId ) = *m_pcReshaper;
+      xNextFrameStep();
+    }
+    EncSlice* sliceEncoder = m_pcEncLib->getSliceEncoder( sliceEncIdx );
+#else
+    EncSlice* sliceEncoder = m_pcSliceEncoder;
+#endif
+
     if( encPic )
     // now compress (trial encode) the various slice segments (slices, and dependent slices)
     {
       DTRACE_UPDATE( g_trace_ctx, ( std::make_pair( "poc", pocCurr ) ) );
+#if ENABLE_WPP_PARALLELISM
+      if( numFrames > 0 )
+      {
+        pcPic->scheduler.setWppThreadId( 0 );
+      }
+#endif
 
       pcSlice->setSliceCurStartCtuTsAddr( 0 );
 
@@ -2630,8 +2659,8 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
       const BrickMap& tileMap = *(pcPic->brickMap);
       for(uint32_t nextCtuTsAddr = 0; nextCtuTsAddr < numberOfCtusInFrame; )
       {
-        m_pcSliceEncoder->precompressSlice( pcPic );
-        m_pcSliceEncoder->compressSlice   ( pcPic, false, false );
+        sliceEncoder->precompressSlice( pcPic );
+        sliceEncoder->compressSlice   ( pcPic, false, false );
 
         const uint32_t curSliceEnd = pcSlice->getSliceCurEndCtuTsAddr();
         pcSlice->setSliceIndex(sliceIdx);
@@ -2639,7 +2668,7 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
         {
           uint32_t independentSliceIdx = pcSlice->getIndependentSliceIdx();
           pcPic->allocateNewSlice();
-          m_pcSliceEncoder->setSliceSegmentIdx      (uiNumSliceSegments);
+          sliceEncoder->setSliceSegmentIdx      (uiNumSliceSegments);
           // prepare for next slice
           pcSlice = pcPic->slices[uiNumSliceSegments];
           CHECK(!(pcSlice->getPPS() != 0), "Unspecified error");
@@ -2668,7 +2697,19 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
         }
         nextCtuTsAddr = curSliceEnd;
       }
+    }
+
+#if ENABLE_WPP_PARALLELISM
+    if( numFrames > 0 )
+    {
+      xWaitFrameStep( numFrames + frameIdx );
+      m_pcSliceEncoder = sliceEncoder;
+      m_pcReshaper     = m_pcEncLib->getReshaper( firstDataId );
+    }
+#endif
 
+    if( encPic )
+    {
       duData.clear();
 
       CodingStructure& cs = *pcPic->cs;
@@ -2767,7 +2808,7 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
 
         m_pcSAO->SAOProcess( cs, sliceEnabled, pcSlice->getLambdas(),
 #if ENABLE_QPA
-                             (m_pcCfg->getUsePerceptQPA() && !m_pcCfg->getUseRateCtrl() && pcSlice->getPPS()->getUseDQP() ? m_pcEncLib->getRdCost (PARL_PARAM0 (0))->getChromaWeight() : 0.0),
+                             (m_pcCfg->getUsePerceptQPA() && !m_pcCfg->getUseRateCtrl() && pcSlice->getPPS()->getUseDQP() ? m_pcEncLib->getRdCost( PARL_PARAM0( firstDataId ) )->getChromaWeight() : 0.0),
 #endif
                              m_pcCfg->getTestSAODisableAtPictureLevel(), m_pcCfg->getSaoEncodingRate(), m_pcCfg->getSaoEncodingRateChroma(), m_pcCfg->getSaoCtuBoundary(), m_pcCfg->getSaoGreedyMergeEnc() );
         //assign SAO slice header
@@ -2791,7 +2832,7 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
         m_pcALF->initCABACEstimator(m_pcEncLib->getCABACEncoder(), m_pcEncLib->getCtxCache(), pcSlice, m_pcEncLib->getApsMap());
         m_pcALF->ALFProcess(cs, pcSlice->getLambdas()
 #if ENABLE_QPA
-          , (m_pcCfg->getUsePerceptQPA() && !m_pcCfg->getUseRateCtrl() && pcSlice->getPPS()->getUseDQP() ? m_pcEncLib->getRdCost(PARL_PARAM0(0))->getChromaWeight() : 0.0)
+          , (m_pcCfg->getUsePerceptQPA() && !m_pcCfg->getUseRateCtrl() && pcSlice->getPPS()->getUseDQP() ? m_pcEncLib->getRdCost( PARL_PARAM0( firstDataId ) )->getChromaWeight() : 0.0)
 #endif
         );
 
@@ -3148,24 +3189,65 @@ void EncGOP::compressGOP( int iPOCLast, int iNumPicRcvd, PicList& rcListPic,
     }
     /* logging: insert a newline at end of picture period */
 
+    pcPic->destroyTempBuffers();
+    pcPic->cs->destroyCoeffs();
+    pcPic->cs->releaseIntermediateData();
+#if ENABLE_WPP_PARALLELISM
+    if( numFrames > 0 )
+    {
+      m_pcEncLib->getSliceEncoder()->setEncCABACTableIdx( sliceEncoder->getEncCABACTableIdx() );
+      xNextFrameStep();
+    }
+#endif
+  };
+
+#if ENABLE_WPP_PARALLELISM
+  if( m_pcEncLib->getNumSliceEncoders() > 1 )
+  {
+    std::vector<int> gopIds;
+    for( int iGOPid = 0; iGOPid < m_iGopSize; )
+    {
+      iGOPid += xGetFrameBatch( iGOPid, iPOCLast, iNumPicRcvd, gopIds );
+
+      const int numFrames = (int) gopIds.size();
+      if( numFrames == 1 )
+      {
+        encodePicture( gopIds[0], 0, 0 );
+      }
+      else if( numFrames > 1 )
+      {
+        m_frameStep = 0;
+        #pragma omp parallel num_threads( numFrames )
+        {
+          CHECK( omp_get_num_threads() != numFrames, "Not enough threads for the batch of pictures" );
+          encodePicture( gopIds[omp_get_thread_num()], omp_get_thread_num(), numFrames );
+        }
+      }
+    }
+    m_pcSliceEncoder = m_pcEncLib->getSliceEncoder();
+    m_pcReshaper     = m_pcEncLib->getReshaper();
+  }
+  else
+#endif
+  for ( int iGOPid=0; iGOPid < m_iGopSize; iGOPid++ )
+  {
+    if (m_pcCfg->getEfficientFieldIRAPEnabled())
+    {
+      iGOPid=effFieldIRAPMap.adjustGOPid(iGOPid);
+    }
+
+    encodePicture( iGOPid, 0, 0 );
+
     if (m_pcCfg->getEfficientFieldIRAPEnabled())
     {
       iGOPid=effFieldIRAPMap.restoreGOPid(iGOPid);
     }
-
-    pcPic->destroyTempBuffers();
-    pcPic->cs->destroyCoeffs();
-    pcPic->cs->releaseIntermediateData();
   } // iGOPid-loop
 
   delete pcBitstreamRedirect;
 
   CHECK(!( (m_iNumPicCoded == iNumPicRcvd) ), "Unspecified error");
 
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfCompressGOP     = timeOfCompressGOP + duration.count();
-
 }
 
 void EncGOP::printOutSummary( uint32_t uiNumAllPicCoded, bool isField, const bool printMSEBasedSNR, const bool printSequenceMSE, const bool printHexPsnr, const bool printRprPSNR, const BitDepths &bitDepths )
@@ -3366,6 +3448,72 @@ void EncGOP::xGetBuffer( PicList&                  rcListPic,
   return;
 }
 
+#if ENABLE_WPP_PARALLELISM
+/** collects the next pictures of the GOP, starting at firstGOPid, which can be encoded in parallel
+ * \returns the number of GOP entries consumed, gopIds gets the entries to be encoded
+ *
+ * The pictures of a batch do not reference each other and an intra picture is always encoded alone.
+ * Field coding and the composite reference are not supported with frame threads, see EncAppCfg.
+ */
+int EncGOP::xGetFrameBatch( int firstGOPid, int iPOCLast, int iNumPicRcvd, std::vector<int>& gopIds )
+{
+  const int maxFrames = std::min<int>( m_pcCfg->getNumFrameThreads(), omp_get_thread_limit() );
+  std::vector<int> batchPOCs;
+
+  gopIds.clear();
+
+  int gopId = firstGOPid;
+  for( ; gopId < m_iGopSize && (int) gopIds.size() < maxFrames; gopId++ )
+  {
+    const int pocCurr = iPOCLast == 0 ? 0 : iPOCLast - iNumPicRcvd + m_pcCfg->getGOPEntry( gopId ).m_POC;
+    if( pocCurr >= m_pcCfg->getFramesToBeEncoded() )
+    {
+      // skipped by compressGOP
+      continue;
+    }
+
+    const bool isIntra = pocCurr == 0 || m_iGopSize == 1 || m_pcCfg->getGOPEntry( gopId ).m_sliceType == 'I' || ( m_pcCfg->getIntraPeriod() > 0 && pocCurr % m_pcCfg->getIntraPeriod() == 0 );
+    bool independent   = !isIntra;
+    const int rplIdx   = m_pcEncLib->getRPLIdx( pocCurr, gopId );
+    for( int l = 0; l < 2 && independent; l++ )
+    {
+      const RPLEntry& rpl = m_pcCfg->getRPLEntry( l, rplIdx );
+      for( int i = 0; i < rpl.m_numRefPics && independent; i++ )
+      {
+        independent = std::find( batchPOCs.begin(), batchPOCs.end(), pocCurr - rpl.m_deltaRefPics[i] ) == batchPOCs.end();
+      }
+    }
+
+    if( !gopIds.empty() && !independent )
+    {
+      break;
+    }
+    gopIds.push_back( gopId );
+    batchPOCs.push_back( pocCurr );
+    if( isIntra )
+    {
+      gopId++;
+      break;
+    }
+  }
+
+  return gopId - firstGOPid;
+}
+
+void EncGOP::xWaitFrameStep( int step )
+{
+  std::unique_lock<std::mutex> lock( m_frameStepMutex );
+  m_frameStepCond.wait( lock, [&]{ return m_frameStep == step; } );
+}
+
+void EncGOP::xNextFrameStep()
+{
+  std::unique_lock<std::mutex> lock( m_frameStepMutex );
+  m_frameStep++;
+  m_frameStepCond.notify_all();
+}
+#endif
+
 #if ENABLE_QPA
 
 #ifndef BETA
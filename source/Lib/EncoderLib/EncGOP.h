@@ -61,6 +61,10 @@
 #include "RateCtrl.h"
 #include <vector>
 #include "EncHRD.h"
+#if ENABLE_WPP_PARALLELISM
+#include <mutex>
+#include <condition_variable>
+#endif
 
 #if JVET_O0756_CALCULATE_HDRMETRICS
 #include "HDRLib/inc/ConvertColorFormat.H"
@@ -74,8 +78,6 @@
 //! \ingroup EncoderLib
 //! \{
 
-extern long long int timeOfCompressGOP;
-
 class EncLib;
 
 // ====================================================================================================================
@@ -185,6 +187,14 @@ private:
 
   AUWriterIf*             m_AUWriterIf;
 
+#if ENABLE_WPP_PARALLELISM
+  // frame-parallel encoding: the pictures of a batch pass the sequential steps one after another,
+  // step i prepares the i-th picture, step numFrames + i finishes it
+  std::mutex              m_frameStepMutex;
+  std::condition_variable m_frameStepCond;
+  int                     m_frameStep;
+#endif
+
 #if JVET_O0756_CALCULATE_HDRMETRICS
 
   hdrtoolslib::Frame **m_ppcFrameOrg;
@@ -269,6 +279,11 @@ protected:
 
   void  xGetBuffer        ( PicList& rcListPic, std::list<PelUnitBuf*>& rcListPicYuvRecOut,
                             int iNumPicRcvd, int iTimeOffset, Picture*& rpcPic, int pocCurr, bool isField );
+#if ENABLE_WPP_PARALLELISM
+  int   xGetFrameBatch    ( int firstGOPid, int iPOCLast, int iNumPicRcvd, std::vector<int>& gopIds );
+  void  xWaitFrameStep    ( int step );
+  void  xNextFrameStep    ();
+#endif
 
 #if JVET_O0756_CALCULATE_HDRMETRICS
   void xCalculateHDRMetrics ( Picture* pcPic, double deltaE[hdrtoolslib::NB_REF_WHITE], double psnrL[hdrtoolslib::NB_REF_WHITE]);
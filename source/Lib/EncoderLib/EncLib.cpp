@@ -44,6 +44,8 @@
 #include "CommonLib/Picture.h"
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/ChromaFormat.h"
+#include "CommonLib/ApproximatAdderSubtraction.h"
+#include "CommonLib/Profiler.h"
 #if ENABLE_SPLIT_PARALLELISM
 #include <omp.h>
 #endif
@@ -94,6 +96,14 @@ void EncLib::create ()
 {
   // initialize global variables
   initROM();
+  setApproxProfile( m_approxAdder, m_approxWidth, m_approxBits, m_approxSites );
+  g_pelBufOP.initApproxProfile( g_approxProfile );
+#if ENABLE_PROFILING
+  if( Profiler::getKernelStats() )
+  {
+    RdCost::initDistFuncStats();
+  }
+#endif
   TComHash::initBlockSizeToIndex();
   m_iPOCLast = m_compositeRefEnabled ? -2 : -1;
   // create processing unit classes
@@ -106,6 +116,10 @@ void EncLib::create ()
 #endif
 #if ENABLE_WPP_PARALLELISM
   m_numCuEncStacks *= ( m_numWppThreads + m_numWppExtraLines );
+  // with frame threads, the sequential parts keep their own slice encoder and stacks
+  m_numSliceEncoders = m_numFrameThreads > 1 ? m_numFrameThreads + 1 : 1;
+  m_numCuEncStacks  *= m_numSliceEncoders;
+  m_cSliceEncoder    = new EncSlice          [m_numSliceEncoders];
 #endif
 
   m_cCuEncoder      = new EncCu              [m_numCuEncStacks];
@@ -155,7 +169,14 @@ void EncLib::destroy ()
 {
   // destroy processing unit classes
   m_cGOPEncoder.        destroy();
+#if ENABLE_WPP_PARALLELISM
+  for( int sId = 0; sId < m_numSliceEncoders; sId++ )
+  {
+    m_cSliceEncoder[sId].destroy();
+  }
+#else
   m_cSliceEncoder.      destroy();
+#endif
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   for( int jId = 0; jId < m_numCuEncStacks; jId++ )
   {
@@ -200,6 +221,9 @@ void EncLib::destroy ()
   delete[] m_cRdCost;
   delete[] m_CtxCache;
 #endif
+#if ENABLE_WPP_PARALLELISM
+  delete[] m_cSliceEncoder;
+#endif
 
 
 
@@ -234,6 +258,13 @@ void EncLib::init( bool isFieldCoding, AUWriterIf* auWriterIf )
   }
   omp_set_nested( true );
 #endif
+#if ENABLE_WPP_PARALLELISM
+  if( m_numFrameThreads > 1 && omp_get_dynamic() )
+  {
+    // each picture of a batch needs its own thread
+    omp_set_dynamic( false );
+  }
+#endif
 
   if (getUseCompositeRef() || getDependentRAPIndicationSEIEnabled())
   {
@@ -304,7 +335,16 @@ void EncLib::init( bool isFieldCoding, AUWriterIf* auWriterIf )
 
   // initialize processing unit classes
   m_cGOPEncoder.  init( this );
+#if ENABLE_WPP_PARALLELISM
+  for( int sId = 0; sId < m_numSliceEncoders; sId++ )
+  {
+    m_cSliceEncoder[sId].init( this, sps0, sId * getNumCuEncStacksPerSliceEncoder(), getNumCuEncStacksPerSliceEncoder() );
+  }
+#elif ENABLE_SPLIT_PARALLELISM
+  m_cSliceEncoder.init( this, sps0, 0, m_numCuEncStacks );
+#else
   m_cSliceEncoder.init( this, sps0 );
+#endif
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   for( int jId = 0; jId < m_numCuEncStacks; jId++ )
   {
@@ -405,9 +445,6 @@ void EncLib::init( bool isFieldCoding, AUWriterIf* auWriterIf )
   {
     xInitScalingLists( sps0, *m_apsMap.getPS( ENC_PPS_ID_RPR ) );
   }
-#if ENABLE_WPP_PARALLELISM
-  m_entropyCodingSyncContextStateVec.resize( pps0.pcv->heightInCtus );
-#endif
   if (getUseCompositeRef())
   {
     Picture *picBg = new Picture;
@@ -1497,16 +1534,9 @@ void EncLib::getActiveRefPicListNumForPOC(const SPS *sps, int POCCurr, int GOPid
   *activeL1 = rpl1->getNumberOfActivePictures();
 }
 
-void EncLib::selectReferencePictureList(Slice* slice, int POCCurr, int GOPid, int ltPoc)
+int EncLib::getRPLIdx(int POCCurr, int GOPid) const
 {
-  bool isEncodeLtRef = (POCCurr == ltPoc);
-  if (m_compositeRefEnabled && isEncodeLtRef)
-  {
-    POCCurr++;
-  }
-
-  slice->setRPL0idx(GOPid);
-  slice->setRPL1idx(GOPid);
+  int rplIdx = GOPid;
 
   int fullListNum = m_iGOPSize;
   int partialListNum = getRPLCandidateSize(0) - m_iGOPSize;
@@ -1515,13 +1545,11 @@ void EncLib::selectReferencePictureList(Slice* slice, int POCCurr, int GOPid, in
   {
     if (POCCurr < 10)
     {
-      slice->setRPL0idx(POCCurr + m_iGOPSize - 1);
-      slice->setRPL1idx(POCCurr + m_iGOPSize - 1);
+      rplIdx = POCCurr + m_iGOPSize - 1;
     }
     else
     {
-      slice->setRPL0idx((POCCurr%m_iGOPSize == 0) ? m_iGOPSize - 1 : POCCurr%m_iGOPSize - 1);
-      slice->setRPL1idx((POCCurr%m_iGOPSize == 0) ? m_iGOPSize - 1 : POCCurr%m_iGOPSize - 1);
+      rplIdx = (POCCurr%m_iGOPSize == 0) ? m_iGOPSize - 1 : POCCurr%m_iGOPSize - 1;
     }
     extraNum = fullListNum + partialListNum;
   }
@@ -1534,12 +1562,25 @@ void EncLib::selectReferencePictureList(Slice* slice, int POCCurr, int GOPid, in
         POCIndex = m_uiIntraPeriod;
       if (POCIndex == m_RPLList0[extraNum].m_POC)
       {
-        slice->setRPL0idx(extraNum);
-        slice->setRPL1idx(extraNum);
+        rplIdx = extraNum;
         extraNum++;
       }
     }
   }
+  return rplIdx;
+}
+
+void EncLib::selectReferencePictureList(Slice* slice, int POCCurr, int GOPid, int ltPoc)
+{
+  bool isEncodeLtRef = (POCCurr == ltPoc);
+  if (m_compositeRefEnabled && isEncodeLtRef)
+  {
+    POCCurr++;
+  }
+
+  const int rplIdx = getRPLIdx(POCCurr, GOPid);
+  slice->setRPL0idx(rplIdx);
+  slice->setRPL1idx(rplIdx);
 
   const ReferencePictureList *rpl0 = (slice->getSPS()->getRPLList0()->getReferencePictureList(slice->getRPL0idx()));
   const ReferencePictureList *rpl1 = (slice->getSPS()->getRPLList1()->getReferencePictureList(slice->getRPL1idx()));
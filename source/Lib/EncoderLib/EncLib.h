@@ -107,7 +107,11 @@ private:
 
   // processing unit
   EncGOP                    m_cGOPEncoder;                        ///< GOP encoder
+#if ENABLE_WPP_PARALLELISM
+  EncSlice                 *m_cSliceEncoder;                      ///< slice encoders, see getSliceEncoder
+#else
   EncSlice                  m_cSliceEncoder;                      ///< slice encoder
+#endif
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   EncCu                    *m_cCuEncoder;                         ///< CU encoder
 #else
@@ -133,6 +137,9 @@ private:
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   int                       m_numCuEncStacks;
 #endif
+#if ENABLE_WPP_PARALLELISM
+  int                       m_numSliceEncoders;
+#endif
 
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   CacheModel                m_cacheModel;
@@ -153,10 +160,6 @@ private:
 public:
   SPS*                      getSPS( int spsId ) { return m_spsMap.getPS( spsId ); };
   APS**                     getApss() { return m_apss; }
-  Ctx                       m_entropyCodingSyncContextState;      ///< leave in addition to vector for compatibility
-#if ENABLE_WPP_PARALLELISM
-  std::vector<Ctx>          m_entropyCodingSyncContextStateVec;   ///< context storage for state of contexts at the wavefront/WPP/entropy-coding-sync second CTU of tile-row
-#endif
 
 protected:
   void  xGetNewPicBuffer  ( std::list<PelUnitBuf*>& rcListPicYuvRecOut, Picture*& rpcPic, int ppsId ); ///< get picture buffer which will be processed. If ppsId<0, then the ppsMap will be queried for the first match.
@@ -202,7 +205,12 @@ public:
   EncSampleAdaptiveOffset* getSAO               ()              { return  &m_cEncSAO;              }
   EncAdaptiveLoopFilter*  getALF                ()              { return  &m_cEncALF;              }
   EncGOP*                 getGOPEncoder         ()              { return  &m_cGOPEncoder;          }
+#if ENABLE_WPP_PARALLELISM
+  // slice encoder 0 is used for the sequential encoding, with NumFrameThreads > 1 the frame threads use 1..NumFrameThreads
+  EncSlice*               getSliceEncoder       ( int sId = 0 ) { return  &m_cSliceEncoder[sId];   }
+#else
   EncSlice*               getSliceEncoder       ()              { return  &m_cSliceEncoder;        }
+#endif
   EncHRD*                 getHRD                ()              { return  &m_encHRD;               }
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   EncCu*                  getCuEncoder          ( int jId = 0 ) { return  &m_cCuEncoder[jId];      }
@@ -225,6 +233,8 @@ public:
 
 
   void                    getActiveRefPicListNumForPOC(const SPS *sps, int POCCurr, int GOPid, uint32_t *activeL0, uint32_t *activeL1);
+  // index of the RPL candidates in the SPS used by the picture POCCurr at GOPid of the GOP structure
+  int                     getRPLIdx(int POCCurr, int GOPid) const;
   void                    selectReferencePictureList(Slice* slice, int POCCurr, int GOPid, int ltPoc);
 
   void                   setParamSetChanged(int spsId, int ppsId);
@@ -238,6 +248,11 @@ public:
   void                   setNumCuEncStacks( int n )             { m_numCuEncStacks = n; }
   int                    getNumCuEncStacks()              const { return m_numCuEncStacks; }
 #endif
+#if ENABLE_WPP_PARALLELISM
+  int                    getNumSliceEncoders()            const { return m_numSliceEncoders; }
+  // each slice encoder works on its own consecutive range of CU encoder stacks
+  int                    getNumCuEncStacksPerSliceEncoder() const { return m_numCuEncStacks / m_numSliceEncoders; }
+#endif
 
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
   EncReshape*            getReshaper( int jId = 0 )             { return  &m_cReshaper[jId]; }
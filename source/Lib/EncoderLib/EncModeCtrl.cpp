@@ -46,16 +46,9 @@
 #include "CommonLib/UnitTools.h"
 
 #include "CommonLib/dtrace_next.h"
+#include "CommonLib/Profiler.h"
 
 #include <cmath>
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-long long int timeOfInterHadActive = 0;
 
 void EncModeCtrl::init( EncCfg *pCfg, RateCtrl *pRateCtrl, RdCost* pRdCost )
 {
@@ -1029,14 +1022,24 @@ void BestEncInfoCache::copyState(const BestEncInfoCache &other, const UnitArea &
             {
               if( other.m_bestEncInfo[x][y][wIdx][hIdx]->temporalId > m_bestEncInfo[x][y][wIdx][hIdx]->temporalId )
               {
+                m_bestEncInfo[x][y][wIdx][hIdx]->cu.repositionTo( other.m_bestEncInfo[x][y][wIdx][hIdx]->cu );
+                m_bestEncInfo[x][y][wIdx][hIdx]->pu.repositionTo( other.m_bestEncInfo[x][y][wIdx][hIdx]->pu );
                 m_bestEncInfo[x][y][wIdx][hIdx]->cu       = other.m_bestEncInfo[x][y][wIdx][hIdx]->cu;
                 m_bestEncInfo[x][y][wIdx][hIdx]->pu       = other.m_bestEncInfo[x][y][wIdx][hIdx]->pu;
                 m_bestEncInfo[x][y][wIdx][hIdx]->numTus   = other.m_bestEncInfo[x][y][wIdx][hIdx]->numTus;
                 m_bestEncInfo[x][y][wIdx][hIdx]->poc      = other.m_bestEncInfo[x][y][wIdx][hIdx]->poc;
                 m_bestEncInfo[x][y][wIdx][hIdx]->testMode = other.m_bestEncInfo[x][y][wIdx][hIdx]->testMode;
+                m_bestEncInfo[x][y][wIdx][hIdx]->temporalId = m_currTemporalId;
 
                 for( int i = 0; i < m_bestEncInfo[x][y][wIdx][hIdx]->numTus; i++ )
-                  m_bestEncInfo[x][y][wIdx][hIdx]->tus[i] = other.m_bestEncInfo[x][y][wIdx][hIdx]->tus[i];
+                {
+                  // the units are assigned without their area, as in setFromCs the TUs also need to be resized
+                  TransformUnit&       tu      = m_bestEncInfo[x][y][wIdx][hIdx]->tus[i];
+                  const TransformUnit& otherTu = other.m_bestEncInfo[x][y][wIdx][hIdx]->tus[i];
+                  tu.repositionTo( otherTu );
+                  tu.resizeTo    ( otherTu );
+                  tu = otherTu;
+                }
               }
             }
             else if( y + ( height >> MIN_CU_LOG2 ) > maxPosY + 1 )
@@ -1069,12 +1072,9 @@ void BestEncInfoCache::touch(const UnitArea &area)
 
 static bool interHadActive( const ComprCUCtx& ctx )
 {
-  auto start  = high_resolution_clock::now();
+  PROFILE_ZONE( "interHadActive" );
   bool output = ctx.interHad != 0;
 
-  auto stop             = high_resolution_clock::now();
-  auto duration         = duration_cast<nanoseconds>(stop - start);
-  timeOfInterHadActive  = timeOfInterHadActive + duration.count();
   return output;
 }
 
@@ -1589,7 +1589,7 @@ bool EncModeCtrlMTnoRQT::tryMode( const EncTestMode& encTestmode, const CodingSt
     const Area curr_cu = CS::getArea(cs, cs.area, partitioner.chType).blocks[getFirstComponentOfChannel(partitioner.chType)];
     try
     {
-      double stored_cost = slice.m_mapPltCost.at(curr_cu.pos()).at(curr_cu.size());
+      double stored_cost = m_mapPltCost.at(curr_cu.pos()).at(curr_cu.size());
       if (bestMode.type != ETM_INVALID && stored_cost > cuECtx.bestCS->cost)
       {
         return false;
@@ -2096,7 +2096,7 @@ bool EncModeCtrlMTnoRQT::isParallelSplit( const CodingStructure &cs, Partitioner
   if( cs.pps->getUseDQP() && partitioner.currQgEnable() ) return false;
   const int numJobs = getNumParallelJobs( cs, partitioner );
   const int numPxl  = partitioner.currArea().Y().area();
-  const int parlAt  = m_pcEncCfg->getNumSplitThreads() <= 3 ? 1024 : 256;
+  const int parlAt  = m_pcEncCfg->getSplitParallelCuSize() * m_pcEncCfg->getSplitParallelCuSize();
   if(  cs.slice->isIntra() && numJobs > 2 && ( numPxl == parlAt || !partitioner.canSplit( CU_QUAD_SPLIT, cs ) ) ) return true;
   if( !cs.slice->isIntra() && numJobs > 1 && ( numPxl == parlAt || !partitioner.canSplit( CU_QUAD_SPLIT, cs ) ) ) return true;
   return false;
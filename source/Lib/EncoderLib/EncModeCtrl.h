@@ -47,8 +47,7 @@
 
 #include <typeinfo>
 #include <vector>
-
-extern long long int timeOfInterHadActive;
+#include <unordered_map>
 
 //////////////////////////////////////////////////////////////////////////
 // Encoder modes to try out
@@ -265,6 +264,7 @@ protected:
   InterSearch*          m_pcInterSearch;
 
   bool                  m_doPlt;
+  std::unordered_map< Position, std::unordered_map< Size, double> > m_mapPltCost;
 
 public:
 
@@ -325,6 +325,8 @@ public:
   void setInterSearch                 (InterSearch* pcInterSearch)   { m_pcInterSearch = pcInterSearch; }
   void   setPltEnc                    ( bool b )                { m_doPlt = b; }
   bool   getPltEnc()                                      const { return m_doPlt; }
+  void   clearPltCost                 ()                        { m_mapPltCost.clear(); }
+  void   setPltCost                   ( const Area& area, double cost ) { m_mapPltCost[area.pos()][area.size()] = cost; }
 
 protected:
   void xExtractFeatures ( const EncTestMode encTestmode, CodingStructure& cs );
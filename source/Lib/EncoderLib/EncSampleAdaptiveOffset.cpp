@@ -1130,6 +1130,13 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
                         , bool isCtuCrossedByVirtualBoundaries, int horVirBndryPos[], int verVirBndryPos[], int numHorVirBndry, int numVerVirBndry
                         )
 {
+  if( !isCtuCrossedByVirtualBoundaries )
+  {
+    getBlkStatsRows( compIdx, channelBitDepth, statsDataTypes, srcBlk, orgBlk, srcStride, orgStride, width, height,
+                     isLeftAvail, isRightAvail, isAboveAvail, isBelowAvail, isAboveLeftAvail, isAboveRightAvail, isCalculatePreDeblockSamples );
+    return;
+  }
+
   int x,y, startX, startY, endX, endY, edgeType, firstLineStartX, firstLineEndX;
   int8_t signLeft, signRight, signDown;
   int64_t *diff, *count;
@@ -1539,6 +1546,118 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
   }
 }
 
+/**
+ - getBlkStats without virtual boundaries
+ .
+ The edge classes are derived per row from the neighbouring samples, the sample ranges of the rows
+ match getBlkStats.
+ */
+void EncSampleAdaptiveOffset::getBlkStatsRows(const ComponentID compIdx, const int channelBitDepth, SAOStatData* statsDataTypes
+                        , Pel* srcBlk, Pel* orgBlk, int srcStride, int orgStride, int width, int height
+                        , bool isLeftAvail,  bool isRightAvail, bool isAboveAvail, bool isBelowAvail, bool isAboveLeftAvail, bool isAboveRightAvail
+                        , bool isCalculatePreDeblockSamples
+                        )
+{
+  const int* skipLinesR = m_skipLinesR[compIdx];
+  const int* skipLinesB = m_skipLinesB[compIdx];
+
+  for( int typeIdx = 0; typeIdx < NUM_SAO_NEW_TYPES; typeIdx++ )
+  {
+    SAOStatData& statsData = statsDataTypes[typeIdx];
+    statsData.reset();
+
+    const int skipR = skipLinesR[typeIdx];
+    const int skipB = skipLinesB[typeIdx];
+
+    if( typeIdx == SAO_TYPE_BO )
+    {
+      const int shiftBits = channelBitDepth - NUM_SAO_BO_CLASSES_LOG2;
+      const int startX    = !isCalculatePreDeblockSamples ? 0 : ( isRightAvail ? ( width - skipR ) : width );
+      const int endX      = !isCalculatePreDeblockSamples ? ( isRightAvail ? ( width - skipR ) : width ) : width;
+      const int endY      = isBelowAvail ? ( height - skipB ) : height;
+
+      for( int y = 0; y < endY; y++ )
+      {
+        m_bandStatsRow( srcBlk + y * srcStride, orgBlk + y * orgStride, startX, endX, shiftBits, statsData.diff, statsData.count );
+      }
+      if( isCalculatePreDeblockSamples && isBelowAvail )
+      {
+        for( int y = endY; y < endY + skipB; y++ )
+        {
+          m_bandStatsRow( srcBlk + y * srcStride, orgBlk + y * orgStride, 0, width, shiftBits, statsData.diff, statsData.count );
+        }
+      }
+      continue;
+    }
+
+    // neighbour offsets of the edge classes
+    int offsetA, offsetB;
+    switch( typeIdx )
+    {
+    case SAO_TYPE_EO_0:   offsetA = -1;             offsetB = 1;              break;
+    case SAO_TYPE_EO_90:  offsetA = -srcStride;     offsetB = srcStride;      break;
+    case SAO_TYPE_EO_135: offsetA = -srcStride - 1; offsetB = srcStride + 1;  break;
+    case SAO_TYPE_EO_45:  offsetA = -srcStride + 1; offsetB = srcStride - 1;  break;
+    default:
+      THROW( "Not a supported SAO type" );
+    }
+
+    int startX, endX, startY, endY;
+    int firstLineStartX, firstLineEndX;
+    if( typeIdx == SAO_TYPE_EO_90 )
+    {
+      startX = !isCalculatePreDeblockSamples ? 0 : ( isRightAvail ? ( width - skipR ) : width );
+      endX   = !isCalculatePreDeblockSamples ? ( isRightAvail ? ( width - skipR ) : width ) : width;
+      startY = isAboveAvail ? 0 : 1;
+      endY   = isBelowAvail ? ( height - skipB ) : ( height - 1 );
+      firstLineStartX = startX;
+      firstLineEndX   = endX;
+    }
+    else
+    {
+      startX = !isCalculatePreDeblockSamples ? ( isLeftAvail  ? 0 : 1 ) : ( isRightAvail ? ( width - skipR ) : ( width - 1 ) );
+      endX   = !isCalculatePreDeblockSamples ? ( isRightAvail ? ( width - skipR ) : ( width - 1 ) ) : ( isRightAvail ? width : ( width - 1 ) );
+      startY = 0;
+      if( typeIdx == SAO_TYPE_EO_0 )
+      {
+        endY = isBelowAvail ? ( height - skipB ) : height;
+        firstLineStartX = startX;
+        firstLineEndX   = endX;
+      }
+      else
+      {
+        endY = isBelowAvail ? ( height - skipB ) : ( height - 1 );
+        if( typeIdx == SAO_TYPE_EO_135 )
+        {
+          firstLineStartX = !isCalculatePreDeblockSamples ? ( isAboveLeftAvail ? 0 : 1 ) : startX;
+          firstLineEndX   = !isCalculatePreDeblockSamples ? ( isAboveAvail ? endX : 1 ) : endX;
+        }
+        else
+        {
+          firstLineStartX = !isCalculatePreDeblockSamples ? ( isAboveAvail ? startX : endX ) : startX;
+          firstLineEndX   = !isCalculatePreDeblockSamples ? ( ( !isRightAvail && isAboveRightAvail ) ? width : endX ) : endX;
+        }
+      }
+    }
+
+    for( int y = startY; y < endY; y++ )
+    {
+      const Pel* srcLine = srcBlk + y * srcStride;
+      m_edgeStatsRow( srcLine, srcLine + offsetA, srcLine + offsetB, orgBlk + y * orgStride, y == 0 ? firstLineStartX : startX, y == 0 ? firstLineEndX : endX, statsData.diff, statsData.count );
+    }
+    if( isCalculatePreDeblockSamples && isBelowAvail )
+    {
+      const int preStartX = typeIdx == SAO_TYPE_EO_90 ? 0     : ( isLeftAvail  ? 0     : 1 );
+      const int preEndX   = typeIdx == SAO_TYPE_EO_90 ? width : ( isRightAvail ? width : ( width - 1 ) );
+      for( int y = endY; y < endY + skipB; y++ )
+      {
+        const Pel* srcLine = srcBlk + y * srcStride;
+        m_edgeStatsRow( srcLine, srcLine + offsetA, srcLine + offsetB, orgBlk + y * orgStride, preStartX, preEndX, statsData.diff, statsData.count );
+      }
+    }
+  }
+}
+
 void EncSampleAdaptiveOffset::deriveLoopFilterBoundaryAvailibility(CodingStructure& cs, const Position &pos, bool& isLeftAvail, bool& isAboveAvail, bool& isAboveLeftAvail) const
 {
   bool isLoopFiltAcrossTilePPS = cs.pps->getLoopFilterAcrossBricksEnabledFlag();
@@ -83,19 +83,23 @@ void EncSlice::destroy()
   m_viRdPicQp.clear();
 }
 
-void EncSlice::init( EncLib* pcEncLib, const SPS& sps )
+void EncSlice::init( EncLib* pcEncLib, const SPS& sps PARL_PARAM( int firstCuEncStack ) PARL_PARAM( int numCuEncStacks ) )
 {
   m_pcCfg             = pcEncLib;
   m_pcLib             = pcEncLib;
   m_pcListPic         = pcEncLib->getListPic();
 
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+  m_firstCuEncStack   = firstCuEncStack;
+  m_numCuEncStacks    = numCuEncStacks;
+#endif
   m_pcGOPEncoder      = pcEncLib->getGOPEncoder();
-  m_pcCuEncoder       = pcEncLib->getCuEncoder();
-  m_pcInterSearch     = pcEncLib->getInterSearch();
-  m_CABACWriter       = pcEncLib->getCABACEncoder()->getCABACWriter   (&sps);
-  m_CABACEstimator    = pcEncLib->getCABACEncoder()->getCABACEstimator(&sps);
-  m_pcTrQuant         = pcEncLib->getTrQuant();
-  m_pcRdCost          = pcEncLib->getRdCost();
+  m_pcCuEncoder       = pcEncLib->getCuEncoder( PARL_PARAM0( firstCuEncStack ) );
+  m_pcInterSearch     = pcEncLib->getInterSearch( PARL_PARAM0( firstCuEncStack ) );
+  m_CABACWriter       = pcEncLib->getCABACEncoder( PARL_PARAM0( firstCuEncStack ) )->getCABACWriter   (&sps);
+  m_CABACEstimator    = pcEncLib->getCABACEncoder( PARL_PARAM0( firstCuEncStack ) )->getCABACEstimator(&sps);
+  m_pcTrQuant         = pcEncLib->getTrQuant( PARL_PARAM0( firstCuEncStack ) );
+  m_pcRdCost          = pcEncLib->getRdCost( PARL_PARAM0( firstCuEncStack ) );
 
   // create lambda and QP arrays
   m_vdRdPicLambda.resize(m_pcCfg->getDeltaQpRD() * 2 + 1 );
@@ -652,8 +656,16 @@ void EncSlice::initEncSlice(Picture* pcPic, const int pocLast, const int pocCurr
 
   if( ( m_pcCfg->getIBCHashSearch() && m_pcCfg->getIBCMode() ) || m_pcCfg->getAllowDisFracMMVD() )
   {
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+    for( int jId = m_firstCuEncStack; jId < m_firstCuEncStack + m_numCuEncStacks; jId++ )
+    {
+      m_pcLib->getCuEncoder( jId )->getIbcHashMap().destroy();
+      m_pcLib->getCuEncoder( jId )->getIbcHashMap().init( pcPic->cs->pps->getPicWidthInLumaSamples(), pcPic->cs->pps->getPicHeightInLumaSamples() );
+    }
+#else
     m_pcCuEncoder->getIbcHashMap().destroy();
     m_pcCuEncoder->getIbcHashMap().init( pcPic->cs->pps->getPicWidthInLumaSamples(), pcPic->cs->pps->getPicHeightInLumaSamples() );
+#endif
   }
 }
 
@@ -1082,7 +1094,7 @@ void EncSlice::setSearchRange( Slice* pcSlice )
       int newSearchRange = Clip3(m_pcCfg->getMinSearchWindow(), iMaxSR, (iMaxSR*ADAPT_SR_SCALE*abs(iCurrPOC - iRefPOC)+iOffset)/iGOPSize);
       m_pcInterSearch->setAdaptiveSearchRange(iDir, iRefIdx, newSearchRange);
 #if ENABLE_WPP_PARALLELISM
-      for( int jId = 1; jId < m_pcLib->getNumCuEncStacks(); jId++ )
+      for( int jId = m_firstCuEncStack + 1; jId < m_firstCuEncStack + m_numCuEncStacks; jId++ )
       {
         m_pcLib->getInterSearch( jId )->setAdaptiveSearchRange( iDir, iRefIdx, newSearchRange );
       }
@@ -1200,6 +1212,8 @@ void EncSlice::calCostSliceI(Picture* pcPic) // TODO: this only analyses the fir
   m_pcRateCtrl->getRCPic()->setTotalIntraCost(iSumHadSlice);
 }
 
+void setJointCbCrModes( CodingStructure& cs, const Position topLeftLuma, const Size sizeLuma );
+
 /** \param pcPic   picture class
  */
 void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, const bool bFastDeltaQP )
@@ -1226,14 +1240,21 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
   m_CABACEstimator->initCtxModels( *pcSlice );
 
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
-  for( int jId = 1; jId < m_pcLib->getNumCuEncStacks(); jId++ )
+  for( int jId = m_firstCuEncStack + 1; jId < m_firstCuEncStack + m_numCuEncStacks; jId++ )
   {
     CABACWriter* cw = m_pcLib->getCABACEncoder( jId )->getCABACEstimator( pcSlice->getSPS() );
     cw->initCtxModels( *pcSlice );
   }
 
 #endif
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+  for( int jId = m_firstCuEncStack; jId < m_firstCuEncStack + m_numCuEncStacks; jId++ )
+  {
+    m_pcLib->getCuEncoder( jId )->getModeCtrl()->setFastDeltaQp( bFastDeltaQP );
+  }
+#else
   m_pcCuEncoder->getModeCtrl()->setFastDeltaQp(bFastDeltaQP);
+#endif
 
 
   //------------------------------------------------------------------------------
@@ -1274,6 +1295,9 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
   cs.slice    = pcSlice;
   cs.pcv      = pcSlice->getPPS()->pcv;
   cs.fracBits = 0;
+#if ENABLE_WPP_PARALLELISM
+  m_entropyCodingSyncContextStateVec.resize( cs.pcv->heightInCtus );
+#endif
 
   if( startCtuTsAddr == 0 && ( pcSlice->getPOC() != m_pcCfg->getSwitchPOC() || -1 == m_pcCfg->getDebugCTU() ) )
   {
@@ -1288,7 +1312,7 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
     {
       m_CABACEstimator->initCtxModels (*pcSlice);
 #if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
-      for (int jId = 1; jId < m_pcLib->getNumCuEncStacks(); jId++)
+      for (int jId = m_firstCuEncStack + 1; jId < m_firstCuEncStack + m_numCuEncStacks; jId++)
       {
         CABACWriter* cw = m_pcLib->getCABACEncoder (jId)->getCABACEstimator (pcSlice->getSPS());
         cw->initCtxModels (*pcSlice);
@@ -1304,28 +1328,107 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
 #endif // ENABLE_QPA
 
   bool checkPLTRatio = m_pcCfg->getIntraPeriod() != 1 && pcSlice->isIRAP();
-  if (checkPLTRatio)
+  const bool doPlt   = checkPLTRatio || m_pcLib->getPltEnc();
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+  for( int jId = m_firstCuEncStack; jId < m_firstCuEncStack + m_numCuEncStacks; jId++ )
   {
-    m_pcCuEncoder->getModeCtrl()->setPltEnc(true);
+    m_pcLib->getCuEncoder( jId )->getModeCtrl()->setPltEnc( doPlt );
   }
-  else
+#else
+  m_pcCuEncoder->getModeCtrl()->setPltEnc( doPlt );
+#endif
+
+  // picture level preparation, done once before the CTUs are distributed to the threads
+  if ( pcSlice->getSPS()->getFpelMmvdEnabledFlag() ||
+      (pcSlice->getSPS()->getIBCFlag() && m_pcCuEncoder->getEncCfg()->getIBCHashSearch()))
   {
-    bool doPlt = m_pcLib->getPltEnc();
-    m_pcCuEncoder->getModeCtrl()->setPltEnc(doPlt);
+    m_pcCuEncoder->getIbcHashMap().rebuildPicHashMap(cs.picture->getTrueOrigBuf());
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+    for( int jId = m_firstCuEncStack + 1; jId < m_firstCuEncStack + m_numCuEncStacks; jId++ )
+    {
+      m_pcLib->getCuEncoder( jId )->getIbcHashMap().rebuildPicHashMap( cs.picture->getTrueOrigBuf() );
+    }
+#endif
+    if (m_pcCfg->getIntraPeriod() != -1)
+    {
+      int hashBlkHitPerc = m_pcCuEncoder->getIbcHashMap().calHashBlkMatchPerc(cs.area.Y());
+      cs.slice->setDisableSATDForRD(hashBlkHitPerc > 59);
+    }
+  }
+  checkDisFracMmvd( pcPic, startCtuTsAddr, boundingCtuTsAddr );
+
+  if (pcSlice->getSPS()->getJointCbCrEnabledFlag())
+  {
+    setJointCbCrModes(cs, Position(0, 0), cs.area.lumaSize());
   }
 
+  if( cs.slice->getSliceType() == B_SLICE )
+  {
+    resetGbiCodingOrder(false, cs);
+  }
+#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
+  for( int jId = m_firstCuEncStack; jId < m_firstCuEncStack + m_numCuEncStacks; jId++ )
+  {
+    InterSearch* interSearch = m_pcLib->getInterSearch( jId );
+    if( jId > m_firstCuEncStack )
+    {
+      // e.g. the unadjusted lambda, which is only derived in the first stack
+      m_pcLib->getRdCost( jId )->copyState( *m_pcRdCost );
+    }
+    interSearch->resetAffineMVList();
+    interSearch->resetUniMvList();
+    if( cs.slice->getSliceType() == B_SLICE )
+    {
+      interSearch->initWeightIdxBits();
+    }
+    if( pcSlice->getSPS()->getUseReshaper() )
+    {
+      // the reshaper of the picture is derived in the first stack only
+      if( jId > m_firstCuEncStack )
+      {
+        *m_pcLib->getReshaper( jId ) = *m_pcLib->getReshaper( m_firstCuEncStack );
+      }
+      m_pcLib->getCuEncoder( jId )->setDecCuReshaperInEncCU( m_pcLib->getReshaper( jId ), pcSlice->getSPS()->getChromaFormatIdc() );
+    }
+  }
+#else
+  m_pcInterSearch->resetAffineMVList();
+  m_pcInterSearch->resetUniMvList();
+  if( cs.slice->getSliceType() == B_SLICE )
+  {
+    m_pcInterSearch->initWeightIdxBits();
+  }
+  if( pcSlice->getSPS()->getUseReshaper() )
+  {
+    m_pcCuEncoder->setDecCuReshaperInEncCU( m_pcLib->getReshaper(), pcSlice->getSPS()->getChromaFormatIdc() );
+  }
+#endif
+#if K0149_BLOCK_STATISTICS
+  const SPS *sps = pcSlice->getSPS();
+  CHECK(sps == 0, "No SPS present");
+  writeBlockStatisticsHeader(sps);
+#endif
+
 #if ENABLE_WPP_PARALLELISM
   bool bUseThreads = m_pcCfg->getNumWppThreads() > 1;
   if( bUseThreads )
   {
+    const int widthInCtus  = pcPic->cs->pcv->widthInCtus;
+    const int heightInCtus = pcPic->cs->pcv->heightInCtus;
+
     CHECK( startCtuTsAddr != 0 || boundingCtuTsAddr != pcPic->cs->pcv->sizeInCtus, "not intended" );
 
     pcPic->cs->allocateVectorsAtPicLevel();
+    pcPic->cs->motionLutRows.resize( heightInCtus );
+    pcPic->cs->prevPLTRows  .resize( heightInCtus );
+    // the slice may be compressed more than once, e.g. for the slice QP decision
+    pcPic->scheduler.resetWpp();
 
     omp_set_num_threads( m_pcCfg->getNumWppThreads() + m_pcCfg->getNumWppExtraLines() );
 
+    // each CTU row is encoded by the stacks of one thread, (ctuTsAddr / widthInCtus) % numThreads
     #pragma omp parallel for schedule(static,1) if(bUseThreads)
-    for( int ctuTsAddr = startCtuTsAddr; ctuTsAddr < boundingCtuTsAddr; ctuTsAddr += widthInCtus )
+    for( int ctuTsAddr = (int)startCtuTsAddr; ctuTsAddr < (int)boundingCtuTsAddr; ctuTsAddr += widthInCtus )
     {
       // wpp thread start
       pcPic->scheduler.setWppThreadId();
@@ -1335,16 +1438,12 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
       encodeCtus( pcPic, bCompressEntireSlice, bFastDeltaQP, ctuTsAddr, ctuTsAddr + widthInCtus, m_pcLib );
       // wpp thread stop
     }
+
+    m_uiPicTotalBits = uint64_t( cs.fracBits >> SCALE_BITS );
+    m_uiPicDist      = cs.dist;
   }
   else
 #endif
-#if K0149_BLOCK_STATISTICS
-  const SPS *sps = pcSlice->getSPS();
-  CHECK(sps == 0, "No SPS present");
-  writeBlockStatisticsHeader(sps);
-#endif
-  m_pcInterSearch->resetAffineMVList();
-  m_pcInterSearch->resetUniMvList();
   encodeCtus( pcPic, bCompressEntireSlice, bFastDeltaQP, startCtuTsAddr, boundingCtuTsAddr, m_pcLib );
   if (checkPLTRatio) m_pcLib->checkPltStats( pcPic );
 }
@@ -1449,7 +1548,8 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
   EncCfg*         pCfg            = pEncLib;
   RateCtrl*       pRateCtrl       = pEncLib->getRateCtrl();
 #if ENABLE_WPP_PARALLELISM
-  // first version dont use ctx from above
+  const bool      wppBitEqual     = pEncLib->getNumWppThreads() > 1 || pEncLib->getEnsureWppBitEqual();
+
   pCABACWriter->initCtxModels( *pcSlice );
 #endif
 #if RDOQ_CHROMA_LAMBDA
@@ -1464,23 +1564,6 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
   prevQP[0] = prevQP[1] = pcSlice->getSliceQp();
   currQP[0] = currQP[1] = pcSlice->getSliceQp();
 
-    prevQP[0] = prevQP[1] = pcSlice->getSliceQp();
-  if ( pcSlice->getSPS()->getFpelMmvdEnabledFlag() ||
-      (pcSlice->getSPS()->getIBCFlag() && m_pcCuEncoder->getEncCfg()->getIBCHashSearch()))
-  {
-    m_pcCuEncoder->getIbcHashMap().rebuildPicHashMap(cs.picture->getTrueOrigBuf());
-    if (m_pcCfg->getIntraPeriod() != -1)
-    {
-      int hashBlkHitPerc = m_pcCuEncoder->getIbcHashMap().calHashBlkMatchPerc(cs.area.Y());
-      cs.slice->setDisableSATDForRD(hashBlkHitPerc > 59);
-    }
-  }
-  checkDisFracMmvd( pcPic, startCtuTsAddr, boundingCtuTsAddr );
-
-  if (pcSlice->getSPS()->getJointCbCrEnabledFlag())
-  {
-    setJointCbCrModes(cs, Position(0, 0), cs.area.lumaSize());
-  }
 
   // for every CTU in the slice segment (may terminate sooner if there is a byte limit on the slice-segment)
   uint32_t startSliceRsRow = tileMap.getCtuBsToRsAddrMap(startCtuTsAddr) / widthInCtus;
@@ -1508,8 +1591,9 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
     if( pCfg->getSwitchPOC() != pcPic->poc || -1 == pCfg->getDebugCTU() )
     if ((cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag()) && ctuXPosInCtus == tileXPosInCtus)
     {
-      cs.motionLut.lut.resize(0);
-      cs.motionLut.lutIbc.resize(0);
+      LutMotionCand& motionLut = cs.getMotionLut( ctuArea );
+      motionLut.lut.resize(0);
+      motionLut.lutIbc.resize(0);
     }
 
 #if ENABLE_WPP_PARALLELISM
@@ -1519,30 +1603,38 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
     if (ctuRsAddr == firstCtuRsAddrOfTile)
     {
       pCABACWriter->initCtxModels( *pcSlice );
-      cs.resetPrevPLT(cs.prevPLT);
+      cs.resetPrevPLT(cs.getPrevPLT( ctuArea ));
+      prevQP[0] = prevQP[1] = pcSlice->getSliceQp();
+    }
+#if ENABLE_WPP_PARALLELISM
+    else if( ctuXPosInCtus == 0 && wppBitEqual )
+    {
+      // every line starts from the same state, no matter which thread encoded the line above:
+      // the contexts after the second CTU of the line above, the slice QP and empty predictor lists
+      pCABACWriter->initCtxModels( *pcSlice );
+      if( widthInCtus > 1 )
+      {
+        pCABACWriter->getCtx() = m_entropyCodingSyncContextStateVec[ctuYPosInCtus-1];  // last line
+      }
+      cs.resetPrevPLT(cs.getPrevPLT( ctuArea ));
       prevQP[0] = prevQP[1] = pcSlice->getSliceQp();
+      pEncLib->getInterSearch( dataId )->resetAffineMVList();
+      pEncLib->getInterSearch( dataId )->resetUniMvList();
     }
+#endif
     else if (ctuXPosInCtus == tileXPosInCtus && pEncLib->getEntropyCodingSyncEnabledFlag())
     {
       // reset and then update contexts to the state at the end of the top CTU (if within current slice and tile).
       pCABACWriter->initCtxModels( *pcSlice );
-      cs.resetPrevPLT(cs.prevPLT);
+      cs.resetPrevPLT(cs.getPrevPLT( ctuArea ));
       if( cs.getCURestricted( pos.offset(0, -1), pos, pcSlice->getIndependentSliceIdx(), tileMap.getBrickIdxRsMap( pos ), CH_L ) )
       {
         // Top is available, we use it.
-        pCABACWriter->getCtx() = pEncLib->m_entropyCodingSyncContextState;
+        pCABACWriter->getCtx() = m_entropyCodingSyncContextStateCtus;
       }
       prevQP[0] = prevQP[1] = pcSlice->getSliceQp();
     }
 
-#if ENABLE_WPP_PARALLELISM
-    if( ctuXPosInCtus == 0 && ctuYPosInCtus > 0 && widthInCtus > 1 && ( pEncLib->getNumWppThreads() > 1 || pEncLib->getEnsureWppBitEqual() ) )
-    {
-      pCABACWriter->getCtx() = pEncLib->m_entropyCodingSyncContextStateVec[ctuYPosInCtus-1];  // last line
-    }
-#else
-#endif
-
 #if RDOQ_CHROMA_LAMBDA && ENABLE_QPA && !ENABLE_QPA_SUB_CTU
     double oldLambdaArray[MAX_NUM_COMPONENT] = {0.0};
 #endif
@@ -1614,23 +1706,6 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
     }
 #endif
 
-    bool updateGbiCodingOrder = cs.slice->getSliceType() == B_SLICE && ctuTsAddr == startCtuTsAddr;
-    if( updateGbiCodingOrder )
-    {
-      resetGbiCodingOrder(false, cs);
-      m_pcInterSearch->initWeightIdxBits();
-    }
-    if (pcSlice->getSPS()->getUseReshaper())
-    {
-      m_pcCuEncoder->setDecCuReshaperInEncCU(m_pcLib->getReshaper(), pcSlice->getSPS()->getChromaFormatIdc());
-
-#if ENABLE_SPLIT_PARALLELISM || ENABLE_WPP_PARALLELISM
-      for (int jId = 1; jId < m_pcLib->getNumCuEncStacks(); jId++)
-      {
-        m_pcLib->getCuEncoder(jId)->setDecCuReshaperInEncCU(m_pcLib->getReshaper(jId), pcSlice->getSPS()->getChromaFormatIdc());
-      }
-#endif
-    }
     if( !cs.slice->isIntra() && pCfg->getMCTSEncConstraint() )
     {
       pcPic->mctsInfo.init( &cs, ctuRsAddr );
@@ -1674,14 +1749,18 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
 #endif
 
     // Store probabilities of first CTU in line into buffer - used only if wavefront-parallel-processing is enabled.
+#if ENABLE_WPP_PARALLELISM
+    if( ctuXPosInCtus == tileXPosInCtus && pEncLib->getEntropyCodingSyncEnabledFlag() && !wppBitEqual )
+#else
     if( ctuXPosInCtus == tileXPosInCtus && pEncLib->getEntropyCodingSyncEnabledFlag() )
+#endif
     {
-      pEncLib->m_entropyCodingSyncContextState = pCABACWriter->getCtx();
+      m_entropyCodingSyncContextStateCtus = pCABACWriter->getCtx();
     }
 #if ENABLE_WPP_PARALLELISM
-    if( ctuXPosInCtus == 1 && ( pEncLib->getNumWppThreads() > 1 || pEncLib->getEnsureWppBitEqual() ) )
+    if( ctuXPosInCtus == 1 && wppBitEqual )
     {
-      pEncLib->m_entropyCodingSyncContextStateVec[ctuYPosInCtus] = pCABACWriter->getCtx();
+      m_entropyCodingSyncContextStateVec[ctuYPosInCtus] = pCABACWriter->getCtx();
     }
 #endif
 
@@ -1740,7 +1819,13 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
     }
 #endif
 
-#if !ENABLE_WPP_PARALLELISM
+#if ENABLE_WPP_PARALLELISM
+    if( pCfg->getNumWppThreads() == 1 )
+    {
+      m_uiPicTotalBits = uint64_t( cs.fracBits >> SCALE_BITS );
+      m_uiPicDist      = cs.dist;
+    }
+#else
     m_uiPicTotalBits += actualBits;
     m_uiPicDist       = cs.dist;
 #endif
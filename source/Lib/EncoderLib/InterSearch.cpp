@@ -45,35 +45,14 @@
 #include "CommonLib/dtrace_next.h"
 #include "CommonLib/dtrace_buffer.h"
 #include "CommonLib/MCTS.h"
+#include "CommonLib/ApproximatAdderSubtraction.h"
 
 #include "EncModeCtrl.h"
 #include "EncLib.h"
+#include "CommonLib/Profiler.h"
 
 #include <math.h>
 #include <limits>
-#include <chrono>
-
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::nanoseconds;
-
-long long int timeOfXPredAffineInterSearch   = 0;
-long long int timeOfXPredAffineInterSearch_1 = 0;
-long long int timeOfXPredAffineInterSearch_2 = 0;
-long long int timeOfXPredAffineInterSearch_3 = 0;
-long long int timeOfXAffineMotionEstimation  = 0;
-long long int timeOfxCalcAffineMVBits        = 0;
-long long int timeOfXGetAffineTemplateCost   = 0;
-long long int timeOfAddAffMVInfo             = 0;
-long long int timeOfResetSavedAffineMotion   = 0;
-long long int timeOfXCheckBestAffineMVP      = 0;
-long long int timeOfXEstimateAffineAMVP      = 0;
-long long int timeOfXDetermineBestMvp        = 0;
-long long int timeOfXCopyAffineAMVPInfo      = 0;
-long long int timeOfStoreAffineMotion        = 0;
-long long int timeOfSolveEqual               = 0;
-long long int timeOfXPatternSearchFast       = 0;
 
 //! \ingroup EncoderLib
 //! \{
@@ -257,6 +236,12 @@ void InterSearch::init(EncCfg *pcEncCfg, TrQuant *pcTrQuant, int iSearchRange, i
   const ChromaFormat cform = pcEncCfg->getChromaFormatIdc();
   InterPrediction::init(pcRdCost, cform, maxCUHeight);
 
+  m_ifME.initInterpolationFilter(true);
+  if (g_approxProfile.isActive(APPROX_SITE_ME) || g_approxProfile.isActive(APPROX_SITE_MC))
+  {
+    m_ifME.setApproxAdder(g_approxProfile.adder);
+  }
+
   for (uint32_t i = 0; i < NUM_REF_PIC_LIST_01; i++)
   {
     m_tmpPredStorage[i].create(UnitArea(cform, Area(0, 0, MAX_CU_SIZE, MAX_CU_SIZE)));
@@ -284,7 +269,7 @@ void InterSearch::init(EncCfg *pcEncCfg, TrQuant *pcTrQuant, int iSearchRange, i
 
 void InterSearch::resetSavedAffineMotion()
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::resetSavedAffineMotion" );
   for (int i = 0; i < 2; i++)
   {
     for (int j = 0; j < 2; j++)
@@ -303,15 +288,11 @@ void InterSearch::resetSavedAffineMotion()
   }
   m_affineMotion.affine4ParaAvail = false;
   m_affineMotion.affine6ParaAvail = false;
-
-  auto stop                    = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfResetSavedAffineMotion = timeOfResetSavedAffineMotion + duration.count();
 }
 
 void InterSearch::storeAffineMotion(Mv acAffineMv[2][3], int16_t affineRefIdx[2], EAffineModel affineType, int gbiIdx)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::storeAffineMotion" );
   if ((gbiIdx == GBI_DEFAULT || !m_affineMotion.affine6ParaAvail) && affineType == AFFINEMODEL_6PARAM)
   {
     for (int i = 0; i < 2; i++)
@@ -337,10 +318,6 @@ void InterSearch::storeAffineMotion(Mv acAffineMv[2][3], int16_t affineRefIdx[2]
     }
     m_affineMotion.affine4ParaAvail = true;
   }
-
-  auto stop               = high_resolution_clock::now();
-  auto duration           = duration_cast<nanoseconds>(stop - start);
-  timeOfStoreAffineMotion = timeOfStoreAffineMotion + duration.count();
 }
 
 inline void InterSearch::xTZSearchHelp(IntTZSearchStruct &rcStruct, const int iSearchX, const int iSearchY,
@@ -3086,7 +3063,7 @@ void InterSearch::predInterSearch(CodingUnit &cu, Partitioner &partitioner)
 
 uint32_t InterSearch::xCalcAffineMVBits(PredictionUnit &pu, Mv acMvTemp[3], Mv acMvPred[3])
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xCalcAffineMVBits" );
   int  mvNum = pu.cu->affineType ? 3 : 2;
   m_pcRdCost->setCostScale(0);
   uint32_t bitsTemp = 0;
@@ -3102,10 +3079,6 @@ uint32_t InterSearch::xCalcAffineMVBits(PredictionUnit &pu, Mv acMvTemp[3], Mv a
     bitsTemp += m_pcRdCost->getBitsOfVectorWithPredictor(mv.getHor(), mv.getVer(), 0);
   }
 
-  auto stop               = high_resolution_clock::now();
-  auto duration           = duration_cast<nanoseconds>(stop - start);
-  timeOfxCalcAffineMVBits = timeOfxCalcAffineMVBits + duration.count();
-
   return bitsTemp;
 }
 
@@ -3289,7 +3262,7 @@ Distortion InterSearch::xGetAffineTemplateCost(PredictionUnit &pu, PelUnitBuf &o
                                                Mv acMvCand[3], int iMVPIdx, int iMVPNum, RefPicList eRefPicList,
                                                int iRefIdx)
 {
-  auto       start  = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xGetAffineTemplateCost" );
   Distortion uiCost = std::numeric_limits<Distortion>::max();
 
   const Picture *picRef = pu.cu->slice->getRefPic(eRefPicList, iRefIdx);
@@ -3312,10 +3285,6 @@ Distortion InterSearch::xGetAffineTemplateCost(PredictionUnit &pu, PelUnitBuf &o
   uiCost += m_pcRdCost->getCost(m_auiMVPIdxCost[iMVPIdx][iMVPNum]);
   DTRACE(g_trace_ctx, D_COMMON, " (%d) affineTemplateCost=%d\n", DTRACE_GET_COUNTER(g_trace_ctx, D_COMMON), uiCost);
 
-  auto stop                    = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfXGetAffineTemplateCost = timeOfXGetAffineTemplateCost + duration.count();
-
   return uiCost;
 }
 
@@ -3638,7 +3607,7 @@ void InterSearch::xPatternSearchFast(const PredictionUnit &pu, RefPicList eRefPi
                                      IntTZSearchStruct &cStruct, Mv &rcMv, Distortion &ruiSAD,
                                      const Mv *const pIntegerMv2Nx2NPred)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xPatternSearchFast" );
   switch (m_motionEstimationSearchMethod)
   {
   case MESEARCH_DIAMOND:
@@ -3656,9 +3625,6 @@ void InterSearch::xPatternSearchFast(const PredictionUnit &pu, RefPicList eRefPi
   case MESEARCH_FULL:   // shouldn't get here.
   default: break;
   }
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfXPatternSearchFast = timeOfXPatternSearchFast + duration.count();
 }
 
 void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, int iRefIdxPred,
@@ -4539,7 +4505,7 @@ void InterSearch::xPredAffineInterSearch(PredictionUnit &pu, PelUnitBuf &origBuf
                                          Distortion &affineCost, Mv hevcMv[2][33], Mv mvAffine4Para[2][33][3],
                                          int refIdx4Para[2], uint8_t gbiIdx, bool enforceGBiPred, uint32_t gbiIdxBits)
 {
-  auto         start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xPredAffineInterSearch" );
   const Slice &slice = *pu.cu->slice;
 
   affineCost = std::numeric_limits<Distortion>::max();
@@ -5290,15 +5256,11 @@ void InterSearch::xPredAffineInterSearch(PredictionUnit &pu, PelUnitBuf &origBuf
     pu.cu->GBiIdx = GBI_DEFAULT;
   }
   // <---- time of this section 21%
-
-  auto stop                    = high_resolution_clock::now();
-  auto duration                = duration_cast<nanoseconds>(stop - start);
-  timeOfXPredAffineInterSearch = timeOfXPredAffineInterSearch + duration.count();
 }
 
 void solveEqual(double dEqualCoeff[7][7], int iOrder, double *dAffinePara)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "solveEqual" );
   for (int k = 0; k < iOrder; k++)
   {
     dAffinePara[k] = 0.;
@@ -5333,9 +5295,6 @@ void solveEqual(double dEqualCoeff[7][7], int iOrder, double *dAffinePara)
     // elimination first column
     if (dEqualCoeff[i][i - 1] == 0.)
     {
-      auto stop        = high_resolution_clock::now();
-      auto duration    = duration_cast<nanoseconds>(stop - start);
-      timeOfSolveEqual = timeOfSolveEqual + duration.count();
       return;
     }
     for (int j = i + 1; j < iOrder + 1; j++)
@@ -5349,9 +5308,6 @@ void solveEqual(double dEqualCoeff[7][7], int iOrder, double *dAffinePara)
 
   if (dEqualCoeff[iOrder][iOrder - 1] == 0.)
   {
-    auto stop        = high_resolution_clock::now();
-    auto duration    = duration_cast<nanoseconds>(stop - start);
-    timeOfSolveEqual = timeOfSolveEqual + duration.count();
     return;
   }
   dAffinePara[iOrder - 1] = dEqualCoeff[iOrder][iOrder] / dEqualCoeff[iOrder][iOrder - 1];
@@ -5363,9 +5319,6 @@ void solveEqual(double dEqualCoeff[7][7], int iOrder, double *dAffinePara)
       {
         dAffinePara[k] = 0.;
       }
-      auto stop        = high_resolution_clock::now();
-      auto duration    = duration_cast<nanoseconds>(stop - start);
-      timeOfSolveEqual = timeOfSolveEqual + duration.count();
       return;
     }
     double temp = 0;
@@ -5380,7 +5333,7 @@ void solveEqual(double dEqualCoeff[7][7], int iOrder, double *dAffinePara)
 void InterSearch::xCheckBestAffineMVP(PredictionUnit &pu, AffineAMVPInfo &affineAMVPInfo, RefPicList eRefPicList,
                                       Mv acMv[3], Mv acMvPred[3], int &riMVPIdx, uint32_t &ruiBits, Distortion &ruiCost)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xCheckBestAffineMVP" );
 
   if (affineAMVPInfo.numCand < 2)
   {
@@ -5435,23 +5388,17 @@ void InterSearch::xCheckBestAffineMVP(PredictionUnit &pu, AffineAMVPInfo &affine
     //ruiBits = calculateSum(calculateSum(uiOrgBits , - iOrgMvBits, 8, 7) , iBestMvBits, 8, 7);
     ruiCost            = (ruiCost - m_pcRdCost->getCost(uiOrgBits)) + m_pcRdCost->getCost(ruiBits);
   }
-  auto stop                 = high_resolution_clock::now();
-  auto duration             = duration_cast<nanoseconds>(stop - start);
-  timeOfXCheckBestAffineMVP = timeOfXCheckBestAffineMVP + duration.count();
 }
 
 void InterSearch::xAffineMotionEstimation(PredictionUnit &pu, PelUnitBuf &origBuf, RefPicList eRefPicList,
                                           Mv acMvPred[3], int iRefIdxPred, Mv acMv[3], uint32_t &ruiBits,
                                           Distortion &ruiCost, int &mvpIdx, const AffineAMVPInfo &aamvpi, bool bBi)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xAffineMotionEstimation" );
 
   if (pu.cu->cs->sps->getUseGBi() && pu.cu->GBiIdx != GBI_DEFAULT && !bBi
       && xReadBufferedAffineUniMv(pu, eRefPicList, iRefIdxPred, acMvPred, acMv, ruiBits, ruiCost, mvpIdx, aamvpi))
   {
-    auto stop                     = high_resolution_clock::now();
-    auto duration                 = duration_cast<nanoseconds>(stop - start);
-    timeOfXAffineMotionEstimation = timeOfXAffineMotionEstimation + duration.count();
 
     return;
   }
@@ -5918,15 +5865,12 @@ void InterSearch::xAffineMotionEstimation(PredictionUnit &pu, PelUnitBuf &origBu
   ruiCost = uiCostBest;
   DTRACE(g_trace_ctx, D_COMMON, " (%d) uiBitsBest=%d, uiCostBest=%d\n", DTRACE_GET_COUNTER(g_trace_ctx, D_COMMON),
          uiBitsBest, uiCostBest);
-  auto stop                     = high_resolution_clock::now();
-  auto duration                 = duration_cast<nanoseconds>(stop - start);
-  timeOfXAffineMotionEstimation = timeOfXAffineMotionEstimation + duration.count();
 }
 
 void InterSearch::xEstimateAffineAMVP(PredictionUnit &pu, AffineAMVPInfo &affineAMVPInfo, PelUnitBuf &origBuf,
                                       RefPicList eRefPicList, int iRefIdx, Mv acMvPred[3], Distortion *puiDistBiP)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xEstimateAffineAMVP" );
 
   Mv         bestMvLT, bestMvRT, bestMvLB;
   int        iBestIdx   = 0;
@@ -5966,24 +5910,16 @@ void InterSearch::xEstimateAffineAMVP(PredictionUnit &pu, AffineAMVPInfo &affine
   pu.mvpIdx[eRefPicList] = iBestIdx;
   pu.mvpNum[eRefPicList] = affineAMVPInfo.numCand;
   DTRACE(g_trace_ctx, D_COMMON, "#estAffi=%d \n", affineAMVPInfo.numCand);
-
-  auto stop                 = high_resolution_clock::now();
-  auto duration             = duration_cast<nanoseconds>(stop - start);
-  timeOfXEstimateAffineAMVP = timeOfXEstimateAffineAMVP + duration.count();
 }
 
 void InterSearch::xCopyAffineAMVPInfo(AffineAMVPInfo &src, AffineAMVPInfo &dst)
 {
-  auto start  = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xCopyAffineAMVPInfo" );
   dst.numCand = src.numCand;
   DTRACE(g_trace_ctx, D_COMMON, " (%d) #copyAffi=%d \n", DTRACE_GET_COUNTER(g_trace_ctx, D_COMMON), src.numCand);
   ::memcpy(dst.mvCandLT, src.mvCandLT, sizeof(Mv) * src.numCand);
   ::memcpy(dst.mvCandRT, src.mvCandRT, sizeof(Mv) * src.numCand);
   ::memcpy(dst.mvCandLB, src.mvCandLB, sizeof(Mv) * src.numCand);
-
-  auto stop                 = high_resolution_clock::now();
-  auto duration             = duration_cast<nanoseconds>(stop - start);
-  timeOfXCopyAffineAMVPInfo = timeOfXCopyAffineAMVPInfo + duration.count();
 }
 
 /**
@@ -6009,18 +5945,18 @@ void InterSearch::xExtDIFUpSamplingH(CPelBuf *pattern, bool useAltHpelIf)
 
   const ChromaFormat chFmt = m_currChromaFormat;
 
-  m_if.filterHor(COMPONENT_Y, srcPtr, srcStride, m_filteredBlockTmp[0][0], intStride, width + 1, height + filterSize,
-                 0 << MV_FRACTIONAL_BITS_DIFF, false, chFmt, clpRng, 0, false, useAltHpelIf);
+  m_ifME.filterHor(COMPONENT_Y, srcPtr, srcStride, m_filteredBlockTmp[0][0], intStride, width + 1, height + filterSize,
+                   0 << MV_FRACTIONAL_BITS_DIFF, false, chFmt, clpRng, 0, false, useAltHpelIf);
   if (!m_skipFracME)
   {
-    m_if.filterHor(COMPONENT_Y, srcPtr, srcStride, m_filteredBlockTmp[2][0], intStride, width + 1, height + filterSize,
-                   2 << MV_FRACTIONAL_BITS_DIFF, false, chFmt, clpRng, 0, false, useAltHpelIf);
+    m_ifME.filterHor(COMPONENT_Y, srcPtr, srcStride, m_filteredBlockTmp[2][0], intStride, width + 1, height + filterSize,
+                     2 << MV_FRACTIONAL_BITS_DIFF, false, chFmt, clpRng, 0, false, useAltHpelIf);
   }
 
   intPtr = m_filteredBlockTmp[0][0] + halfFilterSize * intStride + 1;
   dstPtr = m_filteredBlock[0][0][0];
-  m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 0, height + 0, 0 << MV_FRACTIONAL_BITS_DIFF,
-                 false, true, chFmt, clpRng, 0, false, useAltHpelIf);
+  m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 0, height + 0, 0 << MV_FRACTIONAL_BITS_DIFF,
+                   false, true, chFmt, clpRng, 0, false, useAltHpelIf);
   if (m_skipFracME)
   {
     return;
@@ -6028,18 +5964,18 @@ void InterSearch::xExtDIFUpSamplingH(CPelBuf *pattern, bool useAltHpelIf)
 
   intPtr = m_filteredBlockTmp[0][0] + (halfFilterSize - 1) * intStride + 1;
   dstPtr = m_filteredBlock[2][0][0];
-  m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 0, height + 1, 2 << MV_FRACTIONAL_BITS_DIFF,
-                 false, true, chFmt, clpRng, 0, false, useAltHpelIf);
+  m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 0, height + 1, 2 << MV_FRACTIONAL_BITS_DIFF,
+                   false, true, chFmt, clpRng, 0, false, useAltHpelIf);
 
   intPtr = m_filteredBlockTmp[2][0] + halfFilterSize * intStride;
   dstPtr = m_filteredBlock[0][2][0];
-  m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 1, height + 0, 0 << MV_FRACTIONAL_BITS_DIFF,
-                 false, true, chFmt, clpRng, 0, false, useAltHpelIf);
+  m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 1, height + 0, 0 << MV_FRACTIONAL_BITS_DIFF,
+                   false, true, chFmt, clpRng, 0, false, useAltHpelIf);
 
   intPtr = m_filteredBlockTmp[2][0] + (halfFilterSize - 1) * intStride;
   dstPtr = m_filteredBlock[2][2][0];
-  m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 1, height + 1, 2 << MV_FRACTIONAL_BITS_DIFF,
-                 false, true, chFmt, clpRng, 0, false, useAltHpelIf);
+  m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width + 1, height + 1, 2 << MV_FRACTIONAL_BITS_DIFF,
+                   false, true, chFmt, clpRng, 0, false, useAltHpelIf);
 }
 
 /**
@@ -6080,8 +6016,8 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
   {
     srcPtr += 1;
   }
-  m_if.filterHor(COMPONENT_Y, srcPtr, srcStride, intPtr, intStride, width, extHeight, 1 << MV_FRACTIONAL_BITS_DIFF,
-                 false, chFmt, clpRng);
+  m_ifME.filterHor(COMPONENT_Y, srcPtr, srcStride, intPtr, intStride, width, extHeight, 1 << MV_FRACTIONAL_BITS_DIFF,
+                   false, chFmt, clpRng);
 
   // Horizontal filter 3/4
   srcPtr = pattern->buf - halfFilterSize * srcStride - 1;
@@ -6094,8 +6030,8 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
   {
     srcPtr += 1;
   }
-  m_if.filterHor(COMPONENT_Y, srcPtr, srcStride, intPtr, intStride, width, extHeight, 3 << MV_FRACTIONAL_BITS_DIFF,
-                 false, chFmt, clpRng);
+  m_ifME.filterHor(COMPONENT_Y, srcPtr, srcStride, intPtr, intStride, width, extHeight, 3 << MV_FRACTIONAL_BITS_DIFF,
+                   false, chFmt, clpRng);
 
   // Generate @ 1,1
   intPtr = m_filteredBlockTmp[1][0] + (halfFilterSize - 1) * intStride;
@@ -6104,14 +6040,14 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
   {
     intPtr += intStride;
   }
-  m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 1 << MV_FRACTIONAL_BITS_DIFF, false,
-                 true, chFmt, clpRng);
+  m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 1 << MV_FRACTIONAL_BITS_DIFF, false,
+                   true, chFmt, clpRng);
 
   // Generate @ 3,1
   intPtr = m_filteredBlockTmp[1][0] + (halfFilterSize - 1) * intStride;
   dstPtr = m_filteredBlock[3][1][0];
-  m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 3 << MV_FRACTIONAL_BITS_DIFF, false,
-                 true, chFmt, clpRng);
+  m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 3 << MV_FRACTIONAL_BITS_DIFF, false,
+                   true, chFmt, clpRng);
 
   if (halfPelRef.getVer() != 0)
   {
@@ -6122,8 +6058,8 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
     {
       intPtr += intStride;
     }
-    m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 2 << MV_FRACTIONAL_BITS_DIFF,
-                   false, true, chFmt, clpRng);
+    m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 2 << MV_FRACTIONAL_BITS_DIFF,
+                     false, true, chFmt, clpRng);
 
     // Generate @ 2,3
     intPtr = m_filteredBlockTmp[3][0] + (halfFilterSize - 1) * intStride;
@@ -6132,22 +6068,22 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
     {
       intPtr += intStride;
     }
-    m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 2 << MV_FRACTIONAL_BITS_DIFF,
-                   false, true, chFmt, clpRng);
+    m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 2 << MV_FRACTIONAL_BITS_DIFF,
+                     false, true, chFmt, clpRng);
   }
   else
   {
     // Generate @ 0,1
     intPtr = m_filteredBlockTmp[1][0] + halfFilterSize * intStride;
     dstPtr = m_filteredBlock[0][1][0];
-    m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 0 << MV_FRACTIONAL_BITS_DIFF,
-                   false, true, chFmt, clpRng);
+    m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 0 << MV_FRACTIONAL_BITS_DIFF,
+                     false, true, chFmt, clpRng);
 
     // Generate @ 0,3
     intPtr = m_filteredBlockTmp[3][0] + halfFilterSize * intStride;
     dstPtr = m_filteredBlock[0][3][0];
-    m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 0 << MV_FRACTIONAL_BITS_DIFF,
-                   false, true, chFmt, clpRng);
+    m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 0 << MV_FRACTIONAL_BITS_DIFF,
+                     false, true, chFmt, clpRng);
   }
 
   if (halfPelRef.getHor() != 0)
@@ -6163,8 +6099,8 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
     {
       intPtr += intStride;
     }
-    m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 1 << MV_FRACTIONAL_BITS_DIFF,
-                   false, true, chFmt, clpRng);
+    m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 1 << MV_FRACTIONAL_BITS_DIFF,
+                     false, true, chFmt, clpRng);
 
     // Generate @ 3,2
     intPtr = m_filteredBlockTmp[2][0] + (halfFilterSize - 1) * intStride;
@@ -6177,8 +6113,8 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
     {
       intPtr += intStride;
     }
-    m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 3 << MV_FRACTIONAL_BITS_DIFF,
-                   false, true, chFmt, clpRng);
+    m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 3 << MV_FRACTIONAL_BITS_DIFF,
+                     false, true, chFmt, clpRng);
   }
   else
   {
@@ -6189,8 +6125,8 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
     {
       intPtr += intStride;
     }
-    m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 1 << MV_FRACTIONAL_BITS_DIFF,
-                   false, true, chFmt, clpRng);
+    m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 1 << MV_FRACTIONAL_BITS_DIFF,
+                     false, true, chFmt, clpRng);
 
     // Generate @ 3,0
     intPtr = m_filteredBlockTmp[0][0] + (halfFilterSize - 1) * intStride + 1;
@@ -6199,8 +6135,8 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
     {
       intPtr += intStride;
     }
-    m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 3 << MV_FRACTIONAL_BITS_DIFF,
-                   false, true, chFmt, clpRng);
+    m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 3 << MV_FRACTIONAL_BITS_DIFF,
+                     false, true, chFmt, clpRng);
   }
 
   // Generate @ 1,3
@@ -6210,14 +6146,14 @@ void InterSearch::xExtDIFUpSamplingQ(CPelBuf *pattern, Mv halfPelRef)
   {
     intPtr += intStride;
   }
-  m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 1 << MV_FRACTIONAL_BITS_DIFF, false,
-                 true, chFmt, clpRng);
+  m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 1 << MV_FRACTIONAL_BITS_DIFF, false,
+                   true, chFmt, clpRng);
 
   // Generate @ 3,3
   intPtr = m_filteredBlockTmp[3][0] + (halfFilterSize - 1) * intStride;
   dstPtr = m_filteredBlock[3][3][0];
-  m_if.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 3 << MV_FRACTIONAL_BITS_DIFF, false,
-                 true, chFmt, clpRng);
+  m_ifME.filterVer(COMPONENT_Y, intPtr, intStride, dstPtr, dstStride, width, height, 3 << MV_FRACTIONAL_BITS_DIFF, false,
+                   true, chFmt, clpRng);
 }
 
 //! set wp tables
@@ -7726,7 +7662,7 @@ void InterSearch::xClipMv(Mv &rcMv, const Position &pos, const struct Size &size
 
 uint32_t InterSearch::xDetermineBestMvp(PredictionUnit &pu, Mv acMvTemp[3], int &mvpIdx, const AffineAMVPInfo &aamvpi)
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "InterSearch::xDetermineBestMvp" );
 
   bool     mvpUpdated = false;
   uint32_t minBits    = std::numeric_limits<uint32_t>::max();
@@ -7745,9 +7681,6 @@ uint32_t InterSearch::xDetermineBestMvp(PredictionUnit &pu, Mv acMvTemp[3], int
     }
   }
   CHECK(!mvpUpdated, "xDetermineBestMvp() error");
-  auto stop               = high_resolution_clock::now();
-  auto duration           = duration_cast<nanoseconds>(stop - start);
-  timeOfXDetermineBestMvp = timeOfXDetermineBestMvp + duration.count();
   return minBits;
 }
 
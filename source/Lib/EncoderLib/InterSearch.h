@@ -53,6 +53,7 @@
 #include "CommonLib/AffineGradientSearch.h"
 #include "CommonLib/IbcHashMap.h"
 #include "CommonLib/Hash.h"
+#include "CommonLib/Profiler.h"
 #include <unordered_map>
 #include <vector>
 #include "EncReshape.h"
@@ -63,23 +64,6 @@
 // Class definition
 // ====================================================================================================================
 
-extern long long int timeOfXPredAffineInterSearch;
-extern long long int timeOfXPredAffineInterSearch_1;
-extern long long int timeOfXPredAffineInterSearch_2;
-extern long long int timeOfXPredAffineInterSearch_3;
-extern long long int timeOfXAffineMotionEstimation;
-extern long long int timeOfxCalcAffineMVBits;
-extern long long int timeOfXGetAffineTemplateCost;
-extern long long int timeOfAddAffMVInfo;
-extern long long int timeOfResetSavedAffineMotion;
-extern long long int timeOfXCheckBestAffineMVP;
-extern long long int timeOfXEstimateAffineAMVP;
-extern long long int timeOfXDetermineBestMvp;
-extern long long int timeOfXCopyAffineAMVPInfo;
-extern long long int timeOfStoreAffineMotion;
-extern long long int timeOfSolveEqual;
-extern long long int timeOfXPatternSearchFast;
-
 static const uint32_t MAX_NUM_REF_LIST_ADAPT_SR = 2;
 static const uint32_t MAX_IDX_ADAPT_SR          = 33;
 static const uint32_t NUM_MV_PREDICTORS         = 3;
@@ -174,6 +158,9 @@ protected:
   // Misc.
   Pel            *m_pTempPel;
 
+  // interpolation of the sub-pel motion search patterns, may use the approximate adder (APPROX_SITE_ME)
+  InterpolationFilter m_ifME;
+
   // AMVP cost computation
   uint32_t            m_auiMVPIdxCost               [AMVP_MAX_NUM_CANDS+1][AMVP_MAX_NUM_CANDS+1]; //th array bounds
 
@@ -240,7 +227,7 @@ public:
   }
   void addAffMVInfo(AffineMVInfo &tmpMVInfo)
   {
-    auto            start = high_resolution_clock::now();
+    PROFILE_ZONE( "InterSearch::addAffMVInfo" );
     int j = 0;
     AffineMVInfo *prevInfo = nullptr;
     for (; j < m_affMVListSize; j++)
@@ -260,9 +247,6 @@ public:
       m_affMVListIdx = (m_affMVListIdx + 1) % m_affMVListMaxSize;
       m_affMVListSize = std::min(m_affMVListSize + 1, m_affMVListMaxSize);
     }
-    auto stop                = high_resolution_clock::now();
-    auto duration            = duration_cast<nanoseconds>(stop - start);
-    timeOfAddAffMVInfo       = timeOfAddAffMVInfo + duration.count();
   }
   void resetUniMvList() { m_uniMvListIdx = 0; m_uniMvListSize = 0; }
   void insertUniMvCands(CompArea blkArea, Mv cMvTemp[2][33])
@@ -844,6 +844,8 @@ bool IntraSearch::estIntraPredLumaQT( CodingUnit &cu, Partitioner &partitioner,
     csBest->initStructData();
     csTemp->picture = cs.picture;
     csBest->picture = cs.picture;
+    csTemp->pcv     = cs.pcv;
+    csBest->pcv     = cs.pcv;
 
     static_vector<int, FAST_UDI_MAX_RDMODE_NUM> rdModeIdxList;
     if (testMip)
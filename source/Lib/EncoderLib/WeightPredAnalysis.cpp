@@ -39,16 +39,8 @@
 #include "../CommonLib/Slice.h"
 #include "../CommonLib/Picture.h"
 #include "WeightPredAnalysis.h"
+#include "CommonLib/Profiler.h"
 #include <limits>
-#include <chrono>
-
-using std::chrono::high_resolution_clock;
-using std::chrono::duration_cast;
-using std::chrono::duration;
-using std::chrono::nanoseconds;
-
-
-long long int timeOfWeightPredAnalysis = 0;
 
 static const double WEIGHT_PRED_SAD_RELATIVE_TO_NON_WEIGHT_PRED_SAD=0.99; // NOTE: U0040 used 0.95
 
@@ -233,7 +225,7 @@ Distortion xSearchHistogram(const std::vector<int> &histogramSource,
 
 WeightPredAnalysis::WeightPredAnalysis()
 {
-  auto start = high_resolution_clock::now();
+  PROFILE_ZONE( "WeightPredAnalysis::WeightPredAnalysis" );
 
   for ( uint32_t lst =0 ; lst<NUM_REF_PIC_LIST_01 ; lst++ )
   {
@@ -249,10 +241,6 @@ WeightPredAnalysis::WeightPredAnalysis()
       }
     }
   }
-
-  auto stop                = high_resolution_clock::now();
-  auto duration            = duration_cast<nanoseconds>(stop - start);
-  timeOfWeightPredAnalysis = timeOfWeightPredAnalysis + duration.count();
 }
 
 
@@ -41,9 +41,6 @@
 #include "../CommonLib/Slice.h"
 #include "VLCWriter.h"
 
-extern long long int timeOfWeightPredAnalysis;
-
-
 class  WeightPredAnalysis
 {
 private: